@@ -0,0 +1,130 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "FlowBenchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json; ///< json namespace
+
+#include "FlowTester.hpp"
+#include "Logger.hpp"
+
+#include "internal/FlowProfiler.hpp"
+#include "internal/Node/Node.hpp"
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+
+namespace
+{
+
+/// @brief Sets the log levels in the test arguments to warning and enables the flow profiler
+void prepareArguments()
+{
+    auto& argv = NAV::TESTS::argv;
+    argv.at(6) = "--console-log-level=warning";
+    argv.at(7) = "--file-log-level=warning";
+    if (std::none_of(argv.begin(), argv.end(), [](const char* arg) { return arg != nullptr && std::strcmp(arg, "--profile") == 0; }))
+    {
+        argv.insert(argv.end() - 1, "--profile");
+    }
+}
+
+} // namespace
+
+[[nodiscard]] Logger NAV::BENCHMARKS::initializeBenchmarkLogger()
+{
+    prepareArguments();
+    return TESTS::initializeTestLogger();
+}
+
+NAV::BENCHMARKS::FlowThroughput NAV::BENCHMARKS::benchmarkFlow(const char* path, bool useTestDirectories, size_t runs)
+{
+    prepareArguments();
+
+    FlowThroughput throughput;
+    throughput.path = path;
+    throughput.bestTime = std::numeric_limits<double>::infinity();
+
+    double totalTime = 0.0;
+    for (size_t run = 0; run < runs; run++)
+    {
+        uint64_t messages = 0;
+        nm::RegisterCleanupCallback([&messages]() {
+            for (const Node* node : nm::m_Nodes())
+            {
+                if (const auto& stats = node->getStatistics())
+                {
+                    for (const auto& pinStats : stats->inputPins)
+                    {
+                        messages += pinStats.messagesProcessed.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+        });
+
+        auto start = std::chrono::steady_clock::now();
+        bool success = TESTS::testFlow(path, useTestDirectories);
+        double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (!success)
+        {
+            LOG_ERROR("Execution of flow '{}' failed. Discarding the run.", path);
+            continue;
+        }
+
+        throughput.runs++;
+        totalTime += time;
+        if (time < throughput.bestTime)
+        {
+            throughput.bestTime = time;
+            throughput.messages = messages;
+        }
+    }
+
+    if (throughput.runs == 0)
+    {
+        throughput.bestTime = 0.0;
+        return throughput;
+    }
+    throughput.meanTime = totalTime / static_cast<double>(throughput.runs);
+    throughput.messagesPerSecond = throughput.bestTime > 0.0 ? static_cast<double>(throughput.messages) / throughput.bestTime : 0.0;
+
+    LOG_WARN("{}: {} messages, best {:.3f} s, mean {:.3f} s, {:.0f} messages/s",
+             path, throughput.messages, throughput.bestTime, throughput.meanTime, throughput.messagesPerSecond);
+
+    return throughput;
+}
+
+void NAV::BENCHMARKS::writeFlowThroughput(const FlowThroughput& throughput)
+{
+    auto filepath = std::filesystem::path(BENCHMARK_OUTPUT_DIR) / "flow-throughput.json";
+
+    json j = json::object();
+    if (std::ifstream ifs(filepath); ifs.good())
+    {
+        j = json::parse(ifs, nullptr, false);
+        if (j.is_discarded() || !j.is_object()) { j = json::object(); }
+    }
+
+    j[throughput.path] = {
+        { "runs", throughput.runs },
+        { "messages", throughput.messages },
+        { "bestTime", throughput.bestTime },
+        { "meanTime", throughput.meanTime },
+        { "messagesPerSecond", throughput.messagesPerSecond },
+    };
+
+    std::ofstream ofs(filepath);
+    ofs << j.dump(4) << '\n';
+}
@@ -0,0 +1,49 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file FlowBenchmark.hpp
+/// @brief Helpers to measure the throughput of flows and to initialize the logger for benchmarks
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-08
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "util/Logger.hpp"
+
+namespace NAV::BENCHMARKS
+{
+
+/// @brief Throughput of a flow execution
+struct FlowThroughput
+{
+    std::string path;              ///< Path to the flow file
+    size_t runs = 0;               ///< Amount of executions
+    uint64_t messages = 0;         ///< Messages processed by all input pins in a single run
+    double bestTime = 0.0;         ///< Fastest execution time (load, initialize, run, cleanup) [s]
+    double meanTime = 0.0;         ///< Mean execution time [s]
+    double messagesPerSecond = 0.0; ///< Messages processed per second in the fastest run
+};
+
+/// @brief Initializes the logger with warning level, so that logging does not distort the measurements
+[[nodiscard]] Logger initializeBenchmarkLogger();
+
+/// @brief Loads and executes the flow multiple times and measures the throughput
+/// @param[in] path Path to the flow file
+/// @param[in] useTestDirectories Whether to set the paths to 'test/..' or to the root folder
+/// @param[in] runs Amount of executions
+/// @return Throughput of the flow. Runs with an execution failure are not taken into account.
+FlowThroughput benchmarkFlow(const char* path, bool useTestDirectories, size_t runs = 3);
+
+/// @brief Adds or replaces the result in the flow throughput JSON file (BENCHMARK_OUTPUT_DIR/flow-throughput.json)
+/// @param[in] throughput Result to write
+void writeFlowThroughput(const FlowThroughput& throughput);
+
+} // namespace NAV::BENCHMARKS
@@ -0,0 +1,60 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file FlowThroughputBenchmarks.cpp
+/// @brief End-to-end throughput of the example flows and the file reader flows
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-08
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "FlowBenchmark.hpp"
+
+namespace NAV::BENCHMARKS
+{
+
+namespace
+{
+
+/// @brief Measures the flow and writes the result into the throughput file
+/// @param[in] path Path to the flow file
+/// @param[in] useTestDirectories Whether to set the paths to 'test/..' or to the root folder
+void runFlowBenchmark(const char* path, bool useTestDirectories)
+{
+    auto logger = initializeBenchmarkLogger();
+
+    auto throughput = benchmarkFlow(path, useTestDirectories);
+    REQUIRE(throughput.runs != 0);
+    writeFlowThroughput(throughput);
+}
+
+} // namespace
+
+TEST_CASE("[FlowThroughput] Example flows", "[FlowThroughput][flow]")
+{
+    const char* path = GENERATE("flow/_ImuFusion.flow",
+                                "flow/_InsGnss-LCKF.flow",
+                                "flow/_InsGnss-TCKF.flow",
+                                "flow/_MultiIMU.flow",
+                                "flow/_SPP.flow");
+    runFlowBenchmark(path, false);
+}
+
+TEST_CASE("[FlowThroughput] File readers", "[FlowThroughput][flow]")
+{
+    const char* path = GENERATE("test/flow/Nodes/DataProvider/IMU/VectorNavFile.flow",
+                                "test/flow/Nodes/DataProvider/IMU/MultiImuFile.flow",
+                                "test/flow/Nodes/DataProvider/GNSS/NmeaFile.flow",
+                                "test/flow/Nodes/DataProvider/GNSS/RtklibPosFile.flow",
+                                "test/flow/Nodes/DataProvider/GNSS/RinexNavFile.flow",
+                                "test/flow/Nodes/DataProvider/GNSS/RinexObsFile.flow");
+    runFlowBenchmark(path, true);
+}
+
+} // namespace NAV::BENCHMARKS
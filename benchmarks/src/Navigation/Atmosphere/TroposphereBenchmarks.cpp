@@ -0,0 +1,68 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file TroposphereBenchmarks.cpp
+/// @brief Benchmarks for the troposphere models and mapping functions
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-08
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "FlowBenchmark.hpp"
+#include "Navigation/Atmosphere/Troposphere/Troposphere.hpp"
+#include "Navigation/Transformations/Units.hpp"
+
+namespace NAV::BENCHMARKS
+{
+
+TEST_CASE("[Troposphere] Benchmark calcTroposphericDelayAndMapping", "[Troposphere][Benchmark]")
+{
+    auto logger = initializeBenchmarkLogger();
+
+    const InsTime insTime(2023, 1, 8, 12, 0, 0.0);
+    const Eigen::Vector3d lla_pos(deg2rad(48.78), deg2rad(9.18), 300.0);
+    const double elevation = deg2rad(25.0);
+    const double azimuth = deg2rad(120.0);
+
+    TroposphereModelSelection saastamoinen; // Saastamoinen with cosecant mapping
+    BENCHMARK("Saastamoinen + Cosecant")
+    {
+        return calcTroposphericDelayAndMapping(insTime, lla_pos, elevation, azimuth, saastamoinen);
+    };
+
+    TroposphereModelSelection gmf;
+    gmf.zhdMappingFunction.first = MappingFunction::GMF;
+    gmf.zwdMappingFunction.first = MappingFunction::GMF;
+    BENCHMARK("Saastamoinen + GMF")
+    {
+        return calcTroposphericDelayAndMapping(insTime, lla_pos, elevation, azimuth, gmf);
+    };
+
+    TroposphereModelSelection gpt2;
+    gpt2.zhdModel.first = TroposphereModel::GPT2;
+    gpt2.zwdModel.first = TroposphereModel::GPT2;
+    gpt2.zhdMappingFunction.first = MappingFunction::VMF_GPT2;
+    gpt2.zwdMappingFunction.first = MappingFunction::VMF_GPT2;
+    BENCHMARK("GPT2 + VMF")
+    {
+        return calcTroposphericDelayAndMapping(insTime, lla_pos, elevation, azimuth, gpt2);
+    };
+
+    TroposphereModelSelection gpt3;
+    gpt3.zhdModel.first = TroposphereModel::GPT3;
+    gpt3.zwdModel.first = TroposphereModel::GPT3;
+    gpt3.zhdMappingFunction.first = MappingFunction::VMF_GPT3;
+    gpt3.zwdMappingFunction.first = MappingFunction::VMF_GPT3;
+    BENCHMARK("GPT3 + VMF")
+    {
+        return calcTroposphericDelayAndMapping(insTime, lla_pos, elevation, azimuth, gpt3);
+    };
+}
+
+} // namespace NAV::BENCHMARKS
@@ -0,0 +1,128 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file EphemerisBenchmarks.cpp
+/// @brief Benchmarks for the broadcast ephemeris evaluation of all constellations
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-08
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <chrono>
+
+#include "FlowBenchmark.hpp"
+
+#include "Navigation/GNSS/Satellite/Ephemeris/BDSEphemeris.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GalileoEphemeris.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GLONASSEphemeris.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/GPSEphemeris.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/IRNSSEphemeris.hpp"
+#include "Navigation/GNSS/Satellite/Ephemeris/QZSSEphemeris.hpp"
+
+namespace NAV::BENCHMARKS
+{
+
+namespace
+{
+
+/// @brief Benchmarks the orbit and clock calculation of the ephemeris
+/// @param[in] name Name of the constellation
+/// @param[in] eph Ephemeris to evaluate
+/// @param[in] freq Frequency for the clock corrections
+/// @param[in] transTime Transmit time to evaluate the ephemeris at
+template<class Ephemeris>
+void benchmarkEphemeris(const std::string& name, const Ephemeris& eph, Frequency freq, const InsTime& transTime)
+{
+    BENCHMARK(fmt::format("{} calcSatellitePos", name))
+    {
+        return eph.calcSatellitePos(transTime);
+    };
+    BENCHMARK(fmt::format("{} calcSatellitePosVel", name))
+    {
+        return eph.calcSatellitePosVel(transTime);
+    };
+    BENCHMARK(fmt::format("{} calcClockCorrections", name))
+    {
+        return eph.calcClockCorrections(transTime + std::chrono::duration<long double>(0.07), 2.1e7, freq);
+    };
+}
+
+} // namespace
+
+// The ephemeris values are taken from the ephemeris tests (BRDC_20230080000 and ICD-GLONASS-5.1)
+TEST_CASE("[Ephemeris] Benchmark ephemeris evaluation", "[Ephemeris][Benchmark]")
+{
+    auto logger = initializeBenchmarkLogger();
+
+    const InsTime transTime(2023, 1, 8, 12, 15, 0.0, GPST);
+
+    // G01
+    GPSEphemeris gps(2023, 1, 8, 12, 0, 0, 2.270475961268e-04, -4.774847184308e-12, 0.000000000000e+00,
+                     1.800000000000e+01, 4.412500000000e+01, 4.154815921903e-09, 9.534843171347e-02,
+                     2.287328243256e-06, 1.217866723891e-02, 9.965151548386e-07, 5.153653379440e+03,
+                     4.320000000000e+04, -6.891787052155e-08, -1.509394590195e+00, 1.434236764908e-07,
+                     9.889891589796e-01, 3.767500000000e+02, 9.377162063410e-01, -8.364991292606e-09,
+                     1.185763677531e-10, 1.000000000000e+00, 2.244000000000e+03, 0.000000000000e+00,
+                     2.000000000000e+00, 0.000000000000e+00, 4.656612873077e-09, 1.800000000000e+01,
+                     3.601800000000e+04, 4.000000000000e+00, 0.000000000000e+00, 0.000000000000e+00);
+    benchmarkEphemeris("GPS", gps, G01, transTime);
+
+    // E24
+    GalileoEphemeris gal(2023, 1, 8, 12, 0, 0, -1.046533754561e-03, -2.094679985021e-11, 0.000000000000e+00,
+                         7.200000000000e+01, -1.225000000000e+01, 3.048698419098e-09, 8.358485318292e-01,
+                         -5.848705768585e-07, 7.337066344917e-04, 8.532777428627e-06, 5.440620456696e+03,
+                         4.320000000000e+04, -3.166496753693e-08, 2.602299169600e+00, -5.587935447693e-08,
+                         9.686712412968e-01, 1.626875000000e+02, 6.866771071778e-01, -5.322721712724e-09,
+                         -7.236015694813e-10, 5.160000000000e+02, 2.244000000000e+03, 0.000000000000e+00,
+                         3.120000000000e+00, 0.000000000000e+00, -3.259629011154e-09, -4.190951585770e-09,
+                         4.386400000000e+04, 0.000000000000e+00, 0.000000000000e+00, 0.000000000000e+00);
+    benchmarkEphemeris("Galileo", gal, E01, transTime);
+
+    // ICD-GLONASS-5.1 example (GLONASS is integrated numerically, so the transmit time is kept close to toc)
+    GLONASSEphemeris glo(2007, 11, 15, 6, 15, 0, 0.0, 0.0, 0.0,
+                         -14081.752701, -1.02576358, 0.0, 0.0,
+                         18358.958252, 1.08672147, 0.0, 0.0,
+                         10861.302124, -3.15732343, 0.0, 0.0);
+    benchmarkEphemeris("GLONASS", glo, R01, InsTime(2007, 11, 15, 6, 30, 0.0));
+
+    // C01
+    BDSEphemeris bds(2023, 1, 8, 12, 0, 0, 9.214587043971e-04, -3.444355911597e-12, 0.000000000000e+00,
+                     1.000000000000e+00, -5.703437500000e+02, -1.417916204758e-09, -2.600407961772e+00,
+                     -1.850631088018e-05, 5.964186275378e-04, 1.725181937218e-05, 6.493409469604e+03,
+                     4.320000000000e+04, -1.606531441212e-07, -9.470894048181e-02, 1.862645149231e-08,
+                     1.091456290507e-01, -5.247343750000e+02, 2.084960396501e+00, 2.475460255713e-09,
+                     8.411064640318e-10, 0.000000000000e+00, 8.880000000000e+02, 0.000000000000e+00,
+                     2.000000000000e+00, 0.000000000000e+00, -4.700000000000e-09, -1.000000000000e-08,
+                     4.320000000000e+04, 0.000000000000e+00, 0.000000000000e+00, 0.000000000000e+00);
+    benchmarkEphemeris("BeiDou", bds, B01, transTime);
+
+    // J02
+    QZSSEphemeris qzss(2023, 1, 8, 12, 0, 0, -5.154870450497e-07, -1.136868377216e-13, 0.000000000000e+00,
+                       4.500000000000e+01, -9.359375000000e+01, 1.787574459651e-09, -1.781683475617e+00,
+                       -4.431232810020e-06, 7.510575617198e-02, 1.722574234009e-05, 6.493197826385e+03,
+                       4.320000000000e+04, 1.095235347748e-06, 2.689490712426e+00, -1.784414052963e-06,
+                       7.232893311953e-01, -4.045625000000e+02, -1.578422486558e+00, -1.087188142893e-09,
+                       -8.221771041194e-10, 2.000000000000e+00, 2.244000000000e+03, 1.000000000000e+00,
+                       2.800000000000e+00, 0.000000000000e+00, 4.656612873077e-10, 8.130000000000e+02,
+                       3.960600000000e+04, 0.000000000000e+00, 0.000000000000e+00, 0.000000000000e+00);
+    benchmarkEphemeris("QZSS", qzss, J01, transTime);
+
+    // I02
+    IRNSSEphemeris irnss(2023, 1, 8, 12, 0, 0, 2.506004166207e-04, -2.626165951369e-11, 0.000000000000e+00,
+                         1.000000000000e+00, -4.023750000000e+02, 4.141601085738e-09, -1.732777692392e+00,
+                         -1.328811049461e-05, 1.831341884099e-03, 1.068785786629e-05, 6.493304498672e+03,
+                         4.320000000000e+04, 1.527369022369e-07, 2.697144041504e+00, 5.587935447693e-08,
+                         5.091938487106e-01, -2.446250000000e+02, -3.135464476589e+00, -3.623008055685e-09,
+                         -1.027542801282e-09, 2.000000000000e+00, 2.244000000000e+03, 1.000000000000e+00,
+                         2.000000000000e+00, 0.000000000000e+00, -1.862645149231e-09, 0.000000000000e+00,
+                         9.999000000000e+08, 0.000000000000e+00, 0.000000000000e+00, 0.000000000000e+00);
+    benchmarkEphemeris("IRNSS", irnss, I05, transTime);
+}
+
+} // namespace NAV::BENCHMARKS
@@ -0,0 +1,74 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file InertialIntegratorBenchmarks.cpp
+/// @brief Benchmarks for the inertial integration
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-08
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <chrono>
+
+#include "FlowBenchmark.hpp"
+#include "Navigation/INS/InertialIntegrator.hpp"
+#include "Navigation/Transformations/Units.hpp"
+#include "NodeData/IMU/ImuPos.hpp"
+#include "NodeData/State/PosVelAtt.hpp"
+
+namespace NAV::BENCHMARKS
+{
+
+TEST_CASE("[InertialIntegrator] Benchmark calcInertialSolution", "[InertialIntegrator][Benchmark]")
+{
+    auto logger = initializeBenchmarkLogger();
+
+    const InsTime startTime(2023, 1, 8, 12, 0, 0.0);
+    PosVelAtt initialState;
+    initialState.setState_n(Eigen::Vector3d(deg2rad(48.78), deg2rad(9.18), 300.0),
+                            Eigen::Vector3d(10.0, 2.0, 0.0),
+                            Eigen::Quaterniond::Identity());
+    initialState.insTime = startTime;
+
+    const Eigen::Vector3d p_accel(0.1, 0.2, -9.81);
+    const Eigen::Vector3d p_angRate(0.001, -0.002, 0.01);
+    const ImuPos imuPos;
+    constexpr double dt = 0.01;
+
+    auto frame = GENERATE(InertialIntegrator::IntegrationFrame::ECEF, InertialIntegrator::IntegrationFrame::NED);
+    auto algorithm = GENERATE(InertialIntegrator::IntegrationAlgorithm::SingleStepRungeKutta1,
+                              InertialIntegrator::IntegrationAlgorithm::SingleStepRungeKutta4,
+                              InertialIntegrator::IntegrationAlgorithm::MultiStepRK4);
+
+    InertialIntegrator integrator;
+    json j = { { "integrationFrame", frame }, { "integrationAlgorithm", algorithm } };
+    from_json(j, integrator);
+
+    std::string name = fmt::format("{} ({})", to_string(algorithm), frame == InertialIntegrator::IntegrationFrame::ECEF ? "ECEF" : "NED");
+
+    auto obsTime = startTime;
+    integrator.setInitialState(initialState);
+    BENCHMARK(fmt::format("calcInertialSolution {}", name))
+    {
+        obsTime += std::chrono::duration<long double>(dt);
+        return integrator.calcInertialSolution(obsTime, p_accel, p_angRate, imuPos);
+    };
+
+    obsTime = startTime;
+    integrator.reset();
+    integrator.setInitialState(initialState);
+    BENCHMARK(fmt::format("calcInertialSolutionDelta {}", name))
+    {
+        obsTime += std::chrono::duration<long double>(dt);
+        return integrator.calcInertialSolutionDelta(obsTime, dt, p_accel * dt, p_angRate * dt, p_accel, p_angRate, imuPos);
+    };
+}
+
+} // namespace NAV::BENCHMARKS
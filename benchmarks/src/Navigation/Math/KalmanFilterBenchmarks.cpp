@@ -0,0 +1,110 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file KalmanFilterBenchmarks.cpp
+/// @brief Benchmarks for the KeyedKalmanFilter and the Van Loan discretization
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-08
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <numeric>
+#include <vector>
+
+#include "FlowBenchmark.hpp"
+#include "Navigation/Math/KeyedKalmanFilter.hpp"
+#include "Navigation/Math/VanLoan.hpp"
+
+namespace NAV::BENCHMARKS
+{
+
+namespace
+{
+
+/// @brief Creates a Kalman filter with random but well conditioned matrices
+/// @param[in] nStates Amount of states
+/// @param[in] nMeas Amount of measurements
+KeyedKalmanFilter<double, size_t, size_t> createKalmanFilter(size_t nStates, size_t nMeas)
+{
+    std::vector<size_t> stateKeys(nStates);
+    std::iota(stateKeys.begin(), stateKeys.end(), 0);
+    std::vector<size_t> measKeys(nMeas);
+    std::iota(measKeys.begin(), measKeys.end(), 0);
+
+    KeyedKalmanFilter<double, size_t, size_t> kf(stateKeys, measKeys);
+
+    auto n = static_cast<Eigen::Index>(nStates);
+    auto m = static_cast<Eigen::Index>(nMeas);
+    kf.x(all) = Eigen::VectorXd::Random(n);
+    kf.P(all, all) = Eigen::MatrixXd::Identity(n, n);
+    kf.Phi(all, all) = Eigen::MatrixXd::Identity(n, n) + 0.01 * Eigen::MatrixXd::Random(n, n);
+    kf.Q(all, all) = 1e-4 * Eigen::MatrixXd::Identity(n, n);
+    kf.z(all) = Eigen::VectorXd::Random(m);
+    kf.H(all, all) = Eigen::MatrixXd::Random(m, n);
+    kf.R(all, all) = Eigen::MatrixXd::Identity(m, m);
+    return kf;
+}
+
+} // namespace
+
+TEST_CASE("[KeyedKalmanFilter] Benchmark predict/correct", "[KeyedKalmanFilter][Benchmark]")
+{
+    auto logger = initializeBenchmarkLogger();
+
+    // Loosely coupled (15 states, 6 measurements) and tightly coupled with 10 satellites (17 states, 20 measurements)
+    for (auto [nStates, nMeas] : { std::pair<size_t, size_t>{ 15, 6 }, std::pair<size_t, size_t>{ 17, 20 } })
+    {
+        auto kf = createKalmanFilter(nStates, nMeas);
+        auto P = kf.P(all, all);
+
+        BENCHMARK(fmt::format("predict (n = {})", nStates))
+        {
+            kf.P(all, all) = P;
+            kf.predict();
+            return kf.P(all, all)(0, 0);
+        };
+        BENCHMARK(fmt::format("correct (n = {}, m = {})", nStates, nMeas))
+        {
+            kf.P(all, all) = P;
+            kf.correct();
+            return kf.x(all)(0);
+        };
+    }
+}
+
+TEST_CASE("[VanLoan] Benchmark calcPhiAndQWithVanLoanMethod", "[VanLoan][Benchmark]")
+{
+    auto logger = initializeBenchmarkLogger();
+
+    double dt = 0.01;
+
+    Eigen::Matrix<double, 15, 15> F = Eigen::Matrix<double, 15, 15>::Zero();
+    F.block<3, 3>(0, 3) = Eigen::Matrix3d::Identity();
+    F.block<3, 3>(3, 6) = Eigen::Matrix3d::Random();
+    F.block<3, 3>(3, 9) = Eigen::Matrix3d::Identity();
+    F.block<3, 3>(6, 12) = -Eigen::Matrix3d::Identity();
+    Eigen::Matrix<double, 15, 12> G = Eigen::Matrix<double, 15, 12>::Zero();
+    G.block<12, 12>(3, 0) = Eigen::Matrix<double, 12, 12>::Identity();
+    Eigen::Matrix<double, 12, 12> W = 1e-6 * Eigen::Matrix<double, 12, 12>::Identity();
+
+    BENCHMARK("Fixed size (15 states)")
+    {
+        return calcPhiAndQWithVanLoanMethod(F, G, W, dt);
+    };
+
+    Eigen::MatrixXd Fx = F;
+    Eigen::MatrixXd Gx = G;
+    Eigen::MatrixXd Wx = W;
+    BENCHMARK("Dynamic size (15 states)")
+    {
+        return calcPhiAndQWithVanLoanMethod(Fx, Gx, Wx, dt);
+    };
+}
+
+} // namespace NAV::BENCHMARKS
@@ -0,0 +1,63 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file InsTimeBenchmarks.cpp
+/// @brief Benchmarks for the time arithmetic and conversions
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-08
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <chrono>
+
+#include "FlowBenchmark.hpp"
+#include "Navigation/Time/InsTime.hpp"
+
+namespace NAV::BENCHMARKS
+{
+
+TEST_CASE("[InsTime] Benchmark arithmetic and conversions", "[InsTime][Benchmark]")
+{
+    auto logger = initializeBenchmarkLogger();
+
+    InsTime time(2023, 1, 8, 12, 0, 0.0, GPST);
+    const InsTime other(2023, 1, 8, 11, 59, 59.5, GPST);
+    const std::chrono::duration<long double> dt(0.01);
+
+    BENCHMARK("operator+=")
+    {
+        return time += dt;
+    };
+    BENCHMARK("operator-")
+    {
+        return static_cast<double>((time - other).count());
+    };
+    BENCHMARK("operator<")
+    {
+        return other < time;
+    };
+    BENCHMARK("Construct from YMDHMS")
+    {
+        return InsTime(2023, 1, 8, 12, 0, 0.0, GPST);
+    };
+    BENCHMARK("Construct from GPS week/tow")
+    {
+        return InsTime(2, 224, 43200.0);
+    };
+    BENCHMARK("toGPSweekTow")
+    {
+        return time.toGPSweekTow();
+    };
+    BENCHMARK("toYMDHMS")
+    {
+        return time.toYMDHMS();
+    };
+}
+
+} // namespace NAV::BENCHMARKS
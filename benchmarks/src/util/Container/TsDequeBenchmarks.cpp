@@ -0,0 +1,74 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file TsDequeBenchmarks.cpp
+/// @brief Benchmarks for the thread-safe deque used as input pin queue
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-08
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <memory>
+#include <thread>
+
+#include "FlowBenchmark.hpp"
+#include "NodeData/NodeData.hpp"
+#include "util/Container/TsDeque.hpp"
+
+namespace NAV::BENCHMARKS
+{
+
+TEST_CASE("[TsDeque] Benchmark push/pop", "[TsDeque][Benchmark]")
+{
+    auto logger = initializeBenchmarkLogger();
+
+    auto data = std::make_shared<const NodeData>();
+
+    TsDeque<std::shared_ptr<const NodeData>> queue;
+    BENCHMARK("push_back + pop_front")
+    {
+        queue.push_back(data);
+        auto front = queue.front();
+        queue.pop_front();
+        return front;
+    };
+
+    BENCHMARK("push_back 1000 + extract_front 1000")
+    {
+        for (size_t i = 0; i < 1000; i++) { queue.push_back(data); }
+        size_t count = 0;
+        while (!queue.empty())
+        {
+            count += queue.extract_front() != nullptr;
+        }
+        return count;
+    };
+
+    BENCHMARK_ADVANCED("Contended push_back/extract_front (2 threads, 10000 messages)")(Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&] {
+            std::thread producer([&]() {
+                for (size_t i = 0; i < 10000; i++) { queue.push_back(data); }
+            });
+            size_t count = 0;
+            while (count < 10000)
+            {
+                if (!queue.empty())
+                {
+                    queue.extract_front();
+                    count++;
+                }
+            }
+            producer.join();
+            return count;
+        });
+    };
+}
+
+} // namespace NAV::BENCHMARKS
@@ -179,7 +179,7 @@ class PolynomialCycleSlipDetector
     bool _enabled = true;                          ///< Whether the cycle-slip detector is enabled
     size_t _windowSize;                            ///< Window size for the sliding window
     size_t _polyDegree = 2;                        ///< Polynomial degree to fit
-    Strategy _strategy = Strategy::HouseholderQR;  ///< Strategy used for fitting
+    Strategy _strategy = Strategy::IncrementalQR;  ///< Strategy used for fitting
     unordered_map<Key, SignalDetector> _detectors; ///< Detectors, one for each key
 
     /// @brief Calculate the relative time to the start time of the detector
@@ -14,9 +14,11 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <mutex>
 #include <set>
 #include <optional>
@@ -77,17 +79,140 @@ class AntexReader
     };
 
     /// @brief Get the static Instance of the reader
+    /// @note If the ANTEX files are still read in the background, this waits until they are available
     static AntexReader& Get()
     {
         static AntexReader self;
+        self.waitForInitialization();
         return self;
     }
 
-    /// @brief Initialize from ANTEX file
+    /// @brief Starts reading the ANTEX files on a background thread, so that the program startup is not blocked
+    void initializeAsync()
+    {
+        std::scoped_lock lk(_initMutex);
+        if (_initialized || _initialization.valid()) { return; }
+        _initialization = std::async(std::launch::async, [this]() { initialize(); }).share();
+    }
+
+    /// @brief Initialize from ANTEX file. The files are only read once per process.
     void initialize()
     {
-        if (!_antennas.empty()) { return; }
+        std::call_once(_initOnce, [this]() { read(); });
+        _initialized = true;
+    }
+
+    /// @brief Reset the temporary variables
+    void reset()
+    {
+        std::scoped_lock lk(_notFoundMutex);
+        _notFoundAnt.clear();
+        _notFoundFreq.clear();
+    }
+
+    /// @brief Get the Antenna Phase Center Offset To ARP if it is found in the ANTEX file
+    /// @param[in] antennaType Antenna Type
+    /// @param[in] freq Frequency
+    /// @param[in] insTime Time
+    /// @param[in] receiver Receiver (used for warnings)
+    /// @param[in] nameId NameId of the calling node for Log output
+    template<typename ReceiverType>
+    std::optional<Eigen::Vector3d> getAntennaPhaseCenterOffsetToARP(const std::string& antennaType, Frequency_ freq, const InsTime& insTime,
+                                                                    [[maybe_unused]] ReceiverType receiver, [[maybe_unused]] const std::string& nameId)
+    {
+        if (_antennas.contains(antennaType))
+        {
+            const auto& antenna = _antennas.at(antennaType);
+
+            auto antInfo = antenna.antennaInfo.cend();
+            if (antenna.antennaInfo.size() == 1) // One element only, so take it
+            {
+                antInfo = antenna.antennaInfo.begin();
+            }
+            else // No element is not possible, so more than one here, so search for time
+            {
+                antInfo = std::find_if(antenna.antennaInfo.begin(), antenna.antennaInfo.end(), [&](const Antenna::AntennaInfo& antInfo) {
+                    return (antInfo.from.empty() && antInfo.until.empty())
+                           || (antInfo.from.empty() && insTime <= antInfo.until)
+                           || (antInfo.until.empty() && antInfo.from <= insTime)
+                           || (antInfo.from <= insTime && insTime <= antInfo.until);
+                });
+            }
+            if (antInfo == antenna.antennaInfo.end()) // None matching, so take last
+            {
+                antInfo = antenna.antennaInfo.cend() - 1;
+            }
+
+            if (antInfo->freqInformation.contains(freq))
+            {
+                return antInfo->freqInformation.at(freq).phaseCenterOffsetToARP;
+            }
+            std::scoped_lock lk(_notFoundMutex);
+            if (!_notFoundFreq.contains(std::make_pair(antennaType, freq)))
+            {
+                LOG_WARN("{}: Cannot determine phase center offset, because antenna type '{}' is does not have frequency [{}] in the ANTEX file."
+                         " Please provide a new ANTEX file under 'resources/gnss/antex' or consider not using the frequency, as this can introduce height errors of several centimeter.",
+                         nameId, antennaType, Frequency(freq));
+                _notFoundFreq.insert(std::make_pair(antennaType, freq));
+            }
+        }
+        else if (std::scoped_lock lk(_notFoundMutex);
+                 !_notFoundAnt.contains(antennaType))
+        {
+            LOG_WARN("{}: Cannot determine phase center offset, because antenna type '{}' for receiver '{}' is not found in the ANTEX files.",
+                     nameId, antennaType, receiver);
+            _notFoundAnt.insert(antennaType);
+        }
+
+        return std::nullopt;
+    }
+
+    /// Antennas read from the ANTEX files
+    const std::set<std::string>& antennas() const { return _antennaNames; };
+
+  private:
+    /// @brief Constructor
+    AntexReader() = default;
+
+    /// Antennas read from the ANTEX files
+    std::unordered_map<std::string, Antenna> _antennas;
+
+    /// Ordered names of all antennas
+    std::set<std::string> _antennaNames;
+
+    /// List of Antennas not found to emit a warning
+    std::unordered_set<std::string> _notFoundAnt;
+
+    /// List of Frequencies not found to emit a warning
+    std::unordered_set<std::pair<std::string, Frequency_>> _notFoundFreq;
+
+    /// Mutex for the lists of not found antennas and frequencies, as the nodes call the reader from their own threads
+    std::mutex _notFoundMutex;
+
+    /// Flag to read the ANTEX files only once
+    std::once_flag _initOnce;
+    /// Whether the ANTEX files were read
+    std::atomic<bool> _initialized = false;
+    /// Mutex for starting the background initialization
+    std::mutex _initMutex;
+    /// Background initialization started by initializeAsync()
+    std::shared_future<void> _initialization;
+
+    /// @brief Waits until the background initialization finished
+    void waitForInitialization()
+    {
+        if (_initialized) { return; }
+        std::shared_future<void> initialization;
+        {
+            std::scoped_lock lk(_initMutex);
+            initialization = _initialization;
+        }
+        if (initialization.valid()) { initialization.wait(); }
+    }
 
+    /// @brief Reads all ANTEX files in the resources folder
+    void read()
+    {
         LOG_DEBUG("Reading ANTEX files started...");
 
         auto path = flow::GetProgramRootPath() / "resources" / "gnss" / "antex";
@@ -228,87 +353,6 @@ class AntexReader
         LOG_DEBUG("Reading ANTEX file finished.");
     }
 
-    /// @brief Reset the temporary variables
-    void reset()
-    {
-        _notFoundAnt.clear();
-        _notFoundFreq.clear();
-    }
-
-    /// @brief Get the Antenna Phase Center Offset To ARP if it is found in the ANTEX file
-    /// @param[in] antennaType Antenna Type
-    /// @param[in] freq Frequency
-    /// @param[in] insTime Time
-    /// @param[in] receiver Receiver (used for warnings)
-    /// @param[in] nameId NameId of the calling node for Log output
-    template<typename ReceiverType>
-    std::optional<Eigen::Vector3d> getAntennaPhaseCenterOffsetToARP(const std::string& antennaType, Frequency_ freq, const InsTime& insTime,
-                                                                    [[maybe_unused]] ReceiverType receiver, [[maybe_unused]] const std::string& nameId)
-    {
-        if (_antennas.contains(antennaType))
-        {
-            const auto& antenna = _antennas.at(antennaType);
-
-            auto antInfo = antenna.antennaInfo.cend();
-            if (antenna.antennaInfo.size() == 1) // One element only, so take it
-            {
-                antInfo = antenna.antennaInfo.begin();
-            }
-            else // No element is not possible, so more than one here, so search for time
-            {
-                antInfo = std::find_if(antenna.antennaInfo.begin(), antenna.antennaInfo.end(), [&](const Antenna::AntennaInfo& antInfo) {
-                    return (antInfo.from.empty() && antInfo.until.empty())
-                           || (antInfo.from.empty() && insTime <= antInfo.until)
-                           || (antInfo.until.empty() && antInfo.from <= insTime)
-                           || (antInfo.from <= insTime && insTime <= antInfo.until);
-                });
-            }
-            if (antInfo == antenna.antennaInfo.end()) // None matching, so take last
-            {
-                antInfo = antenna.antennaInfo.cend() - 1;
-            }
-
-            if (antInfo->freqInformation.contains(freq))
-            {
-                return antInfo->freqInformation.at(freq).phaseCenterOffsetToARP;
-            }
-            if (!_notFoundFreq.contains(std::make_pair(antennaType, freq)))
-            {
-                LOG_WARN("{}: Cannot determine phase center offset, because antenna type '{}' is does not have frequency [{}] in the ANTEX file."
-                         " Please provide a new ANTEX file under 'resources/gnss/antex' or consider not using the frequency, as this can introduce height errors of several centimeter.",
-                         nameId, antennaType, Frequency(freq));
-                _notFoundFreq.insert(std::make_pair(antennaType, freq));
-            }
-        }
-        else if (!_notFoundAnt.contains(antennaType))
-        {
-            LOG_WARN("{}: Cannot determine phase center offset, because antenna type '{}' for receiver '{}' is not found in the ANTEX files.",
-                     nameId, antennaType, receiver);
-            _notFoundAnt.insert(antennaType);
-        }
-
-        return std::nullopt;
-    }
-
-    /// Antennas read from the ANTEX files
-    const std::set<std::string>& antennas() const { return _antennaNames; };
-
-  private:
-    /// @brief Constructor
-    AntexReader() = default;
-
-    /// Antennas read from the ANTEX files
-    std::unordered_map<std::string, Antenna> _antennas;
-
-    /// Ordered names of all antennas
-    std::set<std::string> _antennaNames;
-
-    /// List of Antennas not found to emit a warning
-    std::unordered_set<std::string> _notFoundAnt;
-
-    /// List of Frequencies not found to emit a warning
-    std::unordered_set<std::pair<std::string, Frequency_>> _notFoundFreq;
-
     /// @brief Get the Freq from a string
     /// @param[in] str Frequency as string
     static Frequency_ getFreqFromString(const std::string& str)
@@ -14,6 +14,7 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -22,6 +23,7 @@
 
 #include <imgui.h>
 #include "internal/gui/widgets/imgui_ex.hpp"
+#include "internal/gui/widgets/HelpMarker.hpp"
 
 #include "Navigation/GNSS/Core/Code.hpp"
 #include "Navigation/GNSS/Core/Frequency.hpp"
@@ -39,6 +41,7 @@
 #include "util/Container/STL.hpp"
 #include "util/Json.hpp"
 #include "util/Logger.hpp"
+#include "util/ThreadPool.hpp"
 #include <fmt/core.h>
 
 namespace NAV
@@ -76,6 +79,7 @@ class ObservationFilter
             _sameSnrMaskForAllReceivers = other._sameSnrMaskForAllReceivers;
             _neededObsTypes = other._neededObsTypes;
             _usedObsTypes = other._usedObsTypes;
+            _parallelCalculation = other._parallelCalculation;
             std::vector<GnssObs::ObservationType> obsTypeToRemove;
             for (const auto& obsType : _usedObsTypes)
             {
@@ -101,6 +105,7 @@ class ObservationFilter
             _sameSnrMaskForAllReceivers = other._sameSnrMaskForAllReceivers;
             _neededObsTypes = std::move(other._neededObsTypes);
             _usedObsTypes = std::move(other._usedObsTypes);
+            _parallelCalculation = other._parallelCalculation;
             std::vector<GnssObs::ObservationType> obsTypeToRemove;
             for (const auto& obsType : _usedObsTypes)
             {
@@ -153,6 +158,9 @@ class ObservationFilter
 
         std::array<std::unordered_set<SatId>, GnssObs::ObservationType_COUNT> nMeasUniqueSat;
 
+        std::vector<SignalCandidate> candidates;
+        candidates.reserve(receivers.front().gnssObs->data.size());
+
         for (const auto& obsData : receivers.front().gnssObs->data)
         {
             SatId satId = obsData.satSigId.toSatId();
@@ -249,77 +257,49 @@ class ObservationFilter
                      availableObservations.contains(GnssObs::Carrier) ? availableObservations.at(GnssObs::Carrier) : 0,
                      availableObservations.contains(GnssObs::Doppler) ? availableObservations.at(GnssObs::Doppler) : 0);
 
-            std::shared_ptr<NAV::SatNavData> satNavData = nullptr;
-            for (const auto& gnssNavInfo : gnssNavInfos)
-            {
-                auto satNav = gnssNavInfo->searchNavigationData(satId, receivers.front().gnssObs->insTime);
-                if (satNav && satNav->isHealthy())
-                {
-                    satNavData = satNav;
-                    break;
-                }
-            }
-            if (satNavData == nullptr)
-            {
-                LOG_DATA("{}:  [{}] Skipping obs because no navigation data available to calculaten the satellite position", nameId, obsData.satSigId);
-                filtered.navigationDataMissing.push_back(obsData.satSigId);
-                continue;
-            }
+            auto& candidate = candidates.emplace_back();
+            candidate.obsData = &obsData;
+            candidate.availableObservations = std::move(availableObservations);
+        }
 
-            int8_t freqNum = -128;
-            if (satId.satSys == GLO)
+        // The satellite calculations are independent of each other, so they can be done in parallel.
+        // Every signal writes only into its own slot, which are merged in the order of the observations.
+        if (_parallelCalculation && candidates.size() > 1)
+        {
+            ThreadPool::Shared().parallelFor(candidates.size(), [&](size_t i) {
+                calcSignalObservation(candidates[i], receivers, gnssNavInfos, nameId, ignoreElevationMask);
+            });
+        }
+        else
+        {
+            for (auto& candidate : candidates)
             {
-                if (auto gloSatNavData = std::dynamic_pointer_cast<GLONASSEphemeris>(satNavData))
-                {
-                    freqNum = gloSatNavData->frequencyNumber;
-                }
+                calcSignalObservation(candidate, receivers, gnssNavInfos, nameId, ignoreElevationMask);
             }
+        }
 
-            Observations::SignalObservation sigObs(satNavData, freqNum);
+        for (auto& candidate : candidates)
+        {
+            const auto& obsData = *candidate.obsData;
+            SatId satId = obsData.satSigId.toSatId();
 
-            bool skipObservation = false;
-            for (const auto& recv : receivers)
+            switch (candidate.filterReason)
             {
-                auto recvObsData = std::find_if(recv.gnssObs->data.begin(), recv.gnssObs->data.end(),
-                                                [&obsData](const GnssObs::ObservationData& recvObsData) {
-                                                    return recvObsData.satSigId == obsData.satSigId;
-                                                });
-                auto satClk = satNavData->calcClockCorrections(recv.gnssObs->insTime,
-                                                               recvObsData->pseudorange->value,
-                                                               recvObsData->satSigId.freq());
-                auto satPosVel = satNavData->calcSatellitePosVel(satClk.transmitTime);
-
-                LOG_DATA("{}: Adding satellite [{}] for receiver {}", nameId, obsData.satSigId, recv.type);
-                sigObs.recvObs.emplace_back(recv.gnssObs, static_cast<size_t>(recvObsData - recv.gnssObs->data.begin()),
-                                            recv.e_posMarker, recv.lla_posMarker, recv.e_vel,
-                                            satPosVel.e_pos, satPosVel.e_vel, satClk);
-
-                if (!ignoreElevationMask)
-                {
-                    const auto& satElevation = sigObs.recvObs.back().satElevation();
-                    if (satElevation < _elevationMask)
-                    {
-                        LOG_DATA("{}: Signal {} is skipped because of elevation mask. ({} < {})", nameId, obsData.satSigId,
-                                 rad2deg(satElevation), rad2deg(_elevationMask));
-                        skipObservation = true;
-                        filtered.elevationMaskTriggered.emplace_back(obsData.satSigId, satElevation);
-                        break;
-                    }
-                    if (recvObsData->CN0 // If no CN0 available, we use the signal
-                        && !_snrMask
-                                .at(_sameSnrMaskForAllReceivers ? static_cast<ReceiverType>(0) : recv.type)
-                                .checkSNRMask(obsData.satSigId.freq(), satElevation, recvObsData->CN0.value()))
-                    {
-                        LOG_DATA("{}: [{}] SNR mask triggered for [{}] on receiver [{}] with CN0 {} dbHz",
-                                 nameId, receivers.front().gnssObs->insTime.toYMDHMS(GPST), obsData.satSigId, recv.type, recvObsData->CN0.value());
-                        skipObservation = true;
-                        filtered.snrMaskTriggered.emplace_back(obsData.satSigId, *recvObsData->CN0);
-                        break;
-                    }
-                }
+            case SignalCandidate::FilterReason::None:
+                break;
+            case SignalCandidate::FilterReason::NavigationDataMissing:
+                filtered.navigationDataMissing.push_back(obsData.satSigId);
+                continue;
+            case SignalCandidate::FilterReason::ElevationMask:
+                filtered.elevationMaskTriggered.emplace_back(obsData.satSigId, candidate.filterValue);
+                continue;
+            case SignalCandidate::FilterReason::SnrMask:
+                filtered.snrMaskTriggered.emplace_back(obsData.satSigId, candidate.filterValue);
+                continue;
             }
-            if (skipObservation) { continue; }
 
+            auto& sigObs = *candidate.sigObs;
+            const auto& availableObservations = candidate.availableObservations;
             for (const auto& recv : receivers)
             {
                 auto& recvObsData = sigObs.recvObs.at(recv.type);
@@ -338,7 +318,7 @@ class ObservationFilter
                                      obsType, recv.type, recvObsData.obs[obsType].measurement);
                             break;
                         case GnssObs::Carrier:
-                            recvObsData.obs[obsType].measurement = InsConst<>::C / obsData.satSigId.freq().getFrequency(freqNum)
+                            recvObsData.obs[obsType].measurement = InsConst<>::C / obsData.satSigId.freq().getFrequency(candidate.freqNum)
                                                                    * recvObsData.gnssObsData().carrierPhase->value;
                             LOG_DATA("{}:  [{}] Taking {:11} observation into account on {:5} receiver ({:.3f} [m] = {:.3f} [cycles])", nameId, obsData.satSigId,
                                      obsType, recv.type, recvObsData.obs[obsType].measurement, recvObsData.gnssObsData().carrierPhase->value);
@@ -346,7 +326,7 @@ class ObservationFilter
                         case GnssObs::Doppler:
                             recvObsData.obs[obsType].measurement = doppler2rangeRate(recvObsData.gnssObsData().doppler.value(),
                                                                                      obsData.satSigId.freq(),
-                                                                                     freqNum);
+                                                                                     candidate.freqNum);
                             LOG_DATA("{}:  [{}] Taking {:11} observation into account on {:5} receiver ({:.3f} [m/s] = {:.3f} [Hz])", nameId, obsData.satSigId,
                                      obsType, recv.type, recvObsData.obs[obsType].measurement, recvObsData.gnssObsData().doppler.value());
                             break;
@@ -359,7 +339,7 @@ class ObservationFilter
 
             observations.systems.insert(satId.satSys);
             observations.satellites.insert(satId);
-            observations.signals.insert(std::make_pair(obsData.satSigId, sigObs));
+            observations.signals.insert(std::make_pair(obsData.satSigId, std::move(sigObs)));
         }
 
         for (size_t obsType = 0; obsType < GnssObs::ObservationType_COUNT; obsType++)
@@ -497,6 +477,15 @@ class ObservationFilter
         ImGui::SameLine();
         ImGui::TextUnformatted("Used observables");
 
+        if (ImGui::Checkbox(fmt::format("Parallel satellite calculation##{}", id).c_str(), &_parallelCalculation))
+        {
+            LOG_DEBUG("{}: Parallel satellite calculation: {}", id, _parallelCalculation);
+            changed = true;
+        }
+        ImGui::SameLine();
+        gui::widgets::HelpMarker("Calculates the satellite positions and clocks of the signals on all CPU cores.\n"
+                                 "Useful when processing many satellites or receivers.");
+
         return changed;
     }
 
@@ -598,6 +587,115 @@ class ObservationFilter
 
     /// List of signals to exclude temporarily
     std::unordered_map<SatSigId, size_t> _temporarilyExcludedSignalsSatellites;
+    /// Flag wether the satellite calculations of the signals are distributed onto the shared thread pool
+    bool _parallelCalculation = false;
+
+    /// Signal which passed the settings filters and waits for the satellite calculations
+    struct SignalCandidate
+    {
+        /// Reason why the signal was filtered in the satellite calculations
+        enum class FilterReason : uint8_t
+        {
+            None,                  ///< Signal is used
+            NavigationDataMissing, ///< No navigation data available
+            ElevationMask,         ///< Elevation mask triggered
+            SnrMask,               ///< SNR mask triggered
+        };
+
+        const GnssObs::ObservationData* obsData = nullptr;                     ///< Observation data of the first receiver
+        unordered_map<GnssObs::ObservationType, size_t> availableObservations; ///< Amount of receivers which observed the observation types
+        std::optional<Observations::SignalObservation> sigObs;                 ///< Calculated signal observation
+        int8_t freqNum = -128;                                                 ///< GLONASS frequency number
+        FilterReason filterReason = FilterReason::None;                        ///< Reason why the signal was filtered
+        double filterValue = 0.0;                                              ///< Elevation [rad] or Carrier-to-Noise density [dBHz] which triggered the mask
+    };
+
+    /// @brief Calculates the satellite data of a signal for all receivers and checks the elevation and SNR masks
+    /// @param[in, out] candidate Signal to calculate
+    /// @param[in] receivers List of receivers
+    /// @param[in] gnssNavInfos Collection of navigation data providers
+    /// @param[in] nameId Name and Id of the node used for log messages only
+    /// @param[in] ignoreElevationMask Flag wether the elevation mask should be ignored
+    /// @note Only reads the settings, so it can be called for several signals in parallel
+    template<typename ReceiverType>
+    void calcSignalObservation(SignalCandidate& candidate,
+                               const std::array<Receiver<ReceiverType>, ReceiverType::ReceiverType_COUNT>& receivers,
+                               const std::vector<const GnssNavInfo*>& gnssNavInfos,
+                               [[maybe_unused]] const std::string& nameId,
+                               bool ignoreElevationMask) const
+    {
+        const auto& obsData = *candidate.obsData;
+        SatId satId = obsData.satSigId.toSatId();
+
+        std::shared_ptr<NAV::SatNavData> satNavData = nullptr;
+        for (const auto& gnssNavInfo : gnssNavInfos)
+        {
+            auto satNav = gnssNavInfo->searchNavigationData(satId, receivers.front().gnssObs->insTime);
+            if (satNav && satNav->isHealthy())
+            {
+                satNavData = satNav;
+                break;
+            }
+        }
+        if (satNavData == nullptr)
+        {
+            LOG_DATA("{}:  [{}] Skipping obs because no navigation data available to calculaten the satellite position", nameId, obsData.satSigId);
+            candidate.filterReason = SignalCandidate::FilterReason::NavigationDataMissing;
+            return;
+        }
+
+        if (satId.satSys == GLO)
+        {
+            if (auto gloSatNavData = std::dynamic_pointer_cast<GLONASSEphemeris>(satNavData))
+            {
+                candidate.freqNum = gloSatNavData->frequencyNumber;
+            }
+        }
+
+        auto& sigObs = candidate.sigObs.emplace(satNavData, candidate.freqNum);
+
+        for (const auto& recv : receivers)
+        {
+            auto recvObsData = std::find_if(recv.gnssObs->data.begin(), recv.gnssObs->data.end(),
+                                            [&obsData](const GnssObs::ObservationData& recvObsData) {
+                                                return recvObsData.satSigId == obsData.satSigId;
+                                            });
+            auto satClk = satNavData->calcClockCorrections(recv.gnssObs->insTime,
+                                                           recvObsData->pseudorange->value,
+                                                           recvObsData->satSigId.freq());
+            auto satPosVel = satNavData->calcSatellitePosVel(satClk.transmitTime);
+
+            LOG_DATA("{}: Adding satellite [{}] for receiver {}", nameId, obsData.satSigId, recv.type);
+            sigObs.recvObs.emplace_back(recv.gnssObs, static_cast<size_t>(recvObsData - recv.gnssObs->data.begin()),
+                                        recv.e_posMarker, recv.lla_posMarker, recv.e_vel,
+                                        satPosVel.e_pos, satPosVel.e_vel, satClk);
+
+            if (!ignoreElevationMask)
+            {
+                const auto& satElevation = sigObs.recvObs.back().satElevation();
+                if (satElevation < _elevationMask)
+                {
+                    LOG_DATA("{}: Signal {} is skipped because of elevation mask. ({} < {})", nameId, obsData.satSigId,
+                             rad2deg(satElevation), rad2deg(_elevationMask));
+                    candidate.filterReason = SignalCandidate::FilterReason::ElevationMask;
+                    candidate.filterValue = satElevation;
+                    break;
+                }
+                if (recvObsData->CN0 // If no CN0 available, we use the signal
+                    && !_snrMask
+                            .at(_sameSnrMaskForAllReceivers ? static_cast<ReceiverType>(0) : recv.type)
+                            .checkSNRMask(obsData.satSigId.freq(), satElevation, recvObsData->CN0.value()))
+                {
+                    LOG_DATA("{}: [{}] SNR mask triggered for [{}] on receiver [{}] with CN0 {} dbHz",
+                             nameId, receivers.front().gnssObs->insTime.toYMDHMS(GPST), obsData.satSigId, recv.type, recvObsData->CN0.value());
+                    candidate.filterReason = SignalCandidate::FilterReason::SnrMask;
+                    candidate.filterValue = *recvObsData->CN0;
+                    break;
+                }
+            }
+        }
+    }
+
 
     /// @brief Converts the provided object into json
     /// @param[out] j Json object which gets filled with the info
@@ -613,6 +711,7 @@ class ObservationFilter
             { "sameSnrMaskForAllReceivers", obj._sameSnrMaskForAllReceivers },
             { "usedObsTypes", obj._usedObsTypes },
             { "neededObsType", obj._neededObsTypes },
+            { "parallelCalculation", obj._parallelCalculation },
         };
     }
     /// @brief Converts the provided json object into a node object
@@ -637,6 +736,7 @@ class ObservationFilter
         if (j.contains("sameSnrMaskForAllReceivers")) { j.at("sameSnrMaskForAllReceivers").get_to(obj._sameSnrMaskForAllReceivers); }
         if (j.contains("usedObsTypes")) { j.at("usedObsTypes").get_to(obj._usedObsTypes); }
         if (j.contains("neededObsTypes")) { j.at("neededObsTypes").get_to(obj._neededObsTypes); }
+        if (j.contains("parallelCalculation")) { j.at("parallelCalculation").get_to(obj._parallelCalculation); }
     }
 };
 
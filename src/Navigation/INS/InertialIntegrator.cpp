@@ -34,6 +34,89 @@ void InertialIntegrator::reset()
     setBufferSizes();
 }
 
+json InertialIntegrator::saveCheckpoint() const
+{
+    json j;
+    j["measurements"] = json::array();
+    for (const auto& m : _measurements)
+    {
+        j["measurements"].push_back({
+            { "dt", m.dt },
+            { "p_acceleration", m.p_acceleration },
+            { "p_angularRate", m.p_angularRate },
+            { "p_biasAcceleration", m.p_biasAcceleration },
+            { "p_biasAngularRate", m.p_biasAngularRate },
+        });
+    }
+    j["states"] = json::array();
+    for (const auto& state : _states)
+    {
+        // The states are saved in the frame they are integrated in, as converting them into the other frame and back is not exact
+        switch (_integrationFrame)
+        {
+        case IntegrationFrame::NED:
+            j["states"].push_back({
+                { "insTime", state.insTime },
+                { "lla_position", state.lla_position() },
+                { "n_velocity", state.n_velocity() },
+                { "n_Quat_b", state.n_Quat_b().coeffs() },
+            });
+            break;
+        case IntegrationFrame::ECEF:
+            j["states"].push_back({
+                { "insTime", state.insTime },
+                { "e_position", state.e_position() },
+                { "e_velocity", state.e_velocity() },
+                { "e_Quat_b", state.e_Quat_b().coeffs() },
+            });
+            break;
+        }
+    }
+    j["p_lastBiasAcceleration"] = p_lastBiasAcceleration;
+    j["p_lastBiasAngularRate"] = p_lastBiasAngularRate;
+    return j;
+}
+
+void InertialIntegrator::restoreCheckpoint(const json& j)
+{
+    reset();
+
+    if (j.contains("measurements"))
+    {
+        for (const auto& m : j.at("measurements"))
+        {
+            _measurements.push_back(Measurement{ .dt = m.at("dt").get<double>(),
+                                                 .p_acceleration = m.at("p_acceleration").get<Eigen::Vector3d>(),
+                                                 .p_angularRate = m.at("p_angularRate").get<Eigen::Vector3d>(),
+                                                 .p_biasAcceleration = m.at("p_biasAcceleration").get<Eigen::Vector3d>(),
+                                                 .p_biasAngularRate = m.at("p_biasAngularRate").get<Eigen::Vector3d>() });
+        }
+    }
+    if (j.contains("states"))
+    {
+        for (const auto& s : j.at("states"))
+        {
+            PosVelAtt state;
+            s.at("insTime").get_to(state.insTime);
+            if (s.contains("lla_position"))
+            {
+                Eigen::Quaterniond n_Quat_b;
+                n_Quat_b.coeffs() = s.at("n_Quat_b").get<Eigen::Vector4d>();
+                state.setState_n(s.at("lla_position").get<Eigen::Vector3d>(), s.at("n_velocity").get<Eigen::Vector3d>(), n_Quat_b);
+            }
+            else
+            {
+                Eigen::Quaterniond e_Quat_b;
+                e_Quat_b.coeffs() = s.at("e_Quat_b").get<Eigen::Vector4d>();
+                state.setState_e(s.at("e_position").get<Eigen::Vector3d>(), s.at("e_velocity").get<Eigen::Vector3d>(), e_Quat_b);
+            }
+            _states.push_back(state);
+        }
+    }
+    if (j.contains("p_lastBiasAcceleration")) { j.at("p_lastBiasAcceleration").get_to(p_lastBiasAcceleration); }
+    if (j.contains("p_lastBiasAngularRate")) { j.at("p_lastBiasAngularRate").get_to(p_lastBiasAngularRate); }
+}
+
 bool InertialIntegrator::hasInitialPosition() const
 {
     return !_states.empty();
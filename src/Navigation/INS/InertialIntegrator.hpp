@@ -64,6 +64,13 @@ class InertialIntegrator
     /// @brief Clears all internal data
     void reset();
 
+    /// @brief Saves the measurement and state buffers and the sensor biases for a checkpoint
+    [[nodiscard]] json saveCheckpoint() const;
+
+    /// @brief Restores the measurement and state buffers and the sensor biases from a checkpoint
+    /// @param[in] j Json object returned by saveCheckpoint()
+    void restoreCheckpoint(const json& j);
+
     /// @brief Checks if an initial position is set
     [[nodiscard]] bool hasInitialPosition() const;
 
@@ -0,0 +1,61 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "BlockKalmanFilter.hpp"
+
+void NAV::BlockKalmanFilter::predict(KalmanFilter& kf, Eigen::Index numStatesEst)
+{
+    const auto e = numStatesEst;
+    const auto b = kf.x.rows() - e; // Amount of bias states
+    const auto Phi_e = kf.Phi.topLeftCorner(e, e);
+
+    // Math: \mathbf{\hat{x}}_k^- = \mathbf{\Phi}_{k-1}\mathbf{\hat{x}}_{k-1}^+ \qquad \text{(bias states stay constant)}
+    kf.x.topRows(e) = (Phi_e * kf.x.topRows(e)).eval();
+
+    // Math: \mathbf{P}_k^- = \mathbf{\Phi}_{k-1} P_{k-1}^+ \mathbf{\Phi}_{k-1}^T + \mathbf{Q}_{k-1} \qquad \text{evaluated blockwise}
+    kf.P.topLeftCorner(e, e) = (Phi_e * kf.P.topLeftCorner(e, e) * Phi_e.transpose()).eval();
+    kf.P.topLeftCorner(e, e) += kf.Q.topLeftCorner(e, e);
+    if (b > 0)
+    {
+        kf.P.topRightCorner(e, b) = (Phi_e * kf.P.topRightCorner(e, b)).eval();
+        kf.P.bottomLeftCorner(b, e) = kf.P.topRightCorner(e, b).transpose();
+        kf.P.bottomRightCorner(b, b).diagonal() += kf.Q.bottomRightCorner(b, b).diagonal();
+    }
+}
+
+void NAV::BlockKalmanFilter::correct(KalmanFilter& kf, Eigen::Index numStatesEst, Eigen::Index numStatesPerPin, std::optional<Eigen::Index> biasStateIdx)
+{
+    const auto e = numStatesEst;
+    const auto H_e = kf.H.leftCols(e);
+
+    // 𝐏 𝐇ᵀ (only the non-zero columns of 𝐇 contribute)
+    Eigen::MatrixXd PHt = kf.P.leftCols(e) * H_e.transpose();
+    if (biasStateIdx)
+    {
+        PHt.noalias() += kf.P.middleCols(*biasStateIdx, numStatesPerPin) * kf.H.middleCols(*biasStateIdx, numStatesPerPin).transpose();
+    }
+
+    // Math: \mathbf{S}_k = \mathbf{H}_k \mathbf{P}_k^- \mathbf{H}_k^T + \mathbf{R}_k
+    kf.S.noalias() = H_e * PHt.topRows(e);
+    Eigen::VectorXd dz = kf.z - H_e * kf.x.topRows(e);
+    if (biasStateIdx)
+    {
+        kf.S.noalias() += kf.H.middleCols(*biasStateIdx, numStatesPerPin) * PHt.middleRows(*biasStateIdx, numStatesPerPin);
+        dz.noalias() -= kf.H.middleCols(*biasStateIdx, numStatesPerPin) * kf.x.middleRows(*biasStateIdx, numStatesPerPin);
+    }
+    kf.S += kf.R;
+
+    // Math: \mathbf{K}_k = \mathbf{P}_k^- \mathbf{H}_k^T \mathbf{S}_k^{-1} \qquad \text{P. Groves}\,(3.21)
+    kf.K.noalias() = PHt * kf.S.inverse();
+
+    // Math: \mathbf{\hat{x}}_k^+ = \mathbf{\hat{x}}_k^- + \mathbf{K}_k (\mathbf{z}_k - \mathbf{H}_k \mathbf{\hat{x}}_k^-) \qquad \text{P. Groves}\,(3.24)
+    kf.x.noalias() += kf.K * dz;
+
+    // Math: \mathbf{P}_k^+ = (\mathbf{I} - \mathbf{K}_k \mathbf{H}_k) \mathbf{P}_k^- = \mathbf{P}_k^- - \mathbf{K}_k (\mathbf{P}_k^- \mathbf{H}_k^T)^T \qquad \text{P. Groves}\,(3.25)
+    kf.P.noalias() -= kf.K * PHt.transpose();
+}
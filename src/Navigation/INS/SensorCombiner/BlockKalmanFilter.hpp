@@ -0,0 +1,43 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file BlockKalmanFilter.hpp
+/// @brief Kalman Filter steps, which exploit the block structure of the IMU fusion filters
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-15
+
+#pragma once
+
+#include <optional>
+
+#include "Navigation/Math/KalmanFilter.hpp"
+
+/// @brief Kalman Filter steps for the IMU fusion filters (IRWKF and B-spline KF)
+///
+/// The state vector consists of the estimated signal states (the first 'numStatesEst' states),
+/// followed by a block of bias states for every additional IMU. The bias states are modeled as random walks, so
+/// - 𝚽 = diag(𝚽ₑ, 𝑰) and 𝐐 = diag(𝐐ₑ, diagonal bias noise)
+/// - 𝐇 of a measurement has non-zero columns only for the signal states and the bias block of the measuring IMU
+///
+/// The steps only touch these blocks, so their cost grows with the amount of covariance entries instead of with the cube of the state count.
+/// They produce the same result as KalmanFilter::predict() and KalmanFilter::correct() with the dense matrices.
+namespace NAV::BlockKalmanFilter
+{
+/// @brief Do a Time Update
+/// @param[in, out] kf Kalman Filter with the updated 𝚽 and 𝐐 (only the signal block of 𝚽, the signal block and the diagonal of 𝐐 are used)
+/// @param[in] numStatesEst Amount of signal states at the start of the state vector
+void predict(KalmanFilter& kf, Eigen::Index numStatesEst);
+
+/// @brief Do a Measurement Update with a Measurement 𝐳
+/// @param[in, out] kf Kalman Filter with the updated 𝐇, 𝐑 and 𝐳
+/// @param[in] numStatesEst Amount of signal states at the start of the state vector
+/// @param[in] numStatesPerPin Amount of bias states of an IMU
+/// @param[in] biasStateIdx Index of the bias block of the measuring IMU (std::nullopt for the reference IMU without bias states)
+void correct(KalmanFilter& kf, Eigen::Index numStatesEst, Eigen::Index numStatesPerPin, std::optional<Eigen::Index> biasStateIdx);
+
+} // namespace NAV::BlockKalmanFilter
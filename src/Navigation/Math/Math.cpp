@@ -8,6 +8,9 @@
 
 #include "Math.hpp"
 
+#include <algorithm>
+#include <utility>
+
 namespace NAV::math
 {
 
@@ -113,4 +116,60 @@ double calcEllipticalIntegral(double phi, double m)
 
     return phi;
 }
-} // namespace NAV::math
\ No newline at end of file
+
+std::vector<size_t> douglasPeucker(const std::vector<Eigen::Vector3d>& points, double tolerance)
+{
+    if (points.size() <= 2)
+    {
+        std::vector<size_t> indices(points.size());
+        for (size_t i = 0; i < indices.size(); i++) { indices[i] = i; }
+        return indices;
+    }
+
+    std::vector<bool> keep(points.size(), false);
+    keep.front() = true;
+    keep.back() = true;
+
+    // Ranges [first, last] which still have to be checked. A stack avoids the recursion depth of long tracks.
+    std::vector<std::pair<size_t, size_t>> ranges{ { 0, points.size() - 1 } };
+    while (!ranges.empty())
+    {
+        auto [first, last] = ranges.back();
+        ranges.pop_back();
+        if (last - first < 2) { continue; }
+
+        Eigen::Vector3d line = points[last] - points[first];
+        double lineSquaredNorm = line.squaredNorm();
+
+        double maxDistance = -1.0;
+        size_t maxIdx = first;
+        for (size_t i = first + 1; i < last; i++)
+        {
+            Eigen::Vector3d diff = points[i] - points[first];
+            // Distance to the segment (clamped to its end points)
+            double t = lineSquaredNorm > 0.0 ? std::clamp(diff.dot(line) / lineSquaredNorm, 0.0, 1.0) : 0.0;
+            double distance = (diff - t * line).norm();
+            if (distance > maxDistance)
+            {
+                maxDistance = distance;
+                maxIdx = i;
+            }
+        }
+
+        if (maxDistance > tolerance)
+        {
+            keep[maxIdx] = true;
+            ranges.emplace_back(first, maxIdx);
+            ranges.emplace_back(maxIdx, last);
+        }
+    }
+
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < keep.size(); i++)
+    {
+        if (keep[i]) { indices.push_back(i); }
+    }
+    return indices;
+}
+
+} // namespace NAV::math
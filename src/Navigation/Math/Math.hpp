@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <type_traits>
+#include <vector>
 #include <Eigen/Core>
 #include <gcem.hpp>
 #include <fmt/format.h>
@@ -312,4 +313,10 @@ typename Derived::PlainObject lerp(const Eigen::MatrixBase<Derived>& a, const Ei
 /// @note See http://www2.iap.fr/users/pichon/doc/html_xref/elliptic-es.html
 double calcEllipticalIntegral(double phi, double m);
 
+/// @brief Simplifies a polyline with the Douglas-Peucker algorithm
+/// @param[in] points Points of the polyline
+/// @param[in] tolerance Maximum distance of a removed point to the simplified polyline
+/// @return Sorted indices of the points to keep. The first and last point are always kept.
+std::vector<size_t> douglasPeucker(const std::vector<Eigen::Vector3d>& points, double tolerance);
+
 } // namespace NAV::math
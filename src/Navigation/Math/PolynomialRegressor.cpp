@@ -25,6 +25,8 @@ const char* to_string(PolynomialRegressor<>::Strategy strategy)
         return "Bidiagonal Divide and Conquer SVD";
     case PolynomialRegressor<>::Strategy::COD:
         return "Complete Orthogonal Decomposition";
+    case PolynomialRegressor<>::Strategy::IncrementalQR:
+        return "Incremental QR";
     case PolynomialRegressor<>::Strategy::COUNT:
         return "";
     }
@@ -24,6 +24,7 @@ using json = nlohmann::json; ///< json namespace
 
 #include "Polynomial.hpp"
 #include "internal/PolynomialRegressor/IncrementalLeastSquares.hpp"
+#include "internal/PolynomialRegressor/IncrementalQr.hpp"
 #include "internal/PolynomialRegressor/LeastSquares.hpp"
 #include "internal/PolynomialRegressor/HouseholderQr.hpp"
 #include "internal/PolynomialRegressor/BDCSVD.hpp"
@@ -46,6 +47,7 @@ class PolynomialRegressor
         HouseholderQR,           ///< Householder QR decomposition
         BDCSVD,                  ///< Bidiagonal Divide and Conquer SVD
         COD,                     ///< Complete Orthogonal Decomposition
+        IncrementalQR,           ///< QR decomposition with up- and downdates for every data point (sliding window)
         COUNT,                   ///< Amount of items in the enum
     };
 
@@ -54,7 +56,7 @@ class PolynomialRegressor
     /// @param[in] windowSize Amount of points to use for the fit (sliding window)
     /// @param[in] strategy Strategy to use
     PolynomialRegressor(size_t polynomialDegree, size_t windowSize, Strategy strategy = Strategy::HouseholderQR)
-        : _strategy(strategy), _polyDegree(polynomialDegree), _windowSize(windowSize), _incrementalLSQ(polynomialDegree)
+        : _strategy(strategy), _polyDegree(polynomialDegree), _windowSize(windowSize), _incrementalLSQ(polynomialDegree), _incrementalQR(polynomialDegree)
     {
         setWindowSize(windowSize);
         setPolynomialDegree(polynomialDegree);
@@ -84,6 +86,7 @@ class PolynomialRegressor
         _polyDegree = polynomialDegree;
 
         _incrementalLSQ.setPolynomialDegree(polynomialDegree);
+        _incrementalQR.setPolynomialDegree(polynomialDegree);
 
         reset();
     }
@@ -117,8 +120,14 @@ class PolynomialRegressor
                 _incrementalLSQ.removeDataPoint(_data.back().first, _data.back().second);
                 _incrementalLSQ.addDataPoint(x, y);
             }
+            else if (_strategy == Strategy::IncrementalQR)
+            {
+                _incrementalQR.removeDataPoint(_data.back().first, _data.back().second);
+                _incrementalQR.addDataPoint(x, y);
+            }
             _data.back().second = y;
 
+            refactorizeIfNeeded();
             return;
         }
 
@@ -128,14 +137,21 @@ class PolynomialRegressor
         {
             _incrementalLSQ.addDataPoint(x, y);
         }
+        else if (_strategy == Strategy::IncrementalQR)
+        {
+            _incrementalQR.addDataPoint(x, y);
+        }
 
         _data.push_back(std::make_pair(x, y));
+
+        refactorizeIfNeeded();
     }
 
     /// @brief Reset the polynomial coefficients and saved data
     void reset()
     {
         _incrementalLSQ.reset();
+        _incrementalQR.reset();
         _data.clear();
     }
 
@@ -160,6 +176,8 @@ class PolynomialRegressor
         {
         case Strategy::IncrementalLeastSquares:
             return { _incrementalLSQ.calcCoefficients() };
+        case Strategy::IncrementalQR:
+            return { _incrementalQR.calcCoefficients() };
         case Strategy::LeastSquares:
         {
             auto [x, y] = prepareDataVectors();
@@ -209,6 +227,8 @@ class PolynomialRegressor
     ScrollingBuffer<std::pair<Scalar, Scalar>> _data;
     /// Incremental LSQ Regressor
     IncrementalLeastSquares<Scalar> _incrementalLSQ;
+    /// Incremental QR Regressor
+    IncrementalQr<Scalar> _incrementalQR;
 
     /// @brief Removes the first data point from the polynomial fit (sliding window)
     void pop_front()
@@ -222,6 +242,22 @@ class PolynomialRegressor
         {
             _incrementalLSQ.removeDataPoint(x, y);
         }
+        else if (_strategy == Strategy::IncrementalQR)
+        {
+            _incrementalQR.removeDataPoint(x, y);
+        }
+    }
+
+    /// @brief Recalculates the incremental QR factorization from the data, after a window worth of downdates accumulated their rounding errors
+    void refactorizeIfNeeded()
+    {
+        if (_strategy != Strategy::IncrementalQR || !_incrementalQR.needsRefactorization(_windowSize)) { return; }
+
+        _incrementalQR.reset();
+        for (size_t i = 0; i < _data.size(); i++)
+        {
+            _incrementalQR.addDataPoint(_data.at(i).first, _data.at(i).second);
+        }
     }
 };
 
@@ -257,6 +293,7 @@ void from_json(const json& j, PolynomialRegressor<Scalar>& obj)
     {
         j.at("polyDegree").get_to(obj._polyDegree);
         obj._incrementalLSQ.setPolynomialDegree(obj._polyDegree);
+        obj._incrementalQR.setPolynomialDegree(obj._polyDegree);
     }
     if (j.contains("windowSize"))
     {
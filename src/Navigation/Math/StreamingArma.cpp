@@ -0,0 +1,369 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "StreamingArma.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <boost/math/distributions/students_t.hpp>
+
+#include "util/Assert.h"
+
+namespace NAV
+{
+
+StreamingArma::StreamingArma(size_t channels, size_t windowSize, size_t p, size_t q)
+    : _channels(channels), _window(windowSize), _p(p), _q(q), _n(p + q), _lags(p + 3)
+{
+    INS_ASSERT_USER_ERROR(windowSize > _n + _lags + 1, "The window size needs to be greater than the ARMA order plus the order of the long AR model.");
+
+    auto c = static_cast<Eigen::Index>(_channels);
+    auto w = static_cast<Eigen::Index>(_window);
+    auto n = static_cast<Eigen::Index>(_n);
+    _y = Array::Zero(w, c);
+    _e = Array::Zero(w, c);
+    _phi = Array::Zero(w * n, c);
+    _z = Array::Zero(w, c);
+    _sum = Row::Zero(c);
+    _lagSum = Array::Zero(static_cast<Eigen::Index>(_lags) + 1, c);
+    _longAr = Array::Zero(static_cast<Eigen::Index>(_lags), c);
+    _P = Array::Zero(n * n, c);
+    _x = Array::Zero(n, c);
+    _b = Array::Zero(n, c);
+    _zz = Row::Zero(c);
+    _estimate = Eigen::VectorXd::Zero(c);
+    _parameters = Eigen::MatrixXd::Zero(n, c);
+    _pValues = Eigen::MatrixXd::Constant(n, c, std::nan(""));
+    _arOrder.resize(_channels);
+    _maOrder.resize(_channels);
+
+    reset();
+}
+
+void StreamingArma::reset()
+{
+    _head = 0;
+    _size = 0;
+    _sum.setZero();
+    _lagSum.setZero();
+    _longAr.setZero();
+    _P.setZero();
+    _x.setZero();
+    _b.setZero();
+    _zz.setZero();
+    _fitted = false;
+    _refactorize = false;
+    _sinceRefactorize = 0;
+    _estimate.setZero();
+    _parameters.setZero();
+    _pValues.setConstant(std::nan(""));
+    std::fill(_arOrder.begin(), _arOrder.end(), _p);
+    std::fill(_maOrder.begin(), _maOrder.end(), _q);
+}
+
+void StreamingArma::push_back(const Eigen::Ref<const Eigen::VectorXd>& sample)
+{
+    INS_ASSERT_USER_ERROR(static_cast<size_t>(sample.size()) == _channels, "The sample needs a value for every channel.");
+
+    if (_size == _window) { pop_front(); }
+
+    size_t idx = slot(_size);
+    _size++;
+    auto n = static_cast<Eigen::Index>(_n);
+    auto y = [&](size_t i) { return _y.row(static_cast<Eigen::Index>(slot(i))); }; // i-th oldest sample
+
+    _y.row(static_cast<Eigen::Index>(idx)) = sample.transpose().array();
+    _sum += _y.row(static_cast<Eigen::Index>(idx));
+    for (size_t tau = 0; tau <= std::min(_lags, _size - 1); tau++)
+    {
+        _lagSum.row(static_cast<Eigen::Index>(tau)) += y(_size - 1) * y(_size - 1 - tau);
+    }
+    Row mean = _sum / static_cast<double>(_size);
+
+    // Residual of the long AR model (ê_t = 0 while there is not enough data for the model)
+    Row e = Row::Zero(static_cast<Eigen::Index>(_channels));
+    if (_size > _lags + 1)
+    {
+        updateLongAr();
+        e = y(_size - 1) - mean;
+        for (size_t i = 1; i <= _lags; i++)
+        {
+            e -= _longAr.row(static_cast<Eigen::Index>(i) - 1) * (y(_size - 1 - i) - mean);
+        }
+    }
+    _e.row(static_cast<Eigen::Index>(idx)) = e;
+
+    // Regressors y_t-1 ... y_t-p, -ê_t-1 ... -ê_t-q
+    auto phi = _phi.middleRows(static_cast<Eigen::Index>(idx) * n, n);
+    for (size_t i = 0; i < _p; i++)
+    {
+        if (_size > i + 1) { phi.row(static_cast<Eigen::Index>(i)) = y(_size - 2 - i) - mean; }
+        else { phi.row(static_cast<Eigen::Index>(i)).setZero(); }
+    }
+    for (size_t i = 0; i < _q; i++)
+    {
+        if (_size > i + 1) { phi.row(static_cast<Eigen::Index>(_p + i)) = -_e.row(static_cast<Eigen::Index>(slot(_size - 2 - i))); }
+        else { phi.row(static_cast<Eigen::Index>(_p + i)).setZero(); }
+    }
+    _z.row(static_cast<Eigen::Index>(idx)) = y(_size - 1) - mean;
+    auto z = _z.row(static_cast<Eigen::Index>(idx));
+
+    for (Eigen::Index i = 0; i < n; i++) { _b.row(i) += phi.row(i) * z; }
+    _zz += z.square();
+    if (_fitted) { updateLeastSquares(phi, z, 1.0); }
+
+    if (_size == _window)
+    {
+        _sinceRefactorize++;
+        if (!_fitted || _refactorize || _sinceRefactorize >= _window) { refactorize(); }
+        selectModels();
+    }
+}
+
+bool StreamingArma::full() const
+{
+    return _size == _window;
+}
+
+const Eigen::VectorXd& StreamingArma::estimate() const
+{
+    return _estimate;
+}
+
+const Eigen::MatrixXd& StreamingArma::parameters() const
+{
+    return _parameters;
+}
+
+const Eigen::MatrixXd& StreamingArma::pValues() const
+{
+    return _pValues;
+}
+
+size_t StreamingArma::arOrder(size_t channel) const
+{
+    return _arOrder.at(channel);
+}
+
+size_t StreamingArma::maOrder(size_t channel) const
+{
+    return _maOrder.at(channel);
+}
+
+size_t StreamingArma::slot(size_t i) const
+{
+    return (_head + i) % _window;
+}
+
+void StreamingArma::pop_front()
+{
+    auto old = static_cast<Eigen::Index>(_head);
+    auto n = static_cast<Eigen::Index>(_n);
+
+    for (size_t tau = 0; tau <= std::min(_lags, _size - 1); tau++)
+    {
+        _lagSum.row(static_cast<Eigen::Index>(tau)) -= _y.row(old) * _y.row(static_cast<Eigen::Index>(slot(tau)));
+    }
+    _sum -= _y.row(old);
+
+    auto phi = _phi.middleRows(old * n, n);
+    auto z = _z.row(old);
+    for (Eigen::Index i = 0; i < n; i++) { _b.row(i) -= phi.row(i) * z; }
+    _zz -= z.square();
+    if (_fitted) { updateLeastSquares(phi, z, -1.0); }
+
+    _head = slot(1);
+    _size--;
+}
+
+void StreamingArma::updateLongAr()
+{
+    auto c = static_cast<Eigen::Index>(_channels);
+    auto L = static_cast<Eigen::Index>(_lags);
+
+    // Autocorrelation from the sums: Σ (y_i - ȳ)(y_i+tau - ȳ) = Σ y_i y_i+tau - ȳ (Σ_head y + Σ_tail y) + (n - tau) ȳ²
+    Row mean = _sum / static_cast<double>(_size);
+    Array acf(L + 1, c);
+    Row headSum = _sum; // Sum of the first n - tau samples
+    Row tailSum = _sum; // Sum of the last n - tau samples
+    Row c0;
+    for (Eigen::Index tau = 0; tau <= L; tau++)
+    {
+        if (tau > 0)
+        {
+            headSum -= _y.row(static_cast<Eigen::Index>(slot(_size - static_cast<size_t>(tau))));
+            tailSum -= _y.row(static_cast<Eigen::Index>(slot(static_cast<size_t>(tau) - 1)));
+        }
+        Row cov = _lagSum.row(tau) - mean * (headSum + tailSum) + static_cast<double>(_size - static_cast<size_t>(tau)) * mean.square();
+        if (tau == 0) { c0 = cov; }
+        acf.row(tau) = (c0 > 0.0).select(cov / c0, 0.0);
+    }
+
+    // Durbin-Levinson recursion, where the last step yields the AR(L) parameters
+    _longAr.setZero();
+    _longAr.row(0) = acf.row(1);
+    Array prev(L, c);
+    for (Eigen::Index k = 2; k <= L; k++)
+    {
+        Row num = acf.row(k);
+        Row den = Row::Ones(c);
+        for (Eigen::Index j = 1; j < k; j++)
+        {
+            num -= _longAr.row(j - 1) * acf.row(k - j);
+            den -= _longAr.row(j - 1) * acf.row(j);
+        }
+        Row kappa = (den.abs() > 1e-12).select(num / den, 0.0);
+
+        prev.topRows(k - 1) = _longAr.topRows(k - 1);
+        for (Eigen::Index j = 1; j < k; j++)
+        {
+            _longAr.row(j - 1) = prev.row(j - 1) - kappa * prev.row(k - j - 1);
+        }
+        _longAr.row(k - 1) = kappa;
+    }
+}
+
+void StreamingArma::updateLeastSquares(const Eigen::Ref<const Array>& phi, const Eigen::Ref<const Row>& z, double sign)
+{
+    auto c = static_cast<Eigen::Index>(_channels);
+    auto n = static_cast<Eigen::Index>(_n);
+
+    Array Pphi = Array::Zero(n, c);
+    Row denom = Row::Ones(c);
+    Row innovation = z;
+    for (Eigen::Index i = 0; i < n; i++)
+    {
+        for (Eigen::Index j = 0; j < n; j++) { Pphi.row(i) += _P.row(i * n + j) * phi.row(j); }
+        denom += sign * phi.row(i) * Pphi.row(i);
+        innovation -= phi.row(i) * _x.row(i);
+    }
+    if (sign < 0.0 && (denom <= 1e-9).any())
+    {
+        _refactorize = true; // Removing the row would make the normal matrix singular with the accumulated rounding errors
+        return;
+    }
+
+    // Sherman-Morrison: P = P ∓ P φ φᵀ P / (1 ± φᵀ P φ), x = x ± P φ (z - φᵀ x) / (1 ± φᵀ P φ)
+    Pphi.rowwise() /= denom;
+    for (Eigen::Index i = 0; i < n; i++)
+    {
+        for (Eigen::Index j = 0; j < n; j++)
+        {
+            _P.row(i * n + j) -= sign * Pphi.row(i) * Pphi.row(j) * denom;
+        }
+        _x.row(i) += sign * Pphi.row(i) * innovation;
+    }
+}
+
+void StreamingArma::refactorize()
+{
+    auto n = static_cast<Eigen::Index>(_n);
+
+    _sum.setZero();
+    _lagSum.setZero();
+    _b.setZero();
+    _zz.setZero();
+    for (size_t i = 0; i < _size; i++)
+    {
+        auto idx = static_cast<Eigen::Index>(slot(i));
+        _sum += _y.row(idx);
+        for (size_t tau = 0; tau <= _lags && i + tau < _size; tau++)
+        {
+            _lagSum.row(static_cast<Eigen::Index>(tau)) += _y.row(idx) * _y.row(static_cast<Eigen::Index>(slot(i + tau)));
+        }
+        for (Eigen::Index j = 0; j < n; j++) { _b.row(j) += _phi.row(idx * n + j) * _z.row(idx); }
+        _zz += _z.row(idx).square();
+    }
+
+    for (size_t ch = 0; ch < _channels; ch++)
+    {
+        auto c = static_cast<Eigen::Index>(ch);
+        Eigen::MatrixXd ATA = Eigen::MatrixXd::Zero(n, n);
+        for (size_t i = 0; i < _size; i++)
+        {
+            Eigen::VectorXd phi = _phi.col(c).segment(static_cast<Eigen::Index>(slot(i)) * n, n).matrix();
+            ATA.selfadjointView<Eigen::Lower>().rankUpdate(phi);
+        }
+        Eigen::MatrixXd P = Eigen::MatrixXd(ATA.selfadjointView<Eigen::Lower>()).completeOrthogonalDecomposition().pseudoInverse();
+        Eigen::VectorXd x = P * _b.col(c).matrix();
+        for (Eigen::Index i = 0; i < n; i++)
+        {
+            for (Eigen::Index j = 0; j < n; j++) { _P(i * n + j, c) = P(i, j); }
+            _x(i, c) = x(i);
+        }
+    }
+
+    _fitted = true;
+    _refactorize = false;
+    _sinceRefactorize = 0;
+}
+
+void StreamingArma::selectModels()
+{
+    auto n = static_cast<Eigen::Index>(_n);
+    auto newest = static_cast<Eigen::Index>(slot(_size - 1));
+
+    for (size_t ch = 0; ch < _channels; ch++)
+    {
+        auto c = static_cast<Eigen::Index>(ch);
+        Eigen::MatrixXd P(n, n);
+        for (Eigen::Index i = 0; i < n; i++)
+        {
+            for (Eigen::Index j = 0; j < n; j++) { P(i, j) = _P(i * n + j, c); }
+        }
+        Eigen::VectorXd x = _x.col(c).matrix();
+        Eigen::VectorXd b = _b.col(c).matrix();
+        Eigen::VectorXd pValues = Eigen::VectorXd::Constant(n, std::nan(""));
+
+        size_t p = _p;
+        size_t q = _q;
+        while (p + q > 0)
+        {
+            // Parameter significance test
+            double df = static_cast<double>(_size) - static_cast<double>(p + q) - 1.0;
+            if (df <= 0.0) { break; }
+            boost::math::students_t dist(df);
+            double var_e = std::max(_zz(c) - x.dot(b), 0.0) / df; // sigma^2_e = (zᵀz - xᵀAᵀz) / df
+
+            Eigen::Index maxIdx = -1;
+            auto test = [&](Eigen::Index j) {
+                double t = x(j) / std::sqrt(var_e * P(j, j));
+                pValues(j) = std::isnan(t) ? 1.0 : (std::isinf(t) ? 0.0 : 2 * boost::math::pdf(dist, t));
+                if (maxIdx == -1 || pValues(j) > pValues(maxIdx)) { maxIdx = j; }
+            };
+            for (size_t i = 0; i < p; i++) { test(static_cast<Eigen::Index>(i)); }
+            for (size_t i = 0; i < q; i++) { test(static_cast<Eigen::Index>(_p + i)); }
+            if (pValues(maxIdx) <= 0.05) { break; }
+
+            // Reduce the AR or MA order by eliminating the last parameter of the part with the maximum p-Value
+            auto r = static_cast<Eigen::Index>(maxIdx < static_cast<Eigen::Index>(_p) ? p - 1 : _p + q - 1);
+            if (P(r, r) > 0.0)
+            {
+                Eigen::VectorXd Pr = P.col(r);
+                x -= Pr * x(r) / P(r, r);
+                P -= Pr * Pr.transpose() / P(r, r);
+            }
+            x(r) = 0.0;
+            P.row(r).setZero();
+            P.col(r).setZero();
+            pValues(r) = std::nan("");
+            if (maxIdx < static_cast<Eigen::Index>(_p)) { p--; }
+            else { q--; }
+        }
+
+        _arOrder[ch] = p;
+        _maOrder[ch] = q;
+        _parameters.col(c) = x;
+        _pValues.col(c) = pValues;
+        _estimate(c) = _phi.col(c).segment(newest * n, n).matrix().dot(x) + _sum(c) / static_cast<double>(_size);
+    }
+}
+
+} // namespace NAV
@@ -0,0 +1,136 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file StreamingArma.hpp
+/// @brief Sliding window ARMA model estimation with incremental updates for every sample
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-15
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "util/Eigen.hpp"
+
+namespace NAV
+{
+
+/// @brief ARMA(p,q) model estimation over a sliding window, which is updated with every sample instead of refitting the whole window
+///
+/// The parameters are estimated with the Hannan-Rissanen method:
+/// - The autocovariances up to lag p + 3 are kept as sliding sums of lagged products, so adding and removing a sample costs O(p).
+/// - A long AR(p + 3) model is derived from them with Durbin-Levinson. Its residual of the new sample is the MA regressor ê.
+/// - The ARMA parameters are the least squares solution of the window, which is kept by a recursive least squares up- and downdate.
+/// - Parameters failing the zero slope test (p-Value > 0.05) reduce the AR or MA order. The reduced solution is obtained from the full one
+///   by eliminating the parameter with the Schur complement, so no refit is needed.
+///
+/// All channels are stored as columns of row-major arrays, so every update step works on all channels at once.
+/// @note The regressors of a sample are formed with the model at the time the sample was added. The downdates lose accuracy over time,
+///       so all sums and the least squares solution are recalculated from the window every 'windowSize' samples.
+class StreamingArma
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] channels Amount of independent channels (e.g. 6 for the accelerometer and gyroscope axes)
+    /// @param[in] windowSize Amount of samples in the sliding window
+    /// @param[in] p Maximum AR order
+    /// @param[in] q Maximum MA order
+    StreamingArma(size_t channels, size_t windowSize, size_t p, size_t q);
+
+    /// @brief Removes all samples
+    void reset();
+
+    /// @brief Adds a sample and updates the estimates
+    /// @param[in] sample Values of all channels
+    void push_back(const Eigen::Ref<const Eigen::VectorXd>& sample);
+
+    /// @brief Checks whether the window is full and the estimates are available
+    [[nodiscard]] bool full() const;
+
+    /// @brief ARMA estimate of the last sample for every channel (including the mean of the window)
+    [[nodiscard]] const Eigen::VectorXd& estimate() const;
+
+    /// @brief ARMA parameters of every channel as columns (phi_1 ... phi_p, theta_1 ... theta_q). Eliminated parameters are zero.
+    [[nodiscard]] const Eigen::MatrixXd& parameters() const;
+
+    /// @brief Empirical significance (p-Value) of the parameters of every channel as columns. Eliminated parameters are NaN.
+    [[nodiscard]] const Eigen::MatrixXd& pValues() const;
+
+    /// @brief Selected AR order of the channel
+    /// @param[in] channel Channel index
+    [[nodiscard]] size_t arOrder(size_t channel) const;
+
+    /// @brief Selected MA order of the channel
+    /// @param[in] channel Channel index
+    [[nodiscard]] size_t maOrder(size_t channel) const;
+
+  private:
+    /// Array with one column per channel, where every row is contiguous in memory
+    using Array = Eigen::Array<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    /// Row with one value per channel
+    using Row = Eigen::Array<double, 1, Eigen::Dynamic>;
+
+    size_t _channels; ///< Amount of channels
+    size_t _window;   ///< Amount of samples in the sliding window
+    size_t _p;        ///< Maximum AR order
+    size_t _q;        ///< Maximum MA order
+    size_t _n;        ///< Amount of ARMA parameters (p + q)
+    size_t _lags;     ///< Order of the long AR model used for the initial ê
+
+    size_t _head = 0; ///< Slot of the oldest sample in the ring buffers
+    size_t _size = 0; ///< Amount of samples in the ring buffers
+
+    Array _y;   ///< Ring buffer with the samples (window x channels)
+    Array _e;   ///< Ring buffer with the residuals of the long AR model (window x channels)
+    Array _phi; ///< Ring buffer with the regressors of the samples ((window * n) x channels)
+    Array _z;   ///< Ring buffer with the mean reduced samples at the time they were added (window x channels)
+
+    Row _sum;      ///< Sum of the samples in the window
+    Array _lagSum; ///< Sums of the lagged products y_i * y_(i+tau) in the window ((lags + 1) x channels)
+    Array _longAr; ///< Parameters of the long AR model (lags x channels)
+
+    Array _P; ///< Inverse of the normal matrix ((n * n) x channels)
+    Array _x; ///< Least squares solution of the full model (n x channels)
+    Array _b; ///< Sum of the regressors times the targets (n x channels)
+    Row _zz;  ///< Sum of the squared targets
+
+    bool _fitted = false;         ///< Whether _P and _x were calculated from a full window
+    bool _refactorize = false;    ///< Whether a downdate became ill-conditioned
+    size_t _sinceRefactorize = 0; ///< Amount of samples since the last recalculation
+
+    Eigen::VectorXd _estimate;    ///< ARMA estimate of the last sample
+    Eigen::MatrixXd _parameters;  ///< Parameters of the selected models
+    Eigen::MatrixXd _pValues;     ///< Empirical significance of the parameters of the selected models
+    std::vector<size_t> _arOrder; ///< Selected AR orders
+    std::vector<size_t> _maOrder; ///< Selected MA orders
+
+    /// @brief Ring buffer slot of the i-th oldest sample
+    /// @param[in] i Index of the sample (0 = oldest)
+    [[nodiscard]] size_t slot(size_t i) const;
+
+    /// @brief Removes the oldest sample from all sums and the least squares solution
+    void pop_front();
+
+    /// @brief Calculates the long AR model from the autocovariances of the window with Durbin-Levinson
+    void updateLongAr();
+
+    /// @brief Rank-one update (sign = 1) or downdate (sign = -1) of the least squares solution
+    /// @param[in] phi Regressors (n x channels)
+    /// @param[in] z Targets
+    /// @param[in] sign 1 to add the row, -1 to remove it
+    void updateLeastSquares(const Eigen::Ref<const Array>& phi, const Eigen::Ref<const Row>& z, double sign);
+
+    /// @brief Recalculates all sums and the least squares solution from the samples in the window
+    void refactorize();
+
+    /// @brief Selects the model orders with the zero slope test and calculates the estimate of the last sample
+    void selectModels();
+};
+
+} // namespace NAV
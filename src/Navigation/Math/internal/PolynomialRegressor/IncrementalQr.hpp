@@ -0,0 +1,190 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file IncrementalQr.hpp
+/// @brief Sliding window QR Curve Fit with rank-one up- and downdates
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-15
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cmath>
+#include "util/Assert.h"
+#include "util/Eigen.hpp"
+
+namespace NAV
+{
+
+/// @brief QR decomposition Curve Fitting, which is updated with every added and removed data point
+///
+/// Only the triangular factor 𝐑 and 𝐐ᵀ𝐲 of the design matrix are stored. Adding a data point applies Givens rotations,
+/// removing one applies hyperbolic rotations, so both cost O(degree²) instead of a new decomposition of the whole window.
+/// The x values are taken relative to the first point of the factorization to keep the design matrix well conditioned.
+/// @note Downdates lose accuracy over time. The owner should refactorize with the data of the window, when needsRefactorization() returns true.
+/// @tparam Scalar Data type to store
+template<typename Scalar>
+class IncrementalQr
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] polynomialDegree Degree of the polynomial to fit
+    explicit IncrementalQr(size_t polynomialDegree)
+    {
+        setPolynomialDegree(polynomialDegree);
+    }
+
+    /// @brief Set the Polynomial Degree and resets the data
+    /// @param[in] polynomialDegree Degree of the polynomial to fit
+    void setPolynomialDegree(size_t polynomialDegree)
+    {
+        _polyDegree = polynomialDegree;
+        auto n = static_cast<Eigen::Index>(polynomialDegree) + 1;
+        _R = Eigen::MatrixX<Scalar>::Zero(n, n);
+        _Qty = Eigen::VectorX<Scalar>::Zero(n);
+        _row = Eigen::VectorX<Scalar>::Zero(n);
+        reset();
+    }
+
+    /// @brief Add a data point to the polynomial
+    /// @param[in] x X Value
+    /// @param[in] y Y Value
+    void addDataPoint(const Scalar& x, const Scalar& y)
+    {
+        if (_nPoints == 0) { _xOffset = x; }
+        setRow(x);
+        Scalar yRow = y;
+
+        for (Eigen::Index k = 0; k < _R.rows(); k++)
+        {
+            if (_row(k) == 0) { continue; }
+
+            Scalar r = std::hypot(_R(k, k), _row(k));
+            Scalar c = _R(k, k) / r;
+            Scalar s = _row(k) / r;
+
+            _R(k, k) = r;
+            for (Eigen::Index j = k + 1; j < _R.cols(); j++)
+            {
+                Scalar rkj = _R(k, j);
+                _R(k, j) = c * rkj + s * _row(j);
+                _row(j) = c * _row(j) - s * rkj;
+            }
+            Scalar qk = _Qty(k);
+            _Qty(k) = c * qk + s * yRow;
+            yRow = c * yRow - s * qk;
+        }
+        _nPoints++;
+    }
+
+    /// @brief Removes a data point from the polynomial fit
+    /// @param[in] x X Value
+    /// @param[in] y Y Value
+    void removeDataPoint(const Scalar& x, const Scalar& y)
+    {
+        if (_nPoints <= 1)
+        {
+            reset();
+            return;
+        }
+        setRow(x);
+        Scalar yRow = y;
+
+        for (Eigen::Index k = 0; k < _R.rows(); k++)
+        {
+            if (_row(k) == 0) { continue; }
+
+            Scalar rkk = _R(k, k);
+            Scalar diff = (rkk - _row(k)) * (rkk + _row(k));
+            if (!(diff > 0))
+            {
+                _downdateFailed = true;
+                break;
+            }
+            Scalar r = std::sqrt(diff);
+            Scalar c = r / rkk;
+            Scalar s = _row(k) / rkk;
+
+            _R(k, k) = r;
+            for (Eigen::Index j = k + 1; j < _R.cols(); j++)
+            {
+                Scalar rkj = (_R(k, j) - s * _row(j)) / c;
+                _row(j) = c * _row(j) - s * rkj;
+                _R(k, j) = rkj;
+            }
+            Scalar qk = (_Qty(k) - s * yRow) / c;
+            yRow = c * yRow - s * qk;
+            _Qty(k) = qk;
+        }
+        _nPoints--;
+        _nDowndates++;
+    }
+
+    /// @brief Reset the saved data
+    void reset()
+    {
+        _R.setZero();
+        _Qty.setZero();
+        _nPoints = 0;
+        _nDowndates = 0;
+        _downdateFailed = false;
+        _xOffset = 0;
+    }
+
+    /// @brief Checks whether the factorization should be recalculated from the data
+    /// @param[in] maxDowndates Amount of downdates after which the factorization should be recalculated
+    [[nodiscard]] bool needsRefactorization(size_t maxDowndates) const
+    {
+        return _downdateFailed || _nDowndates >= maxDowndates;
+    }
+
+    /// @brief Calculates the polynomial coefficients in order a0 + a1 * x + a2 * x^2 + ...
+    [[nodiscard]] Eigen::VectorX<Scalar> calcCoefficients() const
+    {
+        if (_nPoints == 0) { return {}; }
+
+        auto n = static_cast<Eigen::Index>(std::min(_polyDegree, _nPoints - 1)) + 1;
+
+        Eigen::VectorX<Scalar> coeffs = _R.topLeftCorner(n, n).template triangularView<Eigen::Upper>().solve(_Qty.head(n));
+
+        // Coefficients of (x - x0) into coefficients of x (Taylor shift)
+        for (Eigen::Index i = 0; i < n - 1; i++)
+        {
+            for (Eigen::Index j = n - 2; j >= i; j--)
+            {
+                coeffs(j) -= _xOffset * coeffs(j + 1);
+            }
+        }
+        return coeffs;
+    }
+
+  private:
+    size_t _polyDegree = 2;       ///< Polynomial degree to fit
+    Eigen::MatrixX<Scalar> _R;    ///< Upper triangular factor of the design matrix
+    Eigen::VectorX<Scalar> _Qty;  ///< 𝐐ᵀ𝐲 of the factorization
+    Eigen::VectorX<Scalar> _row;  ///< Design matrix row of the data point which is added or removed
+    Scalar _xOffset = 0;          ///< X value the design matrix is relative to
+    size_t _nPoints = 0;          ///< Amount of data points in the factorization
+    size_t _nDowndates = 0;       ///< Amount of data points removed since the last reset
+    bool _downdateFailed = false; ///< Whether a downdate lost the positive definiteness
+
+    /// @brief Fills the design matrix row for the x value
+    /// @param[in] x X Value
+    void setRow(const Scalar& x)
+    {
+        auto xpow = static_cast<Scalar>(1.0);
+        for (auto& value : _row)
+        {
+            value = xpow;
+            xpow *= x - _xOffset;
+        }
+    }
+};
+
+} // namespace NAV
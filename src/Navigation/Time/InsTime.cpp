@@ -108,6 +108,12 @@ void to_json(json& j, const InsTime& insTime)
         { "mjd_day", mjd.mjd_day },
         { "mjd_frac", mjd.mjd_frac },
     };
+    // Json numbers are doubles, so the remainder is needed to restore the long double exactly (e.g. when resuming from a checkpoint)
+    if (auto remainder = mjd.mjd_frac - static_cast<long double>(static_cast<double>(mjd.mjd_frac));
+        remainder != 0.0L)
+    {
+        j["mjd_frac_remainder"] = static_cast<double>(remainder);
+    }
 }
 
 void from_json(const json& j, InsTime& insTime)
@@ -122,6 +128,10 @@ void from_json(const json& j, InsTime& insTime)
     {
         j.at("mjd_frac").get_to(mjd.mjd_frac);
     }
+    if (j.contains("mjd_frac_remainder"))
+    {
+        mjd.mjd_frac += j.at("mjd_frac_remainder").get<long double>();
+    }
     insTime = InsTime{ mjd };
 }
 
@@ -0,0 +1,113 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file ColumnSelection.hpp
+/// @brief Precompiled selection of NodeData columns for the bulk value export
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-12
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace NAV
+{
+/// @brief Selection of static and dynamic data columns, which are exported together with NodeData::writeValues
+///
+/// The values are written in the order of the static indices, followed by the dynamic descriptors.
+/// For every dynamic descriptor the selection remembers the position where it was found in the last observation,
+/// so that observations with a stable layout do not need to search the descriptor again.
+/// The positions are only hints, which are validated before use. They are stored as relaxed atomics,
+/// so that the same selection can be used on observations in several threads at once.
+class ColumnSelection
+{
+  public:
+    /// Value of a dynamic hint, if the position is not known yet
+    static constexpr size_t NO_HINT = std::numeric_limits<size_t>::max();
+
+    /// @brief Default constructor (selects nothing)
+    ColumnSelection() = default;
+
+    /// @brief Constructor
+    /// @param[in] staticIndices Indices of the selected static data descriptors
+    /// @param[in] dynamicDescriptors Selected dynamic data descriptors
+    explicit ColumnSelection(std::vector<size_t> staticIndices, std::vector<std::string> dynamicDescriptors = {})
+        : _staticIndices(std::move(staticIndices)),
+          _dynamicDescriptors(std::move(dynamicDescriptors)),
+          _dynamicHints(_dynamicDescriptors.size())
+    {
+        for (auto& hint : _dynamicHints) { hint.store(NO_HINT, std::memory_order_relaxed); }
+    }
+
+    /// @brief Destructor
+    ~ColumnSelection() = default;
+    /// @brief Copy constructor
+    ColumnSelection(const ColumnSelection& other)
+        : _staticIndices(other._staticIndices),
+          _dynamicDescriptors(other._dynamicDescriptors),
+          _dynamicHints(other._dynamicHints.size())
+    {
+        for (size_t k = 0; k < _dynamicHints.size(); ++k)
+        {
+            _dynamicHints[k].store(other._dynamicHints[k].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+    /// @brief Move constructor
+    ColumnSelection(ColumnSelection&&) noexcept = default;
+    /// @brief Copy assignment operator
+    ColumnSelection& operator=(const ColumnSelection& other)
+    {
+        if (this != &other) { *this = ColumnSelection(other); }
+        return *this;
+    }
+    /// @brief Move assignment operator
+    ColumnSelection& operator=(ColumnSelection&&) noexcept = default;
+
+    /// @brief Selects the static data descriptors in the range [begin, end)
+    /// @param[in] begin Index of the first descriptor
+    /// @param[in] end Index after the last descriptor
+    [[nodiscard]] static ColumnSelection StaticRange(size_t begin, size_t end)
+    {
+        std::vector<size_t> indices(end > begin ? end - begin : 0);
+        std::iota(indices.begin(), indices.end(), begin);
+        return ColumnSelection(std::move(indices));
+    }
+
+    /// @brief Amount of selected columns
+    [[nodiscard]] size_t size() const { return _staticIndices.size() + _dynamicDescriptors.size(); }
+
+    /// @brief Checks whether no column is selected
+    [[nodiscard]] bool empty() const { return size() == 0; }
+
+    /// @brief Indices of the selected static data descriptors
+    [[nodiscard]] const std::vector<size_t>& staticIndices() const { return _staticIndices; }
+
+    /// @brief Selected dynamic data descriptors
+    [[nodiscard]] const std::vector<std::string>& dynamicDescriptors() const { return _dynamicDescriptors; }
+
+    /// @brief Position of the dynamic descriptor in the last observation, which exported it
+    /// @param[in] k Index of the dynamic descriptor in this selection
+    /// @return Reference to the hint, which can be updated by the observations (relaxed ordering is sufficient)
+    [[nodiscard]] std::atomic<size_t>& dynamicHint(size_t k) const { return _dynamicHints.at(k); }
+
+  private:
+    /// Indices of the selected static data descriptors
+    std::vector<size_t> _staticIndices;
+    /// Selected dynamic data descriptors
+    std::vector<std::string> _dynamicDescriptors;
+    /// Position of the dynamic descriptors in the last observation
+    mutable std::vector<std::atomic<size_t>> _dynamicHints;
+};
+
+} // namespace NAV
@@ -24,6 +24,7 @@
 #include "Navigation/GNSS/Core/SatelliteIdentifier.hpp"
 #include "Navigation/GNSS/Core/Code.hpp"
 #include "util/Assert.h"
+#include "util/Container/LookupIndex.hpp"
 
 namespace NAV
 {
@@ -159,6 +160,9 @@ class GnssObs : public NodeData
     }
 
     /// @brief Satellite observations
+    ///
+    /// The lookups by signal id use a hash index, which is kept up to date when inserting with operator().
+    /// Elements can still be added or erased directly, the index is then rebuilt on the next lookup.
     std::vector<ObservationData> data;
 
     /// @brief Access or insert the satellite data
@@ -166,16 +170,14 @@ class GnssObs : public NodeData
     /// @return The satellite data
     SatelliteData& satData(const SatId& satId)
     {
-        auto iter = std::find_if(_satData.begin(), _satData.end(), [&satId](const SatelliteData& sat) {
-            return sat.satId == satId;
-        });
-        if (iter != _satData.end())
+        if (auto idx = _satDataIndex.find(_satData, satId, &SatelliteData::satId))
         {
-            return *iter;
+            return _satData[*idx];
         }
 
         _satData.emplace_back();
         _satData.back().satId = satId;
+        _satDataIndex.push_back(satId, _satData.size());
         return _satData.back();
     }
 
@@ -184,12 +186,9 @@ class GnssObs : public NodeData
     /// @return The satellite data if in the list
     [[nodiscard]] std::optional<std::reference_wrapper<const SatelliteData>> satData(const SatId& satId) const
     {
-        auto iter = std::find_if(_satData.begin(), _satData.end(), [&satId](const SatelliteData& sat) {
-            return sat.satId == satId;
-        });
-        if (iter != _satData.end())
+        if (auto idx = _satDataIndex.find(_satData, satId, &SatelliteData::satId))
         {
-            return *iter;
+            return _satData[*idx];
         }
         return std::nullopt;
     }
@@ -199,10 +198,7 @@ class GnssObs : public NodeData
     /// @return True if the element exists
     [[nodiscard]] bool contains(const SatSigId& satSigId) const
     {
-        auto iter = std::find_if(data.begin(), data.end(), [&satSigId](const ObservationData& idData) {
-            return idData.satSigId == satSigId;
-        });
-        return iter != data.end();
+        return _dataIndex.find(data, satSigId, &ObservationData::satSigId).has_value();
     }
 
     /// @brief Return the element with the identifier or a newly constructed one if it did not exist
@@ -210,15 +206,13 @@ class GnssObs : public NodeData
     /// @return The element found in the observations or a newly constructed one
     ObservationData& operator()(const SatSigId& satSigId)
     {
-        auto iter = std::find_if(data.begin(), data.end(), [&satSigId](const ObservationData& idData) {
-            return idData.satSigId == satSigId;
-        });
-        if (iter != data.end())
+        if (auto idx = _dataIndex.find(data, satSigId, &ObservationData::satSigId))
         {
-            return *iter;
+            return data[*idx];
         }
 
         data.emplace_back(satSigId);
+        _dataIndex.push_back(satSigId, data.size());
         return data.back();
     }
 
@@ -227,13 +221,9 @@ class GnssObs : public NodeData
     /// @return The element found in the observations
     [[nodiscard]] std::optional<std::reference_wrapper<const ObservationData>> operator()(const SatSigId& satSigId) const
     {
-        auto iter = std::find_if(data.begin(), data.end(), [&satSigId](const ObservationData& idData) {
-            return idData.satSigId == satSigId;
-        });
-
-        if (iter != data.end())
+        if (auto idx = _dataIndex.find(data, satSigId, &ObservationData::satSigId))
         {
-            return *iter;
+            return data[*idx];
         }
         return std::nullopt;
     }
@@ -344,6 +334,11 @@ class GnssObs : public NodeData
   private:
     /// @brief Useful information of the satellites
     std::vector<SatelliteData> _satData;
+
+    /// Index of the observations in 'data' by signal id
+    LookupIndex<SatSigId> _dataIndex;
+    /// Index of the satellite data by satellite id
+    LookupIndex<SatId> _satDataIndex;
 };
 
 /// @brief Converts the enum to a string
@@ -13,30 +13,159 @@
 
 #pragma once
 
-#include <vector>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <variant>
+#include <vector>
+
+#include "NodeData/NodeData.hpp"
 
 namespace NAV
 {
-/// CSV Data container
-class CsvData
+/// @brief CSV Data container
+///
+/// The cells are stored column-wise. Every column keeps its numbers in a contiguous array.
+/// Text is only stored for columns which contain cells that cannot be converted to a number.
+class CsvData : public NodeData
 {
   public:
     /// @brief Returns the type of the data class
     /// @return The data type
     [[nodiscard]] static std::string type() { return "CsvData"; }
 
+    /// @brief Returns the parent types of the data class
+    /// @return The parent data types
+    [[nodiscard]] static std::vector<std::string> parentTypes() { return { NodeData::type() }; }
+
     /// CSV Elements (number or if not convertible to number as std::string)
     using CsvElement = std::variant<double, std::string>;
 
-    /// CSV Line with splitted entries
-    using CsvLine = std::vector<CsvElement>;
-
     /// Data description
     std::vector<std::string> description;
-    /// Data container
-    std::vector<CsvLine> lines;
+
+    /// @brief Amount of data lines
+    [[nodiscard]] size_t rows() const { return _rows; }
+
+    /// @brief Amount of columns
+    [[nodiscard]] size_t cols() const { return _columns.size(); }
+
+    /// @brief Returns the index of the column with the description
+    /// @param[in] desc Description of the column
+    [[nodiscard]] std::optional<size_t> columnIndex(std::string_view desc) const
+    {
+        auto iter = std::find(description.begin(), description.end(), desc);
+        if (iter == description.end()) { return std::nullopt; }
+        return static_cast<size_t>(iter - description.begin());
+    }
+
+    /// @brief Numbers of a column. Cells which are missing or not convertible to a number are NaN.
+    /// @param[in] col Column index
+    [[nodiscard]] const std::vector<double>& column(size_t col) const { return _columns.at(col).values; }
+
+    /// @brief Number in the cell or NaN if missing or not convertible to a number
+    /// @param[in] row Row index
+    /// @param[in] col Column index
+    [[nodiscard]] double value(size_t row, size_t col) const
+    {
+        return col < _columns.size() ? _columns[col].values.at(row) : std::nan("");
+    }
+
+    /// @brief Element in the cell (number or if not convertible to number as std::string)
+    /// @param[in] row Row index
+    /// @param[in] col Column index
+    [[nodiscard]] CsvElement at(size_t row, size_t col) const
+    {
+        if (col < _columns.size() && !_columns[col].text.empty() && !_columns[col].text.at(row).empty())
+        {
+            return _columns[col].text[row];
+        }
+        return value(row, col);
+    }
+
+    /// @brief Reserves memory for the amount of rows in all columns
+    /// @param[in] rows Amount of rows
+    void reserve(size_t rows)
+    {
+        for (auto& column : _columns) { column.values.reserve(rows); }
+    }
+
+    /// @brief Appends a line and converts its cells into numbers where possible
+    /// @param[in] cells Cells of the line
+    void addLine(const std::vector<std::string>& cells)
+    {
+        while (_columns.size() < cells.size())
+        {
+            auto& column = _columns.emplace_back();
+            column.values.reserve(_rows + 1);
+            column.values.resize(_rows, std::nan(""));
+        }
+        for (size_t c = 0; c < _columns.size(); c++)
+        {
+            auto& column = _columns[c];
+            if (c >= cells.size())
+            {
+                column.values.push_back(std::nan(""));
+                if (!column.text.empty()) { column.text.emplace_back(); }
+                continue;
+            }
+            if (auto number = toNumber(cells[c]))
+            {
+                column.values.push_back(*number);
+                if (!column.text.empty()) { column.text.emplace_back(); }
+            }
+            else
+            {
+                column.values.push_back(std::nan(""));
+                if (column.text.empty()) { column.text.resize(_rows); }
+                column.text.push_back(cells[c]);
+            }
+        }
+        _rows++;
+    }
+
+    /// @brief Removes all lines and the description
+    void clear()
+    {
+        description.clear();
+        _columns.clear();
+        _rows = 0;
+    }
+
+    /// @brief Converts a cell into a number. Like std::stod, leading whitespace is skipped and trailing characters are ignored.
+    /// @param[in] cell Text of the cell
+    /// @return The number or nullopt if the cell does not start with a number
+    [[nodiscard]] static std::optional<double> toNumber(std::string_view cell)
+    {
+        auto start = cell.find_first_not_of(" \t\n\v\f\r");
+        if (start == std::string_view::npos) { return std::nullopt; }
+        cell.remove_prefix(start);
+        if (cell.starts_with('+')) { cell.remove_prefix(1); }
+
+        double number{};
+        auto [ptr, ec] = std::from_chars(cell.data(), cell.data() + cell.size(), number);
+        if (ec != std::errc{} || ptr == cell.data()) { return std::nullopt; }
+        return number;
+    }
+
+  private:
+    /// @brief Column of the CSV data
+    struct Column
+    {
+        /// Numbers of the cells. NaN if missing or not convertible to a number.
+        std::vector<double> values;
+        /// Text of the cells which are not convertible to a number (empty for numbers). Only filled if the column has such a cell.
+        std::vector<std::string> text;
+    };
+
+    /// Columns of the data
+    std::vector<Column> _columns;
+
+    /// Amount of data lines
+    size_t _rows = 0;
 };
 
 } // namespace NAV
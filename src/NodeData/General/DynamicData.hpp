@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 #include <string>
@@ -72,6 +73,26 @@ class DynamicData : public NodeData
         return std::nullopt;
     }
 
+    /// @brief Writes the values of the selected dynamic columns into the output buffer
+    /// @param[out] out Output buffer with at least selection.dynamicDescriptors().size() elements. Values not in the observation are set to NaN.
+    /// @param[in] selection Selected columns
+    void writeDynamicValues(std::span<double> out, const ColumnSelection& selection) const override
+    {
+        const auto& descriptors = selection.dynamicDescriptors();
+        for (size_t k = 0; k < descriptors.size(); ++k)
+        {
+            auto& hint = selection.dynamicHint(k);
+            size_t pos = hint.load(std::memory_order_relaxed);
+            if (pos >= data.size() || data[pos].description != descriptors[k])
+            {
+                auto iter = std::find_if(data.begin(), data.end(), [&](const Data& d) { return d.description == descriptors[k]; });
+                pos = iter != data.end() ? static_cast<size_t>(iter - data.begin()) : ColumnSelection::NO_HINT;
+                hint.store(pos, std::memory_order_relaxed);
+            }
+            out[k] = pos != ColumnSelection::NO_HINT ? data[pos].value : std::nan("");
+        }
+    }
+
     /// @brief Returns a vector of data descriptors and values for the dynamic data
     [[nodiscard]] std::vector<std::pair<std::string, double>> getDynamicData() const override
     {
@@ -63,6 +63,11 @@ class ImuObsWDelta : public ImuObs
     /// @brief Get the amount of descriptors
     [[nodiscard]] size_t staticDescriptorCount() const override { return GetStaticDescriptorCount(); }
 
+    /// @brief Writes the values of all selected columns into the output buffer
+    /// @param[out] out Output buffer with at least selection.size() elements. Values not in the observation are set to NaN.
+    /// @param[in] selection Selected columns
+    void writeValues(std::span<double> out, const ColumnSelection& selection) const override { WriteValues(*this, out, selection); }
+
     /// @brief Get the value at the index
     /// @param idx Index corresponding to data descriptor order
     /// @return Value if in the observation
@@ -14,6 +14,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "NodeData/NodeData.hpp"
 #include "NodeData/IMU/ImuPos.hpp"
@@ -277,6 +278,11 @@ class VectorNavBinaryOutput : public NodeData
     /// @brief Get the amount of descriptors
     [[nodiscard]] size_t staticDescriptorCount() const override { return GetStaticDescriptorCount(); }
 
+    /// @brief Writes the values of all selected columns into the output buffer
+    /// @param[out] out Output buffer with at least selection.size() elements. Values not in the observation are set to NaN.
+    /// @param[in] selection Selected columns
+    void writeValues(std::span<double> out, const ColumnSelection& selection) const override { WriteValues(*this, out, selection); }
+
     /// @brief Get the value at the index
     /// @param idx Index corresponding to data descriptor order
     /// @return Value if in the observation
@@ -912,23 +918,54 @@ class VectorNavBinaryOutput : public NodeData
         return std::nullopt;
     }
 
+    /// @brief Non-owning read-only view on the output groups of an observation
+    ///
+    /// Absent groups are represented by a nullptr, so converters can pass the groups around without copying them.
+    struct View
+    {
+        const InsTime& insTime;                                     ///< Time at which the message was received
+        const ImuPos& imuPos;                                       ///< Position and rotation information for conversion from platform to body frame
+        const vendor::vectornav::TimeOutputs* timeOutputs;         ///< Binary Group 2 – Time Outputs
+        const vendor::vectornav::ImuOutputs* imuOutputs;           ///< Binary Group 3 – IMU Outputs
+        const vendor::vectornav::GnssOutputs* gnss1Outputs;        ///< Binary Group 4 – GNSS1 Outputs
+        const vendor::vectornav::AttitudeOutputs* attitudeOutputs; ///< Binary Group 5 – Attitude Outputs
+        const vendor::vectornav::InsOutputs* insOutputs;           ///< Binary Group 6 – INS Outputs
+        const vendor::vectornav::GnssOutputs* gnss2Outputs;        ///< Binary Group 7 – GNSS2 Outputs
+    };
+
+    /// @brief Returns a view on the output groups of this observation
+    /// @attention The view is only valid as long as this observation lives and its groups are not reset
+    [[nodiscard]] View view() const
+    {
+        return View{ insTime, imuPos,
+                     timeOutputs ? &*timeOutputs : nullptr,
+                     imuOutputs ? &*imuOutputs : nullptr,
+                     gnss1Outputs ? &*gnss1Outputs : nullptr,
+                     attitudeOutputs ? &*attitudeOutputs : nullptr,
+                     insOutputs ? &*insOutputs : nullptr,
+                     gnss2Outputs ? &*gnss2Outputs : nullptr };
+    }
+
+    // The output groups are stored inline, so that an observation with all groups only needs a single allocation.
+    // A group is present, if it was contained in the message.
+
     /// @brief Binary Group 2 – Time Outputs
-    std::shared_ptr<vendor::vectornav::TimeOutputs> timeOutputs = nullptr;
+    std::optional<vendor::vectornav::TimeOutputs> timeOutputs;
 
     /// @brief Binary Group 3 – IMU Outputs
-    std::shared_ptr<vendor::vectornav::ImuOutputs> imuOutputs = nullptr;
+    std::optional<vendor::vectornav::ImuOutputs> imuOutputs;
 
     /// @brief Binary Group 4 – GNSS1 Outputs
-    std::shared_ptr<vendor::vectornav::GnssOutputs> gnss1Outputs = nullptr;
+    std::optional<vendor::vectornav::GnssOutputs> gnss1Outputs;
 
     /// @brief Binary Group 5 – Attitude Outputs
-    std::shared_ptr<vendor::vectornav::AttitudeOutputs> attitudeOutputs = nullptr;
+    std::optional<vendor::vectornav::AttitudeOutputs> attitudeOutputs;
 
     /// @brief Binary Group 6 – INS Outputs
-    std::shared_ptr<vendor::vectornav::InsOutputs> insOutputs = nullptr;
+    std::optional<vendor::vectornav::InsOutputs> insOutputs;
 
     /// @brief Binary Group 7 – GNSS2 Outputs
-    std::shared_ptr<vendor::vectornav::GnssOutputs> gnss2Outputs = nullptr;
+    std::optional<vendor::vectornav::GnssOutputs> gnss2Outputs;
 
     /// Position and rotation information for conversion from platform to body frame
     const ImuPos& imuPos;
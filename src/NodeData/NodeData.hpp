@@ -13,10 +13,13 @@
 
 #pragma once
 
+#include <cmath>
+#include <span>
 #include <string>
 #include <vector>
 #include <optional>
 
+#include "NodeData/ColumnSelection.hpp"
 #include "Navigation/Time/InsTime.hpp"
 #include "util/Assert.h"
 
@@ -85,6 +88,35 @@ class NodeData
     /// @brief Returns a vector of data descriptors and values for the dynamic data
     [[nodiscard]] virtual std::vector<std::pair<std::string, double>> getDynamicData() const { return {}; }
 
+    /// @brief Writes the values of all selected columns into the output buffer
+    /// @param[out] out Output buffer with at least selection.size() elements. Values not in the observation are set to NaN.
+    /// @param[in] selection Selected columns
+    ///
+    /// Consumers should prefer this over getValueAt, as all values are extracted with a single virtual call
+    virtual void writeValues(std::span<double> out, const ColumnSelection& selection) const
+    {
+        INS_ASSERT_USER_ERROR(out.size() >= selection.size(), "The output buffer has to be large enough for all selected columns");
+
+        const auto& indices = selection.staticIndices();
+        for (size_t k = 0; k < indices.size(); ++k)
+        {
+            out[k] = getValueAtOrNaN(indices[k]);
+        }
+        writeDynamicValues(out.subspan(indices.size()), selection);
+    }
+
+    /// @brief Writes the values of the selected dynamic columns into the output buffer
+    /// @param[out] out Output buffer with at least selection.dynamicDescriptors().size() elements. Values not in the observation are set to NaN.
+    /// @param[in] selection Selected columns
+    virtual void writeDynamicValues(std::span<double> out, const ColumnSelection& selection) const
+    {
+        const auto& descriptors = selection.dynamicDescriptors();
+        for (size_t k = 0; k < descriptors.size(); ++k)
+        {
+            out[k] = getDynamicDataAt(descriptors[k]).value_or(std::nan(""));
+        }
+    }
+
     /// @brief Shows a GUI tooltip to look into details of the observation
     /// @param[in] detailView Flag to show the detailed view
     /// @param[in] firstOpen Flag whether the tooltip is opened once
@@ -100,6 +132,25 @@ class NodeData
     InsTime insTime;
 
   protected:
+    /// @brief Implementation of writeValues for the derived types
+    /// @param[in] obs Observation to export
+    /// @param[out] out Output buffer with at least selection.size() elements
+    /// @param[in] selection Selected columns
+    ///
+    /// The static values are requested with a non-virtual call to T::getValueAt, so that the compiler can inline the descriptor switch.
+    template<typename T>
+    static void WriteValues(const T& obs, std::span<double> out, const ColumnSelection& selection)
+    {
+        INS_ASSERT_USER_ERROR(out.size() >= selection.size(), "The output buffer has to be large enough for all selected columns");
+
+        const auto& indices = selection.staticIndices();
+        for (size_t k = 0; k < indices.size(); ++k)
+        {
+            out[k] = obs.T::getValueAt(indices[k]).value_or(std::nan(""));
+        }
+        obs.writeDynamicValues(out.subspan(indices.size()), selection);
+    }
+
     /// @brief List of events
     std::vector<std::string> _events;
 };
@@ -0,0 +1,579 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "NodeDataSerializer.hpp"
+
+#include <cstring>
+#include <optional>
+#include <type_traits>
+#include <typeinfo>
+
+#include "util/Logger.hpp"
+
+#include "NodeData/General/DynamicData.hpp"
+#include "NodeData/General/StringObs.hpp"
+#include "NodeData/IMU/ImuObs.hpp"
+#include "NodeData/IMU/ImuObsWDelta.hpp"
+#include "NodeData/State/Pos.hpp"
+#include "NodeData/State/PosVel.hpp"
+#include "NodeData/State/PosVelAtt.hpp"
+
+namespace NAV::NodeDataSerializer
+{
+namespace
+{
+
+/// @brief Appends values to a message
+class Writer
+{
+  public:
+    /// @brief Appends a trivially copyable value
+    template<typename T>
+    void writeValue(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        auto offset = _buffer.size();
+        _buffer.resize(offset + sizeof(T));
+        std::memcpy(_buffer.data() + offset, &value, sizeof(T));
+    }
+
+    /// @brief Appends a string with its length
+    void writeString(const std::string& str)
+    {
+        writeValue(static_cast<uint32_t>(str.size()));
+        _buffer.insert(_buffer.end(), str.begin(), str.end());
+    }
+
+    /// @brief Appends the coefficients of a fixed size matrix
+    template<typename Derived>
+    void writeMatrix(const Eigen::MatrixBase<Derived>& matrix)
+    {
+        for (Eigen::Index c = 0; c < matrix.cols(); c++)
+        {
+            for (Eigen::Index r = 0; r < matrix.rows(); r++)
+            {
+                writeValue(static_cast<double>(matrix(r, c)));
+            }
+        }
+    }
+
+    /// @brief Appends the coefficients of a quaternion
+    void writeQuaternion(const Eigen::Quaterniond& quat) { writeMatrix(quat.coeffs()); }
+
+    /// @brief Appends an optional matrix with a flag whether it has a value
+    template<typename T>
+    void writeOptionalMatrix(const std::optional<T>& matrix)
+    {
+        writeValue(matrix.has_value());
+        if (matrix) { writeMatrix(static_cast<const Eigen::Vector3d&>(*matrix)); }
+    }
+
+    /// @brief Appends the time. The fraction of the day is split into two doubles to keep the precision of the long double.
+    void writeTime(const InsTime& insTime)
+    {
+        writeValue(insTime.empty());
+        if (insTime.empty()) { return; }
+
+        auto mjd = insTime.toMJD();
+        auto fracHigh = static_cast<double>(mjd.mjd_frac);
+        auto fracLow = static_cast<double>(mjd.mjd_frac - static_cast<long double>(fracHigh));
+        writeValue(mjd.mjd_day);
+        writeValue(fracHigh);
+        writeValue(fracLow);
+    }
+
+    /// @brief Returns the message and leaves the writer empty
+    [[nodiscard]] std::vector<uint8_t> release() { return std::move(_buffer); }
+
+  private:
+    /// Message buffer
+    std::vector<uint8_t> _buffer;
+};
+
+/// @brief Reads values from a message
+class Reader
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] buffer Message to read
+    explicit Reader(const std::vector<uint8_t>& buffer)
+        : _buffer(buffer) {}
+
+    /// @brief Reads a trivially copyable value
+    template<typename T>
+    [[nodiscard]] T readValue()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value{};
+        if (!available(sizeof(T))) { return value; }
+        std::memcpy(&value, _buffer.data() + _pos, sizeof(T));
+        _pos += sizeof(T);
+        return value;
+    }
+
+    /// @brief Reads a string with its length
+    [[nodiscard]] std::string readString()
+    {
+        auto size = readValue<uint32_t>();
+        if (!available(size)) { return {}; }
+        std::string str(reinterpret_cast<const char*>(_buffer.data() + _pos), size); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        _pos += size;
+        return str;
+    }
+
+    /// @brief Reads the coefficients of a fixed size matrix
+    template<typename Matrix>
+    [[nodiscard]] Matrix readMatrix()
+    {
+        Matrix matrix;
+        for (Eigen::Index c = 0; c < matrix.cols(); c++)
+        {
+            for (Eigen::Index r = 0; r < matrix.rows(); r++)
+            {
+                matrix(r, c) = readValue<double>();
+            }
+        }
+        return matrix;
+    }
+
+    /// @brief Reads the coefficients of a quaternion
+    [[nodiscard]] Eigen::Quaterniond readQuaternion()
+    {
+        Eigen::Quaterniond quat;
+        quat.coeffs() = readMatrix<Eigen::Vector4d>();
+        return quat;
+    }
+
+    /// @brief Reads an optional vector with a flag whether it has a value
+    [[nodiscard]] std::optional<Eigen::Vector3d> readOptionalVector()
+    {
+        if (!readValue<bool>()) { return std::nullopt; }
+        return readMatrix<Eigen::Vector3d>();
+    }
+
+    /// @brief Reads the time
+    [[nodiscard]] InsTime readTime()
+    {
+        if (readValue<bool>()) { return {}; }
+
+        auto mjdDay = readValue<int32_t>();
+        auto fracHigh = readValue<double>();
+        auto fracLow = readValue<double>();
+        return InsTime(InsTime_MJD(mjdDay, static_cast<long double>(fracHigh) + static_cast<long double>(fracLow)));
+    }
+
+    /// @brief Reads the amount of elements which follow
+    /// @param[in] minElementSize Minimum size of an element in [bytes]
+    /// @return The amount or 0 if the elements can not fit into the remaining message
+    [[nodiscard]] uint32_t readCount(size_t minElementSize)
+    {
+        auto count = readValue<uint32_t>();
+        if (!available(static_cast<size_t>(count) * minElementSize)) { return 0; }
+        return count;
+    }
+
+    /// @brief Whether all values could be read so far
+    [[nodiscard]] bool valid() const { return _valid; }
+
+  private:
+    /// @brief Checks whether the amount of bytes is still available in the buffer
+    /// @param[in] size Amount of bytes
+    bool available(size_t size)
+    {
+        if (size > _buffer.size() - _pos) { _valid = false; }
+        return _valid;
+    }
+
+    /// Message buffer
+    const std::vector<uint8_t>& _buffer;
+    /// Current read position
+    size_t _pos = 0;
+    /// Flag whether all values could be read so far
+    bool _valid = true;
+};
+
+// ###########################################################################################################
+//                                                 Serialize
+// ###########################################################################################################
+
+void write(Writer& writer, const Pos& pos)
+{
+    writer.writeMatrix(pos.e_position());
+
+    auto covariance = pos.e_CovarianceMatrix();
+    writer.writeValue(covariance.has_value());
+    if (covariance)
+    {
+        writer.writeMatrix(covariance->get());
+    }
+    writer.writeOptionalMatrix(pos.e_positionStdev());
+}
+
+void write(Writer& writer, const PosVel& posVel)
+{
+    write(writer, static_cast<const Pos&>(posVel));
+
+    writer.writeMatrix(posVel.e_velocity());
+
+    auto covariance = posVel.e_CovarianceMatrix();
+    writer.writeValue(covariance.has_value());
+    if (covariance)
+    {
+        writer.writeMatrix(covariance->get());
+    }
+    writer.writeOptionalMatrix(posVel.e_velocityStdev());
+}
+
+void write(Writer& writer, const PosVelAtt& posVelAtt)
+{
+    write(writer, static_cast<const PosVel&>(posVelAtt));
+
+    writer.writeQuaternion(posVelAtt.e_Quat_b());
+}
+
+void write(Writer& writer, const ImuObs& imuObs)
+{
+    writer.writeMatrix(imuObs.imuPos.b_positionAccel());
+    writer.writeMatrix(imuObs.imuPos.b_positionGyro());
+    writer.writeMatrix(imuObs.imuPos.b_positionMag());
+    writer.writeQuaternion(imuObs.imuPos.b_quatAccel_p());
+    writer.writeQuaternion(imuObs.imuPos.b_quatGyro_p());
+    writer.writeQuaternion(imuObs.imuPos.b_quatMag_p());
+
+    writer.writeValue(imuObs.timeSinceStartup.has_value());
+    if (imuObs.timeSinceStartup) { writer.writeValue(*imuObs.timeSinceStartup); }
+    writer.writeMatrix(imuObs.p_acceleration);
+    writer.writeMatrix(imuObs.p_angularRate);
+    writer.writeOptionalMatrix(imuObs.p_magneticField);
+    writer.writeValue(imuObs.temperature.has_value());
+    if (imuObs.temperature) { writer.writeValue(*imuObs.temperature); }
+}
+
+void write(Writer& writer, const ImuObsWDelta& imuObs)
+{
+    write(writer, static_cast<const ImuObs&>(imuObs));
+
+    writer.writeValue(imuObs.dtime);
+    writer.writeMatrix(imuObs.dtheta);
+    writer.writeMatrix(imuObs.dvel);
+}
+
+void write(Writer& writer, const StringObs& stringObs)
+{
+    writer.writeString(stringObs.data);
+}
+
+void write(Writer& writer, const DynamicData& dynamicData)
+{
+    writer.writeValue(static_cast<uint32_t>(dynamicData.data.size()));
+    for (const auto& data : dynamicData.data)
+    {
+        writer.writeString(data.description);
+        writer.writeValue(data.value);
+    }
+}
+
+/// @brief Writes all static and dynamic data of an unsupported type in the DynamicData format
+void writeDescriptors(Writer& writer, const NodeData& obs)
+{
+    std::vector<std::pair<std::string, double>> values;
+    auto descriptors = obs.staticDataDescriptors();
+    for (size_t i = 0; i < descriptors.size(); i++)
+    {
+        if (auto value = obs.getValueAt(i)) { values.emplace_back(descriptors.at(i), *value); }
+    }
+    auto dynamicValues = obs.getDynamicData();
+    values.insert(values.end(), dynamicValues.begin(), dynamicValues.end());
+
+    writer.writeValue(static_cast<uint32_t>(values.size()));
+    for (const auto& [description, value] : values)
+    {
+        writer.writeString(description);
+        writer.writeValue(value);
+    }
+}
+
+/// @brief Writes the header and the members of the observation
+template<typename T>
+std::vector<uint8_t> serialize(const NodeData& obs, const T& data)
+{
+    Writer writer;
+    writer.writeValue(MessageType::Data);
+    writer.writeString(T::type());
+    writer.writeTime(obs.insTime);
+    writer.writeValue(static_cast<uint32_t>(obs.events().size()));
+    for (const auto& event : obs.events())
+    {
+        writer.writeString(event);
+    }
+    write(writer, data);
+    return writer.release();
+}
+
+// ###########################################################################################################
+//                                                Deserialize
+// ###########################################################################################################
+
+void read(Reader& reader, Pos& pos)
+{
+    auto e_position = reader.readMatrix<Eigen::Vector3d>();
+    std::optional<Eigen::Matrix3d> e_covariance;
+    if (reader.readValue<bool>()) { e_covariance = reader.readMatrix<Eigen::Matrix3d>(); }
+    auto e_positionStdev = reader.readOptionalVector();
+
+    if (e_covariance)
+    {
+        pos.setPositionAndStdDev_e(e_position, *e_covariance);
+        pos.setPosCovarianceMatrix_e(*e_covariance);
+    }
+    else if (e_positionStdev) // Correlations are not transported, so the local frame standard deviation is approximated
+    {
+        pos.setPositionAndStdDev_e(e_position, e_positionStdev->cwiseAbs2().asDiagonal().toDenseMatrix());
+    }
+    else
+    {
+        pos.setPosition_e(e_position);
+    }
+}
+
+void read(Reader& reader, PosVel& posVel)
+{
+    read(reader, static_cast<Pos&>(posVel));
+
+    auto e_velocity = reader.readMatrix<Eigen::Vector3d>();
+    std::optional<Eigen::Matrix<double, 6, 6>> e_covariance;
+    if (reader.readValue<bool>()) { e_covariance = reader.readMatrix<Eigen::Matrix<double, 6, 6>>(); }
+    auto e_velocityStdev = reader.readOptionalVector();
+
+    if (e_covariance)
+    {
+        posVel.setVelocityAndStdDev_e(e_velocity, e_covariance->bottomRightCorner<3, 3>());
+        posVel.setPosVelCovarianceMatrix_e(*e_covariance);
+    }
+    else if (e_velocityStdev)
+    {
+        posVel.setVelocityAndStdDev_e(e_velocity, e_velocityStdev->cwiseAbs2().asDiagonal().toDenseMatrix());
+    }
+    else
+    {
+        posVel.setVelocity_e(e_velocity);
+    }
+}
+
+void read(Reader& reader, PosVelAtt& posVelAtt)
+{
+    read(reader, static_cast<PosVel&>(posVelAtt));
+
+    posVelAtt.setAttitude_e_Quat_b(reader.readQuaternion());
+}
+
+/// @brief Reads the IMU position
+/// @param[in, out] reader Message reader
+/// @param[in, out] imuPositions IMU positions received so far. A new one is appended if it differs from the last one.
+/// @return The IMU position the observation refers to
+const ImuPos& readImuPos(Reader& reader, std::deque<ImuPos>& imuPositions)
+{
+    json j{
+        { "b_positionAccel", reader.readMatrix<Eigen::Vector3d>() },
+        { "b_positionGyro", reader.readMatrix<Eigen::Vector3d>() },
+        { "b_positionMag", reader.readMatrix<Eigen::Vector3d>() },
+        { "b_quatAccel_p", reader.readMatrix<Eigen::Vector4d>() },
+        { "b_quatGyro_p", reader.readMatrix<Eigen::Vector4d>() },
+        { "b_quatMag_p", reader.readMatrix<Eigen::Vector4d>() },
+    };
+    if (imuPositions.empty() || j != json(imuPositions.back())) // Observations in the flow refer to the IMU position, so it is never modified
+    {
+        from_json(j, imuPositions.emplace_back());
+    }
+    return imuPositions.back();
+}
+
+void read(Reader& reader, ImuObs& imuObs)
+{
+    if (reader.readValue<bool>()) { imuObs.timeSinceStartup = reader.readValue<uint64_t>(); }
+    imuObs.p_acceleration = reader.readMatrix<Eigen::Vector3d>();
+    imuObs.p_angularRate = reader.readMatrix<Eigen::Vector3d>();
+    imuObs.p_magneticField = reader.readOptionalVector();
+    imuObs.temperature = reader.readValue<bool>() ? std::optional<double>(reader.readValue<double>()) : std::nullopt;
+}
+
+void read(Reader& reader, ImuObsWDelta& imuObs)
+{
+    read(reader, static_cast<ImuObs&>(imuObs));
+
+    imuObs.dtime = reader.readValue<double>();
+    imuObs.dtheta = reader.readMatrix<Eigen::Vector3d>();
+    imuObs.dvel = reader.readMatrix<Eigen::Vector3d>();
+}
+
+void read(Reader& reader, StringObs& stringObs)
+{
+    stringObs.data = reader.readString();
+}
+
+void read(Reader& reader, DynamicData& dynamicData)
+{
+    auto count = reader.readCount(sizeof(uint32_t) + sizeof(double));
+    dynamicData.data.reserve(count);
+    for (uint32_t i = 0; i < count && reader.valid(); i++)
+    {
+        auto description = reader.readString();
+        auto value = reader.readValue<double>();
+        dynamicData.data.push_back(DynamicData::Data{ description, value, {} });
+    }
+}
+
+} // namespace
+
+const std::vector<std::string>& SupportedTypes()
+{
+    static const std::vector<std::string> types = {
+        Pos::type(),
+        PosVel::type(),
+        PosVelAtt::type(),
+        ImuObs::type(),
+        ImuObsWDelta::type(),
+        StringObs::type(),
+        DynamicData::type(),
+    };
+    return types;
+}
+
+MessageType GetMessageType(const std::vector<uint8_t>& buffer)
+{
+    Reader reader(buffer);
+    auto type = reader.readValue<MessageType>();
+    if (!reader.valid() || type > MessageType::Invalid) { return MessageType::Invalid; }
+    return type;
+}
+
+std::vector<uint8_t> Serialize(const NodeData& obs)
+{
+    // Only the exact types, as derived types would lose their additional members
+    const auto& type = typeid(obs);
+    if (type == typeid(ImuObsWDelta)) { return serialize(obs, static_cast<const ImuObsWDelta&>(obs)); }
+    if (type == typeid(ImuObs)) { return serialize(obs, static_cast<const ImuObs&>(obs)); }
+    if (type == typeid(PosVelAtt)) { return serialize(obs, static_cast<const PosVelAtt&>(obs)); }
+    if (type == typeid(PosVel)) { return serialize(obs, static_cast<const PosVel&>(obs)); }
+    if (type == typeid(Pos)) { return serialize(obs, static_cast<const Pos&>(obs)); }
+    if (type == typeid(StringObs)) { return serialize(obs, static_cast<const StringObs&>(obs)); }
+    if (type == typeid(DynamicData)) { return serialize(obs, static_cast<const DynamicData&>(obs)); }
+
+    Writer writer;
+    writer.writeValue(MessageType::Data);
+    writer.writeString(DynamicData::type());
+    writer.writeTime(obs.insTime);
+    writer.writeValue(static_cast<uint32_t>(obs.events().size()));
+    for (const auto& event : obs.events())
+    {
+        writer.writeString(event);
+    }
+    writeDescriptors(writer, obs);
+    return writer.release();
+}
+
+std::vector<uint8_t> SerializeEndOfStream()
+{
+    Writer writer;
+    writer.writeValue(MessageType::EndOfStream);
+    return writer.release();
+}
+
+std::string GetDataType(const std::vector<uint8_t>& buffer)
+{
+    Reader reader(buffer);
+    if (reader.readValue<MessageType>() != MessageType::Data) { return {}; }
+    auto type = reader.readString();
+    return reader.valid() ? type : std::string{};
+}
+
+std::shared_ptr<NodeData> Deserialize(const std::vector<uint8_t>& buffer, std::deque<ImuPos>& imuPositions)
+{
+    Reader reader(buffer);
+    if (reader.readValue<MessageType>() != MessageType::Data) { return nullptr; }
+
+    auto type = reader.readString();
+    auto insTime = reader.readTime();
+    std::vector<std::string> events(reader.readCount(sizeof(uint32_t)));
+    if (!reader.valid())
+    {
+        LOG_ERROR("Received a corrupt message of type '{}'", type);
+        return nullptr;
+    }
+    for (auto& event : events)
+    {
+        event = reader.readString();
+        if (!reader.valid()) { return nullptr; }
+    }
+
+    std::shared_ptr<NodeData> obs;
+    if (type == Pos::type())
+    {
+        auto data = std::make_shared<Pos>();
+        read(reader, *data);
+        obs = data;
+    }
+    else if (type == PosVel::type())
+    {
+        auto data = std::make_shared<PosVel>();
+        read(reader, *data);
+        obs = data;
+    }
+    else if (type == PosVelAtt::type())
+    {
+        auto data = std::make_shared<PosVelAtt>();
+        read(reader, *data);
+        obs = data;
+    }
+    else if (type == ImuObs::type())
+    {
+        const auto& imuPos = readImuPos(reader, imuPositions);
+        auto data = std::make_shared<ImuObs>(imuPos);
+        read(reader, *data);
+        obs = data;
+    }
+    else if (type == ImuObsWDelta::type())
+    {
+        const auto& imuPos = readImuPos(reader, imuPositions);
+        auto data = std::make_shared<ImuObsWDelta>(imuPos);
+        read(reader, *data);
+        obs = data;
+    }
+    else if (type == StringObs::type())
+    {
+        auto data = std::make_shared<StringObs>("");
+        read(reader, *data);
+        obs = data;
+    }
+    else if (type == DynamicData::type())
+    {
+        auto data = std::make_shared<DynamicData>();
+        read(reader, *data);
+        obs = data;
+    }
+    else
+    {
+        LOG_ERROR("Received a message with the unknown data type '{}'", type);
+        return nullptr;
+    }
+
+    if (!reader.valid())
+    {
+        LOG_ERROR("Received a truncated message of type '{}'", type);
+        return nullptr;
+    }
+
+    obs->insTime = insTime;
+    for (const auto& event : events)
+    {
+        obs->addEvent(event);
+    }
+    return obs;
+}
+
+} // namespace NAV::NodeDataSerializer
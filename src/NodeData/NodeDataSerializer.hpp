@@ -0,0 +1,69 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file NodeDataSerializer.hpp
+/// @brief Binary serialization of NodeData for transporting it between processes
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-10
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "NodeData/NodeData.hpp"
+#include "NodeData/IMU/ImuPos.hpp"
+
+/// @brief Binary serialization of NodeData
+///
+/// Every message starts with a message type, followed (for data messages) by the data type, the time and the events of the observation.
+/// Pos, PosVel, PosVelAtt, ImuObs, ImuObsWDelta, StringObs and DynamicData are transported with their members.
+/// All other types (including types derived from the ones above) are transported as DynamicData, holding the values of their static and dynamic data descriptors.
+///
+/// The values are written in the native byte order, so the messages are only meant to be exchanged on the same machine.
+namespace NAV::NodeDataSerializer
+{
+/// @brief Types of messages
+enum class MessageType : uint8_t
+{
+    Data,        ///< Message contains an observation
+    EndOfStream, ///< The sender does not send any more data (post-processing finished)
+    Invalid,     ///< Message could not be decoded
+};
+
+/// @brief Data types, which are transported with all their members
+[[nodiscard]] const std::vector<std::string>& SupportedTypes();
+
+/// @brief Determines the type of the message
+/// @param[in] buffer Message bytes
+[[nodiscard]] MessageType GetMessageType(const std::vector<uint8_t>& buffer);
+
+/// @brief Serializes the observation
+/// @param[in] obs Observation to serialize
+/// @return Message bytes
+[[nodiscard]] std::vector<uint8_t> Serialize(const NodeData& obs);
+
+/// @brief Creates a message which signals the end of the data stream
+[[nodiscard]] std::vector<uint8_t> SerializeEndOfStream();
+
+/// @brief Determines the data type of a data message
+/// @param[in] buffer Message bytes
+/// @return The data type or an empty string if the message is not a valid data message
+[[nodiscard]] std::string GetDataType(const std::vector<uint8_t>& buffer);
+
+/// @brief Deserializes an observation
+/// @param[in] buffer Message bytes
+/// @param[in, out] imuPositions IMU positions, ImuObs refer to. A new position is appended if the message contains a different IMU position than the last one.
+///                              The positions are never modified, as other threads can read them over the observations.
+/// @return The observation or nullptr if the message is not a valid data message
+[[nodiscard]] std::shared_ptr<NodeData> Deserialize(const std::vector<uint8_t>& buffer, std::deque<ImuPos>& imuPositions);
+
+} // namespace NAV::NodeDataSerializer
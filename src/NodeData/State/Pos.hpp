@@ -19,8 +19,10 @@
 #include "util/Logger/CommonLog.hpp"
 #include "NodeData/NodeData.hpp"
 #include "util/Container/KeyedMatrix.hpp"
+#include "util/Container/LazyValue.hpp"
 #include "util/Assert.h"
 #include <Eigen/src/Core/MatrixBase.h>
+#include <cstdint>
 
 namespace NAV
 {
@@ -78,6 +80,11 @@ class Pos : public NodeData
     /// @brief Get the amount of descriptors
     [[nodiscard]] size_t staticDescriptorCount() const override { return GetStaticDescriptorCount(); }
 
+    /// @brief Writes the values of all selected columns into the output buffer
+    /// @param[out] out Output buffer with at least selection.size() elements. Values not in the observation are set to NaN.
+    /// @param[in] selection Selected columns
+    void writeValues(std::span<double> out, const ColumnSelection& selection) const override { WriteValues(*this, out, selection); }
+
     /// @brief Get the value at the index
     /// @param idx Index corresponding to data descriptor order
     /// @return Value if in the observation
@@ -172,7 +179,7 @@ class Pos : public NodeData
         /// @brief Constructor
         States() = delete;
 
-        /// @brief State Keys
+        /// @brief State Keys, which are also the indices in the covariance matrices
         enum StateKeys
         {
             PosX,         ///< Position ECEF_X [m]
@@ -185,7 +192,10 @@ class Pos : public NodeData
     };
 
     /// Returns the latitude 𝜙, longitude λ and altitude (height above ground) in [rad, rad, m]
-    [[nodiscard]] const Eigen::Vector3d& lla_position() const { return _lla_position; }
+    [[nodiscard]] const Eigen::Vector3d& lla_position() const
+    {
+        return _lla_position.get([&]() { return trafo::ecef2lla_WGS84(_e_position.value()); });
+    }
 
     /// Returns the latitude 𝜙 in [rad]
     [[nodiscard]] const double& latitude() const { return lla_position()(0); }
@@ -197,19 +207,38 @@ class Pos : public NodeData
     [[nodiscard]] const double& altitude() const { return lla_position()(2); }
 
     /// Returns the  coordinates in [m]
-    [[nodiscard]] const Eigen::Vector3d& e_position() const { return _e_position; }
+    [[nodiscard]] const Eigen::Vector3d& e_position() const
+    {
+        return _e_position.get([&]() { return trafo::lla2ecef_WGS84(_lla_position.value()); });
+    }
 
     /// Returns the standard deviation of the position in ECEF frame coordinates in [m]
-    [[nodiscard]] std::optional<std::reference_wrapper<const Eigen::Vector3d>> e_positionStdev() const { return _e_positionStdev; }
+    [[nodiscard]] std::optional<std::reference_wrapper<const Eigen::Vector3d>> e_positionStdev() const
+    {
+        if (!_hasPositionStdev) { return std::nullopt; }
+        return _e_positionStdev.get([&]() -> Eigen::Vector3d { return (e_Quat_n() * _positionStdevCovarianceMatrix * n_Quat_e()).diagonal().cwiseSqrt(); });
+    }
 
     /// Returns the standard deviation of the position in local navigation frame coordinates in [m]
-    [[nodiscard]] std::optional<std::reference_wrapper<const Eigen::Vector3d>> n_positionStdev() const { return _n_positionStdev; }
+    [[nodiscard]] std::optional<std::reference_wrapper<const Eigen::Vector3d>> n_positionStdev() const
+    {
+        if (!_hasPositionStdev) { return std::nullopt; }
+        return _n_positionStdev.get([&]() -> Eigen::Vector3d { return (n_Quat_e() * _positionStdevCovarianceMatrix * e_Quat_n()).diagonal().cwiseSqrt(); });
+    }
 
     /// Returns the Covariance matrix in ECEF frame
-    [[nodiscard]] std::optional<std::reference_wrapper<const KeyedMatrixXd<States::StateKeys, States::StateKeys>>> e_CovarianceMatrix() const { return _e_covarianceMatrix; }
+    [[nodiscard]] std::optional<std::reference_wrapper<const Eigen::Matrix3d>> e_CovarianceMatrix() const
+    {
+        if (!_hasCovarianceMatrix) { return std::nullopt; }
+        return _e_covarianceMatrix.get([&]() -> Eigen::Matrix3d { return e_Quat_n() * _n_covarianceMatrix.value() * n_Quat_e(); });
+    }
 
     /// Returns the Covariance matrix in local navigation frame
-    [[nodiscard]] std::optional<std::reference_wrapper<const KeyedMatrixXd<States::StateKeys, States::StateKeys>>> n_CovarianceMatrix() const { return _n_covarianceMatrix; }
+    [[nodiscard]] std::optional<std::reference_wrapper<const Eigen::Matrix3d>> n_CovarianceMatrix() const
+    {
+        if (!_hasCovarianceMatrix) { return std::nullopt; }
+        return _n_covarianceMatrix.get([&]() -> Eigen::Matrix3d { return n_Quat_e() * _e_covarianceMatrix.value() * e_Quat_n(); });
+    }
 
     // ###########################################################################################################
     //                                                  Setter
@@ -219,16 +248,18 @@ class Pos : public NodeData
     /// @param[in] e_position New Position in ECEF coordinates
     void setPosition_e(const Eigen::Vector3d& e_position)
     {
-        _e_position = e_position;
-        _lla_position = trafo::ecef2lla_WGS84(e_position);
+        _e_position.set(e_position);
+        _lla_position.reset();
+        resetPositionDependentValues();
     }
 
     /// @brief Set the Position lla object
     /// @param[in] lla_position New Position in LatLonAlt coordinates
     void setPosition_lla(const Eigen::Vector3d& lla_position)
     {
-        _e_position = trafo::lla2ecef_WGS84(lla_position);
-        _lla_position = lla_position;
+        _lla_position.set(lla_position);
+        _e_position.reset();
+        resetPositionDependentValues();
     }
 
     /// @brief Set the Position in ECEF coordinates and its standard deviation
@@ -237,8 +268,11 @@ class Pos : public NodeData
     void setPositionAndStdDev_e(const Eigen::Vector3d& e_position, const Eigen::Matrix3d& e_positionCovarianceMatrix)
     {
         setPosition_e(e_position);
-        _e_positionStdev = e_positionCovarianceMatrix.diagonal().cwiseSqrt();
-        _n_positionStdev = (n_Quat_e() * e_positionCovarianceMatrix * e_Quat_n()).diagonal().cwiseSqrt();
+        _positionStdevCovarianceMatrix = e_positionCovarianceMatrix;
+        _hasPositionStdev = true;
+        _positionStdevFrame = StorageFrame::ECEF;
+        _e_positionStdev.set(e_positionCovarianceMatrix.diagonal().cwiseSqrt());
+        _n_positionStdev.reset();
     }
 
     /// @brief Set the Position in LLA coordinates and its standard deviation
@@ -247,8 +281,11 @@ class Pos : public NodeData
     void setPositionAndStdDev_lla(const Eigen::Vector3d& lla_position, const Eigen::Matrix3d& n_positionCovarianceMatrix)
     {
         setPosition_lla(lla_position);
-        _n_positionStdev = n_positionCovarianceMatrix.diagonal().cwiseSqrt();
-        _e_positionStdev = (e_Quat_n() * n_positionCovarianceMatrix * n_Quat_e()).diagonal().cwiseSqrt();
+        _positionStdevCovarianceMatrix = n_positionCovarianceMatrix;
+        _hasPositionStdev = true;
+        _positionStdevFrame = StorageFrame::NED;
+        _n_positionStdev.set(n_positionCovarianceMatrix.diagonal().cwiseSqrt());
+        _e_positionStdev.reset();
     }
 
     /// @brief Set the Covariance matrix in ECEF coordinates
@@ -260,14 +297,10 @@ class Pos : public NodeData
         INS_ASSERT_USER_ERROR(e_covarianceMatrix.rows() == 3, "This function needs a 3x3 matrix as input");
         INS_ASSERT_USER_ERROR(e_covarianceMatrix.cols() == 3, "This function needs a 3x3 matrix as input");
 
-        _e_covarianceMatrix = KeyedMatrixXd<States::StateKeys,
-                                            States::StateKeys>(e_covarianceMatrix,
-                                                               States::Pos);
-        _n_covarianceMatrix = KeyedMatrixXd<States::StateKeys,
-                                            States::StateKeys>(n_Quat_e()
-                                                                   * (*_e_covarianceMatrix)(States::Pos, States::Pos)
-                                                                   * e_Quat_n(),
-                                                               States::Pos);
+        _hasCovarianceMatrix = true;
+        _covarianceMatrixFrame = StorageFrame::ECEF;
+        _e_covarianceMatrix.set(e_covarianceMatrix);
+        _n_covarianceMatrix.reset();
     }
 
     /// @brief Set the Covariance matrix in ECEF coordinates
@@ -279,36 +312,69 @@ class Pos : public NodeData
         INS_ASSERT_USER_ERROR(n_covarianceMatrix.rows() == 3, "This function needs a 3x3 matrix as input");
         INS_ASSERT_USER_ERROR(n_covarianceMatrix.cols() == 3, "This function needs a 3x3 matrix as input");
 
-        _n_covarianceMatrix = KeyedMatrixXd<States::StateKeys,
-                                            States::StateKeys>(n_covarianceMatrix,
-                                                               States::Pos);
-        _e_covarianceMatrix = KeyedMatrixXd<States::StateKeys,
-                                            States::StateKeys>(e_Quat_n()
-                                                                   * (*_n_covarianceMatrix)(States::Pos, States::Pos)
-                                                                   * n_Quat_e(),
-                                                               States::Pos);
+        _hasCovarianceMatrix = true;
+        _covarianceMatrixFrame = StorageFrame::NED;
+        _n_covarianceMatrix.set(n_covarianceMatrix);
+        _e_covarianceMatrix.reset();
     }
 
     /* -------------------------------------------------------------------------------------------------------- */
     /*                                             Member variables                                             */
     /* -------------------------------------------------------------------------------------------------------- */
 
+  protected:
+    /// @brief Frame a value was set in. The value in the other frame is calculated from it with the current position.
+    enum class StorageFrame : uint8_t
+    {
+        ECEF, ///< Earth-centered Earth-fixed frame
+        NED,  ///< Local navigation frame
+    };
+
+    /// @brief Invalidates the value in the frame, which was not set, so that it gets calculated again with the new position
+    /// @param[in] frame Frame the value was set in
+    /// @param[in, out] e_value Value in ECEF frame
+    /// @param[in, out] n_value Value in local navigation frame
+    template<typename T>
+    static void ResetDerivedFrame(StorageFrame frame, LazyValue<T>& e_value, LazyValue<T>& n_value)
+    {
+        if (frame == StorageFrame::ECEF) { n_value.reset(); }
+        else { e_value.reset(); }
+    }
+
+    /// @brief Invalidates all cached values, which were converted into another frame with the position. Called by the position setters.
+    virtual void resetPositionDependentValues()
+    {
+        ResetDerivedFrame(_positionStdevFrame, _e_positionStdev, _n_positionStdev);
+        ResetDerivedFrame(_covarianceMatrixFrame, _e_covarianceMatrix, _n_covarianceMatrix);
+    }
+
   private:
+    // The setters store the values in the frame they are given in. The values in the other frame are calculated on first access.
+
     /// Position in ECEF coordinates [m]
-    Eigen::Vector3d _e_position{ std::nan(""), std::nan(""), std::nan("") };
+    LazyValue<Eigen::Vector3d> _e_position{ Eigen::Vector3d{ std::nan(""), std::nan(""), std::nan("") } };
     /// Position in LatLonAlt coordinates [rad, rad, m]
-    Eigen::Vector3d _lla_position{ std::nan(""), std::nan(""), std::nan("") };
-
+    LazyValue<Eigen::Vector3d> _lla_position{ Eigen::Vector3d{ std::nan(""), std::nan(""), std::nan("") } };
+
+    /// Whether the standard deviation of the position was set
+    bool _hasPositionStdev = false;
+    /// Frame the standard deviation of the position was set in
+    StorageFrame _positionStdevFrame = StorageFrame::ECEF;
+    /// Covariance matrix the standard deviation of the position was set with (in the frame it was set in)
+    Eigen::Matrix3d _positionStdevCovarianceMatrix;
     /// Standard deviation of Position in ECEF coordinates [m]
-    std::optional<Eigen::Vector3d> _e_positionStdev;
+    LazyValue<Eigen::Vector3d> _e_positionStdev;
     /// Standard deviation of Position in local navigation frame coordinates [m]
-    std::optional<Eigen::Vector3d> _n_positionStdev;
+    LazyValue<Eigen::Vector3d> _n_positionStdev;
 
+    /// Whether the covariance matrix was set
+    bool _hasCovarianceMatrix = false;
+    /// Frame the covariance matrix was set in
+    StorageFrame _covarianceMatrixFrame = StorageFrame::ECEF;
     /// Covariance matrix in ECEF coordinates
-    std::optional<KeyedMatrixXd<States::StateKeys, States::StateKeys>> _e_covarianceMatrix;
-
+    LazyValue<Eigen::Matrix3d> _e_covarianceMatrix;
     /// Covariance matrix in local navigation coordinates
-    std::optional<KeyedMatrixXd<States::StateKeys, States::StateKeys>> _n_covarianceMatrix;
+    LazyValue<Eigen::Matrix3d> _n_covarianceMatrix;
 };
 
 } // namespace NAV
@@ -74,6 +74,11 @@ class PosVel : public Pos
     /// @brief Get the amount of descriptors
     [[nodiscard]] size_t staticDescriptorCount() const override { return GetStaticDescriptorCount(); }
 
+    /// @brief Writes the values of all selected columns into the output buffer
+    /// @param[out] out Output buffer with at least selection.size() elements. Values not in the observation are set to NaN.
+    /// @param[in] selection Selected columns
+    void writeValues(std::span<double> out, const ColumnSelection& selection) const override { WriteValues(*this, out, selection); }
+
     /// @brief Get the value at the index
     /// @param idx Index corresponding to data descriptor order
     /// @return Value if in the observation
@@ -127,13 +132,13 @@ class PosVel : public Pos
             if (auto stDev = e_velocityStdev()) { return stDev->get().z(); }
             break;
         case 30: // XY velocity StDev [m]
-            if (e_CovarianceMatrix().has_value() && (*e_CovarianceMatrix()).get().hasAnyCols(States::Vel)) { return (*e_CovarianceMatrix())(States::VelX, States::VelY); }
+            if (e_CovarianceMatrix().has_value()) { return (*e_CovarianceMatrix())(States::VelX, States::VelY); }
             break;
         case 31: // XZ velocity StDev [m]
-            if (e_CovarianceMatrix().has_value() && (*e_CovarianceMatrix()).get().hasAnyCols(States::Vel)) { return (*e_CovarianceMatrix())(States::VelX, States::VelZ); }
+            if (e_CovarianceMatrix().has_value()) { return (*e_CovarianceMatrix())(States::VelX, States::VelZ); }
             break;
         case 32: // YZ velocity StDev [m]
-            if (e_CovarianceMatrix().has_value() && (*e_CovarianceMatrix()).get().hasAnyCols(States::Vel)) { return (*e_CovarianceMatrix())(States::VelY, States::VelZ); }
+            if (e_CovarianceMatrix().has_value()) { return (*e_CovarianceMatrix())(States::VelY, States::VelZ); }
             break;
         case 33: // North velocity StDev [m/s]
             if (auto stDev = n_velocityStdev()) { return stDev->get().x(); }
@@ -145,13 +150,13 @@ class PosVel : public Pos
             if (auto stDev = n_velocityStdev()) { return stDev->get().z(); }
             break;
         case 36: // NE velocity StDev [m]
-            if (n_CovarianceMatrix().has_value() && (*n_CovarianceMatrix()).get().hasAnyCols(States::Vel)) { return (*n_CovarianceMatrix())(States::VelX, States::VelY); }
+            if (n_CovarianceMatrix().has_value()) { return (*n_CovarianceMatrix())(States::VelX, States::VelY); }
             break;
         case 37: // ND velocity StDev [m]
-            if (n_CovarianceMatrix().has_value() && (*n_CovarianceMatrix()).get().hasAnyCols(States::Vel)) { return (*n_CovarianceMatrix())(States::VelX, States::VelZ); }
+            if (n_CovarianceMatrix().has_value()) { return (*n_CovarianceMatrix())(States::VelX, States::VelZ); }
             break;
         case 38: // ED velocity StDev [m]
-            if (n_CovarianceMatrix().has_value() && (*n_CovarianceMatrix()).get().hasAnyCols(States::Vel)) { return (*n_CovarianceMatrix())(States::VelY, States::VelZ); }
+            if (n_CovarianceMatrix().has_value()) { return (*n_CovarianceMatrix())(States::VelY, States::VelZ); }
             break;
         default:
             return std::nullopt;
@@ -169,7 +174,7 @@ class PosVel : public Pos
         /// @brief Constructor
         States() = delete;
 
-        /// @brief State Keys
+        /// @brief State Keys, which are also the indices in the covariance matrices
         enum StateKeys
         {
             PosX,         ///< Position ECEF_X [m]
@@ -190,22 +195,44 @@ class PosVel : public Pos
     };
 
     /// Returns the velocity in [m/s], in earth coordinates
-    [[nodiscard]] const Eigen::Vector3d& e_velocity() const { return _e_velocity; }
+    [[nodiscard]] const Eigen::Vector3d& e_velocity() const
+    {
+        return _e_velocity.get([&]() -> Eigen::Vector3d { return e_Quat_n() * _n_velocity.value(); });
+    }
 
     /// Returns the velocity in [m/s], in navigation coordinates
-    [[nodiscard]] const Eigen::Vector3d& n_velocity() const { return _n_velocity; }
+    [[nodiscard]] const Eigen::Vector3d& n_velocity() const
+    {
+        return _n_velocity.get([&]() -> Eigen::Vector3d { return n_Quat_e() * _e_velocity.value(); });
+    }
 
     /// Returns the standard deviation of the velocity in [m/s], in earth coordinates
-    [[nodiscard]] std::optional<std::reference_wrapper<const Eigen::Vector3d>> e_velocityStdev() const { return _e_velocityStdev; }
+    [[nodiscard]] std::optional<std::reference_wrapper<const Eigen::Vector3d>> e_velocityStdev() const
+    {
+        if (!_hasVelocityStdev) { return std::nullopt; }
+        return _e_velocityStdev.get([&]() -> Eigen::Vector3d { return (e_Quat_n() * _velocityStdevCovarianceMatrix * n_Quat_e()).diagonal().cwiseSqrt(); });
+    }
 
     /// Returns the standard deviation of the velocity in [m/s], in navigation coordinates
-    [[nodiscard]] std::optional<std::reference_wrapper<const Eigen::Vector3d>> n_velocityStdev() const { return _n_velocityStdev; }
+    [[nodiscard]] std::optional<std::reference_wrapper<const Eigen::Vector3d>> n_velocityStdev() const
+    {
+        if (!_hasVelocityStdev) { return std::nullopt; }
+        return _n_velocityStdev.get([&]() -> Eigen::Vector3d { return (n_Quat_e() * _velocityStdevCovarianceMatrix * e_Quat_n()).diagonal().cwiseSqrt(); });
+    }
 
     /// Returns the Covariance matrix in ECEF frame
-    [[nodiscard]] std::optional<std::reference_wrapper<const KeyedMatrixXd<States::StateKeys, States::StateKeys>>> e_CovarianceMatrix() const { return _e_covarianceMatrix; }
+    [[nodiscard]] std::optional<std::reference_wrapper<const Eigen::Matrix<double, 6, 6>>> e_CovarianceMatrix() const
+    {
+        if (!_hasCovarianceMatrix) { return std::nullopt; }
+        return _e_covarianceMatrix.get([&]() { return rotateCovarianceMatrix(_n_covarianceMatrix.value(), e_Quat_n()); });
+    }
 
     /// Returns the Covariance matrix in local navigation frame
-    [[nodiscard]] std::optional<std::reference_wrapper<const KeyedMatrixXd<States::StateKeys, States::StateKeys>>> n_CovarianceMatrix() const { return _n_covarianceMatrix; }
+    [[nodiscard]] std::optional<std::reference_wrapper<const Eigen::Matrix<double, 6, 6>>> n_CovarianceMatrix() const
+    {
+        if (!_hasCovarianceMatrix) { return std::nullopt; }
+        return _n_covarianceMatrix.get([&]() { return rotateCovarianceMatrix(_e_covarianceMatrix.value(), n_Quat_e()); });
+    }
 
     // ###########################################################################################################
     //                                                  Setter
@@ -215,16 +242,18 @@ class PosVel : public Pos
     /// @param[in] e_velocity The new velocity in the earth frame
     void setVelocity_e(const Eigen::Vector3d& e_velocity)
     {
-        _e_velocity = e_velocity;
-        _n_velocity = n_Quat_e() * e_velocity;
+        _e_velocity.set(e_velocity);
+        _n_velocity.reset();
+        _velocityFrame = StorageFrame::ECEF;
     }
 
     /// @brief Set the Velocity in the NED frame
     /// @param[in] n_velocity The new velocity in the NED frame
     void setVelocity_n(const Eigen::Vector3d& n_velocity)
     {
-        _e_velocity = e_Quat_n() * n_velocity;
-        _n_velocity = n_velocity;
+        _n_velocity.set(n_velocity);
+        _e_velocity.reset();
+        _velocityFrame = StorageFrame::NED;
     }
 
     /// @brief Set the Velocity in ECEF coordinates and its standard deviation
@@ -233,8 +262,11 @@ class PosVel : public Pos
     void setVelocityAndStdDev_e(const Eigen::Vector3d& e_velocity, const Eigen::Matrix3d& e_velocityCovarianceMatrix)
     {
         setVelocity_e(e_velocity);
-        _e_velocityStdev = e_velocityCovarianceMatrix.diagonal().cwiseSqrt();
-        _n_velocityStdev = (n_Quat_e() * e_velocityCovarianceMatrix * e_Quat_n()).diagonal().cwiseSqrt();
+        _velocityStdevCovarianceMatrix = e_velocityCovarianceMatrix;
+        _hasVelocityStdev = true;
+        _velocityStdevFrame = StorageFrame::ECEF;
+        _e_velocityStdev.set(e_velocityCovarianceMatrix.diagonal().cwiseSqrt());
+        _n_velocityStdev.reset();
     }
 
     /// @brief Set the Velocity in NED coordinates and its standard deviation
@@ -243,8 +275,11 @@ class PosVel : public Pos
     void setVelocityAndStdDev_n(const Eigen::Vector3d& n_velocity, const Eigen::Matrix3d& n_velocityCovarianceMatrix)
     {
         setVelocity_n(n_velocity);
-        _n_velocityStdev = n_velocityCovarianceMatrix.diagonal().cwiseSqrt();
-        _e_velocityStdev = (e_Quat_n() * n_velocityCovarianceMatrix * n_Quat_e()).diagonal().cwiseSqrt();
+        _velocityStdevCovarianceMatrix = n_velocityCovarianceMatrix;
+        _hasVelocityStdev = true;
+        _velocityStdevFrame = StorageFrame::NED;
+        _n_velocityStdev.set(n_velocityCovarianceMatrix.diagonal().cwiseSqrt());
+        _e_velocityStdev.reset();
     }
 
     /// @brief Set the Covariance matrix in ECEF coordinates
@@ -256,17 +291,10 @@ class PosVel : public Pos
         INS_ASSERT_USER_ERROR(e_covarianceMatrix.rows() == 6, "This function needs a 6x6 matrix as input");
         INS_ASSERT_USER_ERROR(e_covarianceMatrix.cols() == 6, "This function needs a 6x6 matrix as input");
 
-        _e_covarianceMatrix = KeyedMatrixXd<States::StateKeys,
-                                            States::StateKeys>(e_covarianceMatrix,
-                                                               States::PosVel);
-        _n_covarianceMatrix = _e_covarianceMatrix;
-
-        Eigen::Quaterniond n_Quat_e = trafo::n_Quat_e(latitude(), longitude());
-        Eigen::Quaterniond e_Quat_n = trafo::e_Quat_n(latitude(), longitude());
-
-        (*_n_covarianceMatrix)(all, all).setZero();
-        (*_n_covarianceMatrix)(States::Pos, States::Pos) = n_Quat_e * (*_e_covarianceMatrix)(States::Pos, States::Pos) * e_Quat_n;
-        (*_n_covarianceMatrix)(States::Vel, States::Vel) = n_Quat_e * (*_e_covarianceMatrix)(States::Vel, States::Vel) * e_Quat_n;
+        _hasCovarianceMatrix = true;
+        _covarianceMatrixFrame = StorageFrame::ECEF;
+        _e_covarianceMatrix.set(e_covarianceMatrix);
+        _n_covarianceMatrix.reset();
     }
 
     /// @brief Set the Covariance matrix in NED coordinates
@@ -278,39 +306,68 @@ class PosVel : public Pos
         INS_ASSERT_USER_ERROR(n_covarianceMatrix.rows() == 6, "This function needs a 6x6 matrix as input");
         INS_ASSERT_USER_ERROR(n_covarianceMatrix.cols() == 6, "This function needs a 6x6 matrix as input");
 
-        _n_covarianceMatrix = KeyedMatrixXd<States::StateKeys,
-                                            States::StateKeys>(n_covarianceMatrix,
-                                                               States::PosVel);
-        _e_covarianceMatrix = _n_covarianceMatrix;
-
-        Eigen::Quaterniond n_Quat_e = trafo::n_Quat_e(latitude(), longitude());
-        Eigen::Quaterniond e_Quat_n = trafo::e_Quat_n(latitude(), longitude());
-
-        (*_e_covarianceMatrix)(all, all).setZero();
-        (*_e_covarianceMatrix)(States::Pos, States::Pos) = e_Quat_n * (*_n_covarianceMatrix)(States::Pos, States::Pos) * n_Quat_e;
-        (*_e_covarianceMatrix)(States::Vel, States::Vel) = e_Quat_n * (*_n_covarianceMatrix)(States::Vel, States::Vel) * n_Quat_e;
+        _hasCovarianceMatrix = true;
+        _covarianceMatrixFrame = StorageFrame::NED;
+        _n_covarianceMatrix.set(n_covarianceMatrix);
+        _e_covarianceMatrix.reset();
     }
 
     /* -------------------------------------------------------------------------------------------------------- */
     /*                                             Member variables                                             */
     /* -------------------------------------------------------------------------------------------------------- */
 
+  protected:
+    /// @brief Invalidates all cached values, which were converted into another frame with the position. Called by the position setters.
+    void resetPositionDependentValues() override
+    {
+        Pos::resetPositionDependentValues();
+        ResetDerivedFrame(_velocityFrame, _e_velocity, _n_velocity);
+        ResetDerivedFrame(_velocityStdevFrame, _e_velocityStdev, _n_velocityStdev);
+        ResetDerivedFrame(_covarianceMatrixFrame, _e_covarianceMatrix, _n_covarianceMatrix);
+    }
+
   private:
+    /// @brief Rotates the position and velocity blocks of the covariance matrix into another frame
+    /// @param[in] covarianceMatrix 6x6 PosVel covariance matrix
+    /// @param[in] to_Quat_from Rotation into the target frame
+    /// @return The rotated matrix. The cross covariances between position and velocity are zero.
+    static Eigen::Matrix<double, 6, 6> rotateCovarianceMatrix(const Eigen::Matrix<double, 6, 6>& covarianceMatrix, const Eigen::Quaterniond& to_Quat_from)
+    {
+        Eigen::Matrix3d dcm = to_Quat_from.toRotationMatrix();
+        Eigen::Matrix<double, 6, 6> rotated = Eigen::Matrix<double, 6, 6>::Zero();
+        rotated.topLeftCorner<3, 3>() = dcm * covarianceMatrix.topLeftCorner<3, 3>() * dcm.transpose();
+        rotated.bottomRightCorner<3, 3>() = dcm * covarianceMatrix.bottomRightCorner<3, 3>() * dcm.transpose();
+        return rotated;
+    }
+
+    // The setters store the values in the frame they are given in. The values in the other frame are calculated on first access.
+
     /// Velocity in earth coordinates [m/s]
-    Eigen::Vector3d _e_velocity{ std::nan(""), std::nan(""), std::nan("") };
+    LazyValue<Eigen::Vector3d> _e_velocity{ Eigen::Vector3d{ std::nan(""), std::nan(""), std::nan("") } };
     /// Velocity in navigation coordinates [m/s]
-    Eigen::Vector3d _n_velocity{ std::nan(""), std::nan(""), std::nan("") };
-
+    LazyValue<Eigen::Vector3d> _n_velocity{ Eigen::Vector3d{ std::nan(""), std::nan(""), std::nan("") } };
+    /// Frame the velocity was set in
+    StorageFrame _velocityFrame = StorageFrame::ECEF;
+
+    /// Whether the standard deviation of the velocity was set
+    bool _hasVelocityStdev = false;
+    /// Frame the standard deviation of the velocity was set in
+    StorageFrame _velocityStdevFrame = StorageFrame::ECEF;
+    /// Covariance matrix the standard deviation of the velocity was set with (in the frame it was set in)
+    Eigen::Matrix3d _velocityStdevCovarianceMatrix;
     /// Standard deviation of Velocity in earth coordinates [m/s]
-    std::optional<Eigen::Vector3d> _e_velocityStdev;
+    LazyValue<Eigen::Vector3d> _e_velocityStdev;
     /// Standard deviation of Velocity in navigation coordinates [m/s]
-    std::optional<Eigen::Vector3d> _n_velocityStdev;
+    LazyValue<Eigen::Vector3d> _n_velocityStdev;
 
+    /// Whether the covariance matrix was set
+    bool _hasCovarianceMatrix = false;
+    /// Frame the covariance matrix was set in
+    StorageFrame _covarianceMatrixFrame = StorageFrame::ECEF;
     /// Covariance matrix in ECEF coordinates
-    std::optional<KeyedMatrixXd<States::StateKeys, States::StateKeys>> _e_covarianceMatrix;
-
+    LazyValue<Eigen::Matrix<double, 6, 6>> _e_covarianceMatrix;
     /// Covariance matrix in local navigation coordinates
-    std::optional<KeyedMatrixXd<States::StateKeys, States::StateKeys>> _n_covarianceMatrix;
+    LazyValue<Eigen::Matrix<double, 6, 6>> _n_covarianceMatrix;
 };
 
 } // namespace NAV
@@ -64,6 +64,11 @@ class PosVelAtt : public PosVel
     /// @brief Get the amount of descriptors
     [[nodiscard]] size_t staticDescriptorCount() const override { return GetStaticDescriptorCount(); }
 
+    /// @brief Writes the values of all selected columns into the output buffer
+    /// @param[out] out Output buffer with at least selection.size() elements. Values not in the observation are set to NaN.
+    /// @param[in] selection Selected columns
+    void writeValues(std::span<double> out, const ColumnSelection& selection) const override { WriteValues(*this, out, selection); }
+
     /// @brief Get the value at the index
     /// @param idx Index corresponding to data descriptor order
     /// @return Value if in the observation
@@ -140,7 +145,7 @@ class PosVelAtt : public PosVel
     /// @return The Quaternion for the rotation from body to navigation coordinates
     [[nodiscard]] const Eigen::Quaterniond& n_Quat_b() const
     {
-        return _n_Quat_b;
+        return _n_Quat_b.get([&]() -> Eigen::Quaterniond { return n_Quat_e() * _e_Quat_b.value(); });
     }
 
     /// @brief Returns the Quaternion from navigation to body frame (NED)
@@ -154,7 +159,7 @@ class PosVelAtt : public PosVel
     /// @return The Quaternion for the rotation from body to earth coordinates
     [[nodiscard]] const Eigen::Quaterniond& e_Quat_b() const
     {
-        return _e_Quat_b;
+        return _e_Quat_b.get([&]() -> Eigen::Quaterniond { return e_Quat_n() * _n_Quat_b.value(); });
     }
 
     /// @brief Returns the Quaternion from Earth-fixed to body frame
@@ -179,16 +184,18 @@ class PosVelAtt : public PosVel
     /// @param[in] e_Quat_b Quaternion from body to earth frame
     void setAttitude_e_Quat_b(const Eigen::Quaterniond& e_Quat_b)
     {
-        _e_Quat_b = e_Quat_b;
-        _n_Quat_b = n_Quat_e() * e_Quat_b;
+        _e_Quat_b.set(e_Quat_b);
+        _n_Quat_b.reset();
+        _attitudeFrame = StorageFrame::ECEF;
     }
 
     /// @brief Set the Quaternion from body to navigation frame
     /// @param[in] n_Quat_b Quaternion from body to navigation frame
     void setAttitude_n_Quat_b(const Eigen::Quaterniond& n_Quat_b)
     {
-        _e_Quat_b = e_Quat_n() * n_Quat_b;
-        _n_Quat_b = n_Quat_b;
+        _n_Quat_b.set(n_Quat_b);
+        _e_Quat_b.reset();
+        _attitudeFrame = StorageFrame::NED;
     }
 
     /// @brief Set the State
@@ -247,11 +254,23 @@ class PosVelAtt : public PosVel
     /*                                             Member variables                                             */
     /* -------------------------------------------------------------------------------------------------------- */
 
+  protected:
+    /// @brief Invalidates all cached values, which were converted into another frame with the position. Called by the position setters.
+    void resetPositionDependentValues() override
+    {
+        PosVel::resetPositionDependentValues();
+        ResetDerivedFrame(_attitudeFrame, _e_Quat_b, _n_Quat_b);
+    }
+
   private:
+    // The setters store the attitude in the frame it is given in. The attitude in the other frame is calculated on first access.
+
     /// Quaternion body to earth frame
-    Eigen::Quaterniond _e_Quat_b{ 0, 0, 0, 0 };
+    LazyValue<Eigen::Quaterniond> _e_Quat_b{ Eigen::Quaterniond{ 0, 0, 0, 0 } };
     /// Quaternion body to navigation frame (roll, pitch, yaw)
-    Eigen::Quaterniond _n_Quat_b{ 0, 0, 0, 0 };
+    LazyValue<Eigen::Quaterniond> _n_Quat_b{ Eigen::Quaterniond{ 0, 0, 0, 0 } };
+    /// Frame the attitude was set in
+    StorageFrame _attitudeFrame = StorageFrame::ECEF;
 };
 
 } // namespace NAV
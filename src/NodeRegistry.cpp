@@ -183,7 +183,10 @@ std::vector<std::string> NAV::NodeRegistry::GetParentNodeDataTypes(const std::st
 // Data Link
 #include "Nodes/DataLink/udpSend.hpp"
 #include "Nodes/DataLink/udpRecv.hpp"
+#include "Nodes/DataLink/IpcSend.hpp"
+#include "Nodes/DataLink/IpcRecv.hpp"
 // Data Logger
+#include "Nodes/DataLogger/General/ColumnarLogger.hpp"
 #include "Nodes/DataLogger/General/CsvLogger.hpp"
 #include "Nodes/DataLogger/General/KmlLogger.hpp"
 #include "Nodes/DataLogger/General/MatrixLogger.hpp"
@@ -200,12 +203,14 @@ std::vector<std::string> NAV::NodeRegistry::GetParentNodeDataTypes(const std::st
 #include "Nodes/DataProcessor/SensorCombiner/ImuFusion.hpp"
 // Data Provider
 #include "Nodes/DataProvider/CSV/CsvFile.hpp"
+#include "Nodes/DataProvider/General/ColumnarFile.hpp"
 #include "Nodes/DataProvider/GNSS/FileReader/RinexNavFile.hpp"
 #include "Nodes/DataProvider/GNSS/FileReader/RinexObsFile.hpp"
 #include "Nodes/DataProvider/GNSS/FileReader/EmlidFile.hpp"
 #include "Nodes/DataProvider/GNSS/FileReader/RtklibPosFile.hpp"
 #include "Nodes/DataProvider/GNSS/FileReader/NmeaFile.hpp"
 #include "Nodes/DataProvider/GNSS/FileReader/UbloxFile.hpp"
+#include "Nodes/DataProvider/GNSS/FileReader/UartReplay.hpp"
 #include "Nodes/DataProvider/GNSS/Sensors/EmlidSensor.hpp"
 #include "Nodes/DataProvider/GNSS/Sensors/UbloxSensor.hpp"
 #include "Nodes/DataProvider/IMU/FileReader/ImuFile.hpp"
@@ -250,7 +255,10 @@ void NAV::NodeRegistry::RegisterNodeTypes()
     // Data Link
     registerNodeType<UdpSend>();
     registerNodeType<UdpRecv>();
+    registerNodeType<IpcSend>();
+    registerNodeType<IpcRecv>();
     // Data Logger
+    registerNodeType<ColumnarLogger>();
     registerNodeType<CsvLogger>();
     registerNodeType<KmlLogger>();
     registerNodeType<MatrixLogger>();
@@ -267,12 +275,14 @@ void NAV::NodeRegistry::RegisterNodeTypes()
     registerNodeType<ImuFusion>();
     // Data Provider
     registerNodeType<CsvFile>();
+    registerNodeType<ColumnarFile>();
     registerNodeType<RinexNavFile>();
     registerNodeType<RinexObsFile>();
     registerNodeType<EmlidFile>();
     registerNodeType<RtklibPosFile>();
     registerNodeType<NmeaFile>();
     registerNodeType<UbloxFile>();
+    registerNodeType<UartReplay>();
     registerNodeType<EmlidSensor>();
     registerNodeType<UbloxSensor>();
     registerNodeType<ImuFile>();
@@ -298,6 +308,7 @@ void NAV::NodeRegistry::RegisterNodeTypes()
     Node::_autostartWorker = true;
 }
 
+#include "NodeData/General/CsvData.hpp"
 #include "NodeData/General/DynamicData.hpp"
 #include "NodeData/General/StringObs.hpp"
 #include "NodeData/GNSS/EmlidObs.hpp"
@@ -321,6 +332,7 @@ void NAV::NodeRegistry::RegisterNodeDataTypes()
 {
     registerNodeDataType<NodeData>();
     // General
+    registerNodeDataType<CsvData>();
     registerNodeDataType<DynamicData>();
     registerNodeDataType<StringObs>();
     // GNSS
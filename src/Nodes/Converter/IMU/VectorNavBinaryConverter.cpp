@@ -183,7 +183,8 @@ bool NAV::VectorNavBinaryConverter::initialize()
 
 void NAV::VectorNavBinaryConverter::receiveObs(NAV::InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
 {
-    auto vnObs = std::static_pointer_cast<const VectorNavBinaryOutput>(queue.extract_front());
+    auto obs = std::static_pointer_cast<const VectorNavBinaryOutput>(queue.extract_front());
+    auto vnObs = obs->view();
 
     std::shared_ptr<const NodeData> convertedData = nullptr;
 
@@ -210,91 +211,91 @@ void NAV::VectorNavBinaryConverter::receiveObs(NAV::InputPin::NodeDataQueue& que
     }
 }
 
-std::shared_ptr<const NAV::ImuObsWDelta> NAV::VectorNavBinaryConverter::convert2ImuObsWDelta(const std::shared_ptr<const VectorNavBinaryOutput>& vnObs) // NOLINT(readability-convert-member-functions-to-static)
+std::shared_ptr<const NAV::ImuObsWDelta> NAV::VectorNavBinaryConverter::convert2ImuObsWDelta(const VectorNavBinaryOutput::View& vnObs) // NOLINT(readability-convert-member-functions-to-static)
 {
-    auto imuObs = std::make_shared<ImuObsWDelta>(vnObs->imuPos);
+    auto imuObs = std::make_shared<ImuObsWDelta>(vnObs.imuPos);
 
-    if (vnObs->gnss1Outputs || vnObs->gnss2Outputs) // If there is no GNSS data selected in the vnSensor, Imu messages should still be sent out. The VN-100 will not provide any data otherwise.
+    if (vnObs.gnss1Outputs || vnObs.gnss2Outputs) // If there is no GNSS data selected in the vnSensor, Imu messages should still be sent out. The VN-100 will not provide any data otherwise.
     {
-        if (!vnObs->timeOutputs
-            || !(vnObs->timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_TIMESTATUS)
-            || !vnObs->timeOutputs->timeStatus.dateOk()
-            || !vnObs->timeOutputs->timeStatus.timeOk()
-            || !(vnObs->timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_GPSTOW)
-            || !(vnObs->timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_GPSWEEK))
+        if (!vnObs.timeOutputs
+            || !(vnObs.timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_TIMESTATUS)
+            || !vnObs.timeOutputs->timeStatus.dateOk()
+            || !vnObs.timeOutputs->timeStatus.timeOk()
+            || !(vnObs.timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_GPSTOW)
+            || !(vnObs.timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_GPSWEEK))
         {
             return nullptr;
         }
-        imuObs->insTime = InsTime(InsTime_GPSweekTow(0, static_cast<int32_t>(vnObs->timeOutputs->gpsWeek), static_cast<double>(vnObs->timeOutputs->gpsTow) * 1e-9L));
+        imuObs->insTime = InsTime(InsTime_GPSweekTow(0, static_cast<int32_t>(vnObs.timeOutputs->gpsWeek), static_cast<double>(vnObs.timeOutputs->gpsTow) * 1e-9L));
     }
     else
     {
-        // VN-100 vnObs->insTime is set from
+        // VN-100 vnObs.insTime is set from
         // - 'timeSyncMaster->ppsTime + timeSyncIn' when working together with the VN-310E or
         // - the computer time
-        imuObs->insTime = vnObs->insTime;
+        imuObs->insTime = vnObs.insTime;
     }
 
-    if (vnObs->timeOutputs)
+    if (vnObs.timeOutputs)
     {
-        if (vnObs->timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_TIMESTARTUP)
+        if (vnObs.timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_TIMESTARTUP)
         {
-            imuObs->timeSinceStartup = vnObs->timeOutputs->timeStartup;
+            imuObs->timeSinceStartup = vnObs.timeOutputs->timeStartup;
         }
     }
     bool accelFound = false;
     bool gyroFound = false;
     bool dThetaFound = false;
     bool dVelFound = false;
-    if (vnObs->imuOutputs)
+    if (vnObs.imuOutputs)
     {
         if (!_useCompensatedData)
         {
-            if (vnObs->imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_UNCOMPMAG)
+            if (vnObs.imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_UNCOMPMAG)
             {
-                imuObs->p_magneticField = vnObs->imuOutputs->uncompMag.cast<double>();
+                imuObs->p_magneticField = vnObs.imuOutputs->uncompMag.cast<double>();
             }
-            if (vnObs->imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_UNCOMPACCEL)
+            if (vnObs.imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_UNCOMPACCEL)
             {
-                imuObs->p_acceleration = vnObs->imuOutputs->uncompAccel.cast<double>();
+                imuObs->p_acceleration = vnObs.imuOutputs->uncompAccel.cast<double>();
                 accelFound = true;
             }
-            if (vnObs->imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_UNCOMPGYRO)
+            if (vnObs.imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_UNCOMPGYRO)
             {
-                imuObs->p_angularRate = vnObs->imuOutputs->uncompGyro.cast<double>();
+                imuObs->p_angularRate = vnObs.imuOutputs->uncompGyro.cast<double>();
                 gyroFound = true;
             }
         }
         else
         {
-            if (vnObs->imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_MAG)
+            if (vnObs.imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_MAG)
             {
-                imuObs->p_magneticField = vnObs->imuOutputs->mag.cast<double>();
+                imuObs->p_magneticField = vnObs.imuOutputs->mag.cast<double>();
             }
-            if (vnObs->imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_ACCEL)
+            if (vnObs.imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_ACCEL)
             {
-                imuObs->p_acceleration = vnObs->imuOutputs->accel.cast<double>();
+                imuObs->p_acceleration = vnObs.imuOutputs->accel.cast<double>();
                 accelFound = true;
             }
-            if (vnObs->imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_ANGULARRATE)
+            if (vnObs.imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_ANGULARRATE)
             {
-                imuObs->p_angularRate = vnObs->imuOutputs->angularRate.cast<double>();
+                imuObs->p_angularRate = vnObs.imuOutputs->angularRate.cast<double>();
                 gyroFound = true;
             }
         }
-        if (vnObs->imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_TEMP)
+        if (vnObs.imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_TEMP)
         {
-            imuObs->temperature = vnObs->imuOutputs->temp;
+            imuObs->temperature = vnObs.imuOutputs->temp;
         }
-        if (vnObs->imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_DELTATHETA)
+        if (vnObs.imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_DELTATHETA)
         {
-            imuObs->dtime = vnObs->imuOutputs->deltaTime;
-            imuObs->dtheta = vnObs->imuOutputs->deltaTheta.cast<double>();
+            imuObs->dtime = vnObs.imuOutputs->deltaTime;
+            imuObs->dtheta = vnObs.imuOutputs->deltaTheta.cast<double>();
             dThetaFound = true;
         }
-        if (vnObs->imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_DELTAVEL)
+        if (vnObs.imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_DELTAVEL)
         {
-            imuObs->dvel = vnObs->imuOutputs->deltaV.cast<double>();
+            imuObs->dvel = vnObs.imuOutputs->deltaV.cast<double>();
             dVelFound = true;
         }
     }
@@ -309,79 +310,79 @@ std::shared_ptr<const NAV::ImuObsWDelta> NAV::VectorNavBinaryConverter::convert2
     return nullptr;
 }
 
-std::shared_ptr<const NAV::ImuObs> NAV::VectorNavBinaryConverter::convert2ImuObs(const std::shared_ptr<const VectorNavBinaryOutput>& vnObs) // NOLINT(readability-convert-member-functions-to-static)
+std::shared_ptr<const NAV::ImuObs> NAV::VectorNavBinaryConverter::convert2ImuObs(const VectorNavBinaryOutput::View& vnObs) // NOLINT(readability-convert-member-functions-to-static)
 {
-    auto imuObs = std::make_shared<ImuObs>(vnObs->imuPos);
+    auto imuObs = std::make_shared<ImuObs>(vnObs.imuPos);
 
-    if (vnObs->gnss1Outputs || vnObs->gnss2Outputs) // If there is no GNSS data selected in the vnSensor, Imu messages should still be sent out. The VN-100 will not provide any data otherwise.
+    if (vnObs.gnss1Outputs || vnObs.gnss2Outputs) // If there is no GNSS data selected in the vnSensor, Imu messages should still be sent out. The VN-100 will not provide any data otherwise.
     {
-        if (!vnObs->timeOutputs
-            || !(vnObs->timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_TIMESTATUS)
-            || !vnObs->timeOutputs->timeStatus.dateOk()
-            || !vnObs->timeOutputs->timeStatus.timeOk()
-            || !(vnObs->timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_GPSTOW)
-            || !(vnObs->timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_GPSWEEK))
+        if (!vnObs.timeOutputs
+            || !(vnObs.timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_TIMESTATUS)
+            || !vnObs.timeOutputs->timeStatus.dateOk()
+            || !vnObs.timeOutputs->timeStatus.timeOk()
+            || !(vnObs.timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_GPSTOW)
+            || !(vnObs.timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_GPSWEEK))
         {
             return nullptr;
         }
-        imuObs->insTime = InsTime(InsTime_GPSweekTow(0, static_cast<int32_t>(vnObs->timeOutputs->gpsWeek), static_cast<double>(vnObs->timeOutputs->gpsTow) * 1e-9L));
+        imuObs->insTime = InsTime(InsTime_GPSweekTow(0, static_cast<int32_t>(vnObs.timeOutputs->gpsWeek), static_cast<double>(vnObs.timeOutputs->gpsTow) * 1e-9L));
     }
     else
     {
-        // VN-100 vnObs->insTime is set from
+        // VN-100 vnObs.insTime is set from
         // - 'timeSyncMaster->ppsTime + timeSyncIn' when working together with the VN-310E or
         // - the computer time
-        imuObs->insTime = vnObs->insTime;
+        imuObs->insTime = vnObs.insTime;
     }
 
-    if (vnObs->timeOutputs)
+    if (vnObs.timeOutputs)
     {
-        if (vnObs->timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_TIMESTARTUP)
+        if (vnObs.timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_TIMESTARTUP)
         {
-            imuObs->timeSinceStartup = vnObs->timeOutputs->timeStartup;
+            imuObs->timeSinceStartup = vnObs.timeOutputs->timeStartup;
         }
     }
     bool accelFound = false;
     bool gyroFound = false;
-    if (vnObs->imuOutputs)
+    if (vnObs.imuOutputs)
     {
         if (!_useCompensatedData)
         {
-            if (vnObs->imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_UNCOMPMAG)
+            if (vnObs.imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_UNCOMPMAG)
             {
-                imuObs->p_magneticField = vnObs->imuOutputs->uncompMag.cast<double>();
+                imuObs->p_magneticField = vnObs.imuOutputs->uncompMag.cast<double>();
             }
-            if (vnObs->imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_UNCOMPACCEL)
+            if (vnObs.imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_UNCOMPACCEL)
             {
-                imuObs->p_acceleration = vnObs->imuOutputs->uncompAccel.cast<double>();
+                imuObs->p_acceleration = vnObs.imuOutputs->uncompAccel.cast<double>();
                 accelFound = true;
             }
-            if (vnObs->imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_UNCOMPGYRO)
+            if (vnObs.imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_UNCOMPGYRO)
             {
-                imuObs->p_angularRate = vnObs->imuOutputs->uncompGyro.cast<double>();
+                imuObs->p_angularRate = vnObs.imuOutputs->uncompGyro.cast<double>();
                 gyroFound = true;
             }
         }
         else
         {
-            if (vnObs->imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_MAG)
+            if (vnObs.imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_MAG)
             {
-                imuObs->p_magneticField = vnObs->imuOutputs->mag.cast<double>();
+                imuObs->p_magneticField = vnObs.imuOutputs->mag.cast<double>();
             }
-            if (vnObs->imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_ACCEL)
+            if (vnObs.imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_ACCEL)
             {
-                imuObs->p_acceleration = vnObs->imuOutputs->accel.cast<double>();
+                imuObs->p_acceleration = vnObs.imuOutputs->accel.cast<double>();
                 accelFound = true;
             }
-            if (vnObs->imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_ANGULARRATE)
+            if (vnObs.imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_ANGULARRATE)
             {
-                imuObs->p_angularRate = vnObs->imuOutputs->angularRate.cast<double>();
+                imuObs->p_angularRate = vnObs.imuOutputs->angularRate.cast<double>();
                 gyroFound = true;
             }
         }
-        if (vnObs->imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_TEMP)
+        if (vnObs.imuOutputs->imuField & vn::protocol::uart::ImuGroup::IMUGROUP_TEMP)
         {
-            imuObs->temperature = vnObs->imuOutputs->temp;
+            imuObs->temperature = vnObs.imuOutputs->temp;
         }
     }
 
@@ -394,154 +395,154 @@ std::shared_ptr<const NAV::ImuObs> NAV::VectorNavBinaryConverter::convert2ImuObs
     return nullptr;
 }
 
-std::shared_ptr<const NAV::PosVelAtt> NAV::VectorNavBinaryConverter::convert2PosVelAtt(const std::shared_ptr<const VectorNavBinaryOutput>& vnObs) // NOLINT(readability-convert-member-functions-to-static)
+std::shared_ptr<const NAV::PosVelAtt> NAV::VectorNavBinaryConverter::convert2PosVelAtt(const VectorNavBinaryOutput::View& vnObs) // NOLINT(readability-convert-member-functions-to-static)
 {
     std::optional<Eigen::Quaterniond> n_Quat_b;
     std::optional<Eigen::Vector3d> e_position;
     std::optional<Eigen::Vector3d> lla_position;
     std::optional<Eigen::Vector3d> n_velocity;
 
-    if (vnObs->attitudeOutputs)
+    if (vnObs.attitudeOutputs)
     {
-        if (vnObs->attitudeOutputs->attitudeField & vn::protocol::uart::AttitudeGroup::ATTITUDEGROUP_QUATERNION)
+        if (vnObs.attitudeOutputs->attitudeField & vn::protocol::uart::AttitudeGroup::ATTITUDEGROUP_QUATERNION)
         {
-            n_Quat_b = vnObs->attitudeOutputs->qtn.cast<double>();
+            n_Quat_b = vnObs.attitudeOutputs->qtn.cast<double>();
         }
-        else if (vnObs->attitudeOutputs->attitudeField & vn::protocol::uart::AttitudeGroup::ATTITUDEGROUP_YAWPITCHROLL)
+        else if (vnObs.attitudeOutputs->attitudeField & vn::protocol::uart::AttitudeGroup::ATTITUDEGROUP_YAWPITCHROLL)
         {
-            Eigen::Vector3d ypr = deg2rad(vnObs->attitudeOutputs->ypr.cast<double>());
+            Eigen::Vector3d ypr = deg2rad(vnObs.attitudeOutputs->ypr.cast<double>());
             n_Quat_b = trafo::n_Quat_b(ypr(2), ypr(1), ypr(0));
         }
-        else if (vnObs->attitudeOutputs->attitudeField & vn::protocol::uart::AttitudeGroup::ATTITUDEGROUP_DCM)
+        else if (vnObs.attitudeOutputs->attitudeField & vn::protocol::uart::AttitudeGroup::ATTITUDEGROUP_DCM)
         {
-            n_Quat_b = vnObs->attitudeOutputs->dcm.cast<double>();
+            n_Quat_b = vnObs.attitudeOutputs->dcm.cast<double>();
         }
     }
 
     auto posVelAttObs = std::make_shared<PosVelAtt>();
 
     if ((_posVelSource == PosVelSource_Best || _posVelSource == PosVelSource_Ins)
-        && vnObs->insOutputs
-        && (vnObs->insOutputs->insStatus.mode() == NAV::vendor::vectornav::InsStatus::Mode::Aligning
-            || vnObs->insOutputs->insStatus.mode() == NAV::vendor::vectornav::InsStatus::Mode::Tracking))
+        && vnObs.insOutputs
+        && (vnObs.insOutputs->insStatus.mode() == NAV::vendor::vectornav::InsStatus::Mode::Aligning
+            || vnObs.insOutputs->insStatus.mode() == NAV::vendor::vectornav::InsStatus::Mode::Tracking))
     {
-        if (!vnObs->timeOutputs
-            || !(vnObs->timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_TIMESTATUS)
-            || !vnObs->timeOutputs->timeStatus.dateOk()
-            || !vnObs->timeOutputs->timeStatus.timeOk()
-            || !(vnObs->timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_GPSTOW)
-            || !(vnObs->timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_GPSWEEK))
+        if (!vnObs.timeOutputs
+            || !(vnObs.timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_TIMESTATUS)
+            || !vnObs.timeOutputs->timeStatus.dateOk()
+            || !vnObs.timeOutputs->timeStatus.timeOk()
+            || !(vnObs.timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_GPSTOW)
+            || !(vnObs.timeOutputs->timeField & vn::protocol::uart::TimeGroup::TIMEGROUP_GPSWEEK))
         {
             return nullptr;
         }
 
-        posVelAttObs->insTime = InsTime(InsTime_GPSweekTow(0, static_cast<int32_t>(vnObs->timeOutputs->gpsWeek), static_cast<double>(vnObs->timeOutputs->gpsTow) * 1e-9L));
+        posVelAttObs->insTime = InsTime(InsTime_GPSweekTow(0, static_cast<int32_t>(vnObs.timeOutputs->gpsWeek), static_cast<double>(vnObs.timeOutputs->gpsTow) * 1e-9L));
 
-        if (vnObs->insOutputs->insField & vn::protocol::uart::InsGroup::INSGROUP_POSLLA)
+        if (vnObs.insOutputs->insField & vn::protocol::uart::InsGroup::INSGROUP_POSLLA)
         {
-            lla_position = { deg2rad(vnObs->insOutputs->posLla(0)),
-                             deg2rad(vnObs->insOutputs->posLla(1)),
-                             vnObs->insOutputs->posLla(2) };
+            lla_position = { deg2rad(vnObs.insOutputs->posLla(0)),
+                             deg2rad(vnObs.insOutputs->posLla(1)),
+                             vnObs.insOutputs->posLla(2) };
         }
-        if (vnObs->insOutputs->insField & vn::protocol::uart::InsGroup::INSGROUP_POSECEF)
+        if (vnObs.insOutputs->insField & vn::protocol::uart::InsGroup::INSGROUP_POSECEF)
         {
-            e_position = vnObs->insOutputs->posEcef;
+            e_position = vnObs.insOutputs->posEcef;
         }
 
-        if (vnObs->insOutputs->insField & vn::protocol::uart::InsGroup::INSGROUP_VELNED)
+        if (vnObs.insOutputs->insField & vn::protocol::uart::InsGroup::INSGROUP_VELNED)
         {
-            n_velocity = vnObs->insOutputs->velNed.cast<double>();
+            n_velocity = vnObs.insOutputs->velNed.cast<double>();
         }
-        else if ((vnObs->insOutputs->insField & vn::protocol::uart::InsGroup::INSGROUP_VELECEF)
+        else if ((vnObs.insOutputs->insField & vn::protocol::uart::InsGroup::INSGROUP_VELECEF)
                  && (e_position.has_value() || lla_position.has_value()))
         {
             Eigen::Vector3d lla = lla_position.has_value() ? lla_position.value() : trafo::ecef2lla_WGS84(e_position.value());
-            n_velocity = trafo::n_Quat_e(lla(0), lla(1)) * vnObs->insOutputs->velEcef.cast<double>();
+            n_velocity = trafo::n_Quat_e(lla(0), lla(1)) * vnObs.insOutputs->velEcef.cast<double>();
         }
-        else if ((vnObs->insOutputs->insField & vn::protocol::uart::InsGroup::INSGROUP_VELBODY)
+        else if ((vnObs.insOutputs->insField & vn::protocol::uart::InsGroup::INSGROUP_VELBODY)
                  && n_Quat_b.has_value())
         {
-            n_velocity = n_Quat_b.value() * vnObs->insOutputs->velBody.cast<double>();
+            n_velocity = n_Quat_b.value() * vnObs.insOutputs->velBody.cast<double>();
         }
     }
 
     if ((_posVelSource == PosVelSource_Best || _posVelSource == PosVelSource_Gnss1)
-        && vnObs->gnss1Outputs && vnObs->gnss1Outputs->fix >= 2)
+        && vnObs.gnss1Outputs && vnObs.gnss1Outputs->fix >= 2)
     {
-        if (!vnObs->gnss1Outputs
-            || !vnObs->gnss1Outputs->timeInfo.status.timeOk()
-            || !vnObs->gnss1Outputs->timeInfo.status.dateOk())
+        if (!vnObs.gnss1Outputs
+            || !vnObs.gnss1Outputs->timeInfo.status.timeOk()
+            || !vnObs.gnss1Outputs->timeInfo.status.dateOk())
         {
             return nullptr;
         }
 
-        posVelAttObs->insTime = InsTime(InsTime_GPSweekTow(0, static_cast<int32_t>(vnObs->gnss1Outputs->week), static_cast<double>(vnObs->gnss1Outputs->tow) * 1e-9L));
+        posVelAttObs->insTime = InsTime(InsTime_GPSweekTow(0, static_cast<int32_t>(vnObs.gnss1Outputs->week), static_cast<double>(vnObs.gnss1Outputs->tow) * 1e-9L));
 
         if (!e_position.has_value() && !lla_position.has_value())
         {
-            if (vnObs->gnss1Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_POSLLA)
+            if (vnObs.gnss1Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_POSLLA)
             {
-                lla_position = { deg2rad(vnObs->gnss1Outputs->posLla(0)),
-                                 deg2rad(vnObs->gnss1Outputs->posLla(1)),
-                                 vnObs->gnss1Outputs->posLla(2) };
+                lla_position = { deg2rad(vnObs.gnss1Outputs->posLla(0)),
+                                 deg2rad(vnObs.gnss1Outputs->posLla(1)),
+                                 vnObs.gnss1Outputs->posLla(2) };
             }
-            if (vnObs->gnss1Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_POSECEF)
+            if (vnObs.gnss1Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_POSECEF)
             {
-                e_position = vnObs->gnss1Outputs->posEcef;
+                e_position = vnObs.gnss1Outputs->posEcef;
             }
         }
 
         if (!n_velocity.has_value())
         {
-            if (vnObs->gnss1Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_VELNED)
+            if (vnObs.gnss1Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_VELNED)
             {
-                n_velocity = vnObs->gnss1Outputs->velNed.cast<double>();
+                n_velocity = vnObs.gnss1Outputs->velNed.cast<double>();
             }
-            else if ((vnObs->gnss1Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_VELECEF)
+            else if ((vnObs.gnss1Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_VELECEF)
                      && (e_position.has_value() || lla_position.has_value()))
             {
                 Eigen::Vector3d lla = lla_position.has_value() ? lla_position.value() : trafo::ecef2lla_WGS84(e_position.value());
-                n_velocity = trafo::n_Quat_e(lla(0), lla(1)) * vnObs->gnss1Outputs->velEcef.cast<double>();
+                n_velocity = trafo::n_Quat_e(lla(0), lla(1)) * vnObs.gnss1Outputs->velEcef.cast<double>();
             }
         }
     }
     if ((_posVelSource == PosVelSource_Best || _posVelSource == PosVelSource_Gnss2)
-        && vnObs->gnss2Outputs && vnObs->gnss2Outputs->fix >= 2)
+        && vnObs.gnss2Outputs && vnObs.gnss2Outputs->fix >= 2)
     {
-        if (!vnObs->gnss2Outputs
-            || !vnObs->gnss2Outputs->timeInfo.status.timeOk()
-            || !vnObs->gnss2Outputs->timeInfo.status.dateOk())
+        if (!vnObs.gnss2Outputs
+            || !vnObs.gnss2Outputs->timeInfo.status.timeOk()
+            || !vnObs.gnss2Outputs->timeInfo.status.dateOk())
         {
             return nullptr;
         }
 
-        posVelAttObs->insTime = InsTime(InsTime_GPSweekTow(0, static_cast<int32_t>(vnObs->gnss2Outputs->week), static_cast<double>(vnObs->gnss2Outputs->tow) * 1e-9L));
+        posVelAttObs->insTime = InsTime(InsTime_GPSweekTow(0, static_cast<int32_t>(vnObs.gnss2Outputs->week), static_cast<double>(vnObs.gnss2Outputs->tow) * 1e-9L));
 
         if (!e_position.has_value() && !lla_position.has_value())
         {
-            if (vnObs->gnss2Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_POSLLA)
+            if (vnObs.gnss2Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_POSLLA)
             {
-                lla_position = { deg2rad(vnObs->gnss2Outputs->posLla(0)),
-                                 deg2rad(vnObs->gnss2Outputs->posLla(1)),
-                                 vnObs->gnss2Outputs->posLla(2) };
+                lla_position = { deg2rad(vnObs.gnss2Outputs->posLla(0)),
+                                 deg2rad(vnObs.gnss2Outputs->posLla(1)),
+                                 vnObs.gnss2Outputs->posLla(2) };
             }
-            if (vnObs->gnss2Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_POSECEF)
+            if (vnObs.gnss2Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_POSECEF)
             {
-                e_position = vnObs->gnss2Outputs->posEcef;
+                e_position = vnObs.gnss2Outputs->posEcef;
             }
         }
 
         if (!n_velocity.has_value())
         {
-            if (vnObs->gnss2Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_VELNED)
+            if (vnObs.gnss2Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_VELNED)
             {
-                n_velocity = vnObs->gnss2Outputs->velNed.cast<double>();
+                n_velocity = vnObs.gnss2Outputs->velNed.cast<double>();
             }
-            else if ((vnObs->gnss2Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_VELECEF)
+            else if ((vnObs.gnss2Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_VELECEF)
                      && (e_position.has_value() || lla_position.has_value()))
             {
                 Eigen::Vector3d lla = lla_position.has_value() ? lla_position.value() : trafo::ecef2lla_WGS84(e_position.value());
-                n_velocity = trafo::n_Quat_e(lla(0), lla(1)) * vnObs->gnss2Outputs->velEcef.cast<double>();
+                n_velocity = trafo::n_Quat_e(lla(0), lla(1)) * vnObs.gnss2Outputs->velEcef.cast<double>();
             }
         }
     }
@@ -586,24 +587,24 @@ std::shared_ptr<const NAV::PosVelAtt> NAV::VectorNavBinaryConverter::convert2Pos
     return nullptr;
 }
 
-std::shared_ptr<const NAV::GnssObs> NAV::VectorNavBinaryConverter::convert2GnssObs(const std::shared_ptr<const VectorNavBinaryOutput>& vnObs)
+std::shared_ptr<const NAV::GnssObs> NAV::VectorNavBinaryConverter::convert2GnssObs(const VectorNavBinaryOutput::View& vnObs)
 {
     auto gnssObs = std::make_shared<GnssObs>();
 
-    if (!vnObs->gnss1Outputs
-        || !vnObs->gnss1Outputs->timeInfo.status.timeOk()
-        || !vnObs->gnss1Outputs->timeInfo.status.dateOk())
+    if (!vnObs.gnss1Outputs
+        || !vnObs.gnss1Outputs->timeInfo.status.timeOk()
+        || !vnObs.gnss1Outputs->timeInfo.status.dateOk())
     {
         return nullptr;
     }
 
-    gnssObs->insTime = InsTime(InsTime_GPSweekTow(0, static_cast<int32_t>(vnObs->gnss1Outputs->raw.week), vnObs->gnss1Outputs->raw.tow));
+    gnssObs->insTime = InsTime(InsTime_GPSweekTow(0, static_cast<int32_t>(vnObs.gnss1Outputs->raw.week), vnObs.gnss1Outputs->raw.tow));
 
-    if (vnObs->gnss1Outputs)
+    if (vnObs.gnss1Outputs)
     {
-        if (vnObs->gnss1Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_RAWMEAS)
+        if (vnObs.gnss1Outputs->gnssField & vn::protocol::uart::GpsGroup::GPSGROUP_RAWMEAS)
         {
-            for (const auto& satRaw : vnObs->gnss1Outputs->raw.satellites)
+            for (const auto& satRaw : vnObs.gnss1Outputs->raw.satellites)
             {
                 bool skipMeasurement = false;
                 SatelliteSystem satSys = SatSys_None;
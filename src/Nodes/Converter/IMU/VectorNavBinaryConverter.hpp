@@ -109,24 +109,24 @@ class VectorNavBinaryConverter : public Node
     void receiveObs(InputPin::NodeDataQueue& queue, size_t pinIdx);
 
     /// @brief Converts the VectorNavBinaryOutput to a ImuObsWDelta observation
-    /// @param[in] vnObs VectorNavBinaryOutput to process
+    /// @param[in] vnObs View on the VectorNavBinaryOutput to process
     /// @return The converted data
-    std::shared_ptr<const ImuObsWDelta> convert2ImuObsWDelta(const std::shared_ptr<const VectorNavBinaryOutput>& vnObs);
+    std::shared_ptr<const ImuObsWDelta> convert2ImuObsWDelta(const VectorNavBinaryOutput::View& vnObs);
 
     /// @brief Converts the VectorNavBinaryOutput to a ImuObs observation
-    /// @param[in] vnObs VectorNavBinaryOutput to process
+    /// @param[in] vnObs View on the VectorNavBinaryOutput to process
     /// @return The converted data
-    std::shared_ptr<const ImuObs> convert2ImuObs(const std::shared_ptr<const VectorNavBinaryOutput>& vnObs);
+    std::shared_ptr<const ImuObs> convert2ImuObs(const VectorNavBinaryOutput::View& vnObs);
 
     /// @brief Converts the VectorNavBinaryOutput to a PosVelAtt observation
-    /// @param[in] vnObs VectorNavBinaryOutput to process
+    /// @param[in] vnObs View on the VectorNavBinaryOutput to process
     /// @return The converted data
-    std::shared_ptr<const PosVelAtt> convert2PosVelAtt(const std::shared_ptr<const VectorNavBinaryOutput>& vnObs);
+    std::shared_ptr<const PosVelAtt> convert2PosVelAtt(const VectorNavBinaryOutput::View& vnObs);
 
     /// @brief Converts the VectorNavBinaryOutput to a GnssObs observation
-    /// @param[in] vnObs VectorNavBinaryOutput to process
+    /// @param[in] vnObs View on the VectorNavBinaryOutput to process
     /// @return The converted data
-    static std::shared_ptr<const GnssObs> convert2GnssObs(const std::shared_ptr<const VectorNavBinaryOutput>& vnObs);
+    static std::shared_ptr<const GnssObs> convert2GnssObs(const VectorNavBinaryOutput::View& vnObs);
 };
 
 /// @brief Converts the enum to a string
@@ -0,0 +1,488 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "IpcRecv.hpp"
+
+#include <chrono>
+#include <filesystem>
+
+#include <imgui_stdlib.h>
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "internal/FlowManager.hpp"
+
+#include "internal/gui/widgets/EnumCombo.hpp"
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+#include "internal/gui/NodeEditorApplication.hpp"
+
+#include "NodeData/NodeDataSerializer.hpp"
+#include "NodeData/State/PosVelAtt.hpp"
+#include "NodeRegistry.hpp"
+
+#include "util/Logger.hpp"
+
+NAV::IpcRecv::IpcRecv()
+    : Node(typeStatic()), _socketPath((std::filesystem::temp_directory_path() / "instinct-link.sock").string()), _dataType(PosVelAtt::type())
+{
+    LOG_TRACE("{}: called", name);
+
+    _hasConfig = true;
+    _guiConfigDefaultWindowSize = { 380, 170 };
+
+    nm::CreateOutputPin(this, _dataType.c_str(), Pin::Type::Flow, { _dataType }, &IpcRecv::pollData);
+}
+
+NAV::IpcRecv::~IpcRecv()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    stopReceiver();
+    if (_ring)
+    {
+        _ring.reset();
+        SharedMemoryRing::remove(_shmName);
+    }
+}
+
+std::string NAV::IpcRecv::typeStatic()
+{
+    return "IpcRecv";
+}
+
+std::string NAV::IpcRecv::type() const
+{
+    return typeStatic();
+}
+
+std::string NAV::IpcRecv::category()
+{
+    return "Data Link";
+}
+
+void NAV::IpcRecv::guiConfig()
+{
+    ImGui::SetNextItemWidth(150 * gui::NodeEditorApplication::windowFontRatio());
+    if (gui::widgets::EnumCombo(fmt::format("Transport##{}", size_t(id)).c_str(), _transport))
+    {
+        LOG_DEBUG("{}: Transport changed to {}", nameId(), to_string(_transport));
+        flow::ApplyChanges();
+        doDeinitialize();
+    }
+    if (_transport == IpcTransport::SharedMemory)
+    {
+        ImGui::SetNextItemWidth(250 * gui::NodeEditorApplication::windowFontRatio());
+        if (ImGui::InputText(fmt::format("Name##{}", size_t(id)).c_str(), &_shmName))
+        {
+            LOG_DEBUG("{}: Shared memory name changed to {}", nameId(), _shmName);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+        ImGui::SetNextItemWidth(150 * gui::NodeEditorApplication::windowFontRatio());
+        if (ImGui::InputIntL(fmt::format("Capacity [MiB]##{}", size_t(id)).c_str(), &_shmCapacity, 1, 1024, 1, 16))
+        {
+            LOG_DEBUG("{}: Shared memory capacity changed to {}", nameId(), _shmCapacity);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+        ImGui::SameLine();
+        gui::widgets::HelpMarker("Only used if the shared memory is created by this node.\n"
+                                 "Otherwise the capacity of the sender is used.");
+    }
+    else
+    {
+        if (!IPC_HAS_UNIX_SOCKETS)
+        {
+            ImGui::TextColored(ImColor(255, 0, 0), "Unix sockets are not supported on this platform");
+        }
+        ImGui::SetNextItemWidth(250 * gui::NodeEditorApplication::windowFontRatio());
+        if (ImGui::InputText(fmt::format("Socket path##{}", size_t(id)).c_str(), &_socketPath))
+        {
+            LOG_DEBUG("{}: Socket path changed to {}", nameId(), _socketPath);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+    }
+
+    ImGui::SetNextItemWidth(150 * gui::NodeEditorApplication::windowFontRatio());
+    if (ImGui::BeginCombo(fmt::format("Data type##{}", size_t(id)).c_str(), _dataType.c_str()))
+    {
+        for (const auto& dataType : NodeDataSerializer::SupportedTypes())
+        {
+            const bool isSelected = (_dataType == dataType);
+            if (ImGui::Selectable(dataType.c_str(), isSelected))
+            {
+                {
+                    std::scoped_lock lk(_mutex);
+                    _dataType = dataType;
+                }
+                LOG_DEBUG("{}: Data type changed to {}", nameId(), _dataType);
+                updateOutputPin();
+                flow::ApplyChanges();
+            }
+            if (isSelected) { ImGui::SetItemDefaultFocus(); }
+        }
+        ImGui::EndCombo();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Type of the data sent by the IpcSend node.\n"
+                             "Types which can not be transported with all their members are received as DynamicData.");
+
+    ImGui::SetNextItemWidth(150 * gui::NodeEditorApplication::windowFontRatio());
+    if (ImGui::InputDoubleL(fmt::format("Start timeout##{}", size_t(id)).c_str(), &_startTimeout, 0.0, 3600.0, 1.0, 10.0, "%.1f s"))
+    {
+        LOG_DEBUG("{}: Start timeout changed to {}", nameId(), _startTimeout);
+        flow::ApplyChanges();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Time to wait for the first data when the flow is started.\n"
+                             "If the sender does not send any data within this time, the output pin is finished.");
+
+    if (isInitialized())
+    {
+        ImGui::Text("Received %zu messages", _messagesReceived.load());
+        if (auto dropped = _messagesDropped.load())
+        {
+            ImGui::TextColored(ImColor(255, 0, 0), "Dropped %zu messages with a wrong data type", dropped);
+        }
+    }
+}
+
+json NAV::IpcRecv::save() const
+{
+    LOG_TRACE("{}: called", nameId());
+
+    json j;
+
+    j["transport"] = _transport;
+    j["shmName"] = _shmName;
+    j["shmCapacity"] = _shmCapacity;
+    j["socketPath"] = _socketPath;
+    j["dataType"] = _dataType;
+    j["startTimeout"] = _startTimeout;
+
+    return j;
+}
+
+void NAV::IpcRecv::restore(json const& j)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (j.contains("transport"))
+    {
+        j.at("transport").get_to(_transport);
+    }
+    if (j.contains("shmName"))
+    {
+        j.at("shmName").get_to(_shmName);
+    }
+    if (j.contains("shmCapacity"))
+    {
+        j.at("shmCapacity").get_to(_shmCapacity);
+    }
+    if (j.contains("socketPath"))
+    {
+        j.at("socketPath").get_to(_socketPath);
+    }
+    if (j.contains("dataType"))
+    {
+        {
+            std::scoped_lock lk(_mutex);
+            j.at("dataType").get_to(_dataType);
+        }
+        updateOutputPin();
+    }
+    if (j.contains("startTimeout"))
+    {
+        j.at("startTimeout").get_to(_startTimeout);
+    }
+}
+
+void NAV::IpcRecv::updateOutputPin()
+{
+    if (outputPins.empty()) { return; }
+
+    outputPins.at(OUTPUT_PORT_INDEX_NODE_DATA).dataIdentifier = { _dataType };
+    outputPins.at(OUTPUT_PORT_INDEX_NODE_DATA).name = _dataType;
+
+    for (auto& link : outputPins.at(OUTPUT_PORT_INDEX_NODE_DATA).links)
+    {
+        if (auto* connectedPin = link.getConnectedPin())
+        {
+            outputPins.at(OUTPUT_PORT_INDEX_NODE_DATA).recreateLink(*connectedPin);
+        }
+    }
+}
+
+bool NAV::IpcRecv::initialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    stopReceiver();
+    {
+        std::scoped_lock lk(_mutex);
+        _buffer.clear();
+    }
+    _stopRequested = false;
+
+    if (_transport == IpcTransport::SharedMemory)
+    {
+        _ring.reset(); // Unregisters from the segment before registering again
+        try
+        {
+            _ring = std::make_unique<SharedMemoryRing>(_shmName, static_cast<size_t>(_shmCapacity) * 1024 * 1024, SharedMemoryRing::Role::Consumer);
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("{}: Could not open the shared memory '{}': {}", nameId(), _shmName, e.what());
+            return false;
+        }
+        if (_ring->discardedStaleData())
+        {
+            LOG_WARN("{}: Discarded the data left in the shared memory '{}' by a sender which crashed", nameId(), _shmName);
+        }
+        LOG_DEBUG("{}: Opened the shared memory '{}' with a capacity of {} bytes", nameId(), _shmName, _ring->capacity());
+        _receiveThread = std::thread(&IpcRecv::receiveSharedMemory, this);
+        return true;
+    }
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+    try
+    {
+        std::filesystem::remove(_socketPath); // Left over from a previous run
+        _ioContext.restart();
+        _acceptor = std::make_unique<boost::asio::local::stream_protocol::acceptor>(_ioContext, boost::asio::local::stream_protocol::endpoint(_socketPath));
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("{}: Could not open the socket '{}': {}", nameId(), _socketPath, e.what());
+        return false;
+    }
+    LOG_DEBUG("{}: Listening on the socket '{}'", nameId(), _socketPath);
+    _receiveThread = std::thread(&IpcRecv::receiveSocket, this);
+    return true;
+#else
+    LOG_ERROR("{}: Unix sockets are not supported on this platform", nameId());
+    return false;
+#endif
+}
+
+void NAV::IpcRecv::deinitialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    stopReceiver();
+    if (_ring)
+    {
+        _ring.reset();
+        SharedMemoryRing::remove(_shmName);
+    }
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+    _socket.reset();
+    if (_acceptor)
+    {
+        _acceptor.reset();
+        std::filesystem::remove(_socketPath);
+    }
+#endif
+}
+
+bool NAV::IpcRecv::resetNode()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    _waitingForStart = true;
+    _messagesReceived = 0;
+    _messagesDropped = 0;
+
+    return true;
+}
+
+void NAV::IpcRecv::stopReceiver()
+{
+    {
+        std::scoped_lock lk(_mutex);
+        _stopRequested = true;
+    }
+    _cv.notify_all();
+
+    if (_receiveThread.joinable())
+    {
+        _receiveThread.join();
+    }
+}
+
+std::shared_ptr<const NAV::NodeData> NAV::IpcRecv::pollData(size_t /* pinIdx */, bool peek)
+{
+    std::shared_ptr<const NodeData> obs;
+    {
+        std::unique_lock lk(_mutex);
+
+        auto start = std::chrono::steady_clock::now();
+        while (_buffer.empty())
+        {
+            if (_stopRequested) { return nullptr; }
+            if (_waitingForStart)
+            {
+                // The FlowExecutor peeks the first observation before enabling the callbacks
+                if (!callbacksEnabled && std::chrono::steady_clock::now() - start > std::chrono::duration<double>(_startTimeout))
+                {
+                    LOG_WARN("{}: Did not receive any data within {} s", nameId(), _startTimeout);
+                    return nullptr;
+                }
+            }
+            else if (!callbacksEnabled) // Flow was stopped
+            {
+                return nullptr;
+            }
+            _cv.wait_for(lk, std::chrono::milliseconds(10));
+        }
+        if (callbacksEnabled) { _waitingForStart = false; }
+
+        obs = _buffer.front();
+        if (obs == nullptr) // End of stream
+        {
+            _buffer.pop_front();
+            _cv.notify_all();
+            LOG_DEBUG("{}: The sender finished after {} messages", nameId(), _messagesReceived);
+            return nullptr;
+        }
+        if (!peek)
+        {
+            _buffer.pop_front();
+            _cv.notify_all();
+        }
+    }
+
+    if (!peek)
+    {
+        _messagesReceived++;
+        invokeCallbacks(OUTPUT_PORT_INDEX_NODE_DATA, obs);
+    }
+    return obs;
+}
+
+void NAV::IpcRecv::bufferMessage(const std::vector<uint8_t>& message)
+{
+    std::shared_ptr<const NodeData> obs;
+    switch (NodeDataSerializer::GetMessageType(message))
+    {
+    case NodeDataSerializer::MessageType::Data:
+    {
+        // Downstream nodes cast the data to the type of the output pin
+        auto dataType = NodeDataSerializer::GetDataType(message);
+        std::string expectedType;
+        {
+            std::scoped_lock lk(_mutex);
+            expectedType = _dataType;
+        }
+        if (!NodeRegistry::NodeDataTypeAnyIsChildOf({ dataType }, { expectedType }))
+        {
+            if (_messagesDropped++ == 0)
+            {
+                LOG_ERROR("{}: Dropping the received data of type '{}', because the output pin has the type '{}'", nameId(), dataType, expectedType);
+            }
+            return;
+        }
+        obs = NodeDataSerializer::Deserialize(message, _imuPositions);
+        if (obs == nullptr) { return; }
+        break;
+    }
+    case NodeDataSerializer::MessageType::EndOfStream:
+        break;
+    case NodeDataSerializer::MessageType::Invalid:
+        LOG_ERROR("{}: Received an invalid message with {} bytes", nameId(), message.size());
+        return;
+    }
+
+    std::unique_lock lk(_mutex);
+    _cv.wait(lk, [&]() { return _buffer.size() < MAX_BUFFERED_MESSAGES || _stopRequested; });
+    _buffer.push_back(obs);
+    _cv.notify_all();
+}
+
+void NAV::IpcRecv::receiveSharedMemory()
+{
+    std::vector<uint8_t> message;
+    while (!_stopRequested)
+    {
+        if (_ring->pop(message))
+        {
+            bufferMessage(message);
+        }
+        else
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+}
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+
+void NAV::IpcRecv::receiveSocket()
+{
+    asyncAccept();
+    while (!_stopRequested)
+    {
+        _ioContext.run_for(std::chrono::milliseconds(100));
+        if (_ioContext.stopped()) { _ioContext.restart(); }
+    }
+
+    boost::system::error_code ec;
+    _acceptor->close(ec);
+    if (_socket) { _socket->close(ec); }
+    _ioContext.run(); // Let the cancelled handlers finish
+}
+
+void NAV::IpcRecv::asyncAccept()
+{
+    _socket = std::make_unique<boost::asio::local::stream_protocol::socket>(_ioContext);
+    _acceptor->async_accept(*_socket, [this](const boost::system::error_code& ec) {
+        if (ec) { return; }
+        LOG_DEBUG("{}: Sender connected", nameId());
+        asyncReadMessage();
+    });
+}
+
+void NAV::IpcRecv::asyncReadMessage()
+{
+    boost::asio::async_read(*_socket, boost::asio::buffer(&_messageSize, sizeof(_messageSize)), [this](const boost::system::error_code& ec, size_t /* bytes */) {
+        if (ec)
+        {
+            if (ec != boost::asio::error::operation_aborted && !_stopRequested)
+            {
+                LOG_DEBUG("{}: Sender disconnected ({})", nameId(), ec.message());
+                asyncAccept();
+            }
+            return;
+        }
+        if (_messageSize > MAX_MESSAGE_SIZE)
+        {
+            LOG_ERROR("{}: Received a message size of {} bytes. Dropping the connection, as the stream is corrupt.", nameId(), _messageSize);
+            asyncAccept();
+            return;
+        }
+        _message.resize(_messageSize);
+        boost::asio::async_read(*_socket, boost::asio::buffer(_message), [this](const boost::system::error_code& messageEc, size_t /* bytes */) {
+            if (messageEc)
+            {
+                if (messageEc != boost::asio::error::operation_aborted && !_stopRequested)
+                {
+                    LOG_WARN("{}: Sender disconnected in the middle of a message ({})", nameId(), messageEc.message());
+                    asyncAccept();
+                }
+                return;
+            }
+            bufferMessage(_message);
+            asyncReadMessage();
+        });
+    });
+}
+
+#endif
@@ -0,0 +1,172 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file IpcRecv.hpp
+/// @brief Receives the data of a flow pin from another process on the same machine
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-10
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "internal/Node/Node.hpp"
+#include "NodeData/IMU/ImuPos.hpp"
+#include "util/Ipc/IpcTransport.hpp"
+#include "util/Ipc/SharedMemoryRing.hpp"
+
+namespace NAV
+{
+/// @brief Receives the data sent by an IpcSend node in another process on the same machine
+///
+/// A receiver thread reads and deserializes the messages into a buffer. The output pin polls the buffer,
+/// so that the observations are sorted by their time in post-processing like data from a file.
+/// The end of stream message of the sender finishes the output pin.
+class IpcRecv : public Node
+{
+  public:
+    /// @brief Default constructor
+    IpcRecv();
+    /// @brief Destructor
+    ~IpcRecv() override;
+    /// @brief Copy constructor
+    IpcRecv(const IpcRecv&) = delete;
+    /// @brief Move constructor
+    IpcRecv(IpcRecv&&) = delete;
+    /// @brief Copy assignment operator
+    IpcRecv& operator=(const IpcRecv&) = delete;
+    /// @brief Move assignment operator
+    IpcRecv& operator=(IpcRecv&&) = delete;
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] static std::string typeStatic();
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] std::string type() const override;
+
+    /// @brief String representation of the Class Category
+    [[nodiscard]] static std::string category();
+
+    /// @brief ImGui config window which is shown on double click
+    /// @attention Don't forget to set _hasConfig to true in the constructor of the node
+    void guiConfig() override;
+
+    /// @brief Saves the node into a json object
+    [[nodiscard]] json save() const override;
+
+    /// @brief Restores the node from a json object
+    /// @param[in] j Json object with the node state
+    void restore(const json& j) override;
+
+    /// @brief Resets the node. Already received data is kept, as the sender might already be running.
+    bool resetNode() override;
+
+  private:
+    constexpr static size_t OUTPUT_PORT_INDEX_NODE_DATA = 0; ///< @brief Flow (NodeData)
+
+    /// Maximum amount of buffered observations. Afterwards the receiver thread stops reading, which blocks the sender.
+    constexpr static size_t MAX_BUFFERED_MESSAGES = 10000;
+    /// Maximum size of a message received over the socket. Larger sizes can only come from corrupt data.
+    constexpr static uint32_t MAX_MESSAGE_SIZE = 64 * 1024 * 1024;
+
+    /// @brief Initialize the node
+    bool initialize() override;
+
+    /// @brief Deinitialize the node
+    void deinitialize() override;
+
+    /// @brief Sets the data identifier of the output pin to the selected data type
+    void updateOutputPin();
+
+    /// @brief Polls the next observation from the buffer
+    /// @param[in] pinIdx Index of the pin the data is requested on
+    /// @param[in] peek Specifies if the data should be peeked (without removing it from the buffer) or read
+    /// @return The observation or nullptr if the sender finished
+    [[nodiscard]] std::shared_ptr<const NodeData> pollData(size_t pinIdx, bool peek);
+
+    /// @brief Stops the receiver thread and waits for it to finish
+    void stopReceiver();
+
+    /// @brief Main function of the receiver thread for the shared memory transport
+    void receiveSharedMemory();
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+    /// @brief Main function of the receiver thread for the socket transport
+    void receiveSocket();
+
+    /// @brief Accepts the next sender connection
+    void asyncAccept();
+
+    /// @brief Reads the next message from the connected sender
+    void asyncReadMessage();
+#endif
+
+    /// @brief Deserializes the message and adds it to the buffer
+    /// @param[in] message Received message
+    void bufferMessage(const std::vector<uint8_t>& message);
+
+    /// Transport to receive the data with
+    IpcTransport _transport = IpcTransport::SharedMemory;
+    /// Name of the shared memory segment
+    std::string _shmName = "instinct-link";
+    /// Capacity of the shared memory ring in [MiB], if the receiver creates it
+    int _shmCapacity = 16;
+    /// Path of the Unix socket
+    std::string _socketPath;
+    /// Data type of the output pin (guarded by the mutex, as the receiver thread checks the received data against it)
+    std::string _dataType;
+    /// Time to wait for the first observation when the flow starts in [s]
+    double _startTimeout = 10.0;
+
+    /// Shared memory ring
+    std::unique_ptr<SharedMemoryRing> _ring;
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+    /// Asio context for the socket
+    boost::asio::io_context _ioContext;
+    /// Acceptor for the sender connections
+    std::unique_ptr<boost::asio::local::stream_protocol::acceptor> _acceptor;
+    /// Unix socket connected to the sender
+    std::unique_ptr<boost::asio::local::stream_protocol::socket> _socket;
+    /// Size of the message currently read
+    uint32_t _messageSize = 0;
+    /// Message currently read
+    std::vector<uint8_t> _message;
+#endif
+
+    /// IMU positions, the received ImuObs refer to (only modified by the receiver thread)
+    std::deque<ImuPos> _imuPositions;
+
+    /// Receiver thread
+    std::thread _receiveThread;
+    /// Flag to stop the receiver thread
+    std::atomic<bool> _stopRequested = false;
+
+    /// Mutex for the buffer and the data type
+    std::mutex _mutex;
+    /// Condition variable to signal changes of the buffer
+    std::condition_variable _cv;
+    /// Received observations. A nullptr marks the end of a stream.
+    std::deque<std::shared_ptr<const NodeData>> _buffer;
+
+    /// Flag whether the flow was reset and the first observation is still awaited
+    std::atomic<bool> _waitingForStart = false;
+    /// Amount of observations received in this run
+    std::atomic<size_t> _messagesReceived = 0;
+    /// Amount of observations dropped, because their type does not match the data type of the output pin
+    std::atomic<size_t> _messagesDropped = 0;
+};
+} // namespace NAV
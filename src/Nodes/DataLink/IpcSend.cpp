@@ -0,0 +1,272 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "IpcSend.hpp"
+
+#include <array>
+#include <filesystem>
+#include <thread>
+
+#include <imgui_stdlib.h>
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "internal/FlowManager.hpp"
+
+#include "internal/gui/widgets/EnumCombo.hpp"
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+#include "internal/gui/NodeEditorApplication.hpp"
+
+#include "NodeData/NodeDataSerializer.hpp"
+
+#include "util/Logger.hpp"
+
+NAV::IpcSend::IpcSend()
+    : Node(typeStatic()), _socketPath((std::filesystem::temp_directory_path() / "instinct-link.sock").string())
+{
+    LOG_TRACE("{}: called", name);
+
+    _hasConfig = true;
+    _guiConfigDefaultWindowSize = { 380, 120 };
+
+    nm::CreateInputPin(this, "NodeData", Pin::Type::Flow, { NodeData::type() }, &IpcSend::receiveObs);
+}
+
+NAV::IpcSend::~IpcSend()
+{
+    LOG_TRACE("{}: called", nameId());
+}
+
+std::string NAV::IpcSend::typeStatic()
+{
+    return "IpcSend";
+}
+
+std::string NAV::IpcSend::type() const
+{
+    return typeStatic();
+}
+
+std::string NAV::IpcSend::category()
+{
+    return "Data Link";
+}
+
+void NAV::IpcSend::guiConfig()
+{
+    ImGui::SetNextItemWidth(150 * gui::NodeEditorApplication::windowFontRatio());
+    if (gui::widgets::EnumCombo(fmt::format("Transport##{}", size_t(id)).c_str(), _transport))
+    {
+        LOG_DEBUG("{}: Transport changed to {}", nameId(), to_string(_transport));
+        flow::ApplyChanges();
+        doDeinitialize();
+    }
+    if (_transport == IpcTransport::SharedMemory)
+    {
+        ImGui::SetNextItemWidth(250 * gui::NodeEditorApplication::windowFontRatio());
+        if (ImGui::InputText(fmt::format("Name##{}", size_t(id)).c_str(), &_shmName))
+        {
+            LOG_DEBUG("{}: Shared memory name changed to {}", nameId(), _shmName);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+        ImGui::SetNextItemWidth(150 * gui::NodeEditorApplication::windowFontRatio());
+        if (ImGui::InputIntL(fmt::format("Capacity [MiB]##{}", size_t(id)).c_str(), &_shmCapacity, 1, 1024, 1, 16))
+        {
+            LOG_DEBUG("{}: Shared memory capacity changed to {}", nameId(), _shmCapacity);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+        ImGui::SameLine();
+        gui::widgets::HelpMarker("Only used if the shared memory is created by this node.\n"
+                                 "Otherwise the capacity of the receiver is used.");
+    }
+    else
+    {
+        if (!IPC_HAS_UNIX_SOCKETS)
+        {
+            ImGui::TextColored(ImColor(255, 0, 0), "Unix sockets are not supported on this platform");
+        }
+        ImGui::SetNextItemWidth(250 * gui::NodeEditorApplication::windowFontRatio());
+        if (ImGui::InputText(fmt::format("Socket path##{}", size_t(id)).c_str(), &_socketPath))
+        {
+            LOG_DEBUG("{}: Socket path changed to {}", nameId(), _socketPath);
+            flow::ApplyChanges();
+            doDeinitialize();
+        }
+        ImGui::SameLine();
+        gui::widgets::HelpMarker("The receiving node has to be initialized first, as it opens the socket.");
+    }
+}
+
+json NAV::IpcSend::save() const
+{
+    LOG_TRACE("{}: called", nameId());
+
+    json j;
+
+    j["transport"] = _transport;
+    j["shmName"] = _shmName;
+    j["shmCapacity"] = _shmCapacity;
+    j["socketPath"] = _socketPath;
+
+    return j;
+}
+
+void NAV::IpcSend::restore(json const& j)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (j.contains("transport"))
+    {
+        j.at("transport").get_to(_transport);
+    }
+    if (j.contains("shmName"))
+    {
+        j.at("shmName").get_to(_shmName);
+    }
+    if (j.contains("shmCapacity"))
+    {
+        j.at("shmCapacity").get_to(_shmCapacity);
+    }
+    if (j.contains("socketPath"))
+    {
+        j.at("socketPath").get_to(_socketPath);
+    }
+}
+
+bool NAV::IpcSend::initialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (_transport == IpcTransport::SharedMemory)
+    {
+        _ring.reset(); // Unregisters from the segment before registering again
+        try
+        {
+            _ring = std::make_unique<SharedMemoryRing>(_shmName, static_cast<size_t>(_shmCapacity) * 1024 * 1024, SharedMemoryRing::Role::Producer);
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("{}: Could not open the shared memory '{}': {}", nameId(), _shmName, e.what());
+            return false;
+        }
+        LOG_DEBUG("{}: Opened the shared memory '{}' with a capacity of {} bytes", nameId(), _shmName, _ring->capacity());
+        return true;
+    }
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+    _socket = std::make_unique<boost::asio::local::stream_protocol::socket>(_ioContext);
+    boost::system::error_code ec;
+    _socket->connect(boost::asio::local::stream_protocol::endpoint(_socketPath), ec);
+    if (ec)
+    {
+        LOG_ERROR("{}: Could not connect to the socket '{}': {}. Is the receiving node initialized?", nameId(), _socketPath, ec.message());
+        _socket.reset();
+        return false;
+    }
+    LOG_DEBUG("{}: Connected to the socket '{}'", nameId(), _socketPath);
+    return true;
+#else
+    LOG_ERROR("{}: Unix sockets are not supported on this platform", nameId());
+    return false;
+#endif
+}
+
+void NAV::IpcSend::deinitialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    _ring.reset();
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+    if (_socket)
+    {
+        boost::system::error_code ec;
+        _socket->shutdown(boost::asio::local::stream_protocol::socket::shutdown_both, ec);
+        _socket->close(ec);
+        _socket.reset();
+    }
+#endif
+}
+
+bool NAV::IpcSend::resetNode()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    _messagesSent = 0;
+    _messagesDropped = 0;
+
+    return true;
+}
+
+void NAV::IpcSend::flush()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    send(NodeDataSerializer::SerializeEndOfStream());
+
+    LOG_DEBUG("{}: Sent {} messages ({} dropped)", nameId(), _messagesSent, _messagesDropped);
+}
+
+void NAV::IpcSend::receiveObs(InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
+{
+    auto obs = queue.extract_front();
+
+    if (send(NodeDataSerializer::Serialize(*obs)))
+    {
+        _messagesSent++;
+    }
+    else
+    {
+        _messagesDropped++;
+    }
+}
+
+bool NAV::IpcSend::send(const std::vector<uint8_t>& message)
+{
+    if (_ring)
+    {
+        if (message.size() > _ring->maxMessageSize())
+        {
+            LOG_ERROR("{}: The message with {} bytes does not fit into the shared memory with a capacity of {} bytes", nameId(), message.size(), _ring->capacity());
+            return false;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        while (!_ring->push(message))
+        {
+            if (std::chrono::steady_clock::now() - start > SEND_TIMEOUT)
+            {
+                LOG_WARN("{}: The receiver did not read any data for {} s. Dropping the message.", nameId(), SEND_TIMEOUT.count());
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        return true;
+    }
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+    if (_socket && _socket->is_open())
+    {
+        auto size = static_cast<uint32_t>(message.size());
+        std::array<boost::asio::const_buffer, 2> buffers = { boost::asio::buffer(&size, sizeof(size)), boost::asio::buffer(message) };
+        boost::system::error_code ec;
+        boost::asio::write(*_socket, buffers, ec);
+        if (ec)
+        {
+            LOG_ERROR("{}: Could not send the data over the socket: {}", nameId(), ec.message());
+            _socket->close(ec);
+            return false;
+        }
+        return true;
+    }
+#endif
+
+    return false;
+}
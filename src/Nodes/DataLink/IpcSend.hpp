@@ -0,0 +1,120 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file IpcSend.hpp
+/// @brief Sends the data of a flow pin to another process on the same machine
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-10
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "internal/Node/Node.hpp"
+#include "util/Ipc/IpcTransport.hpp"
+#include "util/Ipc/SharedMemoryRing.hpp"
+
+namespace NAV
+{
+/// @brief Sends the data of a flow pin to an IpcRecv node in another process on the same machine
+///
+/// The data is serialized with the NodeDataSerializer and sent over a shared memory ring or a Unix socket.
+/// When the flow finishes, an end of stream message is sent, so that the receiving flow can finish as well.
+class IpcSend : public Node
+{
+  public:
+    /// @brief Default constructor
+    IpcSend();
+    /// @brief Destructor
+    ~IpcSend() override;
+    /// @brief Copy constructor
+    IpcSend(const IpcSend&) = delete;
+    /// @brief Move constructor
+    IpcSend(IpcSend&&) = delete;
+    /// @brief Copy assignment operator
+    IpcSend& operator=(const IpcSend&) = delete;
+    /// @brief Move assignment operator
+    IpcSend& operator=(IpcSend&&) = delete;
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] static std::string typeStatic();
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] std::string type() const override;
+
+    /// @brief String representation of the Class Category
+    [[nodiscard]] static std::string category();
+
+    /// @brief ImGui config window which is shown on double click
+    /// @attention Don't forget to set _hasConfig to true in the constructor of the node
+    void guiConfig() override;
+
+    /// @brief Saves the node into a json object
+    [[nodiscard]] json save() const override;
+
+    /// @brief Restores the node from a json object
+    /// @param[in] j Json object with the node state
+    void restore(const json& j) override;
+
+    /// @brief Resets the node
+    bool resetNode() override;
+
+    /// @brief Sends the end of stream message after the flow finished
+    void flush() override;
+
+  private:
+    constexpr static size_t INPUT_PORT_INDEX_NODE_DATA = 0; ///< @brief Flow (NodeData)
+
+    /// Time to wait for the receiver to make space in the shared memory ring before dropping a message
+    constexpr static std::chrono::seconds SEND_TIMEOUT{ 5 };
+
+    /// @brief Initialize the node
+    bool initialize() override;
+
+    /// @brief Deinitialize the node
+    void deinitialize() override;
+
+    /// @brief Serializes and sends the observation
+    /// @param[in] queue Queue with all the received data messages
+    /// @param[in] pinIdx Index of the pin the data is received on
+    void receiveObs(InputPin::NodeDataQueue& queue, size_t pinIdx);
+
+    /// @brief Sends the message over the selected transport
+    /// @param[in] message Message to send
+    /// @return True if the message was sent
+    bool send(const std::vector<uint8_t>& message);
+
+    /// Transport to send the data with
+    IpcTransport _transport = IpcTransport::SharedMemory;
+    /// Name of the shared memory segment
+    std::string _shmName = "instinct-link";
+    /// Capacity of the shared memory ring in [MiB], if the sender creates it
+    int _shmCapacity = 16;
+    /// Path of the Unix socket
+    std::string _socketPath;
+
+    /// Shared memory ring
+    std::unique_ptr<SharedMemoryRing> _ring;
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+    /// Asio context for the socket
+    boost::asio::io_context _ioContext;
+    /// Unix socket connected to the receiver
+    std::unique_ptr<boost::asio::local::stream_protocol::socket> _socket;
+#endif
+
+    /// Amount of messages sent in this run
+    size_t _messagesSent = 0;
+    /// Amount of messages which could not be sent in this run
+    size_t _messagesDropped = 0;
+};
+} // namespace NAV
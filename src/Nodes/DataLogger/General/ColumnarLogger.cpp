@@ -0,0 +1,211 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ColumnarLogger.hpp"
+
+#include <numeric>
+
+#include "NodeData/NodeData.hpp"
+
+#include "util/Logger.hpp"
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "internal/FlowManager.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+
+NAV::ColumnarLogger::ColumnarLogger()
+    : Node(typeStatic())
+{
+    LOG_TRACE("{}: called", name);
+
+    _fileType = FileType::BINARY;
+    _asyncOutput = true;
+
+    _hasConfig = true;
+    _guiConfigDefaultWindowSize = { 380, 92 };
+
+    nm::CreateInputPin(this, "writeObservation", Pin::Type::Flow,
+                       { NodeData::type() },
+                       &ColumnarLogger::writeObservation);
+}
+
+NAV::ColumnarLogger::~ColumnarLogger()
+{
+    LOG_TRACE("{}: called", nameId());
+}
+
+std::string NAV::ColumnarLogger::typeStatic()
+{
+    return "ColumnarLogger";
+}
+
+std::string NAV::ColumnarLogger::type() const
+{
+    return typeStatic();
+}
+
+std::string NAV::ColumnarLogger::category()
+{
+    return "Data Logger";
+}
+
+void NAV::ColumnarLogger::guiConfig()
+{
+    if (FileWriter::guiConfig(".icol", { ".icol" }, size_t(id), nameId()))
+    {
+        flow::ApplyChanges();
+        doDeinitialize();
+    }
+
+    if (ImGui::InputIntL(fmt::format("Rows per chunk##{}", size_t(id)).c_str(), &_rowsPerChunk, 1, 1 << 20, 256, 4096))
+    {
+        LOG_DEBUG("{}: Rows per chunk changed to {}", nameId(), _rowsPerChunk);
+        flow::ApplyChanges();
+    }
+}
+
+[[nodiscard]] json NAV::ColumnarLogger::save() const
+{
+    LOG_TRACE("{}: called", nameId());
+
+    json j;
+
+    j["FileWriter"] = FileWriter::save();
+    j["rowsPerChunk"] = _rowsPerChunk;
+
+    return j;
+}
+
+void NAV::ColumnarLogger::restore(json const& j)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (j.contains("FileWriter"))
+    {
+        FileWriter::restore(j.at("FileWriter"));
+    }
+    if (j.contains("rowsPerChunk"))
+    {
+        j.at("rowsPerChunk").get_to(_rowsPerChunk);
+    }
+}
+
+void NAV::ColumnarLogger::flush()
+{
+    writeChunk();
+    _asyncWriter.flush();
+}
+
+bool NAV::ColumnarLogger::initialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (!FileWriter::initialize())
+    {
+        return false;
+    }
+
+    _headerWritten = false;
+    _schema = ColumnarFormat::Schema();
+    _dynamicColumns.clear();
+    _columnSelection = ColumnSelection();
+    _values.clear();
+    _times.clear();
+    _columns.clear();
+
+    return true;
+}
+
+void NAV::ColumnarLogger::deinitialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    writeChunk();
+    FileWriter::deinitialize();
+}
+
+void NAV::ColumnarLogger::updateSchema(const NodeData& obs)
+{
+    std::vector<std::string> newColumns;
+    for (auto& descriptor : obs.dynamicDataDescriptors())
+    {
+        if (_dynamicColumns.insert(descriptor).second) { newColumns.push_back(std::move(descriptor)); }
+    }
+
+    if (!_headerWritten)
+    {
+        if (const auto* connectedPin = inputPins.at(0).link.getConnectedPin();
+            connectedPin && !connectedPin->dataIdentifier.empty())
+        {
+            _schema.dataType = connectedPin->dataIdentifier.front();
+        }
+        _schema.columns = obs.staticDataDescriptors();
+        _schema.staticColumnCount = _schema.columns.size();
+        _schema.columns.insert(_schema.columns.end(), newColumns.begin(), newColumns.end());
+
+        ColumnarFormat::AppendFileHeader(_chunkBuffer, _schema);
+        _headerWritten = true;
+    }
+    else if (!newColumns.empty())
+    {
+        writeChunk(); // The collected rows do not have the new columns
+        _schema.columns.insert(_schema.columns.end(), newColumns.begin(), newColumns.end());
+
+        ColumnarFormat::AppendSchemaChunk(_chunkBuffer, newColumns);
+    }
+    else
+    {
+        return;
+    }
+
+    _asyncWriter.write(_chunkBuffer);
+    _asyncWriter.endBlock();
+    _chunkBuffer.clear();
+
+    std::vector<size_t> staticIndices(_schema.staticColumnCount);
+    std::iota(staticIndices.begin(), staticIndices.end(), 0);
+    _columnSelection = ColumnSelection(std::move(staticIndices),
+                                       std::vector<std::string>(_schema.columns.begin() + static_cast<std::ptrdiff_t>(_schema.staticColumnCount), _schema.columns.end()));
+    _values.resize(_columnSelection.size());
+    _columns.resize(_columnSelection.size());
+    for (auto& column : _columns) { column.reserve(static_cast<size_t>(_rowsPerChunk)); }
+    _times.reserve(static_cast<size_t>(_rowsPerChunk));
+}
+
+void NAV::ColumnarLogger::writeChunk()
+{
+    if (_times.empty()) { return; }
+
+    ColumnarFormat::AppendDataChunk(_chunkBuffer, _times, _columns);
+    _asyncWriter.write(_chunkBuffer);
+    _asyncWriter.endBlock();
+    _chunkBuffer.clear();
+
+    _times.clear();
+    for (auto& column : _columns) { column.clear(); }
+}
+
+void NAV::ColumnarLogger::writeObservation(NAV::InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
+{
+    auto obs = queue.extract_front();
+
+    updateSchema(*obs);
+
+    _times.push_back(ColumnarFormat::ToGpsNanoseconds(obs->insTime));
+    obs->writeValues(_values, _columnSelection);
+    for (size_t c = 0; c < _values.size(); c++)
+    {
+        _columns[c].push_back(_values[c]);
+    }
+
+    if (_times.size() >= static_cast<size_t>(_rowsPerChunk))
+    {
+        writeChunk();
+    }
+}
@@ -0,0 +1,117 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file ColumnarLogger.hpp
+/// @brief Data Logger, which writes observations into the binary columnar log format
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-14
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "internal/Node/Node.hpp"
+#include "NodeData/ColumnSelection.hpp"
+#include "Nodes/DataLogger/Protocol/FileWriter.hpp"
+#include "util/Logger/ColumnarFormat.hpp"
+
+namespace NAV
+{
+class NodeData;
+
+/// @brief Data Logger, which writes the static and dynamic data of any observation into chunks of typed columns
+///
+/// The rows are collected column by column and written as one chunk when the chunk is full.
+/// Dynamic data descriptors, which appear for the first time, are appended to the schema of the file.
+/// The files can be read again with the ColumnarFile node.
+class ColumnarLogger : public Node, public FileWriter
+{
+  public:
+    /// @brief Default constructor
+    ColumnarLogger();
+    /// @brief Destructor
+    ~ColumnarLogger() override;
+    /// @brief Copy constructor
+    ColumnarLogger(const ColumnarLogger&) = delete;
+    /// @brief Move constructor
+    ColumnarLogger(ColumnarLogger&&) = delete;
+    /// @brief Copy assignment operator
+    ColumnarLogger& operator=(const ColumnarLogger&) = delete;
+    /// @brief Move assignment operator
+    ColumnarLogger& operator=(ColumnarLogger&&) = delete;
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] static std::string typeStatic();
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] std::string type() const override;
+
+    /// @brief String representation of the Class Category
+    [[nodiscard]] static std::string category();
+
+    /// @brief ImGui config window which is shown on double click
+    /// @attention Don't forget to set _hasConfig to true in the constructor of the node
+    void guiConfig() override;
+
+    /// @brief Saves the node into a json object
+    [[nodiscard]] json save() const override;
+
+    /// @brief Restores the node from a json object
+    /// @param[in] j Json object with the node state
+    void restore(const json& j) override;
+
+    /// @brief Function called by the flow executer after finishing to flush out remaining data
+    void flush() override;
+
+  private:
+    /// @brief Initialize the node
+    bool initialize() override;
+
+    /// @brief Deinitialize the node
+    void deinitialize() override;
+
+    /// @brief Write Observation to the file
+    /// @param[in] queue Queue with all the received data messages
+    /// @param[in] pinIdx Index of the pin the data is received on
+    void writeObservation(InputPin::NodeDataQueue& queue, size_t pinIdx);
+
+    /// @brief Writes the file header or a schema chunk, if the observation has dynamic data descriptors, which are not in the schema yet
+    /// @param[in] obs Observation to check
+    void updateSchema(const NodeData& obs);
+
+    /// @brief Writes the collected rows as a data chunk
+    void writeChunk();
+
+    /// Amount of rows collected before a chunk is written
+    int _rowsPerChunk = 4096;
+
+    /// Flag whether the header was written already
+    bool _headerWritten = false;
+
+    /// Schema of the file
+    ColumnarFormat::Schema _schema;
+    /// Dynamic data descriptors, which are part of the schema
+    std::unordered_set<std::string> _dynamicColumns;
+
+    /// Selection of all columns in the schema
+    ColumnSelection _columnSelection;
+    /// Buffer for the values of the selected columns
+    std::vector<double> _values;
+
+    /// Time of the collected rows
+    std::vector<int64_t> _times;
+    /// Values of the collected rows for every column
+    std::vector<std::vector<double>> _columns;
+    /// Buffer to encode the chunks
+    std::string _chunkBuffer;
+};
+
+} // namespace NAV
@@ -12,10 +12,11 @@
 
 #include "util/Logger.hpp"
 
-#include <iomanip> // std::setprecision
+#include <cmath>
 
 #include "internal/NodeManager.hpp"
 namespace nm = NAV::NodeManager;
+#include "internal/FlowCheckpoint.hpp"
 #include "internal/FlowManager.hpp"
 #include "NodeRegistry.hpp"
 
@@ -25,6 +26,7 @@ NAV::CsvLogger::CsvLogger()
     LOG_TRACE("{}: called", name);
 
     _fileType = FileType::ASCII;
+    _asyncOutput = true;
 
     _hasConfig = true;
     _guiConfigDefaultWindowSize = { 380, 70 };
@@ -86,14 +88,36 @@ void NAV::CsvLogger::restore(json const& j)
 
 void NAV::CsvLogger::flush()
 {
-    _filestream.flush();
+    _asyncWriter.flush();
+}
+
+std::optional<json> NAV::CsvLogger::saveCheckpoint()
+{
+    auto fileWriter = FileWriter::saveCheckpoint();
+    if (!fileWriter) { return std::nullopt; }
+
+    return json{
+        { "FileWriter", *fileWriter },
+        { "headerWritten", _headerWritten },
+        { "CommonLog", CommonLog::saveCheckpoint() },
+    };
+}
+
+bool NAV::CsvLogger::restoreCheckpoint(const json& j)
+{
+    if (!j.contains("FileWriter")) { return false; }
+
+    if (j.contains("headerWritten")) { j.at("headerWritten").get_to(_headerWritten); }
+    if (j.contains("CommonLog")) { CommonLog::restoreCheckpoint(j.at("CommonLog")); }
+    return FileWriter::restoreCheckpoint(j.at("FileWriter"));
 }
 
 bool NAV::CsvLogger::initialize()
 {
     LOG_TRACE("{}: called", nameId());
 
-    if (!FileWriter::initialize())
+    // When resuming from a checkpoint, restoreCheckpoint() truncates the file to the size at the checkpoint
+    if (!FileWriter::initialize(FlowCheckpoint::IsResuming()))
     {
         return false;
     }
@@ -101,6 +125,7 @@ bool NAV::CsvLogger::initialize()
     CommonLog::initialize();
 
     _headerWritten = false;
+    _columnSelection = ColumnSelection();
 
     return true;
 }
@@ -118,46 +143,48 @@ void NAV::CsvLogger::writeObservation(NAV::InputPin::NodeDataQueue& queue, size_
 
     if (!_headerWritten)
     {
-        _filestream << "Time [s],GpsCycle,GpsWeek,GpsToW [s]";
+        _asyncWriter.write("Time [s],GpsCycle,GpsWeek,GpsToW [s]");
 
         for (const auto& desc : obs->staticDataDescriptors())
         {
-            _filestream << "," << desc;
+            _asyncWriter.write(',');
+            _asyncWriter.write(desc);
         }
-        _filestream << std::endl; // NOLINT(performance-avoid-endl)
+        _asyncWriter.endRow();
 
         _headerWritten = true;
     }
 
-    constexpr int gpsCyclePrecision = 3;
     constexpr int gpsTimePrecision = 12;
-    constexpr int valuePrecision = 15;
+    constexpr int timePrecision = 15;
 
     if (!obs->insTime.empty())
     {
-        _filestream << std::setprecision(valuePrecision) << std::round(calcTimeIntoRun(obs->insTime) * 1e9) / 1e9;
+        auto gpsTime = obs->insTime.toGPSweekTow();
+        _asyncWriter.write(std::round(calcTimeIntoRun(obs->insTime) * 1e9) / 1e9, timePrecision);
+        _asyncWriter.write(',');
+        _asyncWriter.write(gpsTime.gpsCycle);
+        _asyncWriter.write(',');
+        _asyncWriter.write(gpsTime.gpsWeek);
+        _asyncWriter.write(',');
+        _asyncWriter.write(gpsTime.tow, gpsTimePrecision);
     }
-    _filestream << ",";
-    if (!obs->insTime.empty())
-    {
-        _filestream << std::fixed << std::setprecision(gpsCyclePrecision) << obs->insTime.toGPSweekTow().gpsCycle;
-    }
-    _filestream << ",";
-    if (!obs->insTime.empty())
+    else
     {
-        _filestream << std::defaultfloat << std::setprecision(gpsTimePrecision) << obs->insTime.toGPSweekTow().gpsWeek;
+        _asyncWriter.write(",,,");
     }
-    _filestream << ",";
-    if (!obs->insTime.empty())
+
+    if (_columnSelection.size() != obs->staticDescriptorCount())
     {
-        _filestream << std::defaultfloat << std::setprecision(gpsTimePrecision) << obs->insTime.toGPSweekTow().tow;
+        _columnSelection = ColumnSelection::StaticRange(0, obs->staticDescriptorCount());
+        _values.resize(_columnSelection.size());
     }
-    _filestream << std::setprecision(valuePrecision);
-
-    for (size_t i = 0; i < obs->staticDescriptorCount(); ++i)
+    obs->writeValues(_values, _columnSelection);
+    // Missing values and values which are NaN themselves can't be distinguished here, both result in an empty cell
+    for (const auto& val : _values)
     {
-        _filestream << ",";
-        if (auto val = obs->getValueAt(i)) { _filestream << *val; }
+        _asyncWriter.write(',');
+        if (!std::isnan(val)) { _asyncWriter.write(val); }
     }
-    _filestream << '\n';
+    _asyncWriter.endRow();
 }
\ No newline at end of file
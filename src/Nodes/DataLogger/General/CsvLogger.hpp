@@ -13,7 +13,10 @@
 
 #pragma once
 
+#include <vector>
+
 #include "internal/Node/Node.hpp"
+#include "NodeData/ColumnSelection.hpp"
 #include "Nodes/DataLogger/Protocol/FileWriter.hpp"
 #include "util/Logger/CommonLog.hpp"
 
@@ -61,6 +64,15 @@ class CsvLogger : public Node, public FileWriter, public CommonLog
     /// @brief Function called by the flow executer after finishing to flush out remaining data
     void flush() override;
 
+    /// @brief Saves the runtime state of the node for a checkpoint
+    /// @return Json object with the state or nullopt if the size of the file could not be determined
+    [[nodiscard]] std::optional<json> saveCheckpoint() override;
+
+    /// @brief Restores the runtime state of the node from a checkpoint
+    /// @param[in] j Json object with the state returned by saveCheckpoint()
+    /// @return True if the state could be restored
+    bool restoreCheckpoint(const json& j) override;
+
   private:
     /// @brief Initialize the node
     bool initialize() override;
@@ -69,12 +81,18 @@ class CsvLogger : public Node, public FileWriter, public CommonLog
     void deinitialize() override;
 
     /// @brief Write Observation to the file
+    /// @note Values which are NaN are written as empty cells, the same as values missing in the observation (no 'nan' in the file)
     /// @param[in] queue Queue with all the received data messages
     /// @param[in] pinIdx Index of the pin the data is received on
     void writeObservation(InputPin::NodeDataQueue& queue, size_t pinIdx);
 
     /// Flag whether the header was written already
     bool _headerWritten = false;
+
+    /// Selection of all static data columns
+    ColumnSelection _columnSelection;
+    /// Buffer for the values of the selected columns
+    std::vector<double> _values;
 };
 
 } // namespace NAV
@@ -11,6 +11,7 @@
 #include <imgui.h>
 #include <implot_internal.h>
 
+#include "Navigation/Math/Math.hpp"
 #include "Navigation/Transformations/Units.hpp"
 #include "Navigation/Geoid/EGM96.hpp"
 #include "NodeData/NodeData.hpp"
@@ -21,12 +22,16 @@
 
 #include <algorithm>
 #include <iomanip> // std::setprecision
+#include <limits>
 #include <memory>
 
 #include "internal/NodeManager.hpp"
 namespace nm = NAV::NodeManager;
 #include "internal/FlowManager.hpp"
 #include "NodeRegistry.hpp"
+#include "internal/gui/widgets/EnumCombo.hpp"
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
 
 NAV::KmlLogger::KmlLogger()
     : Node(typeStatic())
@@ -36,7 +41,7 @@ NAV::KmlLogger::KmlLogger()
     _fileType = FileType::ASCII;
 
     _hasConfig = true;
-    _guiConfigDefaultWindowSize = { 380, 70 };
+    _guiConfigDefaultWindowSize = { 380, 140 };
 }
 
 NAV::KmlLogger::~KmlLogger()
@@ -70,6 +75,30 @@ void NAV::KmlLogger::guiConfig()
     {
         flow::ApplyChanges();
     }
+
+    if (gui::widgets::EnumCombo(fmt::format("Thinning##{}", size_t(id)).c_str(), _thinning))
+    {
+        LOG_DEBUG("{}: Thinning changed to {}", nameId(), NAV::to_string(_thinning));
+        flow::ApplyChanges();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Distance: Skips positions, which are closer than the tolerance to the last written position.\n"
+                             "Douglas-Peucker: Removes positions, which deviate less than the tolerance from the simplified track (applied per segment).");
+    if (_thinning != Thinning::None)
+    {
+        if (ImGui::InputDoubleL(fmt::format("Tolerance##{}", size_t(id)).c_str(), &_thinningTolerance, 0.0, std::numeric_limits<double>::max(), 0.1, 1.0, "%.3f m"))
+        {
+            LOG_DEBUG("{}: Thinning tolerance changed to {}", nameId(), _thinningTolerance);
+            flow::ApplyChanges();
+        }
+    }
+    if (ImGui::InputIntL(fmt::format("Segment size##{}", size_t(id)).c_str(), &_segmentSize, 2, std::numeric_limits<int>::max(), 100, 1000))
+    {
+        LOG_DEBUG("{}: Segment size changed to {}", nameId(), _segmentSize);
+        flow::ApplyChanges();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Amount of positions collected per pin, before they are written to the file.");
 }
 
 [[nodiscard]] json NAV::KmlLogger::save() const
@@ -80,6 +109,9 @@ void NAV::KmlLogger::guiConfig()
 
     j["dynamicInputPins"] = _dynamicInputPins;
     j["FileWriter"] = FileWriter::save();
+    j["thinning"] = _thinning;
+    j["thinningTolerance"] = _thinningTolerance;
+    j["segmentSize"] = _segmentSize;
 
     return j;
 }
@@ -96,12 +128,41 @@ void NAV::KmlLogger::restore(json const& j)
     {
         FileWriter::restore(j.at("FileWriter"));
     }
+    if (j.contains("thinning"))
+    {
+        j.at("thinning").get_to(_thinning);
+    }
+    if (j.contains("thinningTolerance"))
+    {
+        j.at("thinningTolerance").get_to(_thinningTolerance);
+    }
+    if (j.contains("segmentSize"))
+    {
+        j.at("segmentSize").get_to(_segmentSize);
+    }
 }
 
 void NAV::KmlLogger::flush()
 {
+    LOG_DEBUG("{}: Received all data. Writing remaining positions now...", nameId());
+    writeAllSegments();
+}
+
+bool NAV::KmlLogger::initialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (!FileWriter::initialize())
+    {
+        return false;
+    }
+
+    for (auto& track : _tracks)
+    {
+        track = Track();
+    }
+
     // See https://developers.google.com/kml/documentation/kml_tut#paths
-    LOG_DEBUG("{}: Received all data. Writing file now...", nameId());
     _filestream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
                    "<kml xmlns=\"http://earth.google.com/kml/2.2\">\n"
                    "<Document>\n"
@@ -124,7 +185,7 @@ void NAV::KmlLogger::flush()
     int cmap = gp.Style.Colormap; // Current selected colormap
     int nColors = gp.ColormapData.GetKeyCount(cmap);
 
-    for (size_t i = 0; i < _positionData.size(); i++)
+    for (size_t i = 0; i < _tracks.size(); i++)
     {
         int cidx = static_cast<int>(i) % nColors;
         ImColor color(gp.ColormapData.GetKeyColor(cmap, cidx));
@@ -142,91 +203,23 @@ void NAV::KmlLogger::flush()
                        "</Style>\n";
     }
 
-    for (size_t i = 0; i < _positionData.size(); i++)
-    {
-        const auto& posData = _positionData.at(i);
-        if (posData.empty()) { continue; }
-
-        if (posData.size() > 1) // Track
-        {
-            _filestream << "<Placemark>\n"
-                        << "<name>" << inputPins.at(i).name << " Track</name>\n"
-                        << "<styleUrl>#line" << i << "</styleUrl>\n"
-                        << "<LineString>\n"
-                        << "<altitudeMode>absolute</altitudeMode>\n"
-                           "<coordinates>\n";
-            for (const auto& lla : posData)
-            {
-                fmt::print(_filestream, "{:.9f},{:.9f},{:.3f}\n", lla.y(), lla.x(), lla.z());
-            }
-
-            _filestream << "</coordinates>\n"
-                           "</LineString>\n"
-                           "</Placemark>\n";
-        }
-
-        // Position
-        {
-            if (posData.size() > 1)
-            {
-                _filestream << "<Folder>\n"
-                            << "<name>" << inputPins.at(i).name << " Position</name>\n"
-                            << "<visibility>0</visibility>";
-            }
-            for (const auto& lla : posData)
-            {
-                _filestream << "<Placemark>\n";
-                if (posData.size() > 1)
-                {
-                    _filestream << "<styleUrl>#P2</styleUrl>\n";
-                }
-                else
-                {
-                    _filestream << "<name>" << inputPins.at(i).name << " Position</name>\n";
-                    _filestream << "<styleUrl>#P0</styleUrl>\n";
-                }
-                _filestream << "<Point>\n"
-                               "<extrude>1</extrude>\n"
-                               "<altitudeMode>absolute</altitudeMode>\n"
-                            << "<coordinates>";
-                fmt::print(_filestream, "{:.9f},{:.9f},{:.3f}", lla.y(), lla.x(), lla.z()); //
-                _filestream << "</coordinates>\n"
-                               "</Point>\n"
-                               "</Placemark>\n";
-            }
-            if (posData.size() > 1)
-            {
-                _filestream << "</Folder>\n";
-            }
-        }
-    }
-
+    _footerPos = _filestream.tellp();
     _filestream << "</Document>\n"
                 << "</kml>\n";
     _filestream.flush();
+
+    return _filestream.good();
 }
 
-bool NAV::KmlLogger::initialize()
+void NAV::KmlLogger::deinitialize()
 {
     LOG_TRACE("{}: called", nameId());
 
-    if (!FileWriter::initialize())
+    if (_filestream.is_open())
     {
-        return false;
+        writeAllSegments();
     }
 
-    for (auto& posData : _positionData)
-    {
-        posData.clear();
-    }
-
-    return true;
-}
-
-void NAV::KmlLogger::deinitialize()
-{
-    LOG_TRACE("{}: called", nameId());
-
     FileWriter::deinitialize();
 }
 
@@ -238,14 +231,14 @@ void NAV::KmlLogger::pinAddCallback(Node* node)
                        { Pos::type() },
                        &KmlLogger::writeObservation);
 
-    kmlNode->_positionData.emplace_back();
+    kmlNode->_tracks.emplace_back();
 }
 
 void NAV::KmlLogger::pinDeleteCallback(Node* node, size_t pinIdx)
 {
     auto* kmlNode = static_cast<KmlLogger*>(node); // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
 
-    kmlNode->_positionData.erase(std::next(kmlNode->_positionData.begin(), static_cast<int64_t>(pinIdx)));
+    kmlNode->_tracks.erase(std::next(kmlNode->_tracks.begin(), static_cast<int64_t>(pinIdx)));
 
     nm::DeleteInputPin(node->inputPins.at(pinIdx));
 }
@@ -255,7 +248,138 @@ void NAV::KmlLogger::writeObservation(NAV::InputPin::NodeDataQueue& queue, size_
     auto obs = std::static_pointer_cast<const Pos>(queue.extract_front());
     LOG_DATA("{}: [{}] Received data {}", nameId(), obs->insTime.toYMDHMS(GPST), egm96_compute_altitude_offset(obs->latitude(), obs->longitude()));
 
-    _positionData.at(pinIdx).emplace_back(rad2deg(obs->latitude()),
-                                          rad2deg(obs->longitude()),
-                                          obs->altitude() - egm96_compute_altitude_offset(obs->latitude(), obs->longitude()));
-}
\ No newline at end of file
+    auto& track = _tracks.at(pinIdx);
+
+    if (_thinning == Thinning::Distance)
+    {
+        const auto* last = !track.pending.empty() ? &track.pending.back()
+                                                  : (track.lastWritten ? &track.lastWritten.value() : nullptr);
+        if (last && (obs->e_position() - last->e_position).norm() < _thinningTolerance) { return; }
+    }
+
+    track.pending.push_back(Position{ .lla_position = Eigen::Vector3d(rad2deg(obs->latitude()),
+                                                                      rad2deg(obs->longitude()),
+                                                                      obs->altitude() - egm96_compute_altitude_offset(obs->latitude(), obs->longitude())),
+                                      .e_position = obs->e_position() });
+
+    if (track.pending.size() >= static_cast<size_t>(std::max(_segmentSize, 2)))
+    {
+        writeSegment(pinIdx);
+    }
+}
+
+void NAV::KmlLogger::writeAllSegments()
+{
+    for (size_t i = 0; i < _tracks.size(); i++)
+    {
+        writeSegment(i);
+    }
+}
+
+void NAV::KmlLogger::writeSegment(size_t pinIdx)
+{
+    auto& track = _tracks.at(pinIdx);
+    if (track.pending.empty()) { return; }
+
+    std::vector<const Position*> positions;
+    positions.reserve(track.pending.size());
+    if (_thinning == Thinning::DouglasPeucker)
+    {
+        // The last written position is part of the simplification, so that the segments join smoothly
+        size_t offset = track.lastWritten ? 1 : 0;
+        std::vector<Eigen::Vector3d> points;
+        points.reserve(offset + track.pending.size());
+        if (track.lastWritten) { points.push_back(track.lastWritten->e_position); }
+        for (const auto& pos : track.pending) { points.push_back(pos.e_position); }
+
+        for (auto idx : math::douglasPeucker(points, _thinningTolerance))
+        {
+            if (idx >= offset) { positions.push_back(&track.pending.at(idx - offset)); }
+        }
+    }
+    else
+    {
+        for (const auto& pos : track.pending) { positions.push_back(&pos); }
+    }
+
+    const auto& pinName = inputPins.at(pinIdx).name;
+    auto writePoint = [&](const Position& pos) {
+        _filestream << "<Point>\n"
+                       "<extrude>1</extrude>\n"
+                       "<altitudeMode>absolute</altitudeMode>\n"
+                    << "<coordinates>";
+        fmt::print(_filestream, "{:.9f},{:.9f},{:.3f}", pos.lla_position.y(), pos.lla_position.x(), pos.lla_position.z());
+        _filestream << "</coordinates>\n"
+                       "</Point>\n";
+    };
+
+    _filestream.seekp(_footerPos);
+
+    if (track.writtenCount == 0 && positions.size() == 1) // Single position
+    {
+        _filestream << "<Placemark>\n"
+                    << "<name>" << pinName << " Position</name>\n"
+                    << "<styleUrl>#P0</styleUrl>\n";
+        writePoint(*positions.front());
+        _filestream << "</Placemark>\n";
+    }
+    else
+    {
+        // Track
+        _filestream << "<Placemark>\n"
+                    << "<name>" << pinName << " Track</name>\n"
+                    << "<styleUrl>#line" << pinIdx << "</styleUrl>\n"
+                    << "<LineString>\n"
+                    << "<altitudeMode>absolute</altitudeMode>\n"
+                       "<coordinates>\n";
+        if (track.lastWritten)
+        {
+            fmt::print(_filestream, "{:.9f},{:.9f},{:.3f}\n", track.lastWritten->lla_position.y(), track.lastWritten->lla_position.x(), track.lastWritten->lla_position.z());
+        }
+        for (const auto* pos : positions)
+        {
+            fmt::print(_filestream, "{:.9f},{:.9f},{:.3f}\n", pos->lla_position.y(), pos->lla_position.x(), pos->lla_position.z());
+        }
+        _filestream << "</coordinates>\n"
+                       "</LineString>\n"
+                       "</Placemark>\n";
+
+        // Position
+        _filestream << "<Folder>\n"
+                    << "<name>" << pinName << " Position</name>\n"
+                    << "<visibility>0</visibility>";
+        for (const auto* pos : positions)
+        {
+            _filestream << "<Placemark>\n"
+                        << "<styleUrl>#P2</styleUrl>\n";
+            writePoint(*pos);
+            _filestream << "</Placemark>\n";
+        }
+        _filestream << "</Folder>\n";
+    }
+
+    track.writtenCount += positions.size();
+    track.lastWritten = *positions.back();
+    track.pending.clear();
+
+    _footerPos = _filestream.tellp();
+    _filestream << "</Document>\n"
+                << "</kml>\n";
+    _filestream.flush();
+}
+
+const char* NAV::to_string(NAV::KmlLogger::Thinning value)
+{
+    switch (value)
+    {
+    case NAV::KmlLogger::Thinning::None:
+        return "None";
+    case NAV::KmlLogger::Thinning::Distance:
+        return "Distance";
+    case NAV::KmlLogger::Thinning::DouglasPeucker:
+        return "Douglas-Peucker";
+    case NAV::KmlLogger::Thinning::COUNT:
+        return "";
+    }
+    return "";
+}
@@ -13,7 +13,10 @@
 
 #pragma once
 
+#include <ios>
 #include <memory>
+#include <optional>
+#include <vector>
 #include "internal/Node/Node.hpp"
 #include "internal/gui/widgets/DynamicInputPins.hpp"
 #include "Nodes/DataLogger/Protocol/FileWriter.hpp"
@@ -23,7 +26,10 @@ namespace NAV
 {
 class NodeData;
 
-/// Data Logger for Pos data as KML files (input for Google Earth)
+/// @brief Data Logger for Pos data as KML files (input for Google Earth)
+///
+/// The positions are collected per pin and written as segments (track and points) while the data arrives.
+/// The document footer is written after every segment and overwritten by the next one, so the file is always a valid KML document.
 class KmlLogger : public Node, public FileWriter
 {
   public:
@@ -63,6 +69,15 @@ class KmlLogger : public Node, public FileWriter
     /// @brief Function called by the flow executer after finishing to flush out remaining data
     void flush() override;
 
+    /// @brief Thinning of the positions, before they are written
+    enum class Thinning
+    {
+        None,           ///< Write all positions
+        Distance,       ///< Skip positions closer than the tolerance to the last written position
+        DouglasPeucker, ///< Simplify every segment with the Douglas-Peucker algorithm
+        COUNT,          ///< Number of items in the enum
+    };
+
   private:
     /// @brief Initialize the node
     bool initialize() override;
@@ -78,8 +93,42 @@ class KmlLogger : public Node, public FileWriter
     /// @param[in] pinIdx Input pin index to delete
     static void pinDeleteCallback(Node* node, size_t pinIdx);
 
-    /// One data set of positions for each pin in Latitude [deg], Longitude [deg], Height above Mean Sea Level [m]
-    std::vector<std::vector<Eigen::Vector3d>> _positionData;
+    /// @brief Position to write
+    struct Position
+    {
+        Eigen::Vector3d lla_position; ///< Latitude [deg], Longitude [deg], Height above Mean Sea Level [m]
+        Eigen::Vector3d e_position;   ///< Position in ECEF coordinates [m] (used for the thinning)
+    };
+
+    /// @brief Track of a pin
+    struct Track
+    {
+        std::vector<Position> pending;       ///< Positions, which are not written yet
+        std::optional<Position> lastWritten; ///< Last written position, which continues the line of the next segment
+        size_t writtenCount = 0;             ///< Amount of written positions
+    };
+
+    /// @brief Writes the pending positions of the pin as a segment and patches the footer
+    /// @param[in] pinIdx Index of the pin
+    void writeSegment(size_t pinIdx);
+
+    /// @brief Writes the pending positions of all pins
+    void writeAllSegments();
+
+    /// One track for each pin
+    std::vector<Track> _tracks;
+
+    /// Position of the footer in the file, which is overwritten by the next segment
+    std::streampos _footerPos = 0;
+
+    /// Thinning of the positions
+    Thinning _thinning = Thinning::None;
+
+    /// Tolerance of the thinning [m]
+    double _thinningTolerance = 1.0;
+
+    /// Amount of positions collected per pin before they are written
+    int _segmentSize = 1000;
 
     /// @brief Write Observation to the file
     /// @param[in] queue Queue with all the received data messages
@@ -91,4 +140,9 @@ class KmlLogger : public Node, public FileWriter
     gui::widgets::DynamicInputPins _dynamicInputPins{ 0, this, pinAddCallback, pinDeleteCallback, 1 };
 };
 
+/// @brief Converts the enum to a string
+/// @param[in] value Enum value to convert into text
+/// @return String representation of the enum
+const char* to_string(NAV::KmlLogger::Thinning value);
+
 } // namespace NAV
@@ -10,7 +10,6 @@
 
 #include "util/Logger.hpp"
 
-#include <iomanip> // std::setprecision
 #include "util/Eigen.hpp"
 
 #include "util/Time/TimeBase.hpp"
@@ -25,6 +24,7 @@ NAV::MatrixLogger::MatrixLogger()
     LOG_TRACE("{}: called", name);
 
     _fileType = FileType::ASCII;
+    _asyncOutput = true;
 
     _hasConfig = true;
     _guiConfigDefaultWindowSize = { 380, 70 };
@@ -84,7 +84,7 @@ void NAV::MatrixLogger::restore(json const& j)
 
 void NAV::MatrixLogger::flush()
 {
-    _filestream.flush();
+    _asyncWriter.flush();
 }
 
 bool NAV::MatrixLogger::initialize()
@@ -112,13 +112,12 @@ void NAV::MatrixLogger::deinitialize()
 
 void NAV::MatrixLogger::writeMatrix(const InsTime& insTime, size_t pinIdx)
 {
-    constexpr int gpsCyclePrecision = 3;
     constexpr int gpsTimePrecision = 12;
-    constexpr int valuePrecision = 12;
+    constexpr int timePrecision = 12;
 
     if (!_headerWritten)
     {
-        _filestream << "Time [s],GpsCycle,GpsWeek,GpsTow [s]";
+        _asyncWriter.write("Time [s],GpsCycle,GpsWeek,GpsTow [s]");
     }
 
     if (auto* sourcePin = inputPins.at(pinIdx).link.getConnectedPin())
@@ -135,27 +134,35 @@ void NAV::MatrixLogger::writeMatrix(const InsTime& insTime, size_t pinIdx)
                     {
                         for (int col = 0; col < value->v->cols(); col++)
                         {
-                            _filestream << ",[" << row << ";" << col << "]";
+                            _asyncWriter.write(",[");
+                            _asyncWriter.write(row);
+                            _asyncWriter.write(';');
+                            _asyncWriter.write(col);
+                            _asyncWriter.write(']');
                         }
                     }
-                    _filestream << std::endl; // NOLINT(performance-avoid-endl)
+                    _asyncWriter.endRow();
                     _headerWritten = true;
                 }
 
-                _filestream << std::setprecision(valuePrecision) << std::round(calcTimeIntoRun(insTime) * 1e9) / 1e9;
-                _filestream << "," << std::fixed << std::setprecision(gpsCyclePrecision) << insTime.toGPSweekTow().gpsCycle;
-                _filestream << "," << std::defaultfloat << std::setprecision(gpsTimePrecision) << insTime.toGPSweekTow().gpsWeek;
-                _filestream << "," << std::defaultfloat << std::setprecision(gpsTimePrecision) << insTime.toGPSweekTow().tow;
-                _filestream << std::setprecision(valuePrecision);
+                auto gpsTime = insTime.toGPSweekTow();
+                _asyncWriter.write(std::round(calcTimeIntoRun(insTime) * 1e9) / 1e9, timePrecision);
+                _asyncWriter.write(',');
+                _asyncWriter.write(gpsTime.gpsCycle);
+                _asyncWriter.write(',');
+                _asyncWriter.write(gpsTime.gpsWeek);
+                _asyncWriter.write(',');
+                _asyncWriter.write(gpsTime.tow, gpsTimePrecision);
 
                 for (int row = 0; row < value->v->rows(); row++)
                 {
                     for (int col = 0; col < value->v->cols(); col++)
                     {
-                        _filestream << "," << (*value->v)(row, col);
+                        _asyncWriter.write(',');
+                        _asyncWriter.write((*value->v)(row, col));
                     }
                 }
-                _filestream << "\n";
+                _asyncWriter.endRow();
             }
         }
         else
@@ -0,0 +1,168 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "AsyncFileWriter.hpp"
+
+#include <cerrno>
+#include <fcntl.h>
+#if defined(_WIN32)
+    #include <io.h>
+    #include <sys/stat.h>
+#else
+    #include <unistd.h>
+#endif
+
+#include "util/Logger.hpp"
+
+NAV::AsyncFileWriter::AsyncFileWriter(size_t bufferSize)
+    : _bufferSize(bufferSize)
+{
+    _buffer.reserve(_bufferSize + _bufferSize / 8);
+}
+
+NAV::AsyncFileWriter::~AsyncFileWriter()
+{
+    close();
+}
+
+bool NAV::AsyncFileWriter::open(const std::filesystem::path& path, bool append)
+{
+    close();
+
+#if defined(_WIN32)
+    _fd = ::_wopen(path.c_str(), _O_WRONLY | _O_CREAT | (append ? _O_APPEND : _O_TRUNC) | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    _fd = ::open(path.c_str(), O_WRONLY | O_CREAT | (append ? O_APPEND : O_TRUNC) | O_CLOEXEC, 0644); // NOLINT(hicpp-vararg,cppcoreguidelines-pro-type-vararg)
+#endif
+    if (_fd < 0)
+    {
+        LOG_ERROR("Could not open file {}", path);
+        return false;
+    }
+
+    _error = false;
+    _stop = false;
+    _buffer.clear();
+    _thread = std::thread(&AsyncFileWriter::writerThread, this);
+
+    return true;
+}
+
+void NAV::AsyncFileWriter::close()
+{
+    if (!isOpen()) { return; }
+
+    handOver();
+    {
+        std::scoped_lock lk(_mutex);
+        _stop = true;
+    }
+    _cvWork.notify_one();
+    if (_thread.joinable()) { _thread.join(); }
+
+#if defined(_WIN32)
+    ::_close(_fd);
+#else
+    ::close(_fd);
+#endif
+    _fd = -1;
+    _pending.clear();
+}
+
+void NAV::AsyncFileWriter::endRow()
+{
+    _buffer.push_back('\n');
+    endBlock();
+}
+
+void NAV::AsyncFileWriter::endBlock()
+{
+    if (_buffer.size() >= _bufferSize)
+    {
+        handOver();
+    }
+}
+
+void NAV::AsyncFileWriter::flush()
+{
+    if (!isOpen()) { return; }
+
+    handOver();
+
+    std::unique_lock lk(_mutex);
+    _cvDone.wait(lk, [&] { return _pending.empty() && !_writing; });
+}
+
+void NAV::AsyncFileWriter::handOver()
+{
+    if (_buffer.empty() || !isOpen()) { return; }
+
+    std::unique_lock lk(_mutex);
+    _cvDone.wait(lk, [&] { return _pending.size() < MAX_PENDING_BUFFERS; });
+
+    _pending.push_back(std::move(_buffer));
+    if (!_free.empty())
+    {
+        _buffer = std::move(_free.back());
+        _free.pop_back();
+    }
+    else
+    {
+        _buffer = std::string();
+        _buffer.reserve(_bufferSize + _bufferSize / 8);
+    }
+    _buffer.clear();
+    lk.unlock();
+
+    _cvWork.notify_one();
+}
+
+void NAV::AsyncFileWriter::writerThread()
+{
+    std::unique_lock lk(_mutex);
+    while (true)
+    {
+        _cvWork.wait(lk, [&] { return _stop || !_pending.empty(); });
+        if (_pending.empty()) { break; } // Stop requested and everything written
+
+        auto buffer = std::move(_pending.front());
+        _pending.pop_front();
+        _writing = true;
+        lk.unlock();
+
+        if (!writeToFile(buffer) && !_error.exchange(true))
+        {
+            LOG_ERROR("Could not write to file (errno {})", errno);
+        }
+        buffer.clear();
+
+        lk.lock();
+        _free.push_back(std::move(buffer));
+        _writing = false;
+        _cvDone.notify_all();
+    }
+}
+
+bool NAV::AsyncFileWriter::writeToFile(std::string_view data) const
+{
+    while (!data.empty())
+    {
+#if defined(_WIN32)
+        auto written = ::_write(_fd, data.data(), static_cast<unsigned int>(data.size()));
+#else
+        auto written = ::write(_fd, data.data(), data.size());
+#endif
+        if (written < 0)
+        {
+            if (errno == EINTR) { continue; }
+            return false;
+        }
+        data.remove_prefix(static_cast<size_t>(written));
+    }
+    return true;
+}
@@ -0,0 +1,152 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file AsyncFileWriter.hpp
+/// @brief Buffered file output, which is written to disk by a background thread
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-13
+
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace NAV
+{
+/// @brief Formats text into large reusable buffers and hands full buffers to a background thread, which writes them to the file
+///
+/// The numbers are formatted with fmt, which by default produces the shortest representation that reads back to the same value.
+/// Writing to the buffers is not thread-safe and is meant to be done by a single thread (the node's flow thread).
+class AsyncFileWriter
+{
+  public:
+    /// Default size of a buffer before it is handed to the background thread
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 1 << 20;
+    /// Maximum amount of full buffers waiting to be written. The writing thread blocks if the disk can not keep up.
+    static constexpr size_t MAX_PENDING_BUFFERS = 8;
+
+    /// @brief Constructor
+    /// @param[in] bufferSize Size of a buffer before it is handed to the background thread
+    explicit AsyncFileWriter(size_t bufferSize = DEFAULT_BUFFER_SIZE);
+    /// @brief Destructor (writes remaining data and closes the file)
+    ~AsyncFileWriter();
+    /// @brief Copy constructor
+    AsyncFileWriter(const AsyncFileWriter&) = delete;
+    /// @brief Move constructor
+    AsyncFileWriter(AsyncFileWriter&&) = delete;
+    /// @brief Copy assignment operator
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+    /// @brief Move assignment operator
+    AsyncFileWriter& operator=(AsyncFileWriter&&) = delete;
+
+    /// @brief Opens the file and starts the background thread
+    /// @param[in] path Path of the file
+    /// @param[in] append Keep the content of the file and append to it instead of truncating it
+    /// @return True if the file could be opened
+    bool open(const std::filesystem::path& path, bool append = false);
+
+    /// @brief Writes all remaining data, stops the background thread and closes the file
+    void close();
+
+    /// @brief Checks whether a file is open
+    [[nodiscard]] bool isOpen() const { return _fd >= 0; }
+
+    /// @brief Checks whether all writes so far succeeded
+    [[nodiscard]] bool good() const { return !_error; }
+
+    /// @brief Appends text
+    /// @param[in] text Text to append
+    void write(std::string_view text) { _buffer.append(text); }
+
+    /// @brief Appends a single character
+    /// @param[in] c Character to append
+    void write(char c) { _buffer.push_back(c); }
+
+    /// @brief Appends the shortest representation, which reads back to the same value
+    /// @param[in] value Value to append
+    void write(double value) { fmt::format_to(std::back_inserter(_buffer), "{}", value); }
+
+    /// @brief Appends the value with the given amount of significant digits (like %.{precision}g)
+    /// @param[in] value Value to append
+    /// @param[in] precision Significant digits
+    void write(double value, int precision) { fmt::format_to(std::back_inserter(_buffer), "{:.{}g}", value, precision); }
+
+    /// @brief Appends the value with the given amount of significant digits (like %.{precision}Lg)
+    /// @param[in] value Value to append
+    /// @param[in] precision Significant digits
+    void write(long double value, int precision) { fmt::format_to(std::back_inserter(_buffer), "{:.{}g}", value, precision); }
+
+    /// @brief Appends an integer
+    /// @param[in] value Value to append
+    template<std::integral T>
+    void write(T value)
+    {
+        fmt::format_to(std::back_inserter(_buffer), "{}", value);
+    }
+
+    /// @brief Finishes a row and hands the buffer to the background thread, if it is full
+    void endRow();
+
+    /// @brief Finishes a block of binary data and hands the buffer to the background thread, if it is full
+    void endBlock();
+
+    /// @brief Hands the current buffer to the background thread and waits till everything is written
+    void flush();
+
+  private:
+    /// @brief Moves the current buffer into the queue of the background thread and takes a free buffer
+    void handOver();
+
+    /// @brief Main function of the background thread
+    void writerThread();
+
+    /// @brief Writes the data to the file
+    /// @param[in] data Data to write
+    /// @return True if all data could be written
+    bool writeToFile(std::string_view data) const;
+
+    /// File descriptor (-1 if not open)
+    int _fd = -1;
+    /// Size of a buffer before it is handed over
+    size_t _bufferSize;
+    /// Buffer which is currently filled
+    std::string _buffer;
+
+    /// Mutex for the queue and the free buffers
+    std::mutex _mutex;
+    /// Notifies the background thread about new buffers
+    std::condition_variable _cvWork;
+    /// Notifies the waiting threads that buffers were written
+    std::condition_variable _cvDone;
+    /// Buffers waiting to be written
+    std::deque<std::string> _pending;
+    /// Written buffers, which can be reused
+    std::vector<std::string> _free;
+    /// Flag whether the background thread is writing a buffer at the moment
+    bool _writing = false;
+    /// Flag to stop the background thread
+    bool _stop = false;
+    /// Flag whether a write failed
+    std::atomic<bool> _error = false;
+    /// Background thread
+    std::thread _thread;
+};
+
+} // namespace NAV
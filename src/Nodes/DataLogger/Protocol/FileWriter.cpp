@@ -68,7 +68,7 @@ void NAV::FileWriter::restore(json const& j)
     }
 }
 
-bool NAV::FileWriter::initialize()
+bool NAV::FileWriter::initialize(bool resume)
 {
     deinitialize();
 
@@ -87,10 +87,15 @@ bool NAV::FileWriter::initialize()
         LOG_ERROR("Could not create directory '{}' for file '{}'", filepath.parent_path(), filepath);
     }
 
+    if (_asyncOutput)
+    {
+        return _asyncWriter.open(filepath, resume);
+    }
+
     if (_fileType == FileType::ASCII || _fileType == FileType::BINARY)
     {
         // Does not enable binary read/write, but disables OS dependant treatment of \n, \r
-        _filestream.open(filepath, std::ios_base::trunc | std::ios_base::binary);
+        _filestream.open(filepath, (resume ? std::ios_base::app : std::ios_base::trunc) | std::ios_base::binary);
     }
 
     if (!_filestream.good())
@@ -102,12 +107,54 @@ bool NAV::FileWriter::initialize()
     return true;
 }
 
+std::optional<json> NAV::FileWriter::saveCheckpoint()
+{
+    if (_asyncOutput) { _asyncWriter.flush(); }
+    else { _filestream.flush(); }
+
+    std::error_code ec;
+    auto fileSize = std::filesystem::file_size(getFilepath(), ec);
+    if (ec)
+    {
+        LOG_ERROR("Could not determine the size of the file {}: {}", getFilepath(), ec.message());
+        return std::nullopt;
+    }
+    return json{ { "fileSize", fileSize } };
+}
+
+bool NAV::FileWriter::restoreCheckpoint(const json& j)
+{
+    if (!j.contains("fileSize")) { return false; }
+
+    if (_asyncOutput) { _asyncWriter.flush(); }
+    else { _filestream.flush(); }
+
+    auto filepath = getFilepath();
+    auto fileSize = j.at("fileSize").get<std::uintmax_t>();
+    std::error_code ec;
+    if (auto currentSize = std::filesystem::file_size(filepath, ec);
+        ec || currentSize < fileSize)
+    {
+        LOG_ERROR("The file {} is smaller than at the checkpoint. Was it modified or the output path changed?", filepath);
+        return false;
+    }
+    std::filesystem::resize_file(filepath, fileSize, ec); // The file is opened in append mode, so the output continues at the new end
+    if (ec)
+    {
+        LOG_ERROR("Could not truncate the file {}: {}", filepath, ec.message());
+        return false;
+    }
+    return true;
+}
+
 void NAV::FileWriter::deinitialize()
 {
     LOG_TRACE("called");
 
     try
     {
+        _asyncWriter.close();
+
         if (_filestream.is_open())
         {
             _filestream.flush();
@@ -16,10 +16,13 @@
 #include <string>
 #include <fstream>
 #include <filesystem>
+#include <optional>
 
 #include <nlohmann/json.hpp>
 using json = nlohmann::json; ///< json namespace
 
+#include "Nodes/DataLogger/Protocol/AsyncFileWriter.hpp"
+
 namespace NAV
 {
 /// @brief Parent class for other data loggers which manages the output filestream
@@ -73,17 +76,34 @@ class FileWriter
     void restore(const json& j);
 
     /// @brief Initialize the file reader
-    bool initialize();
+    /// @param[in] resume Opens the file in append mode instead of truncating it. Only set this,
+    ///                   if restoreCheckpoint() truncates the file to the size at the checkpoint afterwards.
+    bool initialize(bool resume = false);
 
     /// @brief Deinitialize the file reader
     void deinitialize();
 
+    /// @brief Writes the buffered data and saves the size of the file for a checkpoint
+    /// @return The state or nullopt if the size of the file could not be determined
+    [[nodiscard]] std::optional<json> saveCheckpoint();
+
+    /// @brief Truncates the file to the size saved in a checkpoint, so that the output continues from there
+    /// @param[in] j Json object returned by saveCheckpoint()
+    /// @return True if the file could be truncated
+    bool restoreCheckpoint(const json& j);
+
     /// Path to the file
     std::string _path;
 
     /// File stream to write the file
     std::ofstream _filestream;
 
+    /// Write the file through _asyncWriter instead of _filestream (set in the constructor of the child class)
+    bool _asyncOutput = false;
+
+    /// Buffered writer with a background thread, used instead of the file stream if _asyncOutput is set
+    AsyncFileWriter _asyncWriter;
+
     /// File Type
     FileType _fileType = FileType::NONE;
 };
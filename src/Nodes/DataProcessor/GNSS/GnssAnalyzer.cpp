@@ -8,6 +8,8 @@
 
 #include "GnssAnalyzer.hpp"
 
+#include <algorithm>
+
 #define IMGUI_DEFINE_MATH_OPERATORS
 #include <imgui_internal.h>
 
@@ -63,6 +65,7 @@ void to_json(json& j, const GnssAnalyzer::Combination& data)
         { "polynomialCycleSlipDetector.thresholdPercentage", data.polynomialCycleSlipDetectorThresholdPercentage },
         { "polynomialCycleSlipDetector.outputWhenWindowSizeNotReached", data.polynomialCycleSlipDetectorOutputWhenWindowSizeNotReached },
         { "polynomialCycleSlipDetector.outputPolynomials", data.polynomialCycleSlipDetectorOutputPolynomials },
+        { "polynomialCycleSlipDetector.maxPolynomials", data.polynomialCycleSlipDetectorMaxPolynomials },
     };
 }
 /// @brief Read info from a json object
@@ -94,6 +97,11 @@ void from_json(const json& j, GnssAnalyzer::Combination& data)
     {
         j.at("polynomialCycleSlipDetector.outputPolynomials").get_to(data.polynomialCycleSlipDetectorOutputPolynomials);
     }
+    if (j.contains("polynomialCycleSlipDetector.maxPolynomials"))
+    {
+        j.at("polynomialCycleSlipDetector.maxPolynomials").get_to(data.polynomialCycleSlipDetectorMaxPolynomials);
+        data.polynomialCycleSlipDetectorMaxPolynomials = std::max(data.polynomialCycleSlipDetectorMaxPolynomials, 1);
+    }
 }
 
 } // namespace NAV
@@ -205,6 +213,15 @@ void NAV::GnssAnalyzer::guiConfig()
                 {
                     flow::ApplyChanges();
                 }
+                if (!comb.polynomialCycleSlipDetectorOutputPolynomials) { ImGui::BeginDisabled(); }
+                ImGui::SetNextItemWidth(100.0F);
+                if (ImGui::InputIntL(fmt::format("Max. polynomials##id{} c{}", size_t(id), c).c_str(), &comb.polynomialCycleSlipDetectorMaxPolynomials, 1))
+                {
+                    flow::ApplyChanges();
+                }
+                ImGui::SameLine();
+                gui::widgets::HelpMarker("Only the last polynomials are kept and evaluated for every epoch");
+                if (!comb.polynomialCycleSlipDetectorOutputPolynomials) { ImGui::EndDisabled(); }
                 if (!comb.polynomialCycleSlipDetector.isEnabled()) { ImGui::EndDisabled(); }
 
                 ImGui::EndPopup();
@@ -340,7 +357,8 @@ bool NAV::GnssAnalyzer::initialize()
     for (auto& comb : _combinations)
     {
         comb.polynomialCycleSlipDetector.clear();
-        comb.polynomials.clear();
+        comb.polynomialCycleSlipDetectorMaxPolynomials = std::max(comb.polynomialCycleSlipDetectorMaxPolynomials, 1);
+        comb.polynomials = ScrollingBuffer<std::pair<InsTime, Polynomial<double>>>(static_cast<size_t>(comb.polynomialCycleSlipDetectorMaxPolynomials));
         for (auto& term : comb.terms)
         {
             term.receivedDuringRun = false;
@@ -363,104 +381,140 @@ void NAV::GnssAnalyzer::deinitialize()
     }
 }
 
-void NAV::GnssAnalyzer::receiveGnssObs(NAV::InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
+bool NAV::GnssAnalyzer::resetNode()
 {
-    auto gnssObs = std::static_pointer_cast<const GnssObs>(queue.extract_front());
-    LOG_DATA("{}: Received GnssObs for [{}]", nameId(), gnssObs->insTime);
+    LOG_TRACE("{}: called", nameId());
 
-    auto gnssComb = std::make_shared<GnssCombination>();
-    gnssComb->insTime = gnssObs->insTime;
+    compileCombinations();
+
+    return true;
+}
+
+void NAV::GnssAnalyzer::compileCombinations()
+{
+    _compiled = CompiledCombinations();
 
     for (size_t c = 0; c < _combinations.size(); c++)
     {
-        auto& comb = _combinations.at(c);
-        GnssCombination::Combination combination;
-        combination.description = comb.description();
+        const auto& comb = _combinations.at(c);
+
+        _compiled.combinationStart.push_back(_compiled.termSignal.size());
+        _compiled.keys.push_back(comb.description());
+        _compiled.descriptions.push_back(_compiled.keys.back());
         for (size_t i = 0; i < _combinations.size(); i++)
         {
             if (i == c) { continue; }
-            if (combination.description == _combinations.at(i).description())
+            if (_compiled.keys.back() == _combinations.at(i).description())
             {
-                combination.description += fmt::format(" - {}", c);
+                _compiled.descriptions.back() += fmt::format(" - {}", c);
                 break;
             }
         }
+        _compiled.lambda.push_back(InsConst<>::C / comb.calcCombinationFrequency());
 
-        double result = 0.0;
         double lambdaMin = 100.0;
-        size_t termsFound = 0;
-        for (auto& term : comb.terms)
+        for (const auto& term : comb.terms)
         {
-            GnssCombination::Combination::Term oTerm;
-            oTerm.sign = term.sign;
-            oTerm.satSigId = term.satSigId;
-            oTerm.obsType = term.obsType == Combination::Term::ObservationType::Pseudorange
-                                ? GnssObs::ObservationType::Pseudorange
-                                : GnssObs::ObservationType::Carrier;
-
-            double freq = term.satSigId.freq().getFrequency(term.freqNum);
-            double lambda = InsConst<>::C / freq;
+            auto signal = _compiled.signalIndices.emplace(term.satSigId, _compiled.signalIndices.size()).first->second;
+            double lambda = InsConst<>::C / term.satSigId.freq().getFrequency(term.freqNum);
             lambdaMin = std::min(lambdaMin, lambda);
 
-            if (auto obs = (*gnssObs)(term.satSigId))
-            {
-                if (term.obsType == Combination::Term::ObservationType::Pseudorange)
-                {
-                    if (auto psr = obs->get().pseudorange)
-                    {
-                        term.receivedDuringRun = true;
+            _compiled.termSignal.push_back(signal);
+            _compiled.termSign.push_back(static_cast<double>(term.sign));
+            _compiled.termLambda.push_back(lambda);
+            _compiled.termIsCarrier.push_back(term.obsType == Combination::Term::ObservationType::Carrier);
+        }
+        _compiled.lambdaMin.push_back(lambdaMin);
+    }
+    _compiled.combinationStart.push_back(_compiled.termSignal.size());
 
-                        double value = psr->value;
-                        result += static_cast<double>(term.sign) * value;
+    _compiled.observations.resize(_compiled.signalIndices.size());
+    _compiled.termValues.resize(_compiled.termSignal.size());
+    _compiled.termObserved.resize(_compiled.termSignal.size());
+}
 
-                        if (comb.unit == Combination::Unit::Cycles)
-                        {
-                            value /= lambda;
-                        }
-                        oTerm.value = value;
+void NAV::GnssAnalyzer::receiveGnssObs(NAV::InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
+{
+    auto gnssObs = std::static_pointer_cast<const GnssObs>(queue.extract_front());
+    LOG_DATA("{}: Received GnssObs for [{}]", nameId(), gnssObs->insTime);
 
-                        termsFound++;
-                    }
-                    else
-                    {
-                        comb.polynomialCycleSlipDetector.reset(comb.description());
-                    }
-                }
-                else // if (term.obsType == Combination::Term::ObservationType::Carrier)
-                {
-                    if (auto carrier = obs->get().carrierPhase)
-                    {
-                        term.receivedDuringRun = true;
+    auto gnssComb = std::make_shared<GnssCombination>();
+    gnssComb->insTime = gnssObs->insTime;
 
-                        double value = carrier->value * lambda;
-                        result += static_cast<double>(term.sign) * value;
+    // Look up the observations of all signals used in the terms with a single pass over the epoch
+    std::fill(_compiled.observations.begin(), _compiled.observations.end(), nullptr);
+    for (const auto& obs : gnssObs->data)
+    {
+        if (auto iter = _compiled.signalIndices.find(obs.satSigId);
+            iter != _compiled.signalIndices.end())
+        {
+            _compiled.observations[iter->second] = &obs;
+        }
+    }
 
-                        if (comb.unit == Combination::Unit::Cycles)
-                        {
-                            value /= lambda;
-                        }
-                        oTerm.value = value;
+    // Values of all terms in [m]
+    for (size_t t = 0; t < _compiled.termSignal.size(); t++)
+    {
+        const auto* obs = _compiled.observations[_compiled.termSignal[t]];
+        _compiled.termObserved[t] = obs != nullptr;
+        _compiled.termValues[t] = std::nan("");
+        if (obs == nullptr) { continue; }
 
-                        termsFound++;
-                    }
-                    else
-                    {
-                        comb.polynomialCycleSlipDetector.reset(comb.description());
-                    }
-                }
+        if (!_compiled.termIsCarrier[t])
+        {
+            if (obs->pseudorange) { _compiled.termValues[t] = obs->pseudorange->value; }
+        }
+        else if (obs->carrierPhase)
+        {
+            _compiled.termValues[t] = obs->carrierPhase->value * _compiled.termLambda[t];
+        }
+    }
+
+    gnssComb->combinations.reserve(_combinations.size());
+    for (size_t c = 0; c < _combinations.size(); c++)
+    {
+        auto& comb = _combinations.at(c);
+        const auto& key = _compiled.keys.at(c);
+        GnssCombination::Combination combination;
+        combination.description = _compiled.descriptions.at(c);
+
+        double result = 0.0;
+        size_t termsFound = 0;
+        size_t start = _compiled.combinationStart.at(c);
+        combination.terms.reserve(comb.terms.size());
+        for (size_t t = start; t < _compiled.combinationStart.at(c + 1); t++)
+        {
+            auto& term = comb.terms.at(t - start);
+
+            GnssCombination::Combination::Term oTerm;
+            oTerm.sign = term.sign;
+            oTerm.satSigId = term.satSigId;
+            oTerm.obsType = _compiled.termIsCarrier[t] ? GnssObs::ObservationType::Carrier
+                                                       : GnssObs::ObservationType::Pseudorange;
+
+            if (double value = _compiled.termValues[t];
+                !std::isnan(value))
+            {
+                term.receivedDuringRun = true;
+                result += _compiled.termSign[t] * value;
+                oTerm.value = comb.unit == Combination::Unit::Cycles ? value / _compiled.termLambda[t] : value;
+                termsFound++;
+            }
+            else if (_compiled.termObserved[t])
+            {
+                comb.polynomialCycleSlipDetector.reset(key);
             }
 
             combination.terms.push_back(oTerm);
         }
         if (termsFound == comb.terms.size())
         {
-            auto lambda = InsConst<>::C / comb.calcCombinationFrequency();
+            auto lambda = _compiled.lambda.at(c);
             double resultCycles = result / lambda;
             combination.result = comb.unit == Combination::Unit::Cycles ? resultCycles : result;
 
             if (comb.polynomialCycleSlipDetector.isEnabled())
             {
-                auto key = comb.description();
                 combination.cycleSlipPrediction = comb.polynomialCycleSlipDetector.predictValue(key, gnssComb->insTime);
                 if (combination.cycleSlipPrediction.has_value())
                 {
@@ -471,10 +525,11 @@ void NAV::GnssAnalyzer::receiveGnssObs(NAV::InputPin::NodeDataQueue& queue, size
                 {
                     if (auto polynomial = comb.polynomialCycleSlipDetector.calcPolynomial(key))
                     {
-                        comb.polynomials.emplace_back(gnssComb->insTime, *polynomial);
+                        comb.polynomials.push_back(std::make_pair(gnssComb->insTime, *polynomial));
                     }
                     if (auto relTime = comb.polynomialCycleSlipDetector.calcRelativeTime(key, gnssComb->insTime))
                     {
+                        combination.cycleSlipPolynomials.reserve(comb.polynomials.size());
                         for (const auto& poly : comb.polynomials)
                         {
                             double value = poly.second.f(*relTime);
@@ -483,7 +538,7 @@ void NAV::GnssAnalyzer::receiveGnssObs(NAV::InputPin::NodeDataQueue& queue, size
                         }
                     }
                 }
-                double threshold = comb.polynomialCycleSlipDetectorThresholdPercentage * lambdaMin;
+                double threshold = comb.polynomialCycleSlipDetectorThresholdPercentage * _compiled.lambdaMin.at(c);
                 if (comb.unit == Combination::Unit::Cycles) { threshold /= lambda; }
 
                 combination.cycleSlipResult = comb.polynomialCycleSlipDetector.checkForCycleSlip(key, gnssComb->insTime, *combination.result, threshold);
@@ -496,8 +551,8 @@ void NAV::GnssAnalyzer::receiveGnssObs(NAV::InputPin::NodeDataQueue& queue, size
             }
         }
 
-        gnssComb->combinations.push_back(combination);
+        gnssComb->combinations.push_back(std::move(combination));
     }
 
     invokeCallbacks(OUTPUT_PORT_INDEX_GNSS_COMBINATION, gnssComb);
-}
\ No newline at end of file
+}
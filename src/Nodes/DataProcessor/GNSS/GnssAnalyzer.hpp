@@ -20,6 +20,9 @@
 #include "Navigation/GNSS/Core/SatelliteIdentifier.hpp"
 #include "Navigation/GNSS/Ambiguity/CycleSlipDetector.hpp"
 #include "Navigation/Math/Polynomial.hpp"
+#include "NodeData/GNSS/GnssObs.hpp"
+#include "util/Container/ScrollingBuffer.hpp"
+#include "util/Container/Unordered_map.hpp"
 
 namespace NAV
 {
@@ -103,8 +106,10 @@ class GnssAnalyzer : public Node
         bool polynomialCycleSlipDetectorOutputWhenWindowSizeNotReached = false;
         /// Whether the polynomials should be outputted
         bool polynomialCycleSlipDetectorOutputPolynomials = false;
-        /// Polynomial collection
-        std::vector<std::pair<InsTime, Polynomial<double>>> polynomials;
+        /// Maximum amount of polynomials which are kept for the output
+        int polynomialCycleSlipDetectorMaxPolynomials = 100;
+        /// Polynomial collection (only the last 'polynomialCycleSlipDetectorMaxPolynomials' are kept)
+        ScrollingBuffer<std::pair<InsTime, Polynomial<double>>> polynomials;
 
         /// @brief Get a string description of the combination
         [[nodiscard]] std::string description() const
@@ -148,12 +153,43 @@ class GnssAnalyzer : public Node
     /// Combinations to calculate
     std::vector<Combination> _combinations{ Combination() };
 
+    /// @brief Combinations compiled into flat arrays, so that an epoch is evaluated in a single pass over the observations and terms
+    struct CompiledCombinations
+    {
+        /// Index into the observed signals for every signal used in any term
+        unordered_map<SatSigId, size_t> signalIndices;
+        /// Observation of every signal in the current epoch (nullptr if not observed)
+        std::vector<const GnssObs::ObservationData*> observations;
+
+        /// Index of the first term of every combination in the term arrays (last element is the amount of terms)
+        std::vector<size_t> combinationStart;
+        std::vector<size_t> termSignal;     ///< Signal index of every term
+        std::vector<double> termSign;       ///< Sign of every term
+        std::vector<double> termLambda;     ///< Wavelength of the frequency of every term [m]
+        std::vector<uint8_t> termIsCarrier; ///< Whether the term is a carrier-phase observation
+        std::vector<double> termValues;     ///< Values of the terms in the current epoch [m] (NaN if not available)
+        std::vector<uint8_t> termObserved;  ///< Whether the signal of the term is observed in the current epoch
+
+        std::vector<std::string> keys;         ///< Description of every combination, used as key of the cycle-slip detector
+        std::vector<std::string> descriptions; ///< Unique description of every combination for the output
+        std::vector<double> lambda;            ///< Wavelength of the combined frequency [m]
+        std::vector<double> lambdaMin;         ///< Smallest wavelength of the terms [m]
+    };
+    /// Compiled combinations
+    CompiledCombinations _compiled;
+
+    /// @brief Compiles the combinations into the flat arrays
+    void compileCombinations();
+
     /// @brief Initialize the node
     bool initialize() override;
 
     /// @brief Deinitialize the node
     void deinitialize() override;
 
+    /// @brief Resets the node. It is guaranteed that the node is initialized when this is called.
+    bool resetNode() override;
+
     /// @brief Receive Gnss observation
     /// @param[in] queue Queue with all the received data messages
     /// @param[in] pinIdx Index of the pin the data is received on
@@ -7,6 +7,8 @@
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include "SinglePointPositioning.hpp"
+#include <algorithm>
+#include <limits>
 #include <imgui.h>
 
 #include "Navigation/GNSS/Positioning/SPP/Algorithm.hpp"
@@ -25,7 +27,9 @@ namespace nm = NAV::NodeManager;
 #include "NodeData/GNSS/SppSolution.hpp"
 
 #include "util/Logger.hpp"
+#include "util/ThreadPool.hpp"
 #include "util/Container/Vector.hpp"
+#include "internal/gui/widgets/HelpMarker.hpp"
 
 NAV::SinglePointPositioning::SinglePointPositioning()
     : Node(typeStatic())
@@ -107,6 +111,30 @@ void NAV::SinglePointPositioning::guiConfig()
     {
         flow::ApplyChanges();
     }
+
+    ImGui::Separator();
+
+    if (_algorithm.getEstimatorType() == SPP::Algorithm::EstimatorType::KalmanFilter) { ImGui::BeginDisabled(); }
+    if (ImGui::Checkbox(fmt::format("Batch processing##{}", size_t(id)).c_str(), &_batchProcessing))
+    {
+        LOG_DEBUG("{}: Batch processing changed to {}", nameId(), _batchProcessing);
+        flow::ApplyChanges();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Post-processing only. Collects the observations and calculates the epochs\n"
+                             "of a batch in parallel on all CPU cores. The solutions are sent out in time order\n"
+                             "once the batch is full or all observations were received.\n"
+                             "Only available for the least squares estimators, because they have no dependency between the epochs.");
+    if (_batchProcessing)
+    {
+        ImGui::SetNextItemWidth(itemWidth);
+        if (ImGui::InputIntL(fmt::format("Epochs per batch##{}", size_t(id)).c_str(), &_batchSize, 1, std::numeric_limits<int>::max(), 100, 1000))
+        {
+            LOG_DEBUG("{}: Epochs per batch changed to {}", nameId(), _batchSize);
+            flow::ApplyChanges();
+        }
+    }
+    if (_algorithm.getEstimatorType() == SPP::Algorithm::EstimatorType::KalmanFilter) { ImGui::EndDisabled(); }
 }
 
 [[nodiscard]] json NAV::SinglePointPositioning::save() const
@@ -116,6 +144,8 @@ void NAV::SinglePointPositioning::guiConfig()
     return {
         { "dynamicInputPins", _dynamicInputPins },
         { "algorithm", _algorithm },
+        { "batchProcessing", _batchProcessing },
+        { "batchSize", _batchSize },
     };
 }
 
@@ -125,6 +155,8 @@ void NAV::SinglePointPositioning::restore(json const& j)
 
     if (j.contains("dynamicInputPins")) { NAV::gui::widgets::from_json(j.at("dynamicInputPins"), _dynamicInputPins, this); }
     if (j.contains("algorithm")) { j.at("algorithm").get_to(_algorithm); }
+    if (j.contains("batchProcessing")) { j.at("batchProcessing").get_to(_batchProcessing); }
+    if (j.contains("batchSize")) { j.at("batchSize").get_to(_batchSize); }
 }
 
 bool NAV::SinglePointPositioning::initialize()
@@ -138,6 +170,7 @@ bool NAV::SinglePointPositioning::initialize()
     }
 
     _algorithm.reset();
+    _batchEpochs.clear();
 
     LOG_DEBUG("{}: initialized", nameId());
 
@@ -147,6 +180,13 @@ bool NAV::SinglePointPositioning::initialize()
 void NAV::SinglePointPositioning::deinitialize()
 {
     LOG_TRACE("{}: called", nameId());
+
+    _batchEpochs.clear();
+}
+
+void NAV::SinglePointPositioning::finalizePostProcessing()
+{
+    processBatch();
 }
 
 void NAV::SinglePointPositioning::pinAddCallback(Node* node)
@@ -159,8 +199,22 @@ void NAV::SinglePointPositioning::pinDeleteCallback(Node* node, size_t pinIdx)
     nm::DeleteInputPin(node->inputPins.at(pinIdx));
 }
 
+bool NAV::SinglePointPositioning::isBatchProcessingActive() const
+{
+    return _batchProcessing
+           && _algorithm.getEstimatorType() != SPP::Algorithm::EstimatorType::KalmanFilter
+           && getMode() == Mode::POST_PROCESSING;
+}
+
 void NAV::SinglePointPositioning::recvGnssObs(NAV::InputPin::NodeDataQueue& queue, size_t /* pinIdx */)
 {
+    if (isBatchProcessingActive())
+    {
+        _batchEpochs.push_back(std::static_pointer_cast<const GnssObs>(queue.extract_front()));
+        if (_batchEpochs.size() >= static_cast<size_t>(_batchSize)) { processBatch(); }
+        return;
+    }
+
     // Collection of all connected navigation data providers
     std::vector<InputPin::IncomingLink::ValueWrapper<GnssNavInfo>> gnssNavInfoWrappers;
     std::vector<const GnssNavInfo*> gnssNavInfos;
@@ -181,4 +235,58 @@ void NAV::SinglePointPositioning::recvGnssObs(NAV::InputPin::NodeDataQueue& queu
     {
         invokeCallbacks(OUTPUT_PORT_INDEX_SPPSOL, sppSol);
     }
-}
\ No newline at end of file
+}
+void NAV::SinglePointPositioning::processBatch()
+{
+    if (_batchEpochs.empty()) { return; }
+
+    std::vector<InputPin::IncomingLink::ValueWrapper<GnssNavInfo>> gnssNavInfoWrappers;
+    std::vector<const GnssNavInfo*> gnssNavInfos;
+    for (size_t i = 0; i < _dynamicInputPins.getNumberOfDynamicPins(); i++)
+    {
+        if (auto gnssNavInfo = getInputValue<GnssNavInfo>(INPUT_PORT_INDEX_GNSS_NAV_INFO + i))
+        {
+            gnssNavInfoWrappers.push_back(*gnssNavInfo);
+            gnssNavInfos.push_back(gnssNavInfo->v);
+        }
+    }
+    if (gnssNavInfos.empty())
+    {
+        _batchEpochs.clear();
+        return;
+    }
+
+    LOG_DEBUG("{}: Calculating a batch of {} epochs [{} - {}]", nameId(), _batchEpochs.size(),
+              _batchEpochs.front()->insTime.toYMDHMS(GPST), _batchEpochs.back()->insTime.toYMDHMS(GPST));
+
+    // Every worker calculates a contiguous segment of epochs with its own copy of the algorithm.
+    // Segments after the first one start by calculating the last epoch of the previous segment,
+    // so that the receiver state (initial position, velocity from position differences) is the same as when calculating serially.
+    size_t nSegments = std::min(_batchEpochs.size(), ThreadPool::Shared().threadCount() + 1);
+    size_t segmentSize = (_batchEpochs.size() + nSegments - 1) / nSegments;
+    nSegments = (_batchEpochs.size() + segmentSize - 1) / segmentSize;
+
+    std::vector<std::shared_ptr<SppSolution>> solutions(_batchEpochs.size());
+    std::vector<SPP::Algorithm> algorithms(nSegments, _algorithm);
+    const auto nodeNameId = nameId();
+
+    ThreadPool::Shared().parallelFor(nSegments, [&](size_t s) {
+        size_t begin = s * segmentSize;
+        size_t end = std::min(begin + segmentSize, _batchEpochs.size());
+        auto& algorithm = algorithms.at(s);
+
+        if (s != 0) { [[maybe_unused]] auto warmUp = algorithm.calcSppSolution(_batchEpochs.at(begin - 1), gnssNavInfos, nodeNameId); }
+        for (size_t e = begin; e < end; e++)
+        {
+            solutions.at(e) = algorithm.calcSppSolution(_batchEpochs.at(e), gnssNavInfos, nodeNameId);
+        }
+    });
+
+    _algorithm = std::move(algorithms.back());
+    _batchEpochs.clear();
+
+    for (auto& sppSol : solutions)
+    {
+        if (sppSol) { invokeCallbacks(OUTPUT_PORT_INDEX_SPPSOL, sppSol); }
+    }
+}
@@ -13,6 +13,9 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "internal/Node/Node.hpp"
 #include "internal/gui/widgets/DynamicInputPins.hpp"
 
@@ -76,6 +79,9 @@ class SinglePointPositioning : public Node
     /// @brief Deinitialize the node
     void deinitialize() override;
 
+    /// @brief Calculates the epochs remaining in the batch at the end of post-processing
+    void finalizePostProcessing() override;
+
     /// @brief Function to call to add a new pin
     /// @param[in, out] node Pointer to this node
     static void pinAddCallback(Node* node);
@@ -87,6 +93,19 @@ class SinglePointPositioning : public Node
     /// @brief SPP algorithm
     SPP::Algorithm _algorithm;
 
+    /// @brief Whether to collect the epochs in post-processing and calculate them in parallel (only for the least squares estimators)
+    bool _batchProcessing = false;
+    /// @brief Amount of epochs to collect before calculating them
+    int _batchSize = 3600;
+    /// @brief Collected epochs
+    std::vector<std::shared_ptr<const GnssObs>> _batchEpochs;
+
+    /// @brief Checks whether the epochs are collected and calculated in batches
+    [[nodiscard]] bool isBatchProcessingActive() const;
+
+    /// @brief Calculates the collected epochs in parallel and sends out the solutions in time order
+    void processBatch();
+
     /// @brief Dynamic input pins
     /// @attention This should always be the last variable in the header, because it accesses others through the function callbacks
     gui::widgets::DynamicInputPins _dynamicInputPins{ INPUT_PORT_INDEX_GNSS_NAV_INFO, this, pinAddCallback, pinDeleteCallback };
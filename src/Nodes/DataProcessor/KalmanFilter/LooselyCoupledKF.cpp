@@ -204,6 +204,21 @@ void NAV::LooselyCoupledKF::guiConfig()
             flow::ApplyChanges();
         }
 
+        ImGui::SetNextItemWidth(configWidth + ImGui::GetStyle().ItemSpacing.x);
+        if (ImGui::InputIntL(fmt::format("Covariance propagation interval##{}", size_t(id)).c_str(), &_covariancePropagationInterval, 1, 1000))
+        {
+            LOG_DEBUG("{}: Covariance propagation interval changed to {}", nameId(), _covariancePropagationInterval);
+            flow::ApplyChanges();
+        }
+        ImGui::SameLine();
+        gui::widgets::HelpMarker("Amount of IMU samples over which the prediction is accumulated.\n"
+                                 "Only the system matrix F is averaged per sample. Phi and Q are calculated\n"
+                                 "and the covariance is propagated only at this reduced rate.\n"
+                                 "Before a measurement update the covariance is always propagated.\n"
+                                 "1 propagates the covariance with every IMU sample (default).\n\n"
+                                 "Attention: The solutions output between two propagations carry no standard\n"
+                                 "deviation and covariance, so these columns stay empty in loggers and plots.");
+
         ImGui::Separator();
 
         // ###########################################################################################################
@@ -527,6 +542,7 @@ void NAV::LooselyCoupledKF::guiConfig()
     j["phiCalculationAlgorithm"] = _phiCalculationAlgorithm;
     j["phiCalculationTaylorOrder"] = _phiCalculationTaylorOrder;
     j["qCalculationAlgorithm"] = _qCalculationAlgorithm;
+    j["covariancePropagationInterval"] = _covariancePropagationInterval;
 
     j["randomProcessAccel"] = _randomProcessAccel;
     j["randomProcessGyro"] = _randomProcessGyro;
@@ -606,6 +622,10 @@ void NAV::LooselyCoupledKF::restore(json const& j)
     {
         j.at("qCalculationAlgorithm").get_to(_qCalculationAlgorithm);
     }
+    if (j.contains("covariancePropagationInterval"))
+    {
+        j.at("covariancePropagationInterval").get_to(_covariancePropagationInterval);
+    }
     // ------------------------------- 𝐐 System/Process noise covariance matrix ---------------------------------
     if (j.contains("randomProcessAccel"))
     {
@@ -750,6 +770,7 @@ bool NAV::LooselyCoupledKF::initialize()
     _inertialIntegrator.reset();
     _lastImuObs = nullptr;
     _externalInitTime.reset();
+    _pendingPredictionSamples = 0;
 
     _kalmanFilter.setZero();
 
@@ -884,12 +905,13 @@ void NAV::LooselyCoupledKF::invokeCallbackWithPosVelAtt(const PosVelAtt& posVelA
 {
     auto lckfSolution = std::make_shared<InsGnssLCKFSolution>();
     lckfSolution->insTime = posVelAtt.insTime;
-    if (posVelAtt.e_CovarianceMatrix())
+    if (auto e_covarianceMatrix = posVelAtt.e_CovarianceMatrix())
     {
-        lckfSolution->setStateAndStdDev_e(posVelAtt.e_position(), posVelAtt.e_CovarianceMatrix()->get()(PosVel::States::Pos, PosVel::States::Pos),
-                                          posVelAtt.e_velocity(), posVelAtt.e_CovarianceMatrix()->get()(PosVel::States::Vel, PosVel::States::Vel),
+        const auto& e_P = e_covarianceMatrix->get();
+        lckfSolution->setStateAndStdDev_e(posVelAtt.e_position(), e_P.block<3, 3>(PosVel::States::PosX, PosVel::States::PosX),
+                                          posVelAtt.e_velocity(), e_P.block<3, 3>(PosVel::States::VelX, PosVel::States::VelX),
                                           posVelAtt.e_Quat_b());
-        lckfSolution->setPosVelCovarianceMatrix_e(posVelAtt.e_CovarianceMatrix()->get()(PosVel::States::PosVel, PosVel::States::PosVel));
+        lckfSolution->setPosVelCovarianceMatrix_e(e_P);
     }
     else
     {
@@ -939,20 +961,27 @@ void NAV::LooselyCoupledKF::recvImuObservation(InputPin::NodeDataQueue& queue, s
     if (inertialNavSol && _inertialIntegrator.getMeasurements().back().dt > 1e-8)
     {
         looselyCoupledPrediction(inertialNavSol, _inertialIntegrator.getMeasurements().back().dt, std::static_pointer_cast<const ImuObs>(nodeData)->imuPos);
-
-        if (_inertialIntegrator.getIntegrationFrame() == InertialIntegrator::IntegrationFrame::NED)
+        if (_pendingPredictionSamples >= _covariancePropagationInterval)
         {
-            inertialNavSol->setStateAndStdDev_n(inertialNavSol->lla_position(), _kalmanFilter.P(KFPos, KFPos),
-                                                inertialNavSol->n_velocity(), _kalmanFilter.P(KFVel, KFVel),
-                                                inertialNavSol->n_Quat_b());
-            inertialNavSol->setPosVelCovarianceMatrix_n(_kalmanFilter.P(KFPosVel, KFPosVel));
+            propagateAccumulatedPrediction();
         }
-        else // if (_inertialIntegrator.getIntegrationFrame() == InertialIntegrator::IntegrationFrame::ECEF)
+
+        if (_pendingPredictionSamples == 0) // Otherwise the covariance is not propagated to this sample yet
         {
-            inertialNavSol->setStateAndStdDev_e(inertialNavSol->e_position(), _kalmanFilter.P(KFPos, KFPos),
-                                                inertialNavSol->e_velocity(), _kalmanFilter.P(KFVel, KFVel),
-                                                inertialNavSol->e_Quat_b());
-            inertialNavSol->setPosVelCovarianceMatrix_e(_kalmanFilter.P(KFPosVel, KFPosVel));
+            if (_inertialIntegrator.getIntegrationFrame() == InertialIntegrator::IntegrationFrame::NED)
+            {
+                inertialNavSol->setStateAndStdDev_n(inertialNavSol->lla_position(), _kalmanFilter.P(KFPos, KFPos),
+                                                    inertialNavSol->n_velocity(), _kalmanFilter.P(KFVel, KFVel),
+                                                    inertialNavSol->n_Quat_b());
+                inertialNavSol->setPosVelCovarianceMatrix_n(_kalmanFilter.P(KFPosVel, KFPosVel));
+            }
+            else // if (_inertialIntegrator.getIntegrationFrame() == InertialIntegrator::IntegrationFrame::ECEF)
+            {
+                inertialNavSol->setStateAndStdDev_e(inertialNavSol->e_position(), _kalmanFilter.P(KFPos, KFPos),
+                                                    inertialNavSol->e_velocity(), _kalmanFilter.P(KFVel, KFVel),
+                                                    inertialNavSol->e_Quat_b());
+                inertialNavSol->setPosVelCovarianceMatrix_e(_kalmanFilter.P(KFPosVel, KFPosVel));
+            }
         }
 
         LOG_DATA("{}:   e_position   = {}", nameId(), inertialNavSol->e_position().transpose());
@@ -1004,6 +1033,7 @@ void NAV::LooselyCoupledKF::recvPosVelObservation(InputPin::NodeDataQueue& queue
         return;
     }
 
+    propagateAccumulatedPrediction(); // The update needs the covariance at the time of the measurement
     looselyCoupledUpdate(obs);
 }
 
@@ -1032,7 +1062,7 @@ void NAV::LooselyCoupledKF::recvPosVelAttInit(InputPin::NodeDataQueue& queue, si
 
 void NAV::LooselyCoupledKF::looselyCoupledPrediction(const std::shared_ptr<const PosVelAtt>& inertialNavSol, double tau_i, const ImuPos& imuPos)
 {
-    LOG_DATA("{}: [{}] Predicting", nameId(), inertialNavSol->insTime.toYMDHMS(GPST));
+    LOG_DATA("{}: [{}] Calculating the transition and noise matrices", nameId(), inertialNavSol->insTime.toYMDHMS(GPST));
 
     // ------------------------------------------- GUI Parameters ----------------------------------------------
 
@@ -1196,10 +1226,38 @@ void NAV::LooselyCoupledKF::looselyCoupledPrediction(const std::shared_ptr<const
         LOG_DATA("{}:     W =\n{}", nameId(), _kalmanFilter.W(all, all));
 
         LOG_DATA("{}:     G*W*G^T =\n{}", nameId(), _kalmanFilter.G(all, all) * _kalmanFilter.W(all, all) * _kalmanFilter.G(all, all).transpose());
+    }
 
+    // Only the system matrix is accumulated per IMU sample, 𝚽 and 𝐐 are calculated once per covariance propagation.
+    // The time-weighted mean of 𝐅 over the accumulated time step is the first order approximation of 𝚽 = 𝚽ₙ · … · 𝚽₁.
+    if (_pendingPredictionSamples == 0)
+    {
+        _accumulatedF = _kalmanFilter.F(all, all);
+        _accumulatedDt = tau_i;
+        if (_qCalculationAlgorithm == QCalculationAlgorithm::Taylor1) { _accumulatedQ = _kalmanFilter.Q(all, all); }
+    }
+    else
+    {
+        _accumulatedDt += tau_i;
+        _accumulatedF += tau_i / _accumulatedDt * (_kalmanFilter.F(all, all) - _accumulatedF);
+        if (_qCalculationAlgorithm == QCalculationAlgorithm::Taylor1) { _accumulatedQ += _kalmanFilter.Q(all, all); }
+    }
+    _pendingPredictionSamples++;
+}
+
+void NAV::LooselyCoupledKF::propagateAccumulatedPrediction()
+{
+    if (_pendingPredictionSamples == 0 || !_lastImuObs) { return; }
+
+    LOG_DATA("{}: Propagating over {} IMU samples ({} s)", nameId(), _pendingPredictionSamples, _accumulatedDt);
+    _kalmanFilter.F(all, all) = _accumulatedF;
+    if (_qCalculationAlgorithm == QCalculationAlgorithm::Taylor1) { _kalmanFilter.Q(all, all) = _accumulatedQ; }
+
+    if (_qCalculationAlgorithm == QCalculationAlgorithm::VanLoan)
+    {
         // 1. Calculate the transition matrix 𝚽_{k-1}
         // 2. Calculate the system noise covariance matrix Q_{k-1}
-        _kalmanFilter.calcPhiAndQWithVanLoanMethod(tau_i);
+        _kalmanFilter.calcPhiAndQWithVanLoanMethod(_accumulatedDt);
     }
 
     // If Q was calculated over Van Loan, then the Phi matrix was automatically calculated with the exponential matrix
@@ -1209,12 +1267,12 @@ void NAV::LooselyCoupledKF::looselyCoupledPrediction(const std::shared_ptr<const
             if (_phiCalculationAlgorithm == PhiCalculationAlgorithm::Exponential)
             {
                 // 1. Calculate the transition matrix 𝚽_{k-1}
-                _kalmanFilter.calcTransitionMatrix_Phi_exp(tau_i);
+                _kalmanFilter.calcTransitionMatrix_Phi_exp(_accumulatedDt);
             }
             else if (_phiCalculationAlgorithm == PhiCalculationAlgorithm::Taylor)
             {
                 // 1. Calculate the transition matrix 𝚽_{k-1}
-                _kalmanFilter.calcTransitionMatrix_Phi_Taylor(tau_i, static_cast<size_t>(_phiCalculationTaylorOrder));
+                _kalmanFilter.calcTransitionMatrix_Phi_Taylor(_accumulatedDt, static_cast<size_t>(_phiCalculationTaylorOrder));
             }
             else
             {
@@ -1227,6 +1285,9 @@ void NAV::LooselyCoupledKF::looselyCoupledPrediction(const std::shared_ptr<const
     LOG_DATA("{}:     KF.Q =\n{}", nameId(), _kalmanFilter.Q);
 
     LOG_DATA("{}:     Q - Q^T =\n{}", nameId(), _kalmanFilter.Q(all, all) - _kalmanFilter.Q(all, all).transpose());
+
+    _pendingPredictionSamples = 0;
+
     LOG_DATA("{}:     KF.P (before prediction) =\n{}", nameId(), _kalmanFilter.P);
 
     // 3. Propagate the state vector estimate from x(+) and x(-)
@@ -1256,7 +1317,7 @@ void NAV::LooselyCoupledKF::looselyCoupledPrediction(const std::shared_ptr<const
         auto rank = lu.rank();
         if (rank != _kalmanFilter.P(all, all).rows())
         {
-            LOG_WARN("{}: [{}] P.rank = {}", nameId(), inertialNavSol->insTime.toYMDHMS(GPST), rank);
+            LOG_WARN("{}: [{}] P.rank = {}", nameId(), _lastImuObs->insTime.toYMDHMS(GPST), rank);
         }
     }
 }
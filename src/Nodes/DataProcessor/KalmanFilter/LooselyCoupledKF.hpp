@@ -141,12 +141,15 @@ class LooselyCoupledKF : public Node
     /// @param[in] pinIdx Index of the pin the data is received on
     void recvPosVelAttInit(InputPin::NodeDataQueue& queue, size_t pinIdx);
 
-    /// @brief Predicts the state from the InertialNavSol
+    /// @brief Calculates the transition and noise matrices for the InertialNavSol and accumulates them until the next covariance propagation
     /// @param[in] inertialNavSol Inertial navigation solution triggering the prediction
     /// @param[in] tau_i Time since the last prediction in [s]
     /// @param[in] imuPos IMU platform frame position with respect to body frame
     void looselyCoupledPrediction(const std::shared_ptr<const PosVelAtt>& inertialNavSol, double tau_i, const ImuPos& imuPos);
 
+    /// @brief Predicts the state and covariance with the matrices accumulated over all IMU samples since the last propagation
+    void propagateAccumulatedPrediction();
+
     /// @brief Updates the predicted state from the InertialNavSol with the PosVel observation
     /// @param[in] posVelObs PosVel measurement triggering the update
     void looselyCoupledUpdate(const std::shared_ptr<const PosVel>& posVelObs);
@@ -162,6 +165,15 @@ class LooselyCoupledKF : public Node
     /// Last received IMU observation (to get ImuPos)
     std::shared_ptr<const ImuObs> _lastImuObs = nullptr;
 
+    /// Time-weighted mean of the system matrices 𝐅ₖ of all IMU samples since the last covariance propagation
+    Eigen::MatrixXd _accumulatedF;
+    /// Sum of the system noise covariance matrices 𝐐ₖ of all IMU samples since the last covariance propagation (Taylor 1st order only)
+    Eigen::MatrixXd _accumulatedQ;
+    /// Time since the last covariance propagation in [s]
+    double _accumulatedDt = 0.0;
+    /// Amount of IMU samples since the last covariance propagation
+    int _pendingPredictionSamples = 0;
+
     /// Roll, Pitch and Yaw angles in [deg] used for initialization if not taken from separate pin
     std::array<double, 3> _initalRollPitchYaw{};
     /// Whether to initialize the state over an external pin
@@ -207,6 +219,9 @@ class LooselyCoupledKF : public Node
     /// @brief Check the rank of the Kalman matrices every iteration (computational expensive)
     bool _checkKalmanMatricesRanks = true;
 
+    /// @brief Amount of IMU samples over which the prediction is accumulated before propagating the covariance
+    int _covariancePropagationInterval = 1;
+
     // ###########################################################################################################
     //                                                Parameters
     // ###########################################################################################################
@@ -447,6 +447,19 @@ void NAV::TightlyCoupledKF::guiConfig()
             flow::ApplyChanges();
         }
 
+        ImGui::SetNextItemWidth(configWidth + ImGui::GetStyle().ItemSpacing.x);
+        if (ImGui::InputIntL(fmt::format("Covariance propagation interval##{}", size_t(id)).c_str(), &_covariancePropagationInterval, 1, 1000))
+        {
+            LOG_DEBUG("{}: Covariance propagation interval changed to {}", nameId(), _covariancePropagationInterval);
+            flow::ApplyChanges();
+        }
+        ImGui::SameLine();
+        gui::widgets::HelpMarker("Amount of IMU samples over which the prediction is accumulated.\n"
+                                 "Only the system matrix F is averaged per sample. Phi and Q are calculated\n"
+                                 "and the covariance is propagated only at this reduced rate.\n"
+                                 "Before a measurement update the covariance is always propagated.\n"
+                                 "1 propagates the covariance with every IMU sample (default).");
+
         // ###########################################################################################################
         //                                Q - System/Process noise covariance matrix
         // ###########################################################################################################
@@ -827,6 +840,7 @@ void NAV::TightlyCoupledKF::guiConfig()
     json j;
 
     j["inertialIntegrator"] = _inertialIntegrator;
+    j["initializeStateOverExternalPin"] = _initializeStateOverExternalPin;
     j["showKalmanFilterOutputPins"] = _showKalmanFilterOutputPins;
     j["nNavInfoPins"] = _nNavInfoPins;
     j["frequencies"] = Frequency_(_filterFreq);
@@ -840,6 +854,7 @@ void NAV::TightlyCoupledKF::guiConfig()
     j["phiCalculationAlgorithm"] = _phiCalculationAlgorithm;
     j["phiCalculationTaylorOrder"] = _phiCalculationTaylorOrder;
     j["qCalculationAlgorithm"] = _qCalculationAlgorithm;
+    j["covariancePropagationInterval"] = _covariancePropagationInterval;
 
     j["randomProcessAccel"] = _randomProcessAccel;
     j["randomProcessGyro"] = _randomProcessGyro;
@@ -891,6 +906,11 @@ void NAV::TightlyCoupledKF::restore(json const& j)
     {
         j.at("inertialIntegrator").get_to(_inertialIntegrator);
     }
+    if (j.contains("initializeStateOverExternalPin"))
+    {
+        j.at("initializeStateOverExternalPin").get_to(_initializeStateOverExternalPin);
+        updateExternalPvaInitPin();
+    }
     if (j.contains("showKalmanFilterOutputPins"))
     {
         j.at("showKalmanFilterOutputPins").get_to(_showKalmanFilterOutputPins);
@@ -948,6 +968,10 @@ void NAV::TightlyCoupledKF::restore(json const& j)
     {
         j.at("qCalculationAlgorithm").get_to(_qCalculationAlgorithm);
     }
+    if (j.contains("covariancePropagationInterval"))
+    {
+        j.at("covariancePropagationInterval").get_to(_covariancePropagationInterval);
+    }
     // ------------------------------- 𝐐 System/Process noise covariance matrix ---------------------------------
     if (j.contains("randomProcessAccel"))
     {
@@ -1117,6 +1141,7 @@ bool NAV::TightlyCoupledKF::initialize()
     _inertialIntegrator.reset();
     _lastImuObs = nullptr;
     _externalInitTime.reset();
+    _pendingPredictionSamples = 0;
 
     _recvClk = {};
 
@@ -1259,6 +1284,80 @@ void NAV::TightlyCoupledKF::deinitialize()
     LOG_TRACE("{}: called", nameId());
 }
 
+std::optional<json> NAV::TightlyCoupledKF::saveCheckpoint()
+{
+    json j;
+    j["inertialIntegrator"] = _inertialIntegrator.saveCheckpoint();
+    j["kalmanFilter"] = {
+        { "x", _kalmanFilter.x },
+        { "P", _kalmanFilter.P },
+        { "Phi", _kalmanFilter.Phi },
+        { "Q", _kalmanFilter.Q },
+    };
+    if (_lastImuObs)
+    {
+        j["lastImuObs"] = { { "insTime", _lastImuObs->insTime }, { "imuPos", _lastImuObs->imuPos } };
+    }
+    j["pendingPredictionSamples"] = _pendingPredictionSamples;
+    if (_pendingPredictionSamples > 0)
+    {
+        j["accumulatedF"] = _accumulatedF;
+        j["accumulatedDt"] = _accumulatedDt;
+        if (_qCalculationAlgorithm == QCalculationAlgorithm::Taylor1) { j["accumulatedQ"] = _accumulatedQ; }
+        else
+        {
+            j["predictionG"] = _predictionG;
+            j["predictionW"] = _predictionW;
+        }
+    }
+    if (!_externalInitTime.empty()) { j["externalInitTime"] = _externalInitTime; }
+    return j;
+}
+
+bool NAV::TightlyCoupledKF::restoreCheckpoint(const json& j)
+{
+    if (!j.contains("inertialIntegrator") || !j.contains("kalmanFilter")) { return false; }
+
+    _inertialIntegrator.restoreCheckpoint(j.at("inertialIntegrator"));
+
+    const auto& kf = j.at("kalmanFilter");
+    kf.at("x").get_to(_kalmanFilter.x);
+    kf.at("P").get_to(_kalmanFilter.P);
+    kf.at("Phi").get_to(_kalmanFilter.Phi);
+    kf.at("Q").get_to(_kalmanFilter.Q);
+
+    if (j.contains("lastImuObs"))
+    {
+        auto lastImuObs = std::make_shared<ImuObs>(j.at("lastImuObs").at("imuPos").get<ImuPos>());
+        j.at("lastImuObs").at("insTime").get_to(lastImuObs->insTime);
+        _lastImuObs = lastImuObs;
+    }
+    if (j.contains("pendingPredictionSamples")) { j.at("pendingPredictionSamples").get_to(_pendingPredictionSamples); }
+    if (_pendingPredictionSamples > 0)
+    {
+        if (!j.contains("accumulatedF") || !j.contains("accumulatedDt")) { return false; }
+        j.at("accumulatedF").get_to(_accumulatedF);
+        j.at("accumulatedDt").get_to(_accumulatedDt);
+        if (_qCalculationAlgorithm == QCalculationAlgorithm::Taylor1)
+        {
+            if (!j.contains("accumulatedQ")) { return false; }
+            j.at("accumulatedQ").get_to(_accumulatedQ);
+        }
+        else
+        {
+            if (!j.contains("predictionG") || !j.contains("predictionW")) { return false; }
+            j.at("predictionG").get_to(_predictionG);
+            j.at("predictionW").get_to(_predictionW);
+        }
+    }
+    if (j.contains("externalInitTime"))
+    {
+        j.at("externalInitTime").get_to(_externalInitTime);
+        inputPins[INPUT_PORT_INDEX_GNSS_OBS].priority = 0; // Same as after receiving the initial state over the external pin
+    }
+    return true;
+}
+
 void NAV::TightlyCoupledKF::invokeCallbackWithPosVelAtt(const PosVelAtt& posVelAtt)
 {
     auto tckfSolution = std::make_shared<InsGnssTCKFSolution>();
@@ -1311,6 +1410,10 @@ void NAV::TightlyCoupledKF::recvImuObservation(InputPin::NodeDataQueue& queue, s
     if (inertialNavSol && _inertialIntegrator.getMeasurements().back().dt > 1e-8)
     {
         tightlyCoupledPrediction(inertialNavSol, _inertialIntegrator.getMeasurements().back().dt, std::static_pointer_cast<const ImuObs>(nodeData)->imuPos);
+        if (_pendingPredictionSamples >= _covariancePropagationInterval)
+        {
+            propagateAccumulatedPrediction();
+        }
 
         LOG_DATA("{}:   e_position   = {}", nameId(), inertialNavSol->e_position().transpose());
         LOG_DATA("{}:   e_velocity   = {}", nameId(), inertialNavSol->e_velocity().transpose());
@@ -1324,6 +1427,7 @@ void NAV::TightlyCoupledKF::recvGnssObs(InputPin::NodeDataQueue& queue, size_t /
     auto obs = std::static_pointer_cast<const GnssObs>(queue.extract_front());
     LOG_DATA("{}: recvGnssObs at time [{}]", nameId(), obs->insTime.toYMDHMS());
 
+    propagateAccumulatedPrediction(); // The update needs the covariance at the time of the measurement
     tightlyCoupledUpdate(obs);
 }
 
@@ -1454,6 +1558,8 @@ void NAV::TightlyCoupledKF::tightlyCoupledPrediction(const std::shared_ptr<const
 
     // System Matrix
     Eigen::Matrix<double, 17, 17> F;
+    // System noise covariance matrix (only calculated per sample with the Taylor 1st order algorithm)
+    Eigen::Matrix<double, 17, 17> Q = Eigen::Matrix<double, 17, 17>::Zero();
 
     if (_inertialIntegrator.getIntegrationFrame() == InertialIntegrator::IntegrationFrame::NED)
     {
@@ -1487,26 +1593,12 @@ void NAV::TightlyCoupledKF::tightlyCoupledPrediction(const std::shared_ptr<const
         if (_qCalculationAlgorithm == QCalculationAlgorithm::Taylor1)
         {
             // 2. Calculate the system noise covariance matrix Q_{k-1}
-            if (_showKalmanFilterOutputPins)
-            {
-                auto guard = requestOutputValueLock(OUTPUT_PORT_INDEX_Q);
-                _kalmanFilter.Q = n_systemNoiseCovarianceMatrix_Q(sigma2_ra, sigma2_rg,
-                                                                  sigma2_bad, sigma2_bgd,
-                                                                  _tau_bad, _tau_bgd,
-                                                                  sigma2_cPhi, sigma2_cf,
-                                                                  F.block<3, 3>(3, 0), T_rn_p,
-                                                                  n_Quat_b.toRotationMatrix(), tau_i);
-                notifyOutputValueChanged(OUTPUT_PORT_INDEX_Q, predictTime, guard);
-            }
-            else
-            {
-                _kalmanFilter.Q = n_systemNoiseCovarianceMatrix_Q(sigma2_ra, sigma2_rg,
-                                                                  sigma2_bad, sigma2_bgd,
-                                                                  _tau_bad, _tau_bgd,
-                                                                  sigma2_cPhi, sigma2_cf,
-                                                                  F.block<3, 3>(3, 0), T_rn_p,
-                                                                  n_Quat_b.toRotationMatrix(), tau_i);
-            }
+            Q = n_systemNoiseCovarianceMatrix_Q(sigma2_ra, sigma2_rg,
+                                                sigma2_bad, sigma2_bgd,
+                                                _tau_bad, _tau_bgd,
+                                                sigma2_cPhi, sigma2_cf,
+                                                F.block<3, 3>(3, 0), T_rn_p,
+                                                n_Quat_b.toRotationMatrix(), tau_i);
         }
     }
     else // if (_inertialIntegrator.getIntegrationFrame() == InertialIntegrator::IntegrationFrame::ECEF)
@@ -1528,53 +1620,65 @@ void NAV::TightlyCoupledKF::tightlyCoupledPrediction(const std::shared_ptr<const
         if (_qCalculationAlgorithm == QCalculationAlgorithm::Taylor1)
         {
             // 2. Calculate the system noise covariance matrix Q_{k-1}
-            if (_showKalmanFilterOutputPins)
-            {
-                auto guard = requestOutputValueLock(OUTPUT_PORT_INDEX_Q);
-                _kalmanFilter.Q = e_systemNoiseCovarianceMatrix_Q(sigma2_ra, sigma2_rg,
-                                                                  sigma2_bad, sigma2_bgd,
-                                                                  _tau_bad, _tau_bgd,
-                                                                  sigma2_cPhi, sigma2_cf,
-                                                                  F.block<3, 3>(3, 0),
-                                                                  e_Quat_b.toRotationMatrix(), tau_i);
-                notifyOutputValueChanged(OUTPUT_PORT_INDEX_Q, predictTime, guard);
-            }
-            else
-            {
-                _kalmanFilter.Q = e_systemNoiseCovarianceMatrix_Q(sigma2_ra, sigma2_rg,
-                                                                  sigma2_bad, sigma2_bgd,
-                                                                  _tau_bad, _tau_bgd,
-                                                                  sigma2_cPhi, sigma2_cf,
-                                                                  F.block<3, 3>(3, 0),
-                                                                  e_Quat_b.toRotationMatrix(), tau_i);
-            }
+            Q = e_systemNoiseCovarianceMatrix_Q(sigma2_ra, sigma2_rg,
+                                                sigma2_bad, sigma2_bgd,
+                                                _tau_bad, _tau_bgd,
+                                                sigma2_cPhi, sigma2_cf,
+                                                F.block<3, 3>(3, 0),
+                                                e_Quat_b.toRotationMatrix(), tau_i);
         }
     }
 
     if (_qCalculationAlgorithm == QCalculationAlgorithm::VanLoan)
     {
         // Noise Input Matrix
-        Eigen::Matrix<double, 17, 14> G = noiseInputMatrix_G(_inertialIntegrator.getIntegrationFrame() == InertialIntegrator::IntegrationFrame::NED
-                                                                 ? inertialNavSol->n_Quat_b()
-                                                                 : inertialNavSol->e_Quat_b());
-        LOG_DATA("{}:     G =\n{}", nameId(), G);
+        _predictionG = noiseInputMatrix_G(_inertialIntegrator.getIntegrationFrame() == InertialIntegrator::IntegrationFrame::NED
+                                              ? inertialNavSol->n_Quat_b()
+                                              : inertialNavSol->e_Quat_b());
+        LOG_DATA("{}:     G =\n{}", nameId(), _predictionG);
 
-        Eigen::Matrix<double, 14, 14> W = noiseScaleMatrix_W(sigma2_ra, sigma2_rg,
-                                                             sigma2_bad, sigma2_bgd,
-                                                             _tau_bad, _tau_bgd,
-                                                             sigma2_cPhi, sigma2_cf);
-        LOG_DATA("{}:     W =\n{}", nameId(), W);
+        _predictionW = noiseScaleMatrix_W(sigma2_ra, sigma2_rg,
+                                          sigma2_bad, sigma2_bgd,
+                                          _tau_bad, _tau_bgd,
+                                          sigma2_cPhi, sigma2_cf);
+        LOG_DATA("{}:     W =\n{}", nameId(), _predictionW);
 
-        LOG_DATA("{}:     G*W*G^T =\n{}", nameId(), G * W * G.transpose());
+        LOG_DATA("{}:     G*W*G^T =\n{}", nameId(), _predictionG * _predictionW * _predictionG.transpose());
+    }
 
-        auto [Phi, Q] = calcPhiAndQWithVanLoanMethod(F, G, W, tau_i);
+    // Only the system matrix is accumulated per IMU sample, 𝚽 and 𝐐 are calculated once per covariance propagation.
+    // The time-weighted mean of 𝐅 over the accumulated time step is the first order approximation of 𝚽 = 𝚽ₙ · … · 𝚽₁.
+    if (_pendingPredictionSamples == 0)
+    {
+        _accumulatedF = F;
+        _accumulatedDt = tau_i;
+        if (_qCalculationAlgorithm == QCalculationAlgorithm::Taylor1) { _accumulatedQ = Q; }
+    }
+    else
+    {
+        _accumulatedDt += tau_i;
+        _accumulatedF += tau_i / _accumulatedDt * (F - _accumulatedF);
+        if (_qCalculationAlgorithm == QCalculationAlgorithm::Taylor1) { _accumulatedQ += Q; }
+    }
+    _pendingPredictionSamples++;
+}
+
+void NAV::TightlyCoupledKF::propagateAccumulatedPrediction()
+{
+    if (_pendingPredictionSamples == 0 || !_lastImuObs) { return; }
+
+    LOG_DATA("{}: Propagating over {} IMU samples ({} s)", nameId(), _pendingPredictionSamples, _accumulatedDt);
+
+    if (_qCalculationAlgorithm == QCalculationAlgorithm::VanLoan)
+    {
+        auto [Phi, Q] = calcPhiAndQWithVanLoanMethod(_accumulatedF, _predictionG, _predictionW, _accumulatedDt);
 
         // 1. Calculate the transition matrix 𝚽_{k-1}
         if (_showKalmanFilterOutputPins)
         {
             auto guard = requestOutputValueLock(OUTPUT_PORT_INDEX_Phi);
             _kalmanFilter.Phi = Phi;
-            notifyOutputValueChanged(OUTPUT_PORT_INDEX_Phi, predictTime, guard);
+            notifyOutputValueChanged(OUTPUT_PORT_INDEX_Phi, _lastImuObs->insTime, guard);
         }
         else
         {
@@ -1586,13 +1690,27 @@ void NAV::TightlyCoupledKF::tightlyCoupledPrediction(const std::shared_ptr<const
         {
             auto guard = requestOutputValueLock(OUTPUT_PORT_INDEX_Q);
             _kalmanFilter.Q = Q;
-            notifyOutputValueChanged(OUTPUT_PORT_INDEX_Q, predictTime, guard);
+            notifyOutputValueChanged(OUTPUT_PORT_INDEX_Q, _lastImuObs->insTime, guard);
         }
         else
         {
             _kalmanFilter.Q = Q;
         }
     }
+    else // if (_qCalculationAlgorithm == QCalculationAlgorithm::Taylor1)
+    {
+        // 2. Calculate the system noise covariance matrix Q_{k-1}
+        if (_showKalmanFilterOutputPins)
+        {
+            auto guard = requestOutputValueLock(OUTPUT_PORT_INDEX_Q);
+            _kalmanFilter.Q = _accumulatedQ;
+            notifyOutputValueChanged(OUTPUT_PORT_INDEX_Q, _lastImuObs->insTime, guard);
+        }
+        else
+        {
+            _kalmanFilter.Q = _accumulatedQ;
+        }
+    }
 
     // If Q was calculated over Van Loan, then the Phi matrix was automatically calculated with the exponential matrix
     if (_phiCalculationAlgorithm != PhiCalculationAlgorithm::Exponential || _qCalculationAlgorithm != QCalculationAlgorithm::VanLoan)
@@ -1601,12 +1719,12 @@ void NAV::TightlyCoupledKF::tightlyCoupledPrediction(const std::shared_ptr<const
             if (_phiCalculationAlgorithm == PhiCalculationAlgorithm::Exponential)
             {
                 // 1. Calculate the transition matrix 𝚽_{k-1}
-                _kalmanFilter.Phi = transitionMatrix_Phi_exp(F, tau_i);
+                _kalmanFilter.Phi = transitionMatrix_Phi_exp(_accumulatedF, _accumulatedDt);
             }
             else if (_phiCalculationAlgorithm == PhiCalculationAlgorithm::Taylor)
             {
                 // 1. Calculate the transition matrix 𝚽_{k-1}
-                _kalmanFilter.Phi = transitionMatrix_Phi_Taylor(F, tau_i, static_cast<size_t>(_phiCalculationTaylorOrder));
+                _kalmanFilter.Phi = transitionMatrix_Phi_Taylor(_accumulatedF, _accumulatedDt, static_cast<size_t>(_phiCalculationTaylorOrder));
             }
             else
             {
@@ -1617,7 +1735,7 @@ void NAV::TightlyCoupledKF::tightlyCoupledPrediction(const std::shared_ptr<const
         {
             auto guard = requestOutputValueLock(OUTPUT_PORT_INDEX_Phi);
             calcPhi();
-            notifyOutputValueChanged(OUTPUT_PORT_INDEX_Phi, predictTime, guard);
+            notifyOutputValueChanged(OUTPUT_PORT_INDEX_Phi, _lastImuObs->insTime, guard);
         }
         else
         {
@@ -1629,6 +1747,9 @@ void NAV::TightlyCoupledKF::tightlyCoupledPrediction(const std::shared_ptr<const
     LOG_DATA("{}:     KF.Q =\n{}", nameId(), _kalmanFilter.Q);
 
     LOG_DATA("{}:     Q - Q^T =\n{}", nameId(), _kalmanFilter.Q - _kalmanFilter.Q.transpose());
+
+    _pendingPredictionSamples = 0;
+
     LOG_DATA("{}:     KF.P (before prediction) =\n{}", nameId(), _kalmanFilter.P);
 
     // 3. Propagate the state vector estimate from x(+) and x(-)
@@ -1638,8 +1759,8 @@ void NAV::TightlyCoupledKF::tightlyCoupledPrediction(const std::shared_ptr<const
         auto guard1 = requestOutputValueLock(OUTPUT_PORT_INDEX_x);
         auto guard2 = requestOutputValueLock(OUTPUT_PORT_INDEX_P);
         _kalmanFilter.predict();
-        notifyOutputValueChanged(OUTPUT_PORT_INDEX_x, predictTime, guard1);
-        notifyOutputValueChanged(OUTPUT_PORT_INDEX_P, predictTime, guard2);
+        notifyOutputValueChanged(OUTPUT_PORT_INDEX_x, _lastImuObs->insTime, guard1);
+        notifyOutputValueChanged(OUTPUT_PORT_INDEX_P, _lastImuObs->insTime, guard2);
     }
     else
     {
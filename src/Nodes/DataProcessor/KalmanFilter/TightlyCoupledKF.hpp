@@ -66,6 +66,14 @@ class TightlyCoupledKF : public Node
     /// @param j Json object with the node state
     void restore(const json& j) override;
 
+    /// @brief Saves the filter state and the inertial integrator for a checkpoint
+    [[nodiscard]] std::optional<json> saveCheckpoint() override;
+
+    /// @brief Restores the filter state and the inertial integrator from a checkpoint
+    /// @param[in] j Json object with the state returned by saveCheckpoint()
+    /// @return True if the state could be restored
+    bool restoreCheckpoint(const json& j) override;
+
   private:
     constexpr static size_t INPUT_PORT_INDEX_IMU = 0;              ///< @brief Flow (ImuObs)
     constexpr static size_t INPUT_PORT_INDEX_GNSS_OBS = 1;         ///< @brief Flow (GnssObs)
@@ -106,12 +114,15 @@ class TightlyCoupledKF : public Node
     /// @param[in] pinIdx Index of the pin the data is received on
     void recvPosVelAttInit(InputPin::NodeDataQueue& queue, size_t pinIdx);
 
-    /// @brief Predicts the state from the InertialNavSol
+    /// @brief Calculates the transition and noise matrices for the InertialNavSol and accumulates them until the next covariance propagation
     /// @param[in] inertialNavSol Inertial navigation solution triggering the prediction
     /// @param[in] tau_i Time since the last prediction in [s]
     /// @param[in] imuPos IMU platform frame position with respect to body frame
     void tightlyCoupledPrediction(const std::shared_ptr<const PosVelAtt>& inertialNavSol, double tau_i, const ImuPos& imuPos);
 
+    /// @brief Predicts the state and covariance with the matrices accumulated over all IMU samples since the last propagation
+    void propagateAccumulatedPrediction();
+
     /// @brief Updates the predicted state from the InertialNavSol with the GNSS observation
     /// @param[in] gnssObservation Gnss observation triggering the update
     void tightlyCoupledUpdate(const std::shared_ptr<const GnssObs>& gnssObservation);
@@ -140,6 +151,19 @@ class TightlyCoupledKF : public Node
     /// Last received IMU observation (to get ImuPos)
     std::shared_ptr<const ImuObs> _lastImuObs = nullptr;
 
+    /// Time-weighted mean of the system matrices 𝐅ₖ of all IMU samples since the last covariance propagation
+    Eigen::Matrix<double, 17, 17> _accumulatedF;
+    /// Sum of the system noise covariance matrices 𝐐ₖ of all IMU samples since the last covariance propagation (Taylor 1st order only)
+    Eigen::Matrix<double, 17, 17> _accumulatedQ;
+    /// Time since the last covariance propagation in [s]
+    double _accumulatedDt = 0.0;
+    /// Noise input matrix 𝐆 of the latest IMU sample (Van Loan only)
+    Eigen::Matrix<double, 17, 14> _predictionG;
+    /// Noise scale matrix 𝐖 of the latest IMU sample (Van Loan only)
+    Eigen::Matrix<double, 14, 14> _predictionW;
+    /// Amount of IMU samples since the last covariance propagation
+    int _pendingPredictionSamples = 0;
+
     /// Roll, Pitch and Yaw angles in [deg] used for initialization if not taken from separate pin
     std::array<double, 3> _initalRollPitchYaw{};
     /// Whether to initialize the state over an external pin
@@ -187,6 +211,9 @@ class TightlyCoupledKF : public Node
     /// @brief Check the rank of the Kalman matrices every iteration (computational expensive)
     bool _checkKalmanMatricesRanks = true;
 
+    /// @brief Amount of IMU samples over which the prediction is accumulated before propagating the covariance
+    int _covariancePropagationInterval = 1;
+
     // ###########################################################################################################
     //                                                Parameters
     // ###########################################################################################################
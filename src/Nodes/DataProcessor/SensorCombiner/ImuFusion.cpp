@@ -15,6 +15,7 @@
 #include "Navigation/Transformations/CoordinateFrames.hpp"
 #include "Navigation/Transformations/Units.hpp"
 
+#include "Navigation/INS/SensorCombiner/BlockKalmanFilter.hpp"
 #include "Navigation/INS/SensorCombiner/IRWKF/IRWKF.hpp"
 #include "Navigation/INS/SensorCombiner/BsplineKF/BsplineKF.hpp"
 #include "Navigation/INS/SensorCombiner/BsplineKF/QuadraticBsplines.hpp"
@@ -1473,11 +1474,11 @@ void NAV::ImuFusion::recvSignal(NAV::InputPin::NodeDataQueue& queue, size_t pinI
     }
     if (_kfInitialized)
     {
-        combineSignals(imuObs);
+        combineSignals(imuObs, pinIdx);
     }
 }
 
-void NAV::ImuFusion::combineSignals(const std::shared_ptr<const ImuObs>& imuObs)
+void NAV::ImuFusion::combineSignals(const std::shared_ptr<const ImuObs>& imuObs, size_t pinIdx)
 {
     LOG_DATA("{}: called", nameId());
 
@@ -1485,7 +1486,7 @@ void NAV::ImuFusion::combineSignals(const std::shared_ptr<const ImuObs>& imuObs)
 
     LOG_DATA("{}: Estimated state before prediction: x =\n{}", nameId(), _kalmanFilter.x);
 
-    _kalmanFilter.predict();
+    BlockKalmanFilter::predict(_kalmanFilter, _numStatesEst);
 
     LOG_DATA("{}: kalmanFilter.P (B-spline coeffs) =\n{}", nameId(), _kalmanFilter.P.block<18, 18>(0, 0));
 
@@ -1498,7 +1499,9 @@ void NAV::ImuFusion::combineSignals(const std::shared_ptr<const ImuObs>& imuObs)
     LOG_DATA("{}: coeff states x =\n{}", nameId(), _kalmanFilter.x.block<18, 1>(0, 0));
     LOG_DATA("{}: Innovation: z - H * x =\n{}", nameId(), _kalmanFilter.z - _kalmanFilter.H * _kalmanFilter.x);
 
-    _kalmanFilter.correct();
+    std::optional<Eigen::Index> biasStateIdx;
+    if (pinIdx > 0) { biasStateIdx = _numStatesEst + _numStatesPerPin * static_cast<Eigen::Index>(pinIdx - 1); }
+    BlockKalmanFilter::correct(_kalmanFilter, _numStatesEst, _numStatesPerPin, biasStateIdx);
     LOG_DATA("{}: Estimated state after correction: x =\n{}", nameId(), _kalmanFilter.x);
 
     if (_checkKalmanMatricesRanks)
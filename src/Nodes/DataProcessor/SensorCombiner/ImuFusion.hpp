@@ -113,7 +113,8 @@ class ImuFusion : public Imu
 
     /// @brief Combines the signals
     /// @param[in] imuObs Imu observation
-    void combineSignals(const std::shared_ptr<const ImuObs>& imuObs);
+    /// @param[in] pinIdx Index of the pin the observation was received on
+    void combineSignals(const std::shared_ptr<const ImuObs>& imuObs, size_t pinIdx);
 
     // --------------------------------------- Kalman filter config ------------------------------------------
     /// Number of input pins
@@ -8,12 +8,16 @@
 
 #include "CsvFile.hpp"
 
+#include <cmath>
+#include <limits>
+
 #include "util/Logger.hpp"
 #include "util/StringUtil.hpp"
 
 #include "internal/NodeManager.hpp"
 namespace nm = NAV::NodeManager;
 #include "internal/FlowManager.hpp"
+#include "internal/gui/widgets/HelpMarker.hpp"
 #include "internal/gui/widgets/imgui_ex.hpp"
 
 NAV::CsvFile::CsvFile()
@@ -24,7 +28,7 @@ NAV::CsvFile::CsvFile()
     _hasConfig = true;
     _guiConfigDefaultWindowSize = { 530, 271 };
 
-    nm::CreateOutputPin(this, CsvData::type().c_str(), Pin::Type::Object, { CsvData::type() }, &_data);
+    updateOutputPin();
 }
 
 NAV::CsvFile::~CsvFile()
@@ -112,9 +116,33 @@ void NAV::CsvFile::guiConfig()
         doInitialize();
     }
 
+    if (ImGui::Checkbox(fmt::format("Stream in chunks##{}", size_t(id)).c_str(), &_streaming))
+    {
+        LOG_DEBUG("{}: Streaming changed to {}", nameId(), _streaming);
+        updateOutputPin();
+        flow::ApplyChanges();
+        doDeinitialize();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Instead of reading the whole file into memory and providing it as object,\n"
+                             "the file is read in chunks of lines which are sent over a flow pin.\n"
+                             "Use this for large files, when the connected nodes process the data sequentially.\n\n"
+                             "Each chunk is time tagged with the 'GpsCycle', 'GpsWeek' and 'GpsToW [s]' columns of its first line with a valid time.\n"
+                             "Chunks without any valid time are skipped with a warning.\n"
+                             "If the file does not have these columns, the index of the first line is used\n"
+                             "as time in [s] since the GPS epoch, so that the chunks keep their order in the flow.");
+    if (_streaming)
+    {
+        if (ImGui::InputIntL(fmt::format("Lines per chunk##{}", size_t(id)).c_str(), &_chunkSize, 1, std::numeric_limits<int>::max()))
+        {
+            LOG_DEBUG("{}: Chunk size changed to {}", nameId(), _chunkSize);
+            flow::ApplyChanges();
+        }
+    }
+
     ImGui::Separator();
 
-    ImGui::Text("Amount of data lines in file: %zu", _data.lines.size());
+    if (!_streaming) { ImGui::Text("Amount of data lines in file: %zu", _data.rows()); }
 
     // Header info
     if (ImGui::BeginTable(fmt::format("##CSVHeaders ({})", size_t(id)).c_str(), 2,
@@ -148,6 +176,8 @@ void NAV::CsvFile::guiConfig()
     j["comment"] = _comment;
     j["skipLines"] = _skipLines;
     j["hasHeaderLine"] = _hasHeaderLine;
+    j["streaming"] = _streaming;
+    j["chunkSize"] = _chunkSize;
 
     return j;
 }
@@ -176,19 +206,43 @@ void NAV::CsvFile::restore(json const& j)
     {
         j.at("hasHeaderLine").get_to(_hasHeaderLine);
     }
+    if (j.contains("streaming"))
+    {
+        j.at("streaming").get_to(_streaming);
+        updateOutputPin();
+    }
+    if (j.contains("chunkSize"))
+    {
+        j.at("chunkSize").get_to(_chunkSize);
+    }
 }
 
 bool NAV::CsvFile::initialize()
 {
     LOG_TRACE("{}: called", nameId());
 
-    _data.description.clear();
-    _data.lines.clear();
+    _data.clear();
+    _streamedLines = 0;
 
     if (!FileReader::initialize())
     {
         return false;
     }
+    if (_streaming) // The lines are read in pollData()
+    {
+        _timeColumns.reset();
+        auto gpsCycle = _data.columnIndex("GpsCycle");
+        auto gpsWeek = _data.columnIndex("GpsWeek");
+        auto gpsTow = _data.columnIndex("GpsToW [s]");
+        if (gpsCycle && gpsWeek && gpsTow) { _timeColumns = { *gpsCycle, *gpsWeek, *gpsTow }; }
+        else
+        {
+            LOG_WARN("{}: The file has no 'GpsCycle', 'GpsWeek' and 'GpsToW [s]' columns. "
+                     "The chunks are time tagged with the line index in [s] since the GPS epoch instead.",
+                     nameId());
+        }
+        return true;
+    }
 
     std::string line;
     while (!eof())
@@ -197,24 +251,10 @@ bool NAV::CsvFile::initialize()
         if (line.empty() || line.at(0) == _comment) { continue; } // Skip empty and comment lines
 
         auto splittedData = str::split(line, _delimiter);
-        if (!splittedData.empty()) { _data.lines.emplace_back(); }
-
-        for (const auto& cell : splittedData)
-        {
-            CsvData::CsvElement value;
-            try
-            {
-                value = std::stod(cell);
-            }
-            catch (...)
-            {
-                value = cell;
-            }
-            _data.lines.back().push_back(value);
-        }
+        if (!splittedData.empty()) { _data.addLine(splittedData); }
     }
 
-    LOG_TRACE("{}: initialize() finished. Read {} columns over {} lines.", nameId(), _data.description.size(), _data.lines.size());
+    LOG_TRACE("{}: initialize() finished. Read {} columns over {} lines.", nameId(), _data.description.size(), _data.rows());
 
     return true;
 }
@@ -222,6 +262,10 @@ bool NAV::CsvFile::initialize()
 bool NAV::CsvFile::resetNode()
 {
     LOG_TRACE("{}: called", nameId());
+
+    if (_streaming) { FileReader::resetReader(); }
+    _streamedLines = 0;
+
     return true;
 }
 
@@ -229,8 +273,7 @@ void NAV::CsvFile::deinitialize()
 {
     LOG_TRACE("{}: called", nameId());
 
-    _data.description.clear();
-    _data.lines.clear();
+    _data.clear();
 
     FileReader::deinitialize();
 }
@@ -254,4 +297,70 @@ void NAV::CsvFile::readHeader()
             desc.erase(std::find_if(desc.begin(), desc.end(), [](int ch) { return std::iscntrl(ch); }), desc.end());
         }
     }
-}
\ No newline at end of file
+}
+void NAV::CsvFile::updateOutputPin()
+{
+    auto pinType = _streaming ? Pin::Type::Flow : Pin::Type::Object;
+    if (!outputPins.empty() && outputPins.front().type == pinType) { return; }
+
+    if (!outputPins.empty()) { nm::DeleteOutputPin(outputPins.front()); }
+    if (_streaming)
+    {
+        nm::CreateOutputPin(this, CsvData::type().c_str(), Pin::Type::Flow, { CsvData::type() }, &CsvFile::pollData);
+    }
+    else
+    {
+        nm::CreateOutputPin(this, CsvData::type().c_str(), Pin::Type::Object, { CsvData::type() }, &_data);
+    }
+}
+
+std::shared_ptr<const NAV::NodeData> NAV::CsvFile::pollData()
+{
+    std::shared_ptr<CsvData> chunk;
+    while (true)
+    {
+        chunk = std::make_shared<CsvData>();
+        chunk->description = _data.description;
+
+        std::string line;
+        while (chunk->rows() < static_cast<size_t>(_chunkSize) && !eof())
+        {
+            getline(line);
+            if (line.empty() || line.at(0) == _comment) { continue; } // Skip empty and comment lines
+
+            auto splittedData = str::split(line, _delimiter);
+            if (!splittedData.empty()) { chunk->addLine(splittedData); }
+            if (chunk->rows() == 1) { chunk->reserve(static_cast<size_t>(_chunkSize)); }
+        }
+        if (chunk->rows() == 0) { return nullptr; }
+
+        size_t firstLine = _streamedLines;
+        _streamedLines += chunk->rows();
+
+        if (!_timeColumns)
+        {
+            chunk->insTime = InsTime(0, 0, static_cast<long double>(firstLine));
+            break;
+        }
+
+        // Time of the first line with a valid time
+        const auto& [gpsCycle, gpsWeek, gpsTow] = *_timeColumns;
+        for (size_t r = 0; r < chunk->rows(); r++)
+        {
+            if (!std::isnan(chunk->value(r, gpsCycle)) && !std::isnan(chunk->value(r, gpsWeek)) && !std::isnan(chunk->value(r, gpsTow)))
+            {
+                chunk->insTime = InsTime(static_cast<int32_t>(chunk->value(r, gpsCycle)),
+                                         static_cast<int32_t>(chunk->value(r, gpsWeek)),
+                                         chunk->value(r, gpsTow));
+                break;
+            }
+        }
+        if (!chunk->insTime.empty()) { break; }
+
+        LOG_WARN("{}: The lines {} to {} have no valid 'GpsCycle', 'GpsWeek' and 'GpsToW [s]'. Skipping the chunk.",
+                 nameId(), firstLine, _streamedLines - 1);
+    }
+
+    invokeCallbacks(OUTPUT_PORT_INDEX_CSV, chunk);
+    return chunk;
+}
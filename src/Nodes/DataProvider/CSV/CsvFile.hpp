@@ -13,6 +13,9 @@
 
 #pragma once
 
+#include <array>
+#include <optional>
+
 #include "internal/Node/Node.hpp"
 #include "Nodes/DataProvider/Protocol/FileReader.hpp"
 #include "NodeData/General/CsvData.hpp"
@@ -57,6 +60,8 @@ class CsvFile : public Node, FileReader
     void restore(const json& j) override;
 
   private:
+    constexpr static size_t OUTPUT_PORT_INDEX_CSV = 0; ///< @brief Object/Flow (CsvData)
+
     /// @brief Initialize the node
     bool initialize() override;
 
@@ -73,9 +78,29 @@ class CsvFile : public Node, FileReader
     /// @brief Read the Header of the file
     void readHeader() override;
 
+    /// @brief Creates the output pin as object (whole file) or flow (chunks) pin depending on the streaming setting
+    void updateOutputPin();
+
+    /// @brief Reads the next chunk of lines from the file
+    /// @return The chunk or nullptr if the end of the file is reached
+    [[nodiscard]] std::shared_ptr<const NodeData> pollData();
+
     /// Data container
     CsvData _data;
 
+    /// Whether the file is read in chunks which are sent over a flow pin instead of being read completely into memory
+    bool _streaming = false;
+
+    /// Amount of lines in a chunk
+    int _chunkSize = 1000;
+
+    /// Amount of data lines sent since the start. Used as time tag if the file has no GPS time columns.
+    size_t _streamedLines = 0;
+
+    /// Indices of the 'GpsCycle', 'GpsWeek' and 'GpsToW [s]' columns. Determined once per file from the header.
+    /// If the file has no such columns, the chunks are time tagged with the line index instead.
+    std::optional<std::array<size_t, 3>> _timeColumns;
+
     /// Delimiter character
     char _delimiter = ',';
 
@@ -140,6 +140,16 @@ bool RinexObsFile::resetNode()
     return true;
 }
 
+std::optional<json> RinexObsFile::saveCheckpoint()
+{
+    return FileReader::saveCheckpoint();
+}
+
+bool RinexObsFile::restoreCheckpoint(const json& j)
+{
+    return FileReader::restoreCheckpoint(j);
+}
+
 FileReader::FileType RinexObsFile::determineFileType()
 {
     auto extHeaderLabel = [](std::string line) {
@@ -524,6 +534,8 @@ void RinexObsFile::readHeader()
 
 std::shared_ptr<const NodeData> RinexObsFile::pollData()
 {
+    markObservationStart();
+
     std::string line;
 
     InsTime epochTime;
@@ -69,6 +69,14 @@ class RinexObsFile : public Node, public FileReader
     /// @brief Resets the node. Moves the read cursor to the start
     bool resetNode() override;
 
+    /// @brief Saves the read position of the file for a checkpoint
+    [[nodiscard]] std::optional<json> saveCheckpoint() override;
+
+    /// @brief Moves the read cursor to the position saved in a checkpoint
+    /// @param[in] j Json object with the state returned by saveCheckpoint()
+    /// @return True if the state could be restored
+    bool restoreCheckpoint(const json& j) override;
+
   private:
     constexpr static size_t OUTPUT_PORT_INDEX_GNSS_OBS = 0; ///< @brief Flow (GnssObs)
 
@@ -0,0 +1,318 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "UartReplay.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+
+#include "util/Logger.hpp"
+
+#include "internal/FlowExecutor.hpp"
+#include "internal/gui/widgets/HelpMarker.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "internal/FlowManager.hpp"
+
+#include "util/Vendor/Ublox/UbloxTypes.hpp"
+#include "util/Time/TimeBase.hpp"
+
+#include "NodeData/General/UartPacket.hpp"
+
+NAV::UartReplay::UartReplay()
+    : Node(typeStatic())
+{
+    LOG_TRACE("{}: called", name);
+
+    _onlyRealTime = true;
+    _hasConfig = true;
+    _guiConfigDefaultWindowSize = { 380, 130 };
+
+    nm::CreateOutputPin(this, "UartPacket", Pin::Type::Flow, { NAV::UartPacket::type() });
+}
+
+NAV::UartReplay::~UartReplay()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    stopReplay();
+}
+
+std::string NAV::UartReplay::typeStatic()
+{
+    return "UartReplay";
+}
+
+std::string NAV::UartReplay::type() const
+{
+    return typeStatic();
+}
+
+std::string NAV::UartReplay::category()
+{
+    return "Data Provider";
+}
+
+void NAV::UartReplay::guiConfig()
+{
+    if (auto res = FileReader::guiConfig(".ubx,.*", { ".ubx" }, size_t(id), nameId()))
+    {
+        LOG_DEBUG("{}: Path changed to {}", nameId(), _path);
+        flow::ApplyChanges();
+        if (res == FileReader::PATH_CHANGED)
+        {
+            doReinitialize();
+        }
+        else
+        {
+            doDeinitialize();
+        }
+    }
+
+    ImGui::SetNextItemWidth(100.0F);
+    if (ImGui::InputDoubleL(fmt::format("Speed factor##{}", size_t(id)).c_str(), &_speedFactor, 0.0, 1000.0, 1.0, 10.0, "%.1f x"))
+    {
+        LOG_DEBUG("{}: Speed factor changed to {}", nameId(), _speedFactor);
+        flow::ApplyChanges();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Replay speed relative to the time in the packets.\n"
+                             "0 replays the packets as fast as possible.\n\n"
+                             "The time passed to the nodes is taken from a virtual clock, which follows the packet time.\n"
+                             "The results are therefore independent of the replay speed.");
+
+    if (ImGui::Checkbox(fmt::format("Stop flow at end of file##{}", size_t(id)).c_str(), &_stopAtEnd))
+    {
+        LOG_DEBUG("{}: Stop at end changed to {}", nameId(), _stopAtEnd);
+        flow::ApplyChanges();
+    }
+}
+
+[[nodiscard]] json NAV::UartReplay::save() const
+{
+    LOG_TRACE("{}: called", nameId());
+
+    json j;
+
+    j["FileReader"] = FileReader::save();
+    j["speedFactor"] = _speedFactor;
+    j["stopAtEnd"] = _stopAtEnd;
+
+    return j;
+}
+
+void NAV::UartReplay::restore(json const& j)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (j.contains("FileReader"))
+    {
+        FileReader::restore(j.at("FileReader"));
+    }
+    if (j.contains("speedFactor"))
+    {
+        j.at("speedFactor").get_to(_speedFactor);
+    }
+    if (j.contains("stopAtEnd"))
+    {
+        j.at("stopAtEnd").get_to(_stopAtEnd);
+    }
+}
+
+bool NAV::UartReplay::initialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    stopReplay();
+
+    return FileReader::initialize();
+}
+
+void NAV::UartReplay::deinitialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    stopReplay();
+
+    FileReader::deinitialize();
+}
+
+bool NAV::UartReplay::resetNode()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    stopReplay();
+    FileReader::resetReader();
+
+    _sensor = std::make_unique<vendor::ublox::UbloxUartSensor>(nameId());
+    _stopRequested = false;
+    _replayThread = std::thread(&UartReplay::replay, this);
+
+    return true;
+}
+
+void NAV::UartReplay::stopReplay()
+{
+    _stopRequested = true;
+    if (_replayThread.joinable())
+    {
+        _replayThread.join();
+    }
+
+    if (util::time::GetClock() == util::time::Clock::Virtual)
+    {
+        util::time::SetClock(util::time::Clock::Computer);
+        util::time::SetCurrentTimeToComputerTime();
+    }
+}
+
+NAV::FileReader::FileType NAV::UartReplay::determineFileType()
+{
+    LOG_TRACE("called for {}", nameId());
+
+    auto filestream = std::ifstream(getFilepath());
+
+    constexpr uint16_t BUFFER_SIZE = 10;
+
+    std::array<char, BUFFER_SIZE> buffer{};
+    if (filestream.good())
+    {
+        filestream.read(buffer.data(), BUFFER_SIZE);
+
+        if ((static_cast<uint8_t>(buffer.at(0)) == vendor::ublox::UbloxUartSensor::BINARY_SYNC_CHAR_1
+             && static_cast<uint8_t>(buffer.at(1)) == vendor::ublox::UbloxUartSensor::BINARY_SYNC_CHAR_2)
+            || buffer.at(0) == vendor::ublox::UbloxUartSensor::ASCII_START_CHAR)
+        {
+            filestream.close();
+            LOG_DEBUG("{} has the file type: Binary", nameId());
+            return FileType::BINARY;
+        }
+        filestream.close();
+
+        LOG_ERROR("{} could not determine file type", nameId());
+        return FileType::NONE;
+    }
+
+    LOG_ERROR("{} could not open file {}", nameId(), getFilepath());
+    return FileType::NONE;
+}
+
+NAV::InsTime NAV::UartReplay::packetTime(const uart::protocol::Packet& packet)
+{
+    // Only the time fields are read here, the full message is decoded by the consumers of the packet.
+    // Layout: Sync1, Sync2, Class, Id, Length (2 bytes), Payload, Checksum (2 bytes)
+    constexpr size_t PAYLOAD_START = 6;
+    constexpr size_t RAWX_TIME_SIZE = sizeof(double) + sizeof(uint16_t); // rcvTow [s], week
+
+    if (packet.type() != uart::protocol::Packet::Type::TYPE_BINARY
+        || packet.getRawDataLength() < PAYLOAD_START + RAWX_TIME_SIZE)
+    {
+        return {};
+    }
+
+    const auto& raw = packet.getRawData();
+    // Only UBX-RXM-RAWX carries a complete GPS time (the NAV messages only have the time of week)
+    if (raw.at(2) != static_cast<uint8_t>(vendor::ublox::UbxClass::UBX_CLASS_RXM)
+        || raw.at(3) != static_cast<uint8_t>(vendor::ublox::UbxRxmMessages::UBX_RXM_RAWX))
+    {
+        return {};
+    }
+
+    double rcvTow = 0.0; // UBX is little endian like the supported hosts
+    uint16_t week = 0;
+    std::memcpy(&rcvTow, raw.data() + PAYLOAD_START, sizeof(rcvTow));
+    std::memcpy(&week, raw.data() + PAYLOAD_START + sizeof(rcvTow), sizeof(week));
+    if (week == 0) { return {}; } // The receiver does not know the week yet
+
+    return { 0, week, static_cast<long double>(rcvTow) };
+}
+
+void NAV::UartReplay::replay()
+{
+    using namespace std::chrono_literals;
+
+    // Wait till the callbacks are enabled by the FlowExecutor, so that no packets are lost
+    while (!callbacksEnabled && !_stopRequested)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+    if (_stopRequested) { return; }
+
+    // The current time is only set by the packets, so that the execution does not depend on the computer clock
+    util::time::SetClock(util::time::Clock::Virtual);
+    util::time::SetVirtualClock(0ns);
+    util::time::ClearCurrentTime();
+
+    // Copy, as the GUI can change the member while replaying
+    const double speedFactor = _speedFactor;
+    LOG_DEBUG("{}: Replay started with speed factor {}", nameId(), speedFactor);
+
+    auto realStart = std::chrono::steady_clock::now();
+    InsTime firstTime;
+    InsTime lastTime;
+    size_t nPackets = 0;
+
+    std::array<char, 4096> buffer{};
+    while (!_stopRequested && good())
+    {
+        auto count = read(buffer.data(), static_cast<std::streamsize>(buffer.size())).gcount();
+        for (std::streamsize i = 0; i < count && !_stopRequested; i++)
+        {
+            auto packet = _sensor->findPacket(static_cast<uint8_t>(buffer.at(static_cast<size_t>(i))));
+            if (packet == nullptr || packet->getRawDataLength() == 0) { continue; }
+
+            if (auto time = packetTime(*packet);
+                !time.empty() && (lastTime.empty() || time >= lastTime))
+            {
+                if (firstTime.empty()) { firstTime = time; }
+                lastTime = time;
+            }
+
+            if (!firstTime.empty())
+            {
+                auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(lastTime - firstTime);
+                util::time::SetVirtualClock(elapsed);
+
+                if (speedFactor > 0.0)
+                {
+                    auto target = realStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>(elapsed / speedFactor);
+                    for (auto now = std::chrono::steady_clock::now(); now < target && !_stopRequested; now = std::chrono::steady_clock::now())
+                    {
+                        std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(target - now, 100ms));
+                    }
+                }
+            }
+
+            invokeCallbacks(OUTPUT_PORT_INDEX_UART_PACKET, std::make_shared<UartPacket>(*packet));
+            nPackets++;
+        }
+    }
+
+    if (_stopRequested) { return; }
+
+    [[maybe_unused]] std::chrono::duration<double> realDuration = std::chrono::steady_clock::now() - realStart;
+    LOG_INFO("{}: Replayed {} packets ({:.1f} s of data) in {:.1f} s", nameId(), nPackets,
+             lastTime.empty() ? 0.0 : static_cast<double>((lastTime - firstTime).count()), realDuration.count());
+
+    if (_stopAtEnd)
+    {
+        // Stopping the flow clears the queues, so let the connected nodes process the last packets first
+        while (!_stopRequested && std::any_of(nm::m_Nodes().begin(), nm::m_Nodes().end(), [](const Node* node) {
+                   return node && node->isInitialized()
+                          && std::any_of(node->inputPins.begin(), node->inputPins.end(), [](const InputPin& inputPin) { return !inputPin.queue.empty(); });
+               }))
+        {
+            std::this_thread::sleep_for(1ms);
+        }
+        FlowExecutor::requestStop();
+    }
+}
@@ -0,0 +1,109 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file UartReplay.hpp
+/// @brief Replays recorded u-blox UART logs like a real-time sensor
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-09
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "internal/Node/Node.hpp"
+#include "Nodes/DataProvider/Protocol/FileReader.hpp"
+#include "util/Vendor/Ublox/UbloxUartSensor.hpp"
+
+namespace NAV
+{
+/// @brief Replays recorded u-blox UART logs (e.g. written by the UartDataLogger) like a real-time sensor
+///
+/// The packets are searched with the same packet finder as the UbloxSensor and sent as UartPacket from a separate thread.
+/// The flow therefore runs in real-time mode. Instead of the computer clock, a virtual clock is advanced to the time of
+/// the packets, which makes the execution deterministic and independent of the replay speed.
+class UartReplay : public Node, public FileReader
+{
+  public:
+    /// @brief Default constructor
+    UartReplay();
+    /// @brief Destructor
+    ~UartReplay() override;
+    /// @brief Copy constructor
+    UartReplay(const UartReplay&) = delete;
+    /// @brief Move constructor
+    UartReplay(UartReplay&&) = delete;
+    /// @brief Copy assignment operator
+    UartReplay& operator=(const UartReplay&) = delete;
+    /// @brief Move assignment operator
+    UartReplay& operator=(UartReplay&&) = delete;
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] static std::string typeStatic();
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] std::string type() const override;
+
+    /// @brief String representation of the Class Category
+    [[nodiscard]] static std::string category();
+
+    /// @brief ImGui config window which is shown on double click
+    /// @attention Don't forget to set _hasConfig to true in the constructor of the node
+    void guiConfig() override;
+
+    /// @brief Saves the node into a json object
+    [[nodiscard]] json save() const override;
+
+    /// @brief Restores the node from a json object
+    /// @param[in] j Json object with the node state
+    void restore(const json& j) override;
+
+    /// @brief Resets the node. Moves the read cursor to the start and starts the replay thread.
+    bool resetNode() override;
+
+  private:
+    constexpr static size_t OUTPUT_PORT_INDEX_UART_PACKET = 0; ///< @brief Flow (UartPacket)
+
+    /// @brief Initialize the node
+    bool initialize() override;
+
+    /// @brief Deinitialize the node
+    void deinitialize() override;
+
+    /// @brief Determines the type of the file
+    /// @return The File Type
+    [[nodiscard]] FileType determineFileType() override;
+
+    /// @brief Stops the replay thread and waits for it to finish
+    void stopReplay();
+
+    /// @brief Main function of the replay thread
+    void replay();
+
+    /// @brief Decodes the time of the packet
+    /// @param[in] packet Packet to decode
+    /// @return The time of the packet or an empty time if the packet has no time information
+    InsTime packetTime(const uart::protocol::Packet& packet);
+
+    /// Replay speed relative to the time in the packets (0 = as fast as possible)
+    double _speedFactor = 1.0;
+
+    /// Stop the flow execution when the end of the file is reached
+    bool _stopAtEnd = true;
+
+    /// Packet finder (recreated for every replay to reset the tracking)
+    std::unique_ptr<vendor::ublox::UbloxUartSensor> _sensor;
+
+    /// Thread which reads the file and sends the packets
+    std::thread _replayThread;
+    /// Flag to stop the replay thread
+    std::atomic<bool> _stopRequested = false;
+};
+
+} // namespace NAV
@@ -111,8 +111,26 @@ bool NAV::UbloxFile::resetNode()
     return true;
 }
 
+std::optional<json> NAV::UbloxFile::saveCheckpoint()
+{
+    json j = FileReader::saveCheckpoint();
+    j["lastObsTime"] = _lastObsTime;
+    return j;
+}
+
+bool NAV::UbloxFile::restoreCheckpoint(const json& j)
+{
+    if (j.contains("lastObsTime"))
+    {
+        j.at("lastObsTime").get_to(_lastObsTime);
+    }
+    return FileReader::restoreCheckpoint(j);
+}
+
 std::shared_ptr<const NAV::NodeData> NAV::UbloxFile::pollData()
 {
+    markObservationStart();
+
     uint8_t i = 0;
     std::unique_ptr<uart::protocol::Packet> packet = nullptr;
     std::shared_ptr<UbloxObs> obs;
@@ -0,0 +1,217 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ColumnarFile.hpp"
+
+#include <cmath>
+
+#include "util/Logger.hpp"
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+#include "internal/FlowManager.hpp"
+
+#include "NodeData/General/DynamicData.hpp"
+
+NAV::ColumnarFile::ColumnarFile()
+    : Node(typeStatic())
+{
+    LOG_TRACE("{}: called", name);
+
+    _hasConfig = true;
+    _guiConfigDefaultWindowSize = { 530, 271 };
+
+    nm::CreateOutputPin(this, "DynamicData", Pin::Type::Flow, { DynamicData::type() }, &ColumnarFile::pollData);
+}
+
+NAV::ColumnarFile::~ColumnarFile()
+{
+    LOG_TRACE("{}: called", nameId());
+}
+
+std::string NAV::ColumnarFile::typeStatic()
+{
+    return "ColumnarFile";
+}
+
+std::string NAV::ColumnarFile::type() const
+{
+    return typeStatic();
+}
+
+std::string NAV::ColumnarFile::category()
+{
+    return "Data Provider";
+}
+
+void NAV::ColumnarFile::guiConfig()
+{
+    if (auto res = FileReader::guiConfig(".icol,.*", { ".icol" }, size_t(id), nameId()))
+    {
+        LOG_DEBUG("{}: Path changed to {}", nameId(), _path);
+        flow::ApplyChanges();
+        if (res == FileReader::PATH_CHANGED)
+        {
+            doReinitialize();
+        }
+        else
+        {
+            doDeinitialize();
+        }
+    }
+
+    if (!isInitialized()) { return; }
+
+    ImGui::Separator();
+
+    ImGui::Text("Data type: %s", _index.schema.dataType.c_str());
+    ImGui::Text("Rows: %zu in %zu chunks%s", _index.rowCount, _index.chunks.size(), _index.truncated ? " (file is truncated)" : "");
+    if (!_index.chunks.empty())
+    {
+        auto firstTime = ColumnarFormat::FromGpsNanoseconds(_index.chunks.front().firstTime);
+        auto lastTime = ColumnarFormat::FromGpsNanoseconds(_index.chunks.back().lastTime);
+        if (!firstTime.empty() && !lastTime.empty())
+        {
+            ImGui::Text("Time span: %s - %s", fmt::format("{}", firstTime.toYMDHMS(GPST)).c_str(), fmt::format("{}", lastTime.toYMDHMS(GPST)).c_str());
+        }
+    }
+
+    if (ImGui::BeginTable(fmt::format("##Columns ({})", size_t(id)).c_str(), 2,
+                          ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+    {
+        ImGui::TableSetupColumn("", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableSetupColumn("Description", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableHeadersRow();
+
+        for (size_t i = 0; i < _index.schema.columns.size(); i++)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", i);
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(_index.schema.columns[i].c_str());
+        }
+
+        ImGui::EndTable();
+    }
+}
+
+[[nodiscard]] json NAV::ColumnarFile::save() const
+{
+    LOG_TRACE("{}: called", nameId());
+
+    json j;
+
+    j["FileReader"] = FileReader::save();
+
+    return j;
+}
+
+void NAV::ColumnarFile::restore(json const& j)
+{
+    LOG_TRACE("{}: called", nameId());
+
+    if (j.contains("FileReader"))
+    {
+        FileReader::restore(j.at("FileReader"));
+    }
+}
+
+bool NAV::ColumnarFile::initialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    deinitialize();
+
+    auto filepath = getFilepath();
+    try
+    {
+        _fileMapping = boost::interprocess::file_mapping(filepath.string().c_str(), boost::interprocess::read_only);
+        _mappedRegion = boost::interprocess::mapped_region(_fileMapping, boost::interprocess::read_only);
+    }
+    catch (const boost::interprocess::interprocess_exception& e)
+    {
+        LOG_ERROR("{}: Could not map the file {}: {}", nameId(), filepath, e.what());
+        return false;
+    }
+    _data = std::string_view(static_cast<const char*>(_mappedRegion.get_address()), _mappedRegion.get_size());
+
+    auto index = ColumnarFormat::ReadIndex(_data);
+    if (!index)
+    {
+        LOG_ERROR("{}: The file {} is not a valid columnar log", nameId(), filepath);
+        deinitialize();
+        return false;
+    }
+    _index = std::move(*index);
+    if (_index.truncated)
+    {
+        LOG_WARN("{}: The file ends with an incomplete chunk, which is ignored", nameId());
+    }
+
+    LOG_DEBUG("{}: Found {} columns and {} rows in {} chunks", nameId(), _index.schema.columns.size(), _index.rowCount, _index.chunks.size());
+
+    return resetNode();
+}
+
+void NAV::ColumnarFile::deinitialize()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    _times.clear();
+    _columns.clear();
+    _index = ColumnarFormat::FileIndex();
+    _data = {};
+    _mappedRegion = boost::interprocess::mapped_region();
+    _fileMapping = boost::interprocess::file_mapping();
+}
+
+bool NAV::ColumnarFile::resetNode()
+{
+    LOG_TRACE("{}: called", nameId());
+
+    _nextChunk = 0;
+    _nextRow = 0;
+    _times.clear();
+
+    return true;
+}
+
+std::shared_ptr<const NAV::NodeData> NAV::ColumnarFile::pollData(size_t /* pinIdx */, bool peek)
+{
+    while (_nextRow >= _times.size())
+    {
+        if (_nextChunk >= _index.chunks.size()) { return nullptr; }
+
+        if (!ColumnarFormat::ReadDataChunk(_data, _index.chunks.at(_nextChunk), _times, _columns, _index.schema.columns.size()))
+        {
+            LOG_ERROR("{}: Could not decode chunk {}", nameId(), _nextChunk);
+            _nextChunk = _index.chunks.size();
+            _times.clear();
+            return nullptr;
+        }
+        _nextChunk++;
+        _nextRow = 0;
+    }
+
+    auto obs = std::make_shared<DynamicData>();
+    obs->insTime = ColumnarFormat::FromGpsNanoseconds(_times[_nextRow]);
+    for (size_t c = 0; c < _columns.size(); c++)
+    {
+        auto value = _columns[c][_nextRow];
+        if (std::isnan(value)) { continue; }
+        obs->data.push_back(DynamicData::Data{ .description = _index.schema.columns[c], .value = value, .rawData = {} });
+    }
+
+    if (!peek)
+    {
+        _nextRow++;
+        invokeCallbacks(OUTPUT_PORT_INDEX_DYNAMIC_DATA, obs);
+    }
+    return obs;
+}
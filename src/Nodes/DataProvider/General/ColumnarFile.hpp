@@ -0,0 +1,111 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file ColumnarFile.hpp
+/// @brief File reader for the binary columnar log format
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-14
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "internal/Node/Node.hpp"
+#include "Nodes/DataProvider/Protocol/FileReader.hpp"
+#include "util/Logger/ColumnarFormat.hpp"
+
+namespace NAV
+{
+class NodeData;
+
+/// @brief Reads files written by the ColumnarLogger
+///
+/// The file is mapped into memory and only the chunk headers are scanned on initialization.
+/// The chunks are decoded one at a time while the rows are polled. Every row is provided as DynamicData,
+/// which holds the present values with the column descriptors of the file.
+class ColumnarFile : public Node, public FileReader
+{
+  public:
+    /// @brief Default constructor
+    ColumnarFile();
+    /// @brief Destructor
+    ~ColumnarFile() override;
+    /// @brief Copy constructor
+    ColumnarFile(const ColumnarFile&) = delete;
+    /// @brief Move constructor
+    ColumnarFile(ColumnarFile&&) = delete;
+    /// @brief Copy assignment operator
+    ColumnarFile& operator=(const ColumnarFile&) = delete;
+    /// @brief Move assignment operator
+    ColumnarFile& operator=(ColumnarFile&&) = delete;
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] static std::string typeStatic();
+
+    /// @brief String representation of the Class Type
+    [[nodiscard]] std::string type() const override;
+
+    /// @brief String representation of the Class Category
+    [[nodiscard]] static std::string category();
+
+    /// @brief ImGui config window which is shown on double click
+    /// @attention Don't forget to set _hasConfig to true in the constructor of the node
+    void guiConfig() override;
+
+    /// @brief Saves the node into a json object
+    [[nodiscard]] json save() const override;
+
+    /// @brief Restores the node from a json object
+    /// @param[in] j Json object with the node state
+    void restore(const json& j) override;
+
+  private:
+    constexpr static size_t OUTPUT_PORT_INDEX_DYNAMIC_DATA = 0; ///< @brief Flow (DynamicData)
+
+    /// @brief Initialize the node
+    bool initialize() override;
+
+    /// @brief Deinitialize the node
+    void deinitialize() override;
+
+    /// @brief Resets the node. It is guaranteed that the node is initialized when this is called.
+    bool resetNode() override;
+
+    /// @brief Polls data from the file
+    /// @param[in] pinIdx Index of the pin the data is requested on
+    /// @param[in] peek Specifies if the data should be peeked (without moving the read cursor) or read
+    /// @return The read observation
+    [[nodiscard]] std::shared_ptr<const NodeData> pollData(size_t pinIdx, bool peek);
+
+    /// Mapping of the file
+    boost::interprocess::file_mapping _fileMapping;
+    /// Mapped region of the whole file
+    boost::interprocess::mapped_region _mappedRegion;
+    /// Content of the file
+    std::string_view _data;
+
+    /// Index of the file
+    ColumnarFormat::FileIndex _index;
+
+    /// Index of the next chunk to decode
+    size_t _nextChunk = 0;
+    /// Index of the next row in the decoded chunk
+    size_t _nextRow = 0;
+    /// Time of the rows in the decoded chunk
+    std::vector<int64_t> _times;
+    /// Values of the rows in the decoded chunk for every column
+    std::vector<std::vector<double>> _columns;
+};
+
+} // namespace NAV
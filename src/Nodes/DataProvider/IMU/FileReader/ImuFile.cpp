@@ -195,8 +195,20 @@ bool NAV::ImuFile::resetNode()
     return true;
 }
 
+std::optional<json> NAV::ImuFile::saveCheckpoint()
+{
+    return FileReader::saveCheckpoint();
+}
+
+bool NAV::ImuFile::restoreCheckpoint(const json& j)
+{
+    return FileReader::restoreCheckpoint(j);
+}
+
 std::shared_ptr<const NAV::NodeData> NAV::ImuFile::pollData()
 {
+    markObservationStart();
+
     std::shared_ptr<ImuObs> obs;
     if (_withDelta) { obs = std::make_shared<ImuObsWDelta>(_imuPos); }
     else { obs = std::make_shared<ImuObs>(_imuPos); }
@@ -462,7 +462,7 @@ std::shared_ptr<const NAV::NodeData> NAV::VectorNavFile::pollData()
             {
                 if (!obs->timeOutputs)
                 {
-                    obs->timeOutputs = std::make_shared<NAV::vendor::vectornav::TimeOutputs>();
+                    obs->timeOutputs.emplace();
                     obs->timeOutputs->timeField |= _binaryOutputRegister.timeField;
                 }
 
@@ -521,7 +521,7 @@ std::shared_ptr<const NAV::NodeData> NAV::VectorNavFile::pollData()
             {
                 if (!obs->imuOutputs)
                 {
-                    obs->imuOutputs = std::make_shared<NAV::vendor::vectornav::ImuOutputs>();
+                    obs->imuOutputs.emplace();
                     obs->imuOutputs->imuField |= _binaryOutputRegister.imuField;
                 }
 
@@ -600,7 +600,7 @@ std::shared_ptr<const NAV::NodeData> NAV::VectorNavFile::pollData()
             {
                 if (!obs->gnss1Outputs)
                 {
-                    obs->gnss1Outputs = std::make_shared<NAV::vendor::vectornav::GnssOutputs>();
+                    obs->gnss1Outputs.emplace();
                     obs->gnss1Outputs->gnssField |= _binaryOutputRegister.gpsField;
                 }
 
@@ -766,7 +766,7 @@ std::shared_ptr<const NAV::NodeData> NAV::VectorNavFile::pollData()
             {
                 if (!obs->attitudeOutputs)
                 {
-                    obs->attitudeOutputs = std::make_shared<NAV::vendor::vectornav::AttitudeOutputs>();
+                    obs->attitudeOutputs.emplace();
                     obs->attitudeOutputs->attitudeField |= _binaryOutputRegister.attitudeField;
                 }
 
@@ -845,7 +845,7 @@ std::shared_ptr<const NAV::NodeData> NAV::VectorNavFile::pollData()
             {
                 if (!obs->insOutputs)
                 {
-                    obs->insOutputs = std::make_shared<NAV::vendor::vectornav::InsOutputs>();
+                    obs->insOutputs.emplace();
                     obs->insOutputs->insField |= _binaryOutputRegister.insField;
                 }
 
@@ -932,7 +932,7 @@ std::shared_ptr<const NAV::NodeData> NAV::VectorNavFile::pollData()
             {
                 if (!obs->gnss2Outputs)
                 {
-                    obs->gnss2Outputs = std::make_shared<NAV::vendor::vectornav::GnssOutputs>();
+                    obs->gnss2Outputs.emplace();
                     obs->gnss2Outputs->gnssField |= _binaryOutputRegister.gps2Field;
                 }
 
@@ -1128,7 +1128,7 @@ std::shared_ptr<const NAV::NodeData> NAV::VectorNavFile::pollData()
             {
                 if (!obs->timeOutputs)
                 {
-                    obs->timeOutputs = std::make_shared<NAV::vendor::vectornav::TimeOutputs>();
+                    obs->timeOutputs.emplace();
                     obs->timeOutputs->timeField |= _binaryOutputRegister.timeField;
                 }
 
@@ -1184,7 +1184,7 @@ std::shared_ptr<const NAV::NodeData> NAV::VectorNavFile::pollData()
             {
                 if (!obs->imuOutputs)
                 {
-                    obs->imuOutputs = std::make_shared<NAV::vendor::vectornav::ImuOutputs>();
+                    obs->imuOutputs.emplace();
                     obs->imuOutputs->imuField |= _binaryOutputRegister.imuField;
                 }
 
@@ -1239,7 +1239,7 @@ std::shared_ptr<const NAV::NodeData> NAV::VectorNavFile::pollData()
             {
                 if (!obs->gnss1Outputs)
                 {
-                    obs->gnss1Outputs = std::make_shared<NAV::vendor::vectornav::GnssOutputs>();
+                    obs->gnss1Outputs.emplace();
                     obs->gnss1Outputs->gnssField |= _binaryOutputRegister.gpsField;
                 }
 
@@ -1355,7 +1355,7 @@ std::shared_ptr<const NAV::NodeData> NAV::VectorNavFile::pollData()
             {
                 if (!obs->attitudeOutputs)
                 {
-                    obs->attitudeOutputs = std::make_shared<NAV::vendor::vectornav::AttitudeOutputs>();
+                    obs->attitudeOutputs.emplace();
                     obs->attitudeOutputs->attitudeField |= _binaryOutputRegister.attitudeField;
                 }
 
@@ -1401,7 +1401,7 @@ std::shared_ptr<const NAV::NodeData> NAV::VectorNavFile::pollData()
             {
                 if (!obs->insOutputs)
                 {
-                    obs->insOutputs = std::make_shared<NAV::vendor::vectornav::InsOutputs>();
+                    obs->insOutputs.emplace();
                     obs->insOutputs->insField |= _binaryOutputRegister.insField;
                 }
 
@@ -1455,7 +1455,7 @@ std::shared_ptr<const NAV::NodeData> NAV::VectorNavFile::pollData()
             {
                 if (!obs->gnss2Outputs)
                 {
-                    obs->gnss2Outputs = std::make_shared<NAV::vendor::vectornav::GnssOutputs>();
+                    obs->gnss2Outputs.emplace();
                     obs->gnss2Outputs->gnssField |= _binaryOutputRegister.gps2Field;
                 }
 
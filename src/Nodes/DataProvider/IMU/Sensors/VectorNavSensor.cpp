@@ -6482,7 +6482,7 @@ void NAV::VectorNavSensor::mergeVectorNavBinaryObservations(const std::shared_pt
     // Group 2 (Time)
     if (!target->timeOutputs && source->timeOutputs)
     {
-        target->timeOutputs = source->timeOutputs;
+        target->timeOutputs = std::move(source->timeOutputs);
     }
     else if (target->timeOutputs && source->timeOutputs)
     {
@@ -6502,7 +6502,7 @@ void NAV::VectorNavSensor::mergeVectorNavBinaryObservations(const std::shared_pt
     // Group 3 (IMU)
     if (!target->imuOutputs && source->imuOutputs)
     {
-        target->imuOutputs = source->imuOutputs;
+        target->imuOutputs = std::move(source->imuOutputs);
     }
     else if (target->imuOutputs && source->imuOutputs)
     {
@@ -6524,7 +6524,7 @@ void NAV::VectorNavSensor::mergeVectorNavBinaryObservations(const std::shared_pt
     // Group 4 (GNSS1)
     if (!target->gnss1Outputs && source->gnss1Outputs)
     {
-        target->gnss1Outputs = source->gnss1Outputs;
+        target->gnss1Outputs = std::move(source->gnss1Outputs);
     }
     else if (target->gnss1Outputs && source->gnss1Outputs)
     {
@@ -6550,7 +6550,7 @@ void NAV::VectorNavSensor::mergeVectorNavBinaryObservations(const std::shared_pt
     // Group 5 (Attitude)
     if (!target->attitudeOutputs && source->attitudeOutputs)
     {
-        target->attitudeOutputs = source->attitudeOutputs;
+        target->attitudeOutputs = std::move(source->attitudeOutputs);
     }
     else if (target->attitudeOutputs && source->attitudeOutputs)
     {
@@ -6569,7 +6569,7 @@ void NAV::VectorNavSensor::mergeVectorNavBinaryObservations(const std::shared_pt
     // Group 6 (INS)
     if (!target->insOutputs && source->insOutputs)
     {
-        target->insOutputs = source->insOutputs;
+        target->insOutputs = std::move(source->insOutputs);
     }
     else if (target->insOutputs && source->insOutputs)
     {
@@ -6590,7 +6590,7 @@ void NAV::VectorNavSensor::mergeVectorNavBinaryObservations(const std::shared_pt
     // Group 7 (GNSS2)
     if (!target->gnss2Outputs && source->gnss2Outputs)
     {
-        target->gnss2Outputs = source->gnss2Outputs;
+        target->gnss2Outputs = std::move(source->gnss2Outputs);
     }
     else if (target->gnss2Outputs && source->gnss2Outputs)
     {
@@ -6657,7 +6657,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 //     {
                 //         if (!obs->timeOutputs)
                 //         {
-                //             obs->timeOutputs = std::make_shared<NAV::vendor::vectornav::TimeOutputs>();
+                //             obs->timeOutputs.emplace();
                 //             obs->timeOutputs->timeField |= vnSensor->_binaryOutputRegister.at(b).timeField;
                 //         }
                 //         obs->timeOutputs->timeField |= vn::protocol::uart::TimeGroup::TIMEGROUP_TIMESTARTUP;
@@ -6667,7 +6667,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 //     {
                 //         if (!obs->timeOutputs)
                 //         {
-                //             obs->timeOutputs = std::make_shared<NAV::vendor::vectornav::TimeOutputs>();
+                //             obs->timeOutputs.emplace();
                 //             obs->timeOutputs->timeField |= vnSensor->_binaryOutputRegister.at(b).timeField;
                 //         }
                 //         obs->timeOutputs->timeField |= vn::protocol::uart::TimeGroup::TIMEGROUP_TIMEGPS;
@@ -6677,7 +6677,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 //     {
                 //         if (!obs->timeOutputs)
                 //         {
-                //             obs->timeOutputs = std::make_shared<NAV::vendor::vectornav::TimeOutputs>();
+                //             obs->timeOutputs.emplace();
                 //             obs->timeOutputs->timeField |= vnSensor->_binaryOutputRegister.at(b).timeField;
                 //         }
                 //         obs->timeOutputs->timeField |= vn::protocol::uart::TimeGroup::TIMEGROUP_TIMESYNCIN;
@@ -6687,7 +6687,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 //     {
                 //         if (!obs->attitudeOutputs)
                 //         {
-                //             obs->attitudeOutputs = std::make_shared<NAV::vendor::vectornav::AttitudeOutputs>();
+                //             obs->attitudeOutputs.emplace();
                 //             obs->attitudeOutputs->attitudeField |= vnSensor->_binaryOutputRegister.at(b).attitudeField;
                 //         }
                 //         obs->attitudeOutputs->attitudeField |= vn::protocol::uart::AttitudeGroup::ATTITUDEGROUP_YAWPITCHROLL;
@@ -6698,7 +6698,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 //     {
                 //         if (!obs->attitudeOutputs)
                 //         {
-                //             obs->attitudeOutputs = std::make_shared<NAV::vendor::vectornav::AttitudeOutputs>();
+                //             obs->attitudeOutputs.emplace();
                 //             obs->attitudeOutputs->attitudeField |= vnSensor->_binaryOutputRegister.at(b).attitudeField;
                 //         }
                 //         obs->attitudeOutputs->attitudeField |= vn::protocol::uart::AttitudeGroup::ATTITUDEGROUP_QUATERNION;
@@ -6709,7 +6709,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 //     {
                 //         if (!obs->imuOutputs)
                 //         {
-                //             obs->imuOutputs = std::make_shared<NAV::vendor::vectornav::ImuOutputs>();
+                //             obs->imuOutputs.emplace();
                 //             obs->imuOutputs->imuField |= vnSensor->_binaryOutputRegister.at(b).imuField;
                 //         }
                 //         obs->imuOutputs->imuField |= vn::protocol::uart::ImuGroup::IMUGROUP_ANGULARRATE;
@@ -6720,7 +6720,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 //     {
                 //         if (!obs->insOutputs)
                 //         {
-                //             obs->insOutputs = std::make_shared<NAV::vendor::vectornav::InsOutputs>();
+                //             obs->insOutputs.emplace();
                 //             obs->insOutputs->insField |= vnSensor->_binaryOutputRegister.at(b).insField;
                 //         }
                 //         obs->insOutputs->insField |= vn::protocol::uart::InsGroup::INSGROUP_POSLLA;
@@ -6731,7 +6731,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 //     {
                 //         if (!obs->insOutputs)
                 //         {
-                //             obs->insOutputs = std::make_shared<NAV::vendor::vectornav::InsOutputs>();
+                //             obs->insOutputs.emplace();
                 //             obs->insOutputs->insField |= vnSensor->_binaryOutputRegister.at(b).insField;
                 //         }
                 //         obs->insOutputs->insField |= vn::protocol::uart::InsGroup::INSGROUP_VELNED;
@@ -6742,7 +6742,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 //     {
                 //         if (!obs->imuOutputs)
                 //         {
-                //             obs->imuOutputs = std::make_shared<NAV::vendor::vectornav::ImuOutputs>();
+                //             obs->imuOutputs.emplace();
                 //             obs->imuOutputs->imuField |= vnSensor->_binaryOutputRegister.at(b).imuField;
                 //         }
                 //         obs->imuOutputs->imuField |= vn::protocol::uart::ImuGroup::IMUGROUP_ACCEL;
@@ -6753,7 +6753,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 //     {
                 //         if (!obs->imuOutputs)
                 //         {
-                //             obs->imuOutputs = std::make_shared<NAV::vendor::vectornav::ImuOutputs>();
+                //             obs->imuOutputs.emplace();
                 //             obs->imuOutputs->imuField |= vnSensor->_binaryOutputRegister.at(b).imuField;
                 //         }
                 //         obs->imuOutputs->imuField |= vn::protocol::uart::ImuGroup::IMUGROUP_UNCOMPACCEL;
@@ -6767,7 +6767,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 //     {
                 //         if (!obs->imuOutputs)
                 //         {
-                //             obs->imuOutputs = std::make_shared<NAV::vendor::vectornav::ImuOutputs>();
+                //             obs->imuOutputs.emplace();
                 //             obs->imuOutputs->imuField |= vnSensor->_binaryOutputRegister.at(b).imuField;
                 //         }
                 //         obs->imuOutputs->imuField |= vn::protocol::uart::ImuGroup::IMUGROUP_MAG;
@@ -6782,7 +6782,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 //     {
                 //         if (!obs->imuOutputs)
                 //         {
-                //             obs->imuOutputs = std::make_shared<NAV::vendor::vectornav::ImuOutputs>();
+                //             obs->imuOutputs.emplace();
                 //             obs->imuOutputs->imuField |= vnSensor->_binaryOutputRegister.at(b).imuField;
                 //         }
                 //         obs->imuOutputs->imuField |= vn::protocol::uart::ImuGroup::IMUGROUP_DELTATHETA;
@@ -6797,7 +6797,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 //     {
                 //         if (!obs->insOutputs)
                 //         {
-                //             obs->insOutputs = std::make_shared<NAV::vendor::vectornav::InsOutputs>();
+                //             obs->insOutputs.emplace();
                 //             obs->insOutputs->insField |= vnSensor->_binaryOutputRegister.at(b).insField;
                 //         }
                 //         obs->insOutputs->insField |= vn::protocol::uart::InsGroup::INSGROUP_INSSTATUS;
@@ -6807,7 +6807,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 //     {
                 //         if (!obs->timeOutputs)
                 //         {
-                //             obs->timeOutputs = std::make_shared<NAV::vendor::vectornav::TimeOutputs>();
+                //             obs->timeOutputs.emplace();
                 //             obs->timeOutputs->timeField |= vnSensor->_binaryOutputRegister.at(b).timeField;
                 //         }
                 //         obs->timeOutputs->timeField |= vn::protocol::uart::TimeGroup::TIMEGROUP_SYNCINCNT;
@@ -6817,7 +6817,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 //     {
                 //         if (!obs->timeOutputs)
                 //         {
-                //             obs->timeOutputs = std::make_shared<NAV::vendor::vectornav::TimeOutputs>();
+                //             obs->timeOutputs.emplace();
                 //             obs->timeOutputs->timeField |= vnSensor->_binaryOutputRegister.at(b).timeField;
                 //         }
                 //         obs->timeOutputs->timeField |= vn::protocol::uart::TimeGroup::TIMEGROUP_TIMEGPSPPS;
@@ -6830,7 +6830,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 {
                     if (!obs->timeOutputs)
                     {
-                        obs->timeOutputs = std::make_shared<NAV::vendor::vectornav::TimeOutputs>();
+                        obs->timeOutputs.emplace();
                         obs->timeOutputs->timeField |= vnSensor->_binaryOutputRegister.at(b).timeField;
                     }
 
@@ -6886,7 +6886,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 {
                     if (!obs->imuOutputs)
                     {
-                        obs->imuOutputs = std::make_shared<NAV::vendor::vectornav::ImuOutputs>();
+                        obs->imuOutputs.emplace();
                         obs->imuOutputs->imuField |= vnSensor->_binaryOutputRegister.at(b).imuField;
                     }
 
@@ -6949,7 +6949,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 {
                     if (!obs->gnss1Outputs)
                     {
-                        obs->gnss1Outputs = std::make_shared<NAV::vendor::vectornav::GnssOutputs>();
+                        obs->gnss1Outputs.emplace();
                         obs->gnss1Outputs->gnssField |= vnSensor->_binaryOutputRegister.at(b).gpsField;
                     }
 
@@ -7080,7 +7080,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 {
                     if (!obs->attitudeOutputs)
                     {
-                        obs->attitudeOutputs = std::make_shared<NAV::vendor::vectornav::AttitudeOutputs>();
+                        obs->attitudeOutputs.emplace();
                         obs->attitudeOutputs->attitudeField |= vnSensor->_binaryOutputRegister.at(b).attitudeField;
                     }
 
@@ -7138,7 +7138,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 {
                     if (!obs->insOutputs)
                     {
-                        obs->insOutputs = std::make_shared<NAV::vendor::vectornav::InsOutputs>();
+                        obs->insOutputs.emplace();
                         obs->insOutputs->insField |= vnSensor->_binaryOutputRegister.at(b).insField;
                     }
 
@@ -7200,7 +7200,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                 {
                     if (!obs->gnss2Outputs)
                     {
-                        obs->gnss2Outputs = std::make_shared<NAV::vendor::vectornav::GnssOutputs>();
+                        obs->gnss2Outputs.emplace();
                         obs->gnss2Outputs->gnssField |= vnSensor->_binaryOutputRegister.at(b).gps2Field;
                     }
 
@@ -7453,7 +7453,7 @@ void NAV::VectorNavSensor::asciiOrBinaryAsyncMessageReceived(void* userData, vn:
                         if (vnSensor->_binaryOutputRegisterMergeIndex != b
                             && ((!obs->insTime.empty() && !vnSensor->_binaryOutputRegisterMergeObservation->insTime.empty()
                                  && (obs->insTime - vnSensor->_binaryOutputRegisterMergeObservation->insTime < allowedTimeDiff)) // NOLINT(hicpp-use-nullptr, modernize-use-nullptr)
-                                || (obs->timeOutputs != nullptr && vnSensor->_binaryOutputRegisterMergeObservation->timeOutputs != nullptr
+                                || (obs->timeOutputs.has_value() && vnSensor->_binaryOutputRegisterMergeObservation->timeOutputs.has_value()
                                     && obs->timeOutputs->timeField & vn::protocol::uart::TIMEGROUP_TIMESTARTUP
                                     && vnSensor->_binaryOutputRegisterMergeObservation->timeOutputs->timeField & vn::protocol::uart::TIMEGROUP_TIMESTARTUP
                                     && (std::chrono::nanoseconds(obs->timeOutputs->timeStartup - vnSensor->_binaryOutputRegisterMergeObservation->timeOutputs->timeStartup) < allowedTimeDiff)))) // NOLINT(hicpp-use-nullptr, modernize-use-nullptr)
@@ -838,16 +838,17 @@ void NAV::ImuSimulator::restore(json const& j)
     }
 }
 
-NAV::InsTime NAV::ImuSimulator::getTimeFromCsvLine(const CsvData::CsvLine& line, const std::vector<std::string>& description) const
+NAV::InsTime NAV::ImuSimulator::getTimeFromCsvLine(const CsvData& data, size_t row) const
 {
+    const auto& description = data.description;
     auto gpsCycleIter = std::find(description.begin(), description.end(), "GpsCycle");
     auto gpsWeekIter = std::find(description.begin(), description.end(), "GpsWeek");
     auto gpsTowIter = std::find(description.begin(), description.end(), "GpsToW [s]");
     if (gpsCycleIter != description.end() && gpsWeekIter != description.end() && gpsTowIter != description.end())
     {
-        auto gpsCycle = static_cast<int32_t>(std::get<double>(line.at(static_cast<size_t>(gpsCycleIter - description.begin()))));
-        auto gpsWeek = static_cast<int32_t>(std::get<double>(line.at(static_cast<size_t>(gpsWeekIter - description.begin()))));
-        auto gpsTow = std::get<double>(line.at(static_cast<size_t>(gpsTowIter - description.begin())));
+        auto gpsCycle = static_cast<int32_t>(data.value(row, static_cast<size_t>(gpsCycleIter - description.begin())));
+        auto gpsWeek = static_cast<int32_t>(data.value(row, static_cast<size_t>(gpsWeekIter - description.begin())));
+        auto gpsTow = data.value(row, static_cast<size_t>(gpsTowIter - description.begin()));
         return { gpsCycle, gpsWeek, gpsTow };
     }
 
@@ -860,12 +861,12 @@ NAV::InsTime NAV::ImuSimulator::getTimeFromCsvLine(const CsvData::CsvLine& line,
     if (yearUTCIter != description.end() && monthUTCIter != description.end() && dayUTCIter != description.end()
         && hourUTCIter != description.end() && minUTCIter != description.end() && secUTCIter != description.end())
     {
-        auto yearUTC = static_cast<uint16_t>(std::get<double>(line.at(static_cast<size_t>(yearUTCIter - description.begin()))));
-        auto monthUTC = static_cast<uint16_t>(std::get<double>(line.at(static_cast<size_t>(monthUTCIter - description.begin()))));
-        auto dayUTC = static_cast<uint16_t>(std::get<double>(line.at(static_cast<size_t>(dayUTCIter - description.begin()))));
-        auto hourUTC = static_cast<uint16_t>(std::get<double>(line.at(static_cast<size_t>(hourUTCIter - description.begin()))));
-        auto minUTC = static_cast<uint16_t>(std::get<double>(line.at(static_cast<size_t>(minUTCIter - description.begin()))));
-        auto secUTC = std::get<double>(line.at(static_cast<size_t>(secUTCIter - description.begin())));
+        auto yearUTC = static_cast<uint16_t>(data.value(row, static_cast<size_t>(yearUTCIter - description.begin())));
+        auto monthUTC = static_cast<uint16_t>(data.value(row, static_cast<size_t>(monthUTCIter - description.begin())));
+        auto dayUTC = static_cast<uint16_t>(data.value(row, static_cast<size_t>(dayUTCIter - description.begin())));
+        auto hourUTC = static_cast<uint16_t>(data.value(row, static_cast<size_t>(hourUTCIter - description.begin())));
+        auto minUTC = static_cast<uint16_t>(data.value(row, static_cast<size_t>(minUTCIter - description.begin())));
+        auto secUTC = data.value(row, static_cast<size_t>(secUTCIter - description.begin()));
         return { yearUTC, monthUTC, dayUTC, hourUTC, minUTC, secUTC, UTC };
     }
 
@@ -873,16 +874,17 @@ NAV::InsTime NAV::ImuSimulator::getTimeFromCsvLine(const CsvData::CsvLine& line,
     return {};
 }
 
-Eigen::Vector3<NAV::ImuSimulator::Scalar> NAV::ImuSimulator::e_getPositionFromCsvLine(const CsvData::CsvLine& line, const std::vector<std::string>& description) const
+Eigen::Vector3<NAV::ImuSimulator::Scalar> NAV::ImuSimulator::e_getPositionFromCsvLine(const CsvData& data, size_t row) const
 {
+    const auto& description = data.description;
     auto posXIter = std::find(description.begin(), description.end(), "Pos ECEF X [m]");
     auto posYIter = std::find(description.begin(), description.end(), "Pos ECEF Y [m]");
     auto posZIter = std::find(description.begin(), description.end(), "Pos ECEF Z [m]");
     if (posXIter != description.end() && posYIter != description.end() && posZIter != description.end())
     {
-        auto posX = std::get<double>(line.at(static_cast<size_t>(posXIter - description.begin())));
-        auto posY = std::get<double>(line.at(static_cast<size_t>(posYIter - description.begin())));
-        auto posZ = std::get<double>(line.at(static_cast<size_t>(posZIter - description.begin())));
+        auto posX = data.value(row, static_cast<size_t>(posXIter - description.begin()));
+        auto posY = data.value(row, static_cast<size_t>(posYIter - description.begin()));
+        auto posZ = data.value(row, static_cast<size_t>(posZIter - description.begin()));
         return { posX, posY, posZ };
     }
 
@@ -891,9 +893,9 @@ Eigen::Vector3<NAV::ImuSimulator::Scalar> NAV::ImuSimulator::e_getPositionFromCs
     auto altIter = std::find(description.begin(), description.end(), "Altitude [m]");
     if (latIter != description.end() && lonIter != description.end() && altIter != description.end())
     {
-        auto lat = deg2rad(std::get<double>(line.at(static_cast<size_t>(latIter - description.begin()))));
-        auto lon = deg2rad(std::get<double>(line.at(static_cast<size_t>(lonIter - description.begin()))));
-        auto alt = std::get<double>(line.at(static_cast<size_t>(altIter - description.begin())));
+        auto lat = deg2rad(data.value(row, static_cast<size_t>(latIter - description.begin())));
+        auto lon = deg2rad(data.value(row, static_cast<size_t>(lonIter - description.begin())));
+        auto alt = data.value(row, static_cast<size_t>(altIter - description.begin()));
         return trafo::lla2ecef_WGS84(Eigen::Vector3<Scalar>(lat, lon, alt));
     }
 
@@ -901,16 +903,17 @@ Eigen::Vector3<NAV::ImuSimulator::Scalar> NAV::ImuSimulator::e_getPositionFromCs
     return { std::nan(""), std::nan(""), std::nan("") };
 }
 
-Eigen::Quaternion<NAV::ImuSimulator::Scalar> NAV::ImuSimulator::n_getAttitudeQuaternionFromCsvLine_b(const CsvData::CsvLine& line, const std::vector<std::string>& description)
+Eigen::Quaternion<NAV::ImuSimulator::Scalar> NAV::ImuSimulator::n_getAttitudeQuaternionFromCsvLine_b(const CsvData& data, size_t row)
 {
+    const auto& description = data.description;
     auto rollIter = std::find(description.begin(), description.end(), "Roll [deg]");
     auto pitchIter = std::find(description.begin(), description.end(), "Pitch [deg]");
     auto yawIter = std::find(description.begin(), description.end(), "Yaw [deg]");
     if (rollIter != description.end() && pitchIter != description.end() && yawIter != description.end())
     {
-        auto roll = static_cast<Scalar>(std::get<double>(line.at(static_cast<size_t>(rollIter - description.begin()))));
-        auto pitch = static_cast<Scalar>(std::get<double>(line.at(static_cast<size_t>(pitchIter - description.begin()))));
-        auto yaw = static_cast<Scalar>(std::get<double>(line.at(static_cast<size_t>(yawIter - description.begin()))));
+        auto roll = static_cast<Scalar>(data.value(row, static_cast<size_t>(rollIter - description.begin())));
+        auto pitch = static_cast<Scalar>(data.value(row, static_cast<size_t>(pitchIter - description.begin())));
+        auto yaw = static_cast<Scalar>(data.value(row, static_cast<size_t>(yawIter - description.begin())));
         return trafo::n_Quat_b(deg2rad(roll), deg2rad(pitch), deg2rad(yaw));
     }
 
@@ -920,10 +923,10 @@ Eigen::Quaternion<NAV::ImuSimulator::Scalar> NAV::ImuSimulator::n_getAttitudeQua
     auto quatZIter = std::find(description.begin(), description.end(), "n_Quat_b z");
     if (quatWIter != description.end() && quatXIter != description.end() && quatYIter != description.end() && quatZIter != description.end())
     {
-        auto w = std::get<double>(line.at(static_cast<size_t>(quatWIter - description.begin())));
-        auto x = std::get<double>(line.at(static_cast<size_t>(quatXIter - description.begin())));
-        auto y = std::get<double>(line.at(static_cast<size_t>(quatYIter - description.begin())));
-        auto z = std::get<double>(line.at(static_cast<size_t>(quatZIter - description.begin())));
+        auto w = data.value(row, static_cast<size_t>(quatWIter - description.begin()));
+        auto x = data.value(row, static_cast<size_t>(quatXIter - description.begin()));
+        auto y = data.value(row, static_cast<size_t>(quatYIter - description.begin()));
+        auto z = data.value(row, static_cast<size_t>(quatZIter - description.begin()));
         return { w, x, y, z };
     }
 
@@ -1272,9 +1275,9 @@ bool NAV::ImuSimulator::initializeSplines()
     else if (_trajectoryType == TrajectoryType::Csv)
     {
         if (auto csvData = getInputValue<CsvData>(INPUT_PORT_INDEX_CSV);
-            csvData && csvData->v->lines.size() >= 2)
+            csvData && csvData->v->rows() >= 2)
         {
-            _startTime = getTimeFromCsvLine(csvData->v->lines.front(), csvData->v->description);
+            _startTime = getTimeFromCsvLine(*csvData->v, 0);
             if (_startTime.empty()) { return false; }
 
             constexpr size_t nVirtPoints = 10;
@@ -1286,18 +1289,18 @@ bool NAV::ImuSimulator::initializeSplines()
             std::vector<Scalar> splinePitch(splineTime.size());
             std::vector<Scalar> splineYaw(splineTime.size());
 
-            for (size_t i = 0; i < csvData->v->lines.size(); i++)
+            for (size_t i = 0; i < csvData->v->rows(); i++)
             {
-                InsTime insTime = getTimeFromCsvLine(csvData->v->lines[i], csvData->v->description);
+                InsTime insTime = getTimeFromCsvLine(*csvData->v, i);
                 if (insTime.empty()) { return false; }
                 LOG_DATA("{}: Time {}", nameId(), insTime);
                 Scalar time = (insTime - _startTime).count();
 
-                Eigen::Vector3<Scalar> e_pos = e_getPositionFromCsvLine(csvData->v->lines[i], csvData->v->description);
+                Eigen::Vector3<Scalar> e_pos = e_getPositionFromCsvLine(*csvData->v, i);
                 if (std::isnan(e_pos.x())) { return false; }
                 LOG_DATA("{}: e_pos {}", nameId(), e_pos);
 
-                Eigen::Quaternion<Scalar> n_Quat_b = n_getAttitudeQuaternionFromCsvLine_b(csvData->v->lines[i], csvData->v->description);
+                Eigen::Quaternion<Scalar> n_Quat_b = n_getAttitudeQuaternionFromCsvLine_b(*csvData->v, i);
                 if (std::isnan(n_Quat_b.w()))
                 {
                     // TODO: Calculate with rotation minimizing frame instead of returning false
@@ -1427,9 +1430,9 @@ bool NAV::ImuSimulator::resetNode()
     if (_trajectoryType == TrajectoryType::Csv)
     {
         if (auto csvData = getInputValue<CsvData>(INPUT_PORT_INDEX_CSV);
-            csvData && !csvData->v->lines.empty())
+            csvData && csvData->v->rows() != 0)
         {
-            _startTime = getTimeFromCsvLine(csvData->v->lines.front(), csvData->v->description);
+            _startTime = getTimeFromCsvLine(*csvData->v, 0);
             if (_startTime.empty())
             {
                 return false;
@@ -250,22 +250,22 @@ class ImuSimulator : public Imu
     // ###########################################################################################################
 
     /// @brief Get the Time from a CSV line
-    /// @param[in] line Line with data from the csv
-    /// @param[in] description Description of the data
+    /// @param[in] data Data from the csv
+    /// @param[in] row Index of the line
     /// @return InsTime or empty time if data not found
-    [[nodiscard]] InsTime getTimeFromCsvLine(const CsvData::CsvLine& line, const std::vector<std::string>& description) const;
+    [[nodiscard]] InsTime getTimeFromCsvLine(const CsvData& data, size_t row) const;
 
     /// @brief Get the Position from a CSV line
-    /// @param[in] line Line with data from the csv
-    /// @param[in] description Description of the data
+    /// @param[in] data Data from the csv
+    /// @param[in] row Index of the line
     /// @return Position in ECEF coordinates in [m] or NaN if data not found
-    [[nodiscard]] Eigen::Vector3<Scalar> e_getPositionFromCsvLine(const CsvData::CsvLine& line, const std::vector<std::string>& description) const;
+    [[nodiscard]] Eigen::Vector3<Scalar> e_getPositionFromCsvLine(const CsvData& data, size_t row) const;
 
     /// @brief Get the Attitude quaternion n_quat_b from a CSV line
-    /// @param[in] line Line with data from the csv
-    /// @param[in] description Description of the data
+    /// @param[in] data Data from the csv
+    /// @param[in] row Index of the line
     /// @return Attitude quaternion n_quat_b or NaN if data not found
-    static Eigen::Quaternion<Scalar> n_getAttitudeQuaternionFromCsvLine_b(const CsvData::CsvLine& line, const std::vector<std::string>& description);
+    static Eigen::Quaternion<Scalar> n_getAttitudeQuaternionFromCsvLine_b(const CsvData& data, size_t row);
 
     /// Assign a variable that holds the Spline information
     struct
@@ -11,6 +11,7 @@
 #include "util/Logger.hpp"
 
 #include "internal/ConfigManager.hpp"
+#include "internal/FlowCheckpoint.hpp"
 #include "internal/FlowManager.hpp"
 
 #include <sstream>
@@ -208,4 +209,38 @@ void NAV::FileReader::resetReader()
     _filestream.clear();
     _filestream.seekg(_dataStart, std::ios_base::beg);
     _lineCnt = _lineCntDataStart;
-}
\ No newline at end of file
+    _obsStartPosition = _dataStart;
+    _obsStartLineCnt = _lineCnt;
+}
+
+void NAV::FileReader::markObservationStart()
+{
+    if (!FlowCheckpoint::IsEnabled()) { return; }
+
+    auto pos = _filestream.tellg();
+    _obsStartPosition = pos == std::streampos(-1) ? std::streamoff(-1) : std::streamoff(pos);
+    _obsStartLineCnt = _lineCnt;
+}
+
+json NAV::FileReader::saveCheckpoint()
+{
+    return json{
+        { "position", _obsStartPosition },
+        { "lineCnt", _obsStartLineCnt },
+    };
+}
+
+bool NAV::FileReader::restoreCheckpoint(const json& j)
+{
+    if (!j.contains("position") || !j.contains("lineCnt")) { return false; }
+
+    auto pos = j.at("position").get<std::streamoff>();
+    _filestream.clear();
+    if (pos < 0) { _filestream.seekg(0, std::ios_base::end); } // The end of the file was reached already
+    else { _filestream.seekg(pos, std::ios_base::beg); }
+    j.at("lineCnt").get_to(_lineCnt);
+    _obsStartPosition = pos;
+    _obsStartLineCnt = _lineCnt;
+
+    return _filestream.good();
+}
@@ -88,6 +88,20 @@ class FileReader
     /// @brief Moves the read cursor to the start
     void resetReader();
 
+    /// @brief Remembers the read position as start of the next observation. Call this at the start of the poll function.
+    /// @note Only queries the position if checkpoints are taken in the current execution
+    void markObservationStart();
+
+    /// @brief Saves the read position at the start of the last polled observation for a checkpoint.
+    ///
+    /// The observation the data provider paused at was polled already, but is sent again after resuming.
+    [[nodiscard]] json saveCheckpoint();
+
+    /// @brief Moves the read cursor to the position saved in a checkpoint
+    /// @param[in] j Json object returned by saveCheckpoint()
+    /// @return True if the position could be restored
+    bool restoreCheckpoint(const json& j);
+
     /// @brief Virtual Function to determine the File Type
     /// @return The File path which was recognized
     [[nodiscard]] virtual FileType determineFileType();
@@ -168,6 +182,10 @@ class FileReader
     size_t _lineCnt = 0;
     /// Line counter data start
     size_t _lineCntDataStart = 0;
+    /// Read position at the start of the last polled observation (-1 if the end of the file was reached)
+    std::streamoff _obsStartPosition = 0;
+    /// Line counter at the start of the last polled observation
+    size_t _obsStartLineCnt = 0;
 };
 
 } // namespace NAV
@@ -221,8 +221,20 @@ bool NAV::PosVelAttFile::resetNode()
     return true;
 }
 
+std::optional<json> NAV::PosVelAttFile::saveCheckpoint()
+{
+    return FileReader::saveCheckpoint();
+}
+
+bool NAV::PosVelAttFile::restoreCheckpoint(const json& j)
+{
+    return FileReader::restoreCheckpoint(j);
+}
+
 std::shared_ptr<const NAV::NodeData> NAV::PosVelAttFile::pollData()
 {
+    markObservationStart();
+
     std::shared_ptr<Pos> obs;
     switch (_fileContent)
     {
@@ -2427,11 +2427,12 @@ void NAV::Plot::plotFlowData(NAV::InputPin::NodeDataQueue& queue, size_t pinIdx)
             auto obs = std::static_pointer_cast<const Pos>(nodeData);
             auto localPosition = calcLocalPosition(obs->lla_position());
 
-            for (size_t j = 0; j < Pos::GetStaticDescriptorCount(); ++j)
+            auto values = extractStaticValues(*obs, pinIdx, 0, Pos::GetStaticDescriptorCount());
+            for (size_t j = 0; j < values.size(); ++j)
             {
                 if (j == 3) { addData(pinIdx, i++, localPosition.northSouth); }
                 else if (j == 4) { addData(pinIdx, i++, localPosition.eastWest); }
-                else { addData(pinIdx, i++, obs->getValueAtOrNaN(j)); }
+                else { addData(pinIdx, i++, values[j]); }
             }
 
             if (sourcePin->dataIdentifier.front() == PosVel::type())
@@ -2469,6 +2470,24 @@ void NAV::Plot::plotFlowData(NAV::InputPin::NodeDataQueue& queue, size_t pinIdx)
     }
 }
 
+std::span<const double> NAV::Plot::extractStaticValues(const NodeData& obs, size_t pinIndex, size_t startIndex, size_t endIndex)
+{
+    auto& columnSelections = _pinData.at(pinIndex).columnSelections;
+    auto iter = std::find_if(columnSelections.begin(), columnSelections.end(), [&](const auto& selection) {
+        const auto& indices = selection.first.staticIndices();
+        return indices.size() == endIndex - startIndex && (indices.empty() || indices.front() == startIndex);
+    });
+    if (iter == columnSelections.end())
+    {
+        auto selection = ColumnSelection::StaticRange(startIndex, endIndex);
+        auto size = selection.size();
+        iter = columnSelections.emplace(columnSelections.end(), std::move(selection), std::vector<double>(size));
+    }
+
+    obs.writeValues(iter->second, iter->first);
+    return iter->second;
+}
+
 void NAV::Plot::plotDynamicData(const std::shared_ptr<const DynamicData>& obs, size_t pinIndex, size_t& plotIndex)
 {
     plotData(obs, pinIndex, plotIndex);
@@ -20,6 +20,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <unordered_set>
 
 #include "NodeData/NodeData.hpp"
@@ -169,6 +170,8 @@ class Plot : public Node, public CommonLog
         int dynamicDataStartIndex = -1;
         /// Events with relative time, absolute time, tooltip text and data Index (-1 means all)
         std::vector<std::tuple<double, InsTime, std::string, int32_t>> events;
+        /// Column selections for the bulk value export of the received NodeData and the buffers for their values
+        std::vector<std::pair<ColumnSelection, std::vector<double>>> columnSelections;
     };
 
     /// @brief Information specifying the look of each plot
@@ -499,12 +502,20 @@ class Plot : public Node, public CommonLog
     template<typename T>
     void plotData(const std::shared_ptr<const T>& obs, size_t pinIndex, size_t& plotIndex, size_t startIndex = 0)
     {
-        for (size_t i = startIndex; i < T::GetStaticDescriptorCount(); ++i)
+        for (const auto& value : extractStaticValues(*obs, pinIndex, startIndex, T::GetStaticDescriptorCount()))
         {
-            addData(pinIndex, plotIndex++, obs->getValueAtOrNaN(i));
+            addData(pinIndex, plotIndex++, value);
         }
     }
 
+    /// @brief Extracts the static data values in the range [startIndex, endIndex) of the observation with a single call
+    /// @param[in] obs Observation to extract the data from
+    /// @param[in] pinIndex Index of the input pin where the data was received
+    /// @param[in] startIndex Data descriptor start index
+    /// @param[in] endIndex Data descriptor end index (exclusive)
+    /// @return Values of the data descriptors (NaN if not in the observation). Valid till the next call.
+    std::span<const double> extractStaticValues(const NodeData& obs, size_t pinIndex, size_t startIndex, size_t endIndex);
+
     /// @brief Plot the data
     /// @param[in] obs Observation to plot
     /// @param[in] pinIndex Index of the input pin where the data was received
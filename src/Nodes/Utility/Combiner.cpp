@@ -9,6 +9,8 @@
 #include "Combiner.hpp"
 #include "Navigation/Time/TimeSystem.hpp"
 
+#include <cmath>
+
 #define IMGUI_DEFINE_MATH_OPERATORS
 #include <imgui_internal.h>
 
@@ -469,12 +471,12 @@ void Combiner::receiveData(InputPin::NodeDataQueue& queue, size_t pinIdx)
                 flow::ApplyChanges();
             }
 
-            auto value = std::holds_alternative<size_t>(term.dataSelection) ? nodeData->getValueAt(std::get<size_t>(term.dataSelection))
-                                                                            : nodeData->getDynamicDataAt(std::get<std::string>(term.dataSelection));
-            if (!value) { continue; }
+            double value = std::nan("");
+            nodeData->writeValues(std::span<double>(&value, 1), term.getColumnSelection());
+            if (std::isnan(value)) { continue; } // Missing in the observation or NaN, which would spoil the interpolation anyway
 
-            LOG_DATA("{}:     Term '{}': {:.3g}", nameId(), term.description(this, getDataDescriptors(term.pinIndex)), *value);
-            term.polyReg.push_back(std::make_pair(nodeDataTimeIntoRun, *value));
+            LOG_DATA("{}:     Term '{}': {:.3g}", nameId(), term.description(this, getDataDescriptors(term.pinIndex)), value);
+            term.polyReg.push_back(std::make_pair(nodeDataTimeIntoRun, value));
             term.rawData.push_back(nodeData);
             LOG_DATA("{}:       Adding NodeData to the end of term.rawData. It now includes:", nameId());
             for ([[maybe_unused]] const auto& data : term.rawData)
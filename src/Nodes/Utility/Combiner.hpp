@@ -110,6 +110,25 @@ class Combiner : public Node, public CommonLog
 
             PolynomialRegressor<double> polyReg{ 1, 2 };                   ///< Polynomial Regressor to interpolate data
             ScrollingBuffer<std::shared_ptr<const NodeData>> rawData{ 2 }; ///< Last raw data to add if we send
+            ColumnSelection columnSelection;                               ///< Precompiled selection of the data (updated on demand)
+
+            /// @brief Returns the column selection matching the data selection
+            const ColumnSelection& getColumnSelection()
+            {
+                if (const auto* index = std::get_if<size_t>(&dataSelection))
+                {
+                    if (columnSelection.staticIndices().size() != 1 || columnSelection.staticIndices().front() != *index)
+                    {
+                        columnSelection = ColumnSelection({ *index });
+                    }
+                }
+                else if (const auto& descriptor = std::get<std::string>(dataSelection);
+                         columnSelection.dynamicDescriptors().size() != 1 || columnSelection.dynamicDescriptors().front() != descriptor)
+                {
+                    columnSelection = ColumnSelection({}, { descriptor });
+                }
+                return columnSelection;
+            }
 
             /// @brief Get a string description of the combination
             /// @param node Combiner node pointer
@@ -214,6 +233,7 @@ class Combiner : public Node, public CommonLog
     [[nodiscard]] bool isLastObsThisEpoch(const InsTime& insTime) const;
 
     /// @brief Receive Data Function
+    /// @note Terms with a NaN value are skipped, the same as values missing in the observation, so NaN is never combined
     /// @param[in] queue Queue with all the received data messages
     /// @param[in] pinIdx Index of the pin the data is received on
     void receiveData(InputPin::NodeDataQueue& queue, size_t pinIdx);
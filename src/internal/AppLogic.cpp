@@ -61,7 +61,7 @@ int NAV::AppLogic::processCommandLineArguments(int argc, const char* argv[]) //
     // Register all Node Data Types which are available to the program
     NAV::NodeRegistry::RegisterNodeDataTypes();
 
-    NAV::AntexReader::Get().initialize();
+    NAV::AntexReader::Get().initializeAsync();
 
     util::time::SetCurrentTimeToComputerTime();
 
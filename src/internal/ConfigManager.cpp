@@ -58,6 +58,15 @@ void NAV::ConfigManager::initialize()
             ("console-log-level", bpo::value<std::string>()->default_value("info"),                 "Log level on the console      (possible values: trace/debug/info/warning/error/critical/off" )
             ("file-log-level",    bpo::value<std::string>()->default_value("debug"),                "Log level to the log file     (possible values: trace/debug/info/warning/error/critical/off" )
             ("log-filter",        bpo::value<std::string>(),                                        "Filter/Regex for log messages"                                                               )
+            ("log-async",         bpo::bool_switch()->default_value(false),                         "Write log messages asynchronously on a dedicated writer thread"                              )
+            ("log-queue-size",    bpo::value<size_t>()->default_value(8192),                        "Amount of messages in the queue of the asynchronous logger"                                  )
+            ("log-overflow-policy", bpo::value<std::string>()->default_value("block"),              "Behavior of the asynchronous logger on a full queue (possible values: block/drop/sample)"    )
+            ("log-rate-limit",    bpo::value<size_t>()->default_value(0),                           "Max. messages per second and node below warning level in async mode (0 = unlimited)"         )
+            ("profile",           bpo::bool_switch()->default_value(false),                         "Collect runtime statistics of nodes and pins and log a summary after execution"              )
+            ("profile-trace",     bpo::value<std::string>(),                                        "Write a Chrome trace/Perfetto timeline of the node callbacks to this file (implies --profile)" )
+            ("checkpoint",        bpo::value<std::string>(),                                        "Write checkpoints of the runtime state of all nodes to this file during post-processing"     )
+            ("checkpoint-interval", bpo::value<double>()->default_value(10.0),                      "Interval of the checkpoints in minutes of data time (0 = no checkpoints)"                     )
+            ("resume",            bpo::bool_switch()->default_value(false),                         "Resume the post-processing from the checkpoint file"                                         )
         ;
         // clang-format on
     }
@@ -126,6 +135,24 @@ void NAV::ConfigManager::CheckOptions(const int argc, [[maybe_unused]] const cha
         }
     }
 
+    if (const auto& policy = vm["log-overflow-policy"].as<std::string>();
+        policy != "block" && policy != "drop" && policy != "sample")
+    {
+        LOG_CRITICAL("The command line argument 'log-overflow-policy' has to be one of 'block/drop/sample' but the value '{}' was provided", policy);
+    }
+    if (vm["log-queue-size"].as<size_t>() == 0)
+    {
+        LOG_CRITICAL("The command line argument 'log-queue-size' has to be greater than 0");
+    }
+    if (!vm["log-async"].as<bool>() && vm["log-rate-limit"].as<size_t>() != 0)
+    {
+        LOG_WARN("The command line argument 'log-rate-limit' only has an effect in combination with 'log-async'");
+    }
+    if (vm["resume"].as<bool>() && !vm.count("checkpoint"))
+    {
+        LOG_CRITICAL("The command line argument 'resume' needs the path of the checkpoint file in the argument 'checkpoint'");
+    }
+
     for (int i = 0; i < argc; i++)
     {
         LOG_DEBUG("\targument[{}] = '{}'", i, argv[i]);
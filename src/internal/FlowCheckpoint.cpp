@@ -0,0 +1,411 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "FlowCheckpoint.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "internal/ConfigManager.hpp"
+#include "internal/FlowManager.hpp"
+#include "internal/Node/Node.hpp"
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+
+#include "Navigation/Time/InsTime.hpp"
+#include "util/Logger.hpp"
+
+namespace
+{
+
+/// @brief Phases of a checkpoint
+enum class Phase
+{
+    Off,         ///< No checkpoint pending
+    Approaching, ///< Waiting for all data providers to reach the checkpoint time
+    Draining,    ///< All data providers paused. Waiting for the nodes to process all data before the checkpoint time.
+};
+
+/// @brief Data provider of the current execution
+struct Provider
+{
+    bool paused = false;    ///< Flag whether the provider paused at the pending checkpoint
+    bool finished = false;  ///< Flag whether the provider sent all its data
+    NAV::InsTime pauseTime; ///< Time of the observation the provider paused at
+};
+
+/// Flag whether checkpoints are taken in the current execution
+std::atomic<bool> _enabled = false;
+
+/// Mutex for all variables below
+std::mutex _mutex;
+/// Current phase of the checkpoint
+Phase _phase = Phase::Off;
+/// Time of the pending checkpoint (empty till the first data was seen)
+NAV::InsTime _checkpointTime;
+/// Interval between the checkpoints in data time
+std::chrono::duration<long double> _interval{ 0 };
+/// Data providers of the current execution
+std::unordered_map<const NAV::Node*, Provider> _providers;
+/// Sum of the worker activity counters on the last check, if all workers were idle
+std::optional<size_t> _lastIdleActivity;
+
+/// Checkpoint loaded to resume from
+json _resume;
+
+/// @brief Path of the checkpoint file from the program options
+std::filesystem::path checkpointPath()
+{
+    std::filesystem::path path = NAV::ConfigManager::Get<std::string>("checkpoint");
+    if (path.is_relative())
+    {
+        path = NAV::flow::GetOutputPath() / path;
+    }
+    return path;
+}
+
+/// @brief Calculates the first multiple of the interval (since the start of GPS time) after the provided time
+/// @param[in] insTime Time to calculate the next checkpoint for
+NAV::InsTime nextCheckpointTime(const NAV::InsTime& insTime)
+{
+    auto gpst = insTime.toGPSweekTow();
+    long double seconds = (static_cast<long double>(gpst.gpsCycle) * NAV::InsTimeUtil::WEEKS_PER_GPS_CYCLE + gpst.gpsWeek) * NAV::InsTimeUtil::SECONDS_PER_WEEK
+                          + gpst.tow;
+    long double next = (std::floor(seconds / _interval.count()) + 1.0L) * _interval.count();
+    return insTime + std::chrono::duration<long double>(next - seconds);
+}
+
+/// @brief Wakes the workers of all nodes, so that they check their data again
+void wakeAllWorkers()
+{
+    for (NAV::Node* node : nm::m_Nodes())
+    {
+        if (node != nullptr && node->kind != NAV::Node::Kind::GroupBox && node->isInitialized()) { node->wakeWorker(); }
+    }
+}
+
+/// @brief Stops taking checkpoints in this execution and releases all held back data. Needs the mutex to be locked.
+void disable()
+{
+    _enabled = false;
+    _phase = Phase::Off;
+    _providers.clear();
+}
+
+/// @brief Collects the state of all nodes and writes the checkpoint file. Needs the mutex to be locked.
+/// @return False if the flow does not support checkpoints
+bool writeCheckpoint()
+{
+    json j;
+    j["insTime"] = _checkpointTime;
+    j["nodes"] = json::object();
+    for (NAV::Node* node : nm::m_Nodes())
+    {
+        if (node == nullptr || node->kind == NAV::Node::Kind::GroupBox || !node->isInitialized()) { continue; }
+
+        std::vector<bool> queueBlocked;
+        for (const auto& inputPin : node->inputPins)
+        {
+            if (!inputPin.queue.empty() && inputPin.queue.front()->insTime < _checkpointTime)
+            {
+                LOG_WARN("{}: Data or notifications before the checkpoint are still queued on pin '{}'. Skipping the checkpoint at {}.",
+                         node->nameId(), inputPin.name, _checkpointTime.toYMDHMS(NAV::GPST));
+                return true;
+            }
+            queueBlocked.push_back(inputPin.queueBlocked);
+        }
+
+        auto state = node->saveCheckpoint();
+        if (!state)
+        {
+            LOG_WARN("{}: The node does not support checkpoints. No checkpoints are written for this flow.", node->nameId());
+            return false;
+        }
+        j["nodes"][std::to_string(size_t(node->id))] = json{
+            { "type", node->type() },
+            { "state", *state },
+            { "queueBlocked", queueBlocked },
+        };
+    }
+
+    auto path = checkpointPath();
+    auto pathTmp = path;
+    pathTmp += ".tmp";
+    if (path.has_parent_path() && !std::filesystem::exists(path.parent_path()))
+    {
+        std::filesystem::create_directories(path.parent_path());
+    }
+    {
+        std::ofstream file(pathTmp, std::ios_base::trunc);
+        file << j.dump();
+        if (!file.good())
+        {
+            LOG_ERROR("Could not write the checkpoint file {}", pathTmp);
+            return true;
+        }
+    }
+    std::filesystem::rename(pathTmp, path); // Replaces the previous checkpoint only if the new one is complete
+    LOG_INFO("Wrote the checkpoint at {} to {}", _checkpointTime.toYMDHMS(NAV::GPST), path);
+    return true;
+}
+
+} // namespace
+
+bool NAV::FlowCheckpoint::IsRequested()
+{
+    return ConfigManager::HasKey("checkpoint") && ConfigManager::Get<double>("checkpoint-interval", 0.0) > 0.0;
+}
+
+bool NAV::FlowCheckpoint::IsResuming()
+{
+    return ConfigManager::HasKey("checkpoint") && ConfigManager::Get<bool>("resume", false)
+           && std::none_of(nm::m_Nodes().begin(), nm::m_Nodes().end(), [](const Node* node) {
+                  return node && !node->isDisabled() && node->isOnlyRealtime();
+              });
+}
+
+bool NAV::FlowCheckpoint::LoadResume()
+{
+    auto path = checkpointPath();
+    std::ifstream file(path);
+    if (!file.good())
+    {
+        LOG_ERROR("Could not open the checkpoint file {} to resume from", path);
+        return false;
+    }
+    try
+    {
+        _resume = json::parse(file);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("Could not read the checkpoint file {}: {}", path, e.what());
+        return false;
+    }
+    if (!_resume.contains("insTime") || !_resume.contains("nodes"))
+    {
+        LOG_ERROR("The checkpoint file {} is incomplete", path);
+        return false;
+    }
+
+    LOG_INFO("Resuming from the checkpoint at {} in {}", _resume.at("insTime").get<InsTime>().toYMDHMS(GPST), path);
+    return true;
+}
+
+bool NAV::FlowCheckpoint::Restore(Node* node)
+{
+    auto key = std::to_string(size_t(node->id));
+    if (!_resume.contains("nodes") || !_resume.at("nodes").contains(key))
+    {
+        LOG_ERROR("{}: The checkpoint contains no state for this node. Was the flow modified after writing the checkpoint?", node->nameId());
+        return false;
+    }
+    const auto& j = _resume.at("nodes").at(key);
+    if (j.at("type").get<std::string>() != node->type())
+    {
+        LOG_ERROR("{}: The checkpoint contains the state of a '{}' node for this id. Was the flow modified after writing the checkpoint?",
+                  node->nameId(), j.at("type").get<std::string>());
+        return false;
+    }
+    if (!node->restoreCheckpoint(j.at("state")))
+    {
+        LOG_ERROR("{}: Could not restore the state from the checkpoint", node->nameId());
+        return false;
+    }
+    if (j.contains("queueBlocked"))
+    {
+        auto queueBlocked = j.at("queueBlocked").get<std::vector<bool>>();
+        for (size_t i = 0; i < std::min(queueBlocked.size(), node->inputPins.size()); i++)
+        {
+            node->inputPins[i].queueBlocked = queueBlocked[i];
+        }
+    }
+    LOG_DEBUG("{}: Restored the state from the checkpoint", node->nameId());
+    return true;
+}
+
+void NAV::FlowCheckpoint::Start(bool postProcessing)
+{
+    std::scoped_lock lk(_mutex);
+    _resume = json{};
+    disable();
+
+    if (!postProcessing && ConfigManager::HasKey("checkpoint") && ConfigManager::Get<bool>("resume", false))
+    {
+        LOG_WARN("Resuming from a checkpoint is only available in post-processing mode");
+    }
+    if (!IsRequested()) { return; }
+    if (!postProcessing)
+    {
+        LOG_WARN("Checkpoints are only available in post-processing mode");
+        return;
+    }
+
+    _interval = std::chrono::duration<long double>(ConfigManager::Get<double>("checkpoint-interval") * 60.0);
+    _checkpointTime.reset();
+    _lastIdleActivity.reset();
+    for (const Node* node : nm::m_Nodes())
+    {
+        if (node != nullptr && node->kind != Node::Kind::GroupBox && node->isInitialized() && !node->pollEvents.empty())
+        {
+            _providers[node] = Provider{};
+        }
+    }
+    _phase = Phase::Approaching;
+    _enabled = true;
+    LOG_DEBUG("Writing checkpoints every {} min of data time to {}", ConfigManager::Get<double>("checkpoint-interval"), checkpointPath());
+}
+
+void NAV::FlowCheckpoint::Stop()
+{
+    std::scoped_lock lk(_mutex);
+    disable();
+}
+
+bool NAV::FlowCheckpoint::IsEnabled() noexcept
+{
+    return _enabled.load(std::memory_order_relaxed);
+}
+
+void NAV::FlowCheckpoint::Update()
+{
+    if (!IsEnabled()) { return; }
+
+    std::unique_lock lk(_mutex);
+    if (_phase == Phase::Approaching)
+    {
+        bool anyPaused = false;
+        for (const auto& [node, provider] : _providers)
+        {
+            if (!provider.paused && !provider.finished) { return; }
+            anyPaused |= provider.paused;
+        }
+        if (!anyPaused)
+        {
+            LOG_DEBUG("All data providers finished. No more checkpoints are written.");
+            disable();
+            lk.unlock();
+            wakeAllWorkers();
+            return;
+        }
+
+        LOG_DEBUG("All data providers reached the checkpoint at {}", _checkpointTime.toYMDHMS(GPST));
+        _phase = Phase::Draining;
+        _lastIdleActivity.reset();
+        lk.unlock();
+        wakeAllWorkers(); // Nodes waiting for data on other pins can process everything before the checkpoint now
+        return;
+    }
+    if (_phase != Phase::Draining) { return; }
+
+    // The flow is idle, if no worker is processing or about to process and no worker started processing since the last check
+    size_t activity = 0;
+    for (Node* node : nm::m_Nodes())
+    {
+        if (node == nullptr || node->kind == Node::Kind::GroupBox || !node->isInitialized()) { continue; }
+
+        std::scoped_lock workerLock(node->_workerMutex);
+        if (node->_workerWakeup || node->_workerBusy)
+        {
+            _lastIdleActivity.reset();
+            return;
+        }
+        activity += node->_workerActivity;
+    }
+    if (_lastIdleActivity != activity)
+    {
+        _lastIdleActivity = activity;
+        return;
+    }
+
+    if (!writeCheckpoint())
+    {
+        disable();
+        lk.unlock();
+        wakeAllWorkers();
+        return;
+    }
+
+    InsTime earliestPause;
+    for (auto& [node, provider] : _providers)
+    {
+        if (provider.paused && (earliestPause.empty() || provider.pauseTime < earliestPause)) { earliestPause = provider.pauseTime; }
+        provider.paused = false;
+    }
+    _checkpointTime = nextCheckpointTime(earliestPause);
+    _phase = Phase::Approaching;
+    lk.unlock();
+    wakeAllWorkers();
+}
+
+bool NAV::FlowCheckpoint::HoldsBack(const InsTime& insTime)
+{
+    if (!IsEnabled() || insTime.empty()) { return false; }
+
+    std::scoped_lock lk(_mutex);
+    return _phase != Phase::Off && (_checkpointTime.empty() || insTime >= _checkpointTime);
+}
+
+bool NAV::FlowCheckpoint::IsDraining(const InsTime& insTime)
+{
+    if (!IsEnabled() || insTime.empty()) { return false; }
+
+    std::scoped_lock lk(_mutex);
+    return _phase == Phase::Draining && insTime < _checkpointTime;
+}
+
+bool NAV::FlowCheckpoint::IsPaused(const Node* node)
+{
+    if (!IsEnabled()) { return false; }
+
+    std::scoped_lock lk(_mutex);
+    auto provider = _providers.find(node);
+    return provider != _providers.end() && provider->second.paused;
+}
+
+bool NAV::FlowCheckpoint::PauseProvider(const Node* node, const InsTime& insTime)
+{
+    if (!IsEnabled() || insTime.empty()) { return false; }
+
+    std::scoped_lock lk(_mutex);
+    auto provider = _providers.find(node);
+    if (_phase == Phase::Off || provider == _providers.end()) { return false; }
+
+    if (_checkpointTime.empty())
+    {
+        _checkpointTime = nextCheckpointTime(insTime);
+        LOG_DEBUG("The first checkpoint is written at {}", _checkpointTime.toYMDHMS(GPST));
+    }
+    if (insTime < _checkpointTime) { return false; }
+
+    if (!provider->second.paused)
+    {
+        LOG_DATA("{}: Pausing at {} for the checkpoint", node->nameId(), insTime.toYMDHMS(GPST));
+        provider->second.paused = true;
+        provider->second.pauseTime = insTime;
+    }
+    return true;
+}
+
+void NAV::FlowCheckpoint::NodeFinished(const Node* node)
+{
+    if (!IsEnabled()) { return; }
+
+    std::scoped_lock lk(_mutex);
+    if (auto provider = _providers.find(node); provider != _providers.end())
+    {
+        provider->second.finished = true;
+    }
+}
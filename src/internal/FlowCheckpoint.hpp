@@ -0,0 +1,95 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file FlowCheckpoint.hpp
+/// @brief Checkpoints of the runtime state of all nodes during post-processing and resuming from them
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-15
+///
+/// Checkpoints are taken at multiples of the interval in data time (GPS time). When the data reaches the next checkpoint time,
+/// - the data providers pause before sending observations at or after this time,
+/// - all other nodes hold back observations at or after this time and process everything before it,
+/// - the state of all nodes is written into the checkpoint file as soon as all worker threads are idle.
+///
+/// Observations which are still queued at this point are discarded on resume, because the data providers restore the file position before them.
+/// This assumes that nodes do not produce output with a time later than the input they are processing.
+
+#pragma once
+
+#include <chrono>
+#include <optional>
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json; ///< json namespace
+
+namespace NAV
+{
+class Node;
+class InsTime;
+
+namespace FlowCheckpoint
+{
+
+/// Interval in which the FlowExecutor checks the progress of a pending checkpoint
+constexpr std::chrono::milliseconds UPDATE_INTERVAL{ 10 };
+
+/// @brief Checks the program options whether checkpoints should be written in the next execution
+[[nodiscard]] bool IsRequested();
+
+/// @brief Checks the program options whether the next execution resumes from the checkpoint file
+/// @note Resuming is only possible in post-processing mode, so flows with real-time nodes never resume
+[[nodiscard]] bool IsResuming();
+
+/// @brief Reads the checkpoint file to resume from. Called by the FlowExecutor before initializing the nodes.
+/// @return True if the file could be read
+bool LoadResume();
+
+/// @brief Restores the runtime state of the node from the loaded checkpoint. Called by the FlowExecutor after resetting the node.
+/// @param[in, out] node Node to restore
+/// @return True if the state could be restored
+bool Restore(Node* node);
+
+/// @brief Starts taking checkpoints if requested. Called by the FlowExecutor after all nodes were reset.
+/// @param[in] postProcessing Whether the flow executes in post-processing mode (checkpoints are not available in real-time mode)
+void Start(bool postProcessing);
+
+/// @brief Stops taking checkpoints. Called by the FlowExecutor after the execution finished.
+void Stop();
+
+/// @brief Checks if checkpoints are taken in the current execution
+[[nodiscard]] bool IsEnabled() noexcept;
+
+/// @brief Writes the pending checkpoint as soon as all nodes are idle. Called periodically by the FlowExecutor while waiting for the nodes.
+void Update();
+
+/// @brief Checks whether a node has to hold back data of this time, because a checkpoint is pending before it
+/// @param[in] insTime Time of the data
+[[nodiscard]] bool HoldsBack(const InsTime& insTime);
+
+/// @brief Checks whether data of this time can be processed without waiting for data on the other input pins,
+///        because all data providers reached the pending checkpoint and no earlier data will arrive anymore
+/// @param[in] insTime Time of the data
+[[nodiscard]] bool IsDraining(const InsTime& insTime);
+
+/// @brief Checks whether the data provider paused at the pending checkpoint
+/// @param[in] node Data provider
+[[nodiscard]] bool IsPaused(const Node* node);
+
+/// @brief Called by data providers for the time of every observation. Pauses the provider if the observation is at or after the pending checkpoint.
+/// @param[in] node Data provider
+/// @param[in] insTime Time of the observation
+/// @return True if the provider has to pause
+bool PauseProvider(const Node* node, const InsTime& insTime);
+
+/// @brief Called by the FlowExecutor when a node finished sending data
+/// @param[in] node The finished node
+void NodeFinished(const Node* node);
+
+} // namespace FlowCheckpoint
+
+} // namespace NAV
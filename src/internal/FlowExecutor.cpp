@@ -13,6 +13,8 @@
 #include "Navigation/Time/InsTime.hpp"
 
 #include "internal/Node/Node.hpp"
+#include "internal/FlowCheckpoint.hpp"
+#include "internal/FlowProfiler.hpp"
 
 #include "internal/NodeManager.hpp"
 namespace nm = NAV::NodeManager;
@@ -110,6 +112,18 @@ void NAV::FlowExecutor::stop()
     if (_thd.joinable()) { _thd.join(); }
 }
 
+void NAV::FlowExecutor::requestStop()
+{
+    LOG_TRACE("called");
+
+    std::scoped_lock<std::mutex> lk(_mutex);
+    if (_state == State::Running || _state == State::Starting)
+    {
+        _state = State::Stopping;
+        _cv.notify_all();
+    }
+}
+
 void NAV::FlowExecutor::waitForFinish()
 {
     LOG_TRACE("Waiting for finish of FlowExecutor...");
@@ -128,6 +142,7 @@ void NAV::FlowExecutor::waitForFinish()
 void NAV::FlowExecutor::deregisterNode([[maybe_unused]] const Node* node)
 {
     LOG_DEBUG("Node {} finished.", node->nameId());
+    FlowCheckpoint::NodeFinished(node);
     _activeNodes--;
 
     if (_activeNodes == 0)
@@ -154,6 +169,14 @@ void NAV::FlowExecutor::execute()
         node->pollEvents.clear();
     }
 
+    if (FlowCheckpoint::IsResuming() && !FlowCheckpoint::LoadResume())
+    {
+        std::scoped_lock<std::mutex> lk(_mutex);
+        _state = State::Idle;
+        _cv.notify_all();
+        return;
+    }
+
     if (!nm::InitializeAllNodes()) // This wakes the threads
     {
         std::scoped_lock<std::mutex> lk(_mutex);
@@ -190,6 +213,12 @@ void NAV::FlowExecutor::execute()
             std::scoped_lock<std::mutex> guard(node->_configWindowMutex);
             node->resetNode();
         }
+        if (!realTimeMode && FlowCheckpoint::IsResuming() && !FlowCheckpoint::Restore(node))
+        {
+            std::scoped_lock<std::mutex> lk(_mutex);
+            _state = State::Stopping;
+            break;
+        }
         for (size_t i = 0; i < node->outputPins.size(); i++) // for (auto& outputPin : node->outputPins)
         {
             auto& outputPin = node->outputPins[i];
@@ -222,6 +251,9 @@ void NAV::FlowExecutor::execute()
         }
     }
 
+    FlowCheckpoint::Start(!realTimeMode);
+    FlowProfiler::Start();
+
     {
         std::scoped_lock<std::mutex> lk(_mutex);
         if (_state == State::Starting)
@@ -260,6 +292,14 @@ void NAV::FlowExecutor::execute()
                 break;
             }
 
+            if (FlowCheckpoint::IsEnabled())
+            {
+                if (_cv.wait_for(lk, FlowCheckpoint::UPDATE_INTERVAL, [] { return _state == State::Stopping; })) { break; }
+                lk.unlock();
+                FlowCheckpoint::Update();
+                continue;
+            }
+
             timeout = !_cv.wait_for(lk, timeoutDuration, [] { return _state == State::Stopping; });
             if (timeout && _activeNodes == 0)
             {
@@ -274,6 +314,7 @@ void NAV::FlowExecutor::execute()
 
     // Deinitialize
     LOG_DEBUG("Stopping FlowExecutor...");
+    FlowCheckpoint::Stop();
     nm::DisableAllCallbacks();
     nm::ClearAllNodeQueues();
 
@@ -297,6 +338,8 @@ void NAV::FlowExecutor::execute()
         LOG_INFO("Elapsed time: {} s", elapsed.count());
     }
 
+    FlowProfiler::Stop();
+
     _activeNodes = 0;
     LOG_TRACE("FlowExecutor deinitialized.");
     {
@@ -30,6 +30,9 @@ void start();
 /// @brief Stops the Thread
 void stop();
 
+/// @brief Requests the Thread to stop without waiting for it. Can be called from node threads.
+void requestStop();
+
 /// @brief Waits for a thread to finish its execution
 void waitForFinish();
 
@@ -0,0 +1,257 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "FlowProfiler.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <fstream>
+
+#include "internal/ConfigManager.hpp"
+#include "internal/FlowManager.hpp"
+#include "internal/Node/Node.hpp"
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+
+#include "util/Atomic.hpp"
+#include "util/Logger.hpp"
+#include "util/StringUtil.hpp"
+
+namespace
+{
+
+/// Flag whether profiling is active in the current execution
+std::atomic<bool> _enabled = false;
+
+/// Start of the execution. All trace events are relative to this.
+NAV::FlowProfiler::Clock::time_point _startTime;
+
+/// Maximum amount of trace events recorded per node (limits the memory usage on long runs)
+constexpr size_t MAX_TRACE_EVENTS_PER_NODE = 500'000;
+
+} // namespace
+
+/* -------------------------------------------------------------------------------------------------------- */
+/*                                             DurationHistogram                                            */
+/* -------------------------------------------------------------------------------------------------------- */
+
+void NAV::FlowProfiler::DurationHistogram::add(std::chrono::nanoseconds duration)
+{
+    auto us = static_cast<uint64_t>(std::max(std::chrono::duration_cast<std::chrono::microseconds>(duration).count(), int64_t(0)));
+    size_t bin = std::min(static_cast<size_t>(std::bit_width(us)), BINS - 1);
+    _counts.at(bin).fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t NAV::FlowProfiler::DurationHistogram::count() const
+{
+    uint64_t sum = 0;
+    for (const auto& count : _counts) { sum += count.load(std::memory_order_relaxed); }
+    return sum;
+}
+
+std::chrono::microseconds NAV::FlowProfiler::DurationHistogram::quantile(double quantile) const
+{
+    auto total = count();
+    if (total == 0) { return std::chrono::microseconds(0); }
+
+    auto target = static_cast<uint64_t>(std::ceil(quantile * static_cast<double>(total)));
+    uint64_t sum = 0;
+    for (size_t i = 0; i < BINS; i++)
+    {
+        sum += _counts.at(i).load(std::memory_order_relaxed);
+        if (sum >= target) { return std::chrono::microseconds(uint64_t(1) << i); }
+    }
+    return std::chrono::microseconds(uint64_t(1) << (BINS - 1));
+}
+
+void NAV::FlowProfiler::DurationHistogram::reset()
+{
+    for (auto& count : _counts) { count.store(0, std::memory_order_relaxed); }
+}
+
+/* -------------------------------------------------------------------------------------------------------- */
+/*                                         PinStatistics/NodeStatistics                                     */
+/* -------------------------------------------------------------------------------------------------------- */
+
+void NAV::FlowProfiler::PinStatistics::addCallback(std::chrono::nanoseconds duration)
+{
+    messagesProcessed.fetch_add(1, std::memory_order_relaxed);
+    callbackTimeTotal.fetch_add(static_cast<uint64_t>(duration.count()), std::memory_order_relaxed);
+    atomicMax(callbackTimeMax, static_cast<uint64_t>(duration.count()));
+    callbackTime.add(duration);
+}
+
+void NAV::FlowProfiler::PinStatistics::updateQueueDepth(size_t queueSize)
+{
+    atomicMax(queueHighWaterMark, queueSize);
+}
+
+NAV::FlowProfiler::NodeStatistics::NodeStatistics(size_t nInputPins, bool recordTrace)
+    : inputPins(nInputPins), recordTrace(recordTrace) {}
+
+void NAV::FlowProfiler::NodeStatistics::addCallback(size_t pinIdx, Clock::time_point start, Clock::time_point end, bool notify)
+{
+    if (pinIdx < inputPins.size())
+    {
+        inputPins[pinIdx].addCallback(end - start);
+    }
+    if (recordTrace && trace.size() < MAX_TRACE_EVENTS_PER_NODE)
+    {
+        trace.push_back(TraceEvent{ std::chrono::duration_cast<std::chrono::nanoseconds>(start - _startTime).count(),
+                                    std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(),
+                                    static_cast<int32_t>(pinIdx),
+                                    notify });
+    }
+}
+
+void NAV::FlowProfiler::NodeStatistics::beginTemporalSortBlock()
+{
+    if (blockedSince == Clock::time_point{})
+    {
+        blockedSince = Clock::now();
+        temporalSortBlockCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void NAV::FlowProfiler::NodeStatistics::endTemporalSortBlock()
+{
+    if (blockedSince != Clock::time_point{})
+    {
+        temporalSortBlocked.fetch_add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - blockedSince).count()),
+                                      std::memory_order_relaxed);
+        blockedSince = Clock::time_point{};
+    }
+}
+
+/* -------------------------------------------------------------------------------------------------------- */
+/*                                                 Functions                                                */
+/* -------------------------------------------------------------------------------------------------------- */
+
+bool NAV::FlowProfiler::IsRequested()
+{
+    return ConfigManager::Get<bool>("profile", false) || ConfigManager::HasKey("profile-trace");
+}
+
+bool NAV::FlowProfiler::IsEnabled()
+{
+    return _enabled;
+}
+
+void NAV::FlowProfiler::Start()
+{
+    _enabled = IsRequested();
+    bool recordTrace = ConfigManager::HasKey("profile-trace");
+    LOG_DEBUG("Flow profiling is {}", _enabled ? (recordTrace ? "enabled with trace" : "enabled") : "disabled");
+
+    for (Node* node : nm::m_Nodes())
+    {
+        if (node == nullptr) { continue; }
+        auto stats = _enabled ? std::make_shared<NodeStatistics>(node->inputPins.size(), recordTrace) : nullptr;
+        if (stats && recordTrace)
+        {
+            stats->trace.reserve(4096);
+        }
+        std::atomic_store(&node->_statistics, std::move(stats));
+    }
+    _startTime = Clock::now();
+}
+
+void NAV::FlowProfiler::Stop()
+{
+    if (!_enabled) { return; }
+
+    LogSummary();
+
+    if (ConfigManager::HasKey("profile-trace"))
+    {
+        std::filesystem::path path = ConfigManager::Get<std::string>("profile-trace");
+        if (path.is_relative())
+        {
+            path = flow::GetOutputPath() / path;
+        }
+        if (WriteChromeTrace(path))
+        {
+            LOG_INFO("Wrote flow trace to {}", path);
+        }
+    }
+    _enabled = false;
+}
+
+void NAV::FlowProfiler::LogSummary()
+{
+    LOG_INFO("Flow profile (callback times in µs, quantiles are upper bin bounds):");
+    LOG_INFO("{:<40} {:<20} {:>10} {:>10} {:>8} {:>8} {:>10} {:>8}",
+             "Node", "Pin", "Messages", "Mean", "P50", "P99", "Max", "Queue");
+    for (const Node* node : nm::m_Nodes())
+    {
+        const auto& stats = node ? node->getStatistics() : nullptr;
+        if (stats == nullptr) { continue; }
+
+        std::string nodeName = node->nameId();
+        for (size_t i = 0; i < stats->inputPins.size() && i < node->inputPins.size(); i++)
+        {
+            const auto& pinStats = stats->inputPins[i];
+            auto messages = pinStats.messagesProcessed.load(std::memory_order_relaxed);
+            if (messages == 0 && pinStats.queueHighWaterMark == 0) { continue; }
+
+            [[maybe_unused]] double meanUs = messages == 0 ? 0.0 : static_cast<double>(pinStats.callbackTimeTotal.load()) / static_cast<double>(messages) * 1e-3;
+            LOG_INFO("{:<40} {:<20} {:>10} {:>10.2f} {:>8} {:>8} {:>10.1f} {:>8}",
+                     nodeName, str::replaceAll_copy(node->inputPins[i].name, "\n", " "), messages, meanUs,
+                     pinStats.callbackTime.quantile(0.5).count(), pinStats.callbackTime.quantile(0.99).count(),
+                     static_cast<double>(pinStats.callbackTimeMax.load()) * 1e-3, pinStats.queueHighWaterMark.load());
+            nodeName.clear(); // Only print the node name in the first line
+        }
+        LOG_INFO("{:<40} wakeups: {}, waiting for temporal sorting: {:.3f} s ({} times)",
+                 nodeName.empty() ? "" : nodeName, stats->wakeups.load(),
+                 static_cast<double>(stats->temporalSortBlocked.load()) * 1e-9, stats->temporalSortBlockCount.load());
+    }
+}
+
+bool NAV::FlowProfiler::WriteChromeTrace(const std::filesystem::path& path)
+{
+    std::ofstream filestream(path);
+    if (!filestream.good())
+    {
+        LOG_ERROR("Could not open the trace file: {}", path);
+        return false;
+    }
+
+    // See https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU for the format
+    filestream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    bool first = true;
+    for (const Node* node : nm::m_Nodes())
+    {
+        const auto& stats = node ? node->getStatistics() : nullptr;
+        if (stats == nullptr) { continue; }
+
+        auto tid = size_t(node->id);
+        std::string nodeName = str::replaceAll_copy(node->nameId(), "\"", "'");
+        filestream << (first ? "" : ",\n")
+                   << fmt::format(R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":"{}"}}}})", tid, nodeName);
+        first = false;
+
+        for (const auto& event : stats->trace)
+        {
+            std::string pinName = event.pinIdx >= 0 && static_cast<size_t>(event.pinIdx) < node->inputPins.size()
+                                      ? str::replaceAll_copy(str::replaceAll_copy(node->inputPins.at(static_cast<size_t>(event.pinIdx)).name, "\n", " "), "\"", "'")
+                                      : "poll";
+            filestream << ",\n"
+                       << fmt::format(R"({{"name":"{}","cat":"{}","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+                                      pinName, event.notify ? "notify" : "flow", tid,
+                                      static_cast<double>(event.start) * 1e-3, static_cast<double>(event.dur) * 1e-3);
+        }
+        if (stats->trace.size() >= MAX_TRACE_EVENTS_PER_NODE)
+        {
+            LOG_WARN("{}: Trace was truncated after {} events", node->nameId(), MAX_TRACE_EVENTS_PER_NODE);
+        }
+    }
+    filestream << "\n]}\n";
+
+    return true;
+}
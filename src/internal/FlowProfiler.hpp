@@ -0,0 +1,143 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file FlowProfiler.hpp
+/// @brief Runtime statistics and tracing of nodes and pins during flow execution
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-07
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace NAV
+{
+class Node;
+
+namespace FlowProfiler
+{
+
+/// Clock used for all measurements
+using Clock = std::chrono::steady_clock;
+
+/// @brief Histogram of durations with logarithmic bins. Bin 0 holds durations below 1 µs, bin i durations in [2^(i-1), 2^i) µs.
+class DurationHistogram
+{
+  public:
+    /// Amount of bins (last bin holds all durations above ~4 s)
+    static constexpr size_t BINS = 24;
+
+    /// @brief Adds a duration to the histogram
+    /// @param[in] duration Duration to add
+    void add(std::chrono::nanoseconds duration);
+
+    /// @brief Total amount of entries in the histogram
+    [[nodiscard]] uint64_t count() const;
+
+    /// @brief Returns the upper bound of the bin containing the requested quantile
+    /// @param[in] quantile Quantile in the range [0, 1]
+    [[nodiscard]] std::chrono::microseconds quantile(double quantile) const;
+
+    /// @brief Removes all entries from the histogram
+    void reset();
+
+  private:
+    /// Counts per bin
+    std::array<std::atomic<uint64_t>, BINS> _counts{};
+};
+
+/// @brief Statistics of a single input pin
+struct PinStatistics
+{
+    std::atomic<uint64_t> messagesProcessed{ 0 }; ///< Amount of callbacks invoked on the pin
+    std::atomic<uint64_t> callbackTimeTotal{ 0 }; ///< Sum of all callback durations [ns]
+    std::atomic<uint64_t> callbackTimeMax{ 0 };   ///< Maximum callback duration [ns]
+    DurationHistogram callbackTime;               ///< Histogram of the callback durations
+    std::atomic<size_t> queueHighWaterMark{ 0 };  ///< Maximum amount of messages waiting in the queue
+
+    /// @brief Records a callback invocation
+    /// @param[in] duration Duration of the callback
+    void addCallback(std::chrono::nanoseconds duration);
+
+    /// @brief Updates the queue high-water mark. Called by the threads pushing data into the queue.
+    /// @param[in] queueSize Current size of the queue
+    void updateQueueDepth(size_t queueSize);
+};
+
+/// @brief Single event on the timeline
+struct TraceEvent
+{
+    int64_t start;   ///< Start of the event relative to the execution start [ns]
+    int64_t dur;     ///< Duration of the event [ns]
+    int32_t pinIdx;  ///< Index of the input pin the callback was called on (-1 for polling output pins)
+    bool notify;     ///< Whether this was a notify callback on a non-flow pin
+};
+
+/// @brief Statistics of a single node
+struct NodeStatistics
+{
+    /// @brief Constructor
+    /// @param[in] nInputPins Amount of input pins of the node
+    /// @param[in] recordTrace Whether events on the timeline should be recorded
+    NodeStatistics(size_t nInputPins, bool recordTrace);
+
+    std::vector<PinStatistics> inputPins;             ///< Statistics of the input pins
+    std::atomic<uint64_t> wakeups{ 0 };               ///< Amount of worker thread wakeups
+    std::atomic<uint64_t> temporalSortBlocked{ 0 };   ///< Time the worker waited for data on other pins for temporal sorting [ns]
+    std::atomic<uint64_t> temporalSortBlockCount{ 0 }; ///< Amount of times the worker waited for data on other pins
+
+    /// Time since when the node waits for data for temporal sorting (only accessed by the worker thread)
+    Clock::time_point blockedSince;
+    /// Whether the trace events should be recorded
+    bool recordTrace = false;
+    /// Events on the timeline (only accessed by the worker thread during execution)
+    std::vector<TraceEvent> trace;
+
+    /// @brief Records a callback invocation
+    /// @param[in] pinIdx Index of the input pin
+    /// @param[in] start Start time of the callback
+    /// @param[in] end End time of the callback
+    /// @param[in] notify Whether this was a notify callback on a non-flow pin
+    void addCallback(size_t pinIdx, Clock::time_point start, Clock::time_point end, bool notify);
+
+    /// @brief Marks the worker as waiting for data on other pins for temporal sorting
+    void beginTemporalSortBlock();
+
+    /// @brief Marks the worker as not waiting for data anymore
+    void endTemporalSortBlock();
+};
+
+/// @brief Checks the program options whether profiling should be enabled for the next execution
+[[nodiscard]] bool IsRequested();
+
+/// @brief Checks if profiling is active in the current execution
+[[nodiscard]] bool IsEnabled();
+
+/// @brief Creates new statistics for all nodes. Called by the FlowExecutor before enabling the callbacks.
+void Start();
+
+/// @brief Logs the summary and writes the trace file if requested. Called by the FlowExecutor after the execution finished.
+void Stop();
+
+/// @brief Logs a summary table of all node and pin statistics
+void LogSummary();
+
+/// @brief Writes the recorded events as Chrome trace (also readable by Perfetto)
+/// @param[in] path Path of the file to write
+/// @return True if the file could be written
+bool WriteChromeTrace(const std::filesystem::path& path);
+
+} // namespace FlowProfiler
+
+} // namespace NAV
@@ -9,15 +9,19 @@
 #include "Node.hpp"
 
 #include <stdexcept>
+#include <limits>
 
 #include "util/StringUtil.hpp"
 #include "util/Assert.h"
 
+#include "internal/FlowCheckpoint.hpp"
 #include "internal/FlowExecutor.hpp"
+#include "internal/FlowProfiler.hpp"
 #include "internal/gui/FlowAnimation.hpp"
 #include "internal/NodeManager.hpp"
 namespace nm = NAV::NodeManager;
 #include "util/Json.hpp"
+#include "util/Time/TimeBase.hpp"
 
 #include <imgui_node_editor.h>
 namespace ed = ax::NodeEditor;
@@ -70,6 +74,31 @@ void NAV::Node::deinitialize() {}
 
 void NAV::Node::flush() {}
 
+void NAV::Node::finalizePostProcessing() {}
+
+std::optional<json> NAV::Node::saveCheckpoint()
+{
+    // Nodes which neither receive data (flow data or change notifications) nor poll flow data have no runtime state
+    if (std::none_of(inputPins.begin(), inputPins.end(), [](const InputPin& inputPin) {
+            if (!inputPin.isPinLinked()) { return false; }
+            if (inputPin.type == Pin::Type::Flow) { return true; }
+            const auto* notifyFunc = std::get_if<InputPin::DataChangedNotifyFunc>(&inputPin.callback);
+            return notifyFunc != nullptr && *notifyFunc != nullptr;
+        })
+        && std::none_of(outputPins.begin(), outputPins.end(), [](const OutputPin& outputPin) {
+               return std::holds_alternative<OutputPin::PollDataFunc>(outputPin.data) || std::holds_alternative<OutputPin::PeekPollDataFunc>(outputPin.data);
+           }))
+    {
+        return json::object();
+    }
+    return std::nullopt;
+}
+
+bool NAV::Node::restoreCheckpoint(const json& /* j */)
+{
+    return saveCheckpoint().has_value();
+}
+
 bool NAV::Node::resetNode()
 {
     LOG_TRACE("{}: called", nameId());
@@ -105,15 +134,16 @@ void NAV::Node::notifyOutputValueChanged(size_t pinIdx, const InsTime& insTime,
                 link.dataChangeNotification = true;
                 LOG_DATA("{}: Increasing data access counter on output pin '{}'. Value now {}.", nameId(), outputPin.name, outputPin.dataAccessCounter);
 
-                if (nm::showFlowWhenNotifyingValueChange)
-                {
-                    FlowAnimation::Add(link.linkId);
-                }
+                FlowAnimation::AddNotification(*link.activity);
 
                 auto data = std::make_shared<NodeData>();
                 data->insTime = insTime;
 
                 targetPin->queue.push_back(data);
+                if (auto stats = std::atomic_load(&link.connectedNode->_statistics))
+                {
+                    stats->inputPins.at(static_cast<size_t>(targetPin - link.connectedNode->inputPins.data())).updateQueueDepth(targetPin->queue.size());
+                }
             }
         }
         for (const auto& link : outputPin.links)
@@ -182,18 +212,26 @@ void NAV::Node::invokeCallbacks(size_t portIndex, const std::shared_ptr<const NA
             LOG_DATA("{}: Tried to invokeCallbacks on pin {} without a InsTime. The time is mandatory though!!! ", nameId(), portIndex);
             return;
         }
+        if (_mode == Mode::REAL_TIME && _realTimeSettingsActive.monitorLatency)
+        {
+            if (auto currentTime = util::time::GetCurrentInsTime(); !currentTime.empty())
+            {
+                _realTimeStatistics.addLatency(std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - data->insTime));
+            }
+        }
 
         for (const auto& link : outputPins.at(portIndex).links)
         {
             auto* targetPin = link.getConnectedPin();
             if (link.connectedNode->isInitialized() && !targetPin->queueBlocked)
             {
-                if (NodeManager::showFlowWhenNotifyingValueChange)
-                {
-                    FlowAnimation::Add(link.linkId);
-                }
+                FlowAnimation::AddCallback(*link.activity);
 
                 targetPin->queue.push_back(data);
+                if (auto stats = std::atomic_load(&link.connectedNode->_statistics))
+                {
+                    stats->inputPins.at(static_cast<size_t>(targetPin - link.connectedNode->inputPins.data())).updateQueueDepth(targetPin->queue.size());
+                }
                 LOG_DATA("{}: Waking up worker of node '{}'. New data on pin '{}'", nameId(), link.connectedNode->nameId(), targetPin->name);
                 link.connectedNode->wakeWorker();
             }
@@ -497,6 +535,11 @@ bool NAV::Node::isInitialized() const
     std::scoped_lock lk(_stateMutex);
     return _state == State::Initialized;
 }
+bool NAV::Node::isReinitializing() const
+{
+    std::scoped_lock lk(_stateMutex);
+    return (_state == State::DoDeinitialize || _state == State::Deinitializing) && _reinitialize;
+}
 bool NAV::Node::isTransient() const
 {
     std::scoped_lock lk(_stateMutex);
@@ -522,6 +565,26 @@ bool NAV::Node::isOnlyRealtime() const
     return _onlyRealTime;
 }
 
+std::shared_ptr<NAV::FlowProfiler::NodeStatistics> NAV::Node::getStatistics() const
+{
+    return std::atomic_load(&_statistics);
+}
+
+const NAV::RealTime::Statistics& NAV::Node::getRealTimeStatistics() const
+{
+    return _realTimeStatistics;
+}
+
+void NAV::Node::addRealTimeProcessing(std::chrono::nanoseconds duration)
+{
+    if (_realTimeStatistics.addProcessing(duration, _realTimeSettingsActive.budget)
+        && _realTimeStatistics.deadlineMisses.load(std::memory_order_relaxed) == 1)
+    {
+        LOG_WARN("{}: Processing a message took {} µs, which exceeds the budget of {} µs. Further deadline misses are only counted in the statistics.",
+                 nameId(), std::chrono::duration_cast<std::chrono::microseconds>(duration).count(), _realTimeSettingsActive.budget.count());
+    }
+}
+
 void NAV::Node::workerThread(Node* node)
 {
     LOG_TRACE("{}: Worker thread started.", node->nameId());
@@ -572,13 +635,20 @@ void NAV::Node::workerThread(Node* node)
             bool timeout = false;
             {
                 std::unique_lock lk(node->_workerMutex);
+                node->_workerBusy = false;
                 timeout = !node->_workerConditionVariable.wait_for(lk, node->_workerTimeout, [node] { return node->_workerWakeup; });
                 node->_workerWakeup = false;
+                node->_workerBusy = true;
+                node->_workerActivity++;
             }
             LOG_DATA("{}: Worker woke up", node->nameId());
 
             if (node->isInitialized() && (node->callbacksEnabled || node->_mode == Node::Mode::REAL_TIME))
             {
+                auto stats = node->callbacksEnabled ? std::atomic_load(&node->_statistics) : nullptr;
+                if (stats) { stats->wakeups.fetch_add(1, std::memory_order_relaxed); }
+                bool realTime = node->_mode == Node::Mode::REAL_TIME;
+
                 if (timeout && node->callbacksEnabled) // Timeout reached
                 {
                     node->workerTimeoutHandler();
@@ -598,6 +668,11 @@ void NAV::Node::workerThread(Node* node)
                             auto& inputPin = node->inputPins[i];
                             if (inputPin.type != Pin::Type::Flow && !inputPin.queue.empty())
                             {
+                                if (FlowCheckpoint::HoldsBack(inputPin.queue.front()->insTime))
+                                {
+                                    LOG_DATA("{}: Holding back notification on input pin '{}' for the pending checkpoint", node->nameId(), inputPin.name);
+                                    continue;
+                                }
                                 if (auto callback = std::get<InputPin::DataChangedNotifyFunc>(inputPin.callback))
                                 {
                                     LOG_DATA("{}: Invoking notify callback on input pin '{}'", node->nameId(), inputPin.name);
@@ -611,7 +686,18 @@ void NAV::Node::workerThread(Node* node)
                                         }
                                     }
 #endif
-                                    std::invoke(callback, node, insTime, i);
+                                    if (stats || realTime)
+                                    {
+                                        auto start = FlowProfiler::Clock::now();
+                                        std::invoke(callback, node, insTime, i);
+                                        auto end = FlowProfiler::Clock::now();
+                                        if (stats) { stats->addCallback(i, start, end, true); }
+                                        if (realTime) { node->addRealTimeProcessing(end - start); }
+                                    }
+                                    else
+                                    {
+                                        std::invoke(callback, node, insTime, i);
+                                    }
                                     notifyTriggered = true;
                                 }
                             }
@@ -639,12 +725,28 @@ void NAV::Node::workerThread(Node* node)
                                         }
                                     }
                                 }
+                                if (!allInputPinsHaveData && FlowCheckpoint::IsEnabled())
+                                {
+                                    // All data before a pending checkpoint was sent already, so no earlier data can arrive on the other pins
+                                    InsTime earliestQueuedTime;
+                                    for (const auto& inputPin : node->inputPins)
+                                    {
+                                        if (inputPin.type == Pin::Type::Flow && !inputPin.queue.empty()
+                                            && (earliestQueuedTime.empty() || inputPin.queue.front()->insTime < earliestQueuedTime))
+                                        {
+                                            earliestQueuedTime = inputPin.queue.front()->insTime;
+                                        }
+                                    }
+                                    allInputPinsHaveData = FlowCheckpoint::IsDraining(earliestQueuedTime);
+                                }
                                 if (!allInputPinsHaveData)
                                 {
                                     LOG_DATA("{}: Not all pins have data for temporal sorting", node->nameId());
+                                    if (stats) { stats->beginTemporalSortBlock(); }
                                     break;
                                 }
                                 LOG_DATA("{}: All pins have data for temporal sorting", node->nameId());
+                                if (stats) { stats->endTemporalSortBlock(); }
                             }
 
                             // Find pin with the earliest data
@@ -665,6 +767,11 @@ void NAV::Node::workerThread(Node* node)
                                 }
                             }
                             if (earliestInputPinPriority == -1000) { break; }
+                            if (FlowCheckpoint::HoldsBack(earliestTime))
+                            {
+                                LOG_DATA("{}: Holding back data at {} for the pending checkpoint", node->nameId(), earliestTime.toYMDHMS(GPST));
+                                break;
+                            }
 
                             auto& inputPin = node->inputPins[earliestInputPinIdx];
                             if (inputPin.firable && inputPin.firable(node, inputPin))
@@ -681,7 +788,18 @@ void NAV::Node::workerThread(Node* node)
                                         }
                                     }
 #endif
-                                    std::invoke(callback, node, inputPin.queue, earliestInputPinIdx);
+                                    if (stats || realTime)
+                                    {
+                                        auto start = FlowProfiler::Clock::now();
+                                        std::invoke(callback, node, inputPin.queue, earliestInputPinIdx);
+                                        auto end = FlowProfiler::Clock::now();
+                                        if (stats) { stats->addCallback(earliestInputPinIdx, start, end, false); }
+                                        if (realTime) { node->addRealTimeProcessing(end - start); }
+                                    }
+                                    else
+                                    {
+                                        std::invoke(callback, node, inputPin.queue, earliestInputPinIdx);
+                                    }
                                 }
                             }
                             else if (inputPin.dropQueueIfNotFirable)
@@ -712,17 +830,23 @@ void NAV::Node::workerThread(Node* node)
                         size_t outputPinIdx = it->second.second;
                         Node* node = outputPin->parentNode;
 
+                        if (FlowCheckpoint::IsPaused(node)) { break; }
+
                         if (std::holds_alternative<OutputPin::PollDataFunc>(outputPin->data))
                         {
                             auto* callback = std::get_if<OutputPin::PollDataFunc>(&outputPin->data);
                             if (callback != nullptr && *callback != nullptr)
                             {
                                 LOG_DATA("{}: Polling data from output pin '{}'", node->nameId(), str::replaceAll_copy(outputPin->name, "\n", ""));
-                                if ((node->**callback)() == nullptr)
+                                auto start = stats ? FlowProfiler::Clock::now() : FlowProfiler::Clock::time_point{};
+                                auto obs = (node->**callback)();
+                                if (stats) { stats->addCallback(std::numeric_limits<size_t>::max(), start, FlowProfiler::Clock::now(), false); }
+                                if (obs == nullptr)
                                 {
                                     node->pollEvents.erase(it); // Delete the event if no more data on this pin
                                     break;
                                 }
+                                if (FlowCheckpoint::PauseProvider(node, obs->insTime)) { break; }
                             }
                         }
                         else if (std::holds_alternative<OutputPin::PeekPollDataFunc>(outputPin->data))
@@ -730,11 +854,15 @@ void NAV::Node::workerThread(Node* node)
                             auto* callback = std::get_if<OutputPin::PeekPollDataFunc>(&outputPin->data);
                             if (callback != nullptr && *callback != nullptr)
                             {
+                                if (FlowCheckpoint::PauseProvider(node, it->first)) { break; }
                                 if (!it->first.empty())
                                 {
                                     LOG_DATA("{}: Polling data from output pin '{}'", node->nameId(), str::replaceAll_copy(outputPin->name, "\n", ""));
                                     // Trigger the already peeked observation and invoke it's callbacks (peek = false)
-                                    if ((node->**callback)(outputPinIdx, false) == nullptr)
+                                    auto start = stats ? FlowProfiler::Clock::now() : FlowProfiler::Clock::time_point{};
+                                    auto obs = (node->**callback)(outputPinIdx, false);
+                                    if (stats) { stats->addCallback(std::numeric_limits<size_t>::max(), start, FlowProfiler::Clock::now(), false); }
+                                    if (obs == nullptr)
                                     {
                                         LOG_ERROR("{}: {} could not poll its observation despite being able to peek it.", node->nameId(), outputPin->name);
                                     }
@@ -796,7 +924,7 @@ void NAV::Node::workerThread(Node* node)
             }
 
             // Check if node finished
-            if (node->_mode == Mode::POST_PROCESSING)
+            if (node->_mode == Mode::POST_PROCESSING && !FlowCheckpoint::IsPaused(node))
             {
                 if (std::all_of(node->inputPins.begin(), node->inputPins.end(), [](const InputPin& inputPin) {
                         return inputPin.type != Pin::Type::Flow || !inputPin.isPinLinked() || inputPin.link.connectedNode->isDisabled()
@@ -805,6 +933,8 @@ void NAV::Node::workerThread(Node* node)
                     }))
                 {
                     LOG_TRACE("{}: Node finished", node->nameId());
+                    if (auto stats = std::atomic_load(&node->_statistics)) { stats->endTemporalSortBlock(); } // Pins closed while waiting for data
+                    node->finalizePostProcessing();
                     node->callbacksEnabled = false;
                     for (auto& outputPin : node->outputPins)
                     {
@@ -835,6 +965,13 @@ bool NAV::Node::workerInitializeNode()
     }
     _mode = Node::Mode::REAL_TIME;
 
+    {
+        std::scoped_lock<std::mutex> guard(_configWindowMutex);
+        _realTimeSettingsActive = _realTimeSettings;
+    }
+    RealTime::ApplyToCurrentThread(_realTimeSettingsActive, nameId(), _realTimeThreadModified);
+    _realTimeStatistics.reset();
+
     LOG_DEBUG("{}: Initializing Node", nameId());
 
     // Initialize Nodes connected to the input pins
@@ -850,11 +987,14 @@ bool NAV::Node::workerInitializeNode()
                     if (!connectedNode->doInitialize(true))
                     {
                         LOG_ERROR("{}: Could not initialize connected node {}", nameId(), connectedNode->nameId());
-                        std::scoped_lock lk(_stateMutex);
-                        if (_state == State::Initializing)
                         {
-                            _state = Node::State::Deinitialized;
+                            std::scoped_lock lk(_stateMutex);
+                            if (_state == State::Initializing)
+                            {
+                                _state = Node::State::Deinitialized;
+                            }
                         }
+                        nm::NotifyInitializationFinished();
                         return false;
                     }
                 }
@@ -898,20 +1038,26 @@ bool NAV::Node::workerInitializeNode()
             }
         }
 
-        std::scoped_lock lk(_stateMutex);
-        if (_state == State::Initializing)
         {
-            _state = Node::State::Initialized;
+            std::scoped_lock lk(_stateMutex);
+            if (_state == State::Initializing)
+            {
+                _state = Node::State::Initialized;
+            }
         }
+        nm::NotifyInitializationFinished();
         return true;
     }
 
     LOG_TRACE("{}: initialize() failed", nameId());
-    std::scoped_lock lk(_stateMutex);
-    if (_state == State::Initializing)
     {
-        _state = Node::State::Deinitialized;
+        std::scoped_lock lk(_stateMutex);
+        if (_state == State::Initializing)
+        {
+            _state = Node::State::Deinitialized;
+        }
     }
+    nm::NotifyInitializationFinished();
     return false;
 }
 
@@ -993,6 +1139,7 @@ void NAV::to_json(json& j, const Node& node)
         { "enabled", !node.isDisabled() },
         { "inputPins", node.inputPins },
         { "outputPins", node.outputPins },
+        { "realTime", node._realTimeSettings },
     };
 }
 void NAV::from_json(const json& j, Node& node)
@@ -1020,6 +1167,11 @@ void NAV::from_json(const json& j, Node& node)
         }
     }
 
+    if (j.contains("realTime"))
+    {
+        j.at("realTime").get_to(node._realTimeSettings);
+    }
+
     if (j.contains("inputPins"))
     {
         auto inputPins = j.at("inputPins").get<std::vector<InputPin>>();
@@ -18,6 +18,7 @@
 #include <imgui_stdlib.h>
 
 #include "internal/Node/Pin.hpp"
+#include "internal/RealTime.hpp"
 #include "Navigation/Time/InsTime.hpp"
 
 #include "util/Logger.hpp"
@@ -31,6 +32,7 @@
 #include <atomic>
 #include <chrono>
 #include <map>
+#include <optional>
 
 #include <nlohmann/json.hpp>
 using json = nlohmann::json; ///< json namespace
@@ -59,6 +61,23 @@ void deinitialize(); // NOLINT(readability-redundant-declaration) - false warnin
 
 } // namespace FlowExecutor
 
+namespace FlowProfiler
+{
+struct NodeStatistics;
+
+/// @brief Creates new statistics for all nodes
+void Start(); // NOLINT(readability-redundant-declaration) - false warning. This is needed for the friend declaration below
+
+} // namespace FlowProfiler
+
+namespace FlowCheckpoint
+{
+
+/// @brief Writes the pending checkpoint as soon as all nodes are idle
+void Update(); // NOLINT(readability-redundant-declaration) - false warning. This is needed for the friend declaration below
+
+} // namespace FlowCheckpoint
+
 namespace gui
 {
 class NodeEditorApplication;
@@ -255,6 +274,23 @@ class Node
     /// @brief Function called by the flow executer after finishing to flush out remaining data
     virtual void flush();
 
+    /// @brief Function called in post-processing after all incoming data was processed, but before the output pins are marked as finished
+    /// @note Other than in flush(), data sent from here still reaches the connected nodes
+    virtual void finalizePostProcessing();
+
+    /// @brief Saves the runtime state of the node for a checkpoint of the post-processing
+    /// @return The state or nullopt if the node does not support checkpoints
+    /// @note Called while the worker of the node is idle. Notifications at or after the checkpoint time are held back like flow data.
+    ///       The base implementation only supports nodes which neither receive flow data or change notifications nor poll flow data.
+    ///       The time of polled observations is only known after they were sent, so poll functions have to save the state before their last polled observation.
+    ///       The observation the provider paused at is then sent again after resuming.
+    [[nodiscard]] virtual std::optional<json> saveCheckpoint();
+
+    /// @brief Restores the runtime state of the node from a checkpoint. Called after resetNode() when resuming the post-processing.
+    /// @param[in] j Json object with the state returned by saveCheckpoint()
+    /// @return True if the state could be restored
+    virtual bool restoreCheckpoint(const json& j);
+
     /* -------------------------------------------------------------------------------------------------------- */
     /*                                             Member functions                                             */
     /* -------------------------------------------------------------------------------------------------------- */
@@ -360,12 +396,21 @@ class Node
     /// @brief Checks if the node is initialized
     [[nodiscard]] bool isInitialized() const;
 
+    /// @brief Checks if the node is deinitializing in order to initialize again afterwards
+    [[nodiscard]] bool isReinitializing() const;
+
     /// @brief Checks if the node is changing its state currently
     [[nodiscard]] bool isTransient() const;
 
     /// @brief Checks if the node is only working in real time (sensors, network interfaces, ...)
     [[nodiscard]] bool isOnlyRealtime() const;
 
+    /// @brief Get the runtime statistics of the node (nullptr if profiling was not enabled in the last execution)
+    [[nodiscard]] std::shared_ptr<FlowProfiler::NodeStatistics> getStatistics() const;
+
+    /// @brief Get the live statistics of the node in real-time mode (reset on every initialization)
+    [[nodiscard]] const RealTime::Statistics& getRealTimeStatistics() const;
+
     /* -------------------------------------------------------------------------------------------------------- */
     /*                                             Member variables                                             */
     /* -------------------------------------------------------------------------------------------------------- */
@@ -438,6 +483,24 @@ class Node
     std::mutex _workerMutex;                                                 ///< Mutex to interact with the worker condition variable
     std::condition_variable _workerConditionVariable;                        ///< Condition variable to signal the worker thread to do something
     bool _workerWakeup = false;                                              ///< Variable to prevent the worker from sleeping
+    bool _workerBusy = false;                                                ///< Flag whether the worker is processing (guarded by the worker mutex)
+    size_t _workerActivity = 0;                                              ///< Amount of times the worker started processing (guarded by the worker mutex)
+
+    /// Runtime statistics of the node. Replaced by the FlowProfiler while real-time nodes may read it, so only access it with std::atomic_load/std::atomic_store.
+    std::shared_ptr<FlowProfiler::NodeStatistics> _statistics;
+
+    /// Real-time settings of the worker thread. Saved in the flow file and applied on the next initialization.
+    RealTime::Settings _realTimeSettings;
+    /// Real-time settings applied on the last initialization
+    RealTime::Settings _realTimeSettingsActive;
+    /// Flag whether the affinity or scheduling of the worker thread was modified (only accessed by the worker thread)
+    bool _realTimeThreadModified = false;
+    /// Live statistics in real-time mode
+    RealTime::Statistics _realTimeStatistics;
+
+    /// @brief Records the processing duration of a message in real-time mode and checks it against the budget
+    /// @param[in] duration Duration of the processing
+    void addRealTimeProcessing(std::chrono::nanoseconds duration);
 
     /// @brief Worker thread
     /// @param[in, out] node The node where the thread belongs to
@@ -461,6 +524,10 @@ class Node
     friend void NAV::FlowExecutor::execute();
     /// @brief Deinitialize all Nodes
     friend void NAV::FlowExecutor::deinitialize();
+    /// @brief Creates new statistics for all nodes
+    friend void NAV::FlowProfiler::Start();
+    /// @brief Writes the pending checkpoint as soon as all nodes are idle
+    friend void NAV::FlowCheckpoint::Update();
     /// @brief Register all available Node types for the program
     friend void NAV::NodeRegistry::RegisterNodeTypes();
 
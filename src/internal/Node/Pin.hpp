@@ -28,6 +28,7 @@ using json = nlohmann::json; ///< json namespace
 #include <condition_variable>
 
 #include "util/Logger.hpp"
+#include "internal/gui/FlowAnimation.hpp"
 #include "util/Container/TsDeque.hpp"
 #include "Navigation/Time/InsTime.hpp"
 
@@ -427,6 +428,9 @@ class OutputPin : public Pin
 
         /// @brief Flag to signal the connected node, that the data was changed
         bool dataChangeNotification = false;
+
+        /// @brief Activity on the link for the flow animation and the message rate
+        std::shared_ptr<FlowAnimation::LinkActivity> activity = std::make_shared<FlowAnimation::LinkActivity>();
     };
 
     /// Info to identify the linked pins
@@ -16,6 +16,9 @@
 #include "util/Assert.h"
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 #include <deque>
 
@@ -28,6 +31,9 @@
 std::vector<NAV::Node*> m_nodes;
 size_t m_NextId = 1;
 
+std::mutex m_initializationMutex;
+std::condition_variable m_initializationCv;
+
 /* -------------------------------------------------------------------------------------------------------- */
 /*                                       Private Function Declarations                                      */
 /* -------------------------------------------------------------------------------------------------------- */
@@ -354,19 +360,46 @@ bool NAV::NodeManager::InitializeAllNodes()
     LOG_TRACE("called");
     bool nodeCouldNotInitialize = false;
 
-    InitializeAllNodesAsync();
-
+    std::vector<Node*> nodes;
     for (auto* node : m_nodes)
     {
         if (node && node->kind != Node::Kind::GroupBox && !node->isDisabled() && !node->isInitialized())
         {
-            if (!node->doInitialize(true))
+            nodes.push_back(node);
+        }
+    }
+    if (nodes.empty()) { return true; }
+
+    auto start = std::chrono::steady_clock::now();
+    InitializeAllNodesAsync(); // Wakes the workers, which initialize their nodes in parallel
+
+    {
+        std::unique_lock lk(m_initializationMutex);
+        size_t lastInitialized = 0;
+        while (true)
+        {
+            auto progress = GetInitializationProgress();
+            if (progress.initializing == 0) { break; }
+            if (progress.initialized != lastInitialized)
             {
-                LOG_ERROR("Node '{}' could not initialize.", node->nameId());
-                nodeCouldNotInitialize = true;
+                lastInitialized = progress.initialized;
+                LOG_DEBUG("Initialized {}/{} nodes", progress.initialized, progress.total);
             }
+            // The timeout catches nodes which leave the initialization without notifying (e.g. deleted or disabled in the meantime)
+            m_initializationCv.wait_for(lk, std::chrono::milliseconds(100));
+        }
+    }
+
+    for (auto* node : nodes)
+    {
+        if (std::find(m_nodes.begin(), m_nodes.end(), node) != m_nodes.end() && !node->isDisabled() && !node->isInitialized())
+        {
+            LOG_ERROR("Node '{}' could not initialize.", node->nameId());
+            nodeCouldNotInitialize = true;
         }
     }
+    LOG_DEBUG("Initializing {} nodes took {:.3f}s", nodes.size(),
+              std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
 
     return !nodeCouldNotInitialize;
 }
@@ -384,6 +417,35 @@ void NAV::NodeManager::InitializeAllNodesAsync()
     }
 }
 
+NAV::NodeManager::InitializationProgress NAV::NodeManager::GetInitializationProgress()
+{
+    InitializationProgress progress;
+    for (const auto* node : m_nodes)
+    {
+        if (!node || node->kind == Node::Kind::GroupBox || node->isDisabled()) { continue; }
+
+        progress.total++;
+        // Checked before the state, because a reinitializing node continues with DoInitialize after the deinitialization
+        if (node->isReinitializing())
+        {
+            progress.initializing++;
+            continue;
+        }
+        auto state = node->getState();
+        if (state == Node::State::Initialized) { progress.initialized++; }
+        else if (state == Node::State::DoInitialize || state == Node::State::Initializing) { progress.initializing++; }
+    }
+    return progress;
+}
+
+void NAV::NodeManager::NotifyInitializationFinished()
+{
+    {
+        std::scoped_lock lk(m_initializationMutex); // Prevents the notification from getting lost between the check and the wait
+    }
+    m_initializationCv.notify_all();
+}
+
 #ifdef TESTING
 
 std::vector<std::pair<ax::NodeEditor::PinId, NAV::InputPin::WatcherCallback>> watcherPinList;
@@ -201,13 +201,30 @@ void DisableAllCallbacks();
 /// @brief Clears all nodes queues
 void ClearAllNodeQueues();
 
-/// @brief Initializes all nodes.
+/// @brief Initializes all nodes and waits until all of them finished.
+///
+/// The nodes are initialized in parallel on their worker threads. Nodes connected over non-flow pins
+/// are initialized before the nodes depending on them. The progress is logged while waiting.
 /// @return Returns false if one of the nodes could not initialize
 bool InitializeAllNodes();
 
 /// @brief Initializes all nodes in a separate thread
 void InitializeAllNodesAsync();
 
+/// @brief Progress of the node initialization
+struct InitializationProgress
+{
+    size_t total = 0;        ///< Amount of enabled nodes
+    size_t initialized = 0;  ///< Amount of nodes which are initialized
+    size_t initializing = 0; ///< Amount of nodes which are waiting for or running their (re)initialization
+};
+
+/// @brief Counts the states of all enabled nodes
+[[nodiscard]] InitializationProgress GetInitializationProgress();
+
+/// @brief Notifies the waiting InitializeAllNodes() that a node finished its initialization. Called from the node workers.
+void NotifyInitializationFinished();
+
 /// @brief Generates a new node id
 ax::NodeEditor::NodeId GetNextNodeId();
 
@@ -0,0 +1,180 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "RealTime.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+#ifdef __linux__
+    #include <pthread.h>
+    #include <sched.h>
+    #include <unistd.h>
+#endif
+
+#include <fmt/ranges.h>
+
+#include "util/Atomic.hpp"
+#include "util/Logger.hpp"
+
+/* -------------------------------------------------------------------------------------------------------- */
+/*                                                 Settings                                                 */
+/* -------------------------------------------------------------------------------------------------------- */
+
+bool NAV::RealTime::Settings::modifiesThread() const
+{
+    return !cpuAffinity.empty() || policy != SchedulingPolicy::Default;
+}
+
+void NAV::RealTime::to_json(json& j, const Settings& settings)
+{
+    j = json{
+        { "cpuAffinity", settings.cpuAffinity },
+        { "policy", settings.policy },
+        { "priority", settings.priority },
+        { "budget", settings.budget.count() },
+        { "monitorLatency", settings.monitorLatency },
+    };
+}
+
+void NAV::RealTime::from_json(const json& j, Settings& settings)
+{
+    if (j.contains("cpuAffinity"))
+    {
+        j.at("cpuAffinity").get_to(settings.cpuAffinity);
+    }
+    if (j.contains("policy"))
+    {
+        j.at("policy").get_to(settings.policy);
+    }
+    if (j.contains("priority"))
+    {
+        j.at("priority").get_to(settings.priority);
+    }
+    if (j.contains("budget"))
+    {
+        settings.budget = std::chrono::microseconds(j.at("budget").get<int64_t>());
+    }
+    if (j.contains("monitorLatency"))
+    {
+        j.at("monitorLatency").get_to(settings.monitorLatency);
+    }
+}
+
+/* -------------------------------------------------------------------------------------------------------- */
+/*                                                Statistics                                                */
+/* -------------------------------------------------------------------------------------------------------- */
+
+bool NAV::RealTime::Statistics::addProcessing(std::chrono::nanoseconds duration, std::chrono::microseconds budget)
+{
+    messagesProcessed.fetch_add(1, std::memory_order_relaxed);
+    atomicMax(processingTimeMax, static_cast<uint64_t>(std::max(duration.count(), int64_t(0))));
+    processingTime.add(duration);
+
+    if (budget.count() > 0 && duration > budget)
+    {
+        deadlineMisses.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+void NAV::RealTime::Statistics::addLatency(std::chrono::nanoseconds latency)
+{
+    messagesOutput.fetch_add(1, std::memory_order_relaxed);
+    atomicMax(latencyMax, static_cast<uint64_t>(std::max(latency.count(), int64_t(0))));
+    this->latency.add(latency);
+}
+
+void NAV::RealTime::Statistics::reset()
+{
+    messagesProcessed.store(0, std::memory_order_relaxed);
+    deadlineMisses.store(0, std::memory_order_relaxed);
+    processingTimeMax.store(0, std::memory_order_relaxed);
+    processingTime.reset();
+    messagesOutput.store(0, std::memory_order_relaxed);
+    latencyMax.store(0, std::memory_order_relaxed);
+    latency.reset();
+}
+
+/* -------------------------------------------------------------------------------------------------------- */
+/*                                                 Functions                                                */
+/* -------------------------------------------------------------------------------------------------------- */
+
+bool NAV::RealTime::ApplyToCurrentThread(const Settings& settings, const std::string& nameId, bool& modified)
+{
+    if (!settings.modifiesThread() && !modified) { return true; }
+
+    bool success = true;
+#ifdef __linux__
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if (settings.cpuAffinity.empty())
+    {
+        // Restore the affinity of the main thread, which is the default of the process
+        sched_getaffinity(getpid(), sizeof(cpuSet), &cpuSet);
+    }
+    for (const auto& cpu : settings.cpuAffinity)
+    {
+        if (cpu < CPU_SETSIZE) { CPU_SET(cpu, &cpuSet); }
+    }
+    if (int err = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet))
+    {
+        LOG_WARN("{}: Could not set the CPU affinity of the worker thread: {}", nameId, std::strerror(err));
+        success = false;
+    }
+
+    int policy = SCHED_OTHER;
+    if (settings.policy == SchedulingPolicy::FIFO) { policy = SCHED_FIFO; }
+    else if (settings.policy == SchedulingPolicy::RR) { policy = SCHED_RR; }
+    sched_param param{};
+    param.sched_priority = policy == SCHED_OTHER ? 0 : std::clamp(settings.priority, sched_get_priority_min(policy), sched_get_priority_max(policy));
+    if (int err = pthread_setschedparam(pthread_self(), policy, &param))
+    {
+        LOG_WARN("{}: Could not set the scheduling policy {} with priority {} for the worker thread: {}. Real-time policies need the CAP_SYS_NICE capability or an rtprio limit.",
+                 nameId, to_string(settings.policy), param.sched_priority, std::strerror(err));
+        success = false;
+    }
+    if (success && settings.modifiesThread())
+    {
+        LOG_DEBUG("{}: Worker thread runs with scheduling policy {} (priority {}) on CPUs [{}]", nameId,
+                  to_string(settings.policy), param.sched_priority, fmt::join(settings.cpuAffinity, ", "));
+    }
+#else
+    if (settings.modifiesThread())
+    {
+        LOG_WARN("{}: CPU affinity and real-time scheduling of the worker threads are only supported on Linux", nameId);
+        success = false;
+    }
+#endif
+    modified = settings.modifiesThread();
+
+    return success;
+}
+
+size_t NAV::RealTime::CpuCount()
+{
+    return std::max(std::thread::hardware_concurrency(), 1U);
+}
+
+const char* NAV::to_string(RealTime::SchedulingPolicy policy)
+{
+    switch (policy)
+    {
+    case RealTime::SchedulingPolicy::Default:
+        return "Default";
+    case RealTime::SchedulingPolicy::FIFO:
+        return "FIFO";
+    case RealTime::SchedulingPolicy::RR:
+        return "Round-robin";
+    case RealTime::SchedulingPolicy::COUNT:
+        break;
+    }
+    return "";
+}
@@ -0,0 +1,111 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file RealTime.hpp
+/// @brief Real-time settings (CPU affinity, scheduling priority, processing budget) and deadline monitoring of the node worker threads
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-15
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json; ///< json namespace
+
+#include "internal/FlowProfiler.hpp"
+
+namespace NAV
+{
+
+namespace RealTime
+{
+
+/// @brief Scheduling policies of the worker threads
+enum class SchedulingPolicy : uint8_t
+{
+    Default, ///< Scheduling of the operating system (SCHED_OTHER)
+    FIFO,    ///< Real-time first-in first-out scheduling (SCHED_FIFO)
+    RR,      ///< Real-time round-robin scheduling (SCHED_RR)
+    COUNT,   ///< Amount of items in the enum
+};
+
+/// @brief Real-time settings of a node worker thread
+struct Settings
+{
+    /// CPUs the worker thread is allowed to run on. Empty means no pinning.
+    std::vector<size_t> cpuAffinity;
+    /// Scheduling policy of the worker thread
+    SchedulingPolicy policy = SchedulingPolicy::Default;
+    /// Priority of the worker thread for the real-time scheduling policies
+    int priority = 1;
+    /// Processing budget for a single message. Zero disables the deadline monitoring.
+    std::chrono::microseconds budget{ 0 };
+    /// Whether the latency between the time of the output messages and the current time should be measured
+    bool monitorLatency = false;
+
+    /// @brief Checks whether the settings change the affinity or scheduling of the worker thread
+    [[nodiscard]] bool modifiesThread() const;
+};
+
+/// @brief Converts the provided settings into a json object
+/// @param[out] j Json object which gets filled with the info
+/// @param[in] settings Settings to convert into json
+void to_json(json& j, const Settings& settings);
+/// @brief Converts the provided json object into settings
+/// @param[in] j Json object with the needed values
+/// @param[out] settings Object to fill from the json
+void from_json(const json& j, Settings& settings);
+
+/// @brief Live statistics of a node running in real-time mode
+struct Statistics
+{
+    std::atomic<uint64_t> messagesProcessed{ 0 }; ///< Amount of messages processed by the worker
+    std::atomic<uint64_t> deadlineMisses{ 0 };    ///< Amount of messages where the processing exceeded the budget
+    std::atomic<uint64_t> processingTimeMax{ 0 }; ///< Maximum processing duration of a message [ns]
+    FlowProfiler::DurationHistogram processingTime; ///< Histogram of the processing durations
+    std::atomic<uint64_t> messagesOutput{ 0 };    ///< Amount of output messages where the latency was measured
+    std::atomic<uint64_t> latencyMax{ 0 };        ///< Maximum latency between the message time and the time it was output [ns]
+    FlowProfiler::DurationHistogram latency;      ///< Histogram of the latencies
+
+    /// @brief Records the processing of a message
+    /// @param[in] duration Duration of the processing
+    /// @param[in] budget Processing budget for a single message (zero if not monitored)
+    /// @return True if the budget was exceeded
+    bool addProcessing(std::chrono::nanoseconds duration, std::chrono::microseconds budget);
+
+    /// @brief Records the latency of an output message
+    /// @param[in] latency Latency between the message time and the time it was output
+    void addLatency(std::chrono::nanoseconds latency);
+
+    /// @brief Resets all statistics
+    void reset();
+};
+
+/// @brief Applies the CPU affinity and scheduling settings to the calling thread
+/// @param[in] settings Settings to apply
+/// @param[in] nameId Name of the node for logging
+/// @param[in, out] modified Whether the thread was modified before. If the settings do not modify the thread, it is only reset when this is set.
+/// @return True if all settings could be applied
+bool ApplyToCurrentThread(const Settings& settings, const std::string& nameId, bool& modified);
+
+/// @brief Amount of CPUs which can be selected for the affinity
+[[nodiscard]] size_t CpuCount();
+
+} // namespace RealTime
+
+/// @brief Converts the enum to a string
+/// @param[in] policy Enum value to convert into text
+/// @return String representation of the enum
+const char* to_string(RealTime::SchedulingPolicy policy);
+
+} // namespace NAV
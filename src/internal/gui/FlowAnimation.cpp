@@ -8,36 +8,55 @@
 
 #include "FlowAnimation.hpp"
 
-#include <vector>
-#include <mutex>
-#include <algorithm>
+#include <imgui_node_editor.h>
+
+#include "internal/Node/Node.hpp"
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
 
 namespace
 {
 
-/// Queue to store animations till the draw threads pushes them onto the library
-std::vector<std::pair<ax::NodeEditor::LinkId, ax::NodeEditor::FlowDirection>> flowAnimationQueue;
-/// Mutex to lock the animation queue
-std::mutex flowAnimationQueueMutex;
+/// Interval over which the message rates of the links are calculated
+constexpr std::chrono::milliseconds RATE_INTERVAL{ 500 };
 
 } // namespace
 
-void NAV::FlowAnimation::Add(ax::NodeEditor::LinkId id, ax::NodeEditor::FlowDirection direction)
-{
-    const std::scoped_lock<std::mutex> lock(flowAnimationQueueMutex);
-    if (std::find(flowAnimationQueue.begin(), flowAnimationQueue.end(), std::make_pair(id, direction)) == flowAnimationQueue.end())
-    {
-        flowAnimationQueue.emplace_back(id, direction);
-    }
-}
-
 void NAV::FlowAnimation::ProcessQueue()
 {
-    const std::scoped_lock<std::mutex> lock(flowAnimationQueueMutex);
-    for (const auto& [linkId, direction] : flowAnimationQueue)
+    auto now = std::chrono::steady_clock::now();
+
+    for (const auto* node : nm::m_Nodes())
     {
-        ax::NodeEditor::Flow(linkId, direction);
+        for (const auto& output : node->outputPins)
+        {
+            for (const auto& link : output.links)
+            {
+                auto& activity = *link.activity;
+                auto callbacks = activity.callbacks.load(std::memory_order_relaxed);
+                auto notifications = activity.notifications.load(std::memory_order_relaxed);
+
+                if ((nm::showFlowWhenInvokingCallbacks && callbacks != activity.animatedCallbacks)
+                    || (nm::showFlowWhenNotifyingValueChange && notifications != activity.animatedNotifications))
+                {
+                    ax::NodeEditor::Flow(link.linkId, ax::NodeEditor::FlowDirection::Forward);
+                }
+                activity.animatedCallbacks = callbacks;
+                activity.animatedNotifications = notifications;
+
+                if (callbacks < activity.rateCallbacks || activity.rateIntervalStart == std::chrono::steady_clock::time_point{})
+                {
+                    activity.rateCallbacks = callbacks;
+                    activity.rateIntervalStart = now;
+                    activity.rate = 0.0;
+                }
+                else if (auto elapsed = now - activity.rateIntervalStart; elapsed >= RATE_INTERVAL)
+                {
+                    activity.rate = static_cast<double>(callbacks - activity.rateCallbacks) / std::chrono::duration<double>(elapsed).count();
+                    activity.rateCallbacks = callbacks;
+                    activity.rateIntervalStart = now;
+                }
+            }
+        }
     }
-
-    flowAnimationQueue.clear();
 }
@@ -13,17 +13,43 @@
 
 #pragma once
 
-#include <imgui_node_editor.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 
 namespace NAV::FlowAnimation
 {
 
-/// @brief Thread safe flow animaton of links
-/// @param[in] id Id of the link to animate the flow with
-/// @param[in] direction The direction to show the flow
-void Add(ax::NodeEditor::LinkId id, ax::NodeEditor::FlowDirection direction = ax::NodeEditor::FlowDirection::Forward);
+/// @brief Activity on a link. The counters are incremented lock-free by the node threads and sampled by the GUI once per frame.
+struct LinkActivity
+{
+    std::atomic<uint64_t> callbacks{ 0 };     ///< Amount of messages sent over the link
+    std::atomic<uint64_t> notifications{ 0 }; ///< Amount of value change notifications sent over the link
+
+    // The following members are only accessed by the GUI thread
+
+    uint64_t animatedCallbacks = 0;                            ///< Value of the callbacks counter at the last animation
+    uint64_t animatedNotifications = 0;                        ///< Value of the notifications counter at the last animation
+    uint64_t rateCallbacks = 0;                                ///< Value of the callbacks counter at the start of the rate interval
+    std::chrono::steady_clock::time_point rateIntervalStart{}; ///< Start of the interval the rate is calculated over
+    double rate = 0.0;                                         ///< Messages per second over the last interval
+};
+
+/// @brief Counts a message sent over a link. Thread safe and lock-free.
+/// @param[in, out] activity Activity of the link
+inline void AddCallback(LinkActivity& activity)
+{
+    activity.callbacks.fetch_add(1, std::memory_order_relaxed);
+}
+
+/// @brief Counts a value change notification sent over a link. Thread safe and lock-free.
+/// @param[in, out] activity Activity of the link
+inline void AddNotification(LinkActivity& activity)
+{
+    activity.notifications.fetch_add(1, std::memory_order_relaxed);
+}
 
-/// @brief Triggers the queued flow animations
+/// @brief Samples the activity of all links, triggers the flow animations and updates the message rates. Called once per frame by the GUI.
 void ProcessQueue();
 
 } // namespace NAV::FlowAnimation
@@ -29,6 +29,7 @@ namespace ed = ax::NodeEditor;
 namespace util = ax::NodeEditor::Utilities;
 
 #include "internal/gui/panels/LeftPane.hpp"
+#include "internal/gui/panels/LogOutput.hpp"
 
 #include "internal/gui/menus/MainMenuBar.hpp"
 
@@ -36,6 +37,8 @@ namespace util = ax::NodeEditor::Utilities;
 #include "internal/gui/widgets/HelpMarker.hpp"
 #include "internal/gui/widgets/Spinner.hpp"
 #include "internal/gui/widgets/TextAnsiColored.hpp"
+#include "internal/gui/widgets/EnumCombo.hpp"
+#include "internal/gui/widgets/imgui_ex.hpp"
 
 #include "internal/gui/windows/Global.hpp"
 #include "internal/gui/windows/ImPlotStyleEditor.hpp"
@@ -54,10 +57,13 @@ namespace nm = NAV::NodeManager;
 #include "util/Json.hpp"
 #include "util/StringUtil.hpp"
 
+#include <fmt/ranges.h>
+
 #include <string>
 #include <array>
 #include <vector>
 #include <map>
+#include <limits>
 #include <algorithm>
 #include <utility>
 #include <filesystem>
@@ -771,6 +777,93 @@ void NAV::gui::NodeEditorApplication::ShowRenamePinRequest(Pin*& renamePin)
     ImGui::PopFont();
 }
 
+void NAV::gui::NodeEditorApplication::ShowRealTimeSettings(Node* node)
+{
+    if (!ImGui::CollapsingHeader(fmt::format("Real-time##{}", size_t(node->id)).c_str())) { return; }
+
+    auto& settings = node->_realTimeSettings;
+
+    ImGui::TextUnformatted("CPU affinity");
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("CPUs the worker thread of the node is allowed to run on. Nothing selected means no pinning.\n"
+                             "All settings are applied on the next initialization of the node.");
+    for (size_t cpu = 0; cpu < RealTime::CpuCount(); cpu++)
+    {
+        if (cpu % 8 != 0) { ImGui::SameLine(); }
+        auto iter = std::ranges::lower_bound(settings.cpuAffinity, cpu);
+        bool selected = iter != settings.cpuAffinity.end() && *iter == cpu;
+        if (ImGui::Checkbox(fmt::format("{:2}##cpu {}", cpu, size_t(node->id)).c_str(), &selected))
+        {
+            if (selected) { settings.cpuAffinity.insert(iter, cpu); }
+            else { settings.cpuAffinity.erase(iter); }
+            LOG_DEBUG("{}: CPU affinity changed to [{}]", node->nameId(), fmt::join(settings.cpuAffinity, ", "));
+            flow::ApplyChanges();
+        }
+    }
+
+    ImGui::SetNextItemWidth(140 * windowFontRatio());
+    if (widgets::EnumCombo(fmt::format("Scheduling policy##{}", size_t(node->id)).c_str(), settings.policy))
+    {
+        LOG_DEBUG("{}: Scheduling policy changed to {}", node->nameId(), to_string(settings.policy));
+        flow::ApplyChanges();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("FIFO and Round-robin are real-time policies, which need the CAP_SYS_NICE capability or an rtprio limit (see 'ulimit -r').\n"
+                             "Only supported on Linux.");
+    if (settings.policy != RealTime::SchedulingPolicy::Default)
+    {
+        ImGui::SetNextItemWidth(140 * windowFontRatio());
+        if (ImGui::InputIntL(fmt::format("Priority##{}", size_t(node->id)).c_str(), &settings.priority, 1, 99))
+        {
+            LOG_DEBUG("{}: Priority changed to {}", node->nameId(), settings.priority);
+            flow::ApplyChanges();
+        }
+    }
+
+    ImGui::SetNextItemWidth(140 * windowFontRatio());
+    if (int budget = static_cast<int>(settings.budget.count());
+        ImGui::InputIntL(fmt::format("Processing budget [µs]##{}", size_t(node->id)).c_str(), &budget, 0, std::numeric_limits<int>::max(), 100, 1000))
+    {
+        settings.budget = std::chrono::microseconds(budget);
+        LOG_DEBUG("{}: Processing budget changed to {} µs", node->nameId(), budget);
+        flow::ApplyChanges();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Maximum time the processing of a single message may take in real-time mode. 0 disables the deadline monitoring.");
+
+    if (ImGui::Checkbox(fmt::format("Monitor latency##{}", size_t(node->id)).c_str(), &settings.monitorLatency))
+    {
+        LOG_DEBUG("{}: Monitor latency changed to {}", node->nameId(), settings.monitorLatency);
+        flow::ApplyChanges();
+    }
+    ImGui::SameLine();
+    gui::widgets::HelpMarker("Measures the time between the timestamp of the messages output by the node and the current time.\n"
+                             "Needs a time source in the flow, e.g. a sensor providing GNSS time.");
+
+    if (node->isInitialized() && node->getMode() == Node::Mode::REAL_TIME)
+    {
+        const auto& stats = node->getRealTimeStatistics();
+        ImGui::Separator();
+        uint64_t messages = stats.messagesProcessed.load(std::memory_order_relaxed);
+        uint64_t misses = stats.deadlineMisses.load(std::memory_order_relaxed);
+        ImGui::Text("Messages processed: %lu", messages);
+        ImGui::Text("Processing time: p50 %ld µs, p99 %ld µs, max %.1f µs",
+                    stats.processingTime.quantile(0.5).count(), stats.processingTime.quantile(0.99).count(),
+                    static_cast<double>(stats.processingTimeMax.load(std::memory_order_relaxed)) * 1e-3);
+        if (node->_realTimeSettingsActive.budget.count() > 0)
+        {
+            ImGui::Text("Deadline misses: %lu (%.2f %%)", misses, messages == 0 ? 0.0 : 100.0 * static_cast<double>(misses) / static_cast<double>(messages));
+        }
+        if (node->_realTimeSettingsActive.monitorLatency)
+        {
+            ImGui::Text("Latency: p50 %ld µs, p99 %ld µs, max %.1f µs (%lu messages)",
+                        stats.latency.quantile(0.5).count(), stats.latency.quantile(0.99).count(),
+                        static_cast<double>(stats.latencyMax.load(std::memory_order_relaxed)) * 1e-3,
+                        stats.messagesOutput.load(std::memory_order_relaxed));
+        }
+    }
+}
+
 void NAV::gui::NodeEditorApplication::OnFrame(float deltaTime)
 {
     bool firstFrame = ImGui::GetFrameCount() == 1;
@@ -1111,6 +1204,24 @@ void NAV::gui::NodeEditorApplication::OnFrame(float deltaTime)
                 for (const auto& link : output.links)
                 {
                     ed::Link(link.linkId, output.id, link.connectedPinId, color, 2.0F * defaultFontRatio());
+
+                    if (_showMessageRateOnLinks && output.type == Pin::Type::Flow)
+                    {
+                        auto* editor = reinterpret_cast<ax::NodeEditor::Detail::EditorContext*>(ed::GetCurrentEditor());
+                        if (const auto* edLink = editor->FindLink(link.linkId))
+                        {
+                            auto curve = edLink->GetCurve();
+                            auto center = ImCubicBezier(curve.P0, curve.P1, curve.P2, curve.P3, 0.5F);
+                            double rate = link.activity->rate;
+                            std::string text = fmt::format("{:.{}f} msg/s", rate, rate < 10.0 ? 1 : 0);
+                            auto size = ImGui::CalcTextSize(text.c_str());
+                            auto padding = ImGui::GetStyle().FramePadding;
+
+                            auto* drawList = ImGui::GetWindowDrawList();
+                            drawList->AddRectFilled(center - size * 0.5F - padding, center + size * 0.5F + padding, ImColor(0, 0, 0, 160), size.y * 0.15F);
+                            drawList->AddText(center - size * 0.5F, IM_COL32(255, 255, 255, 255), text.c_str());
+                        }
+                    }
                 }
             }
         }
@@ -1709,6 +1820,7 @@ void NAV::gui::NodeEditorApplication::OnFrame(float deltaTime)
                     node->guiConfig();
                 }
                 if (locked) { ImGui::EndDisabled(); }
+                if (!node->_configWindowForceCollapse) { ShowRealTimeSettings(node); }
                 ImGui::PopFont();
             }
             else // Window is collapsed
@@ -1805,28 +1917,9 @@ void NAV::gui::NodeEditorApplication::OnFrame(float deltaTime)
                 ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
                 ImGui::PushFont(MonoFont());
 
-                auto logMessages = Logger::GetRingBufferSink()->last_formatted();
-
-                for (auto& logLine : logMessages)
-                {
-                    for (int n = logLevelFilterSelected; n < spdlog::level::n_levels; n++)
-                    {
-                        if (logLine.find(fmt::format("] [{}]", spdlog::level::to_short_c_str(static_cast<spdlog::level::level_enum>(n)))) != std::string::npos)
-                        {
-                            if (!textFilter.IsActive() || textFilter.PassFilter(logLine.c_str()))
-                            {
-                                // str::replace(logLine, "[T]", "\033[30m[T]\033[0m");
-                                str::replace(logLine, "[D]", "\033[36m[D]\033[0m");
-                                str::replace(logLine, "[I]", "\033[32m[I]\033[0m");
-                                str::replace(logLine, "[W]", "\033[33m[W]\033[0m");
-                                str::replace(logLine, "[E]", "\033[31m[E]\033[0m");
-                                ImGui::TextAnsiUnformatted(logLine.c_str());
-                                // ImGui::TextAnsiUnformatted("\033[31;1;4mHello\033[0mtt");
-                            }
-                            break;
-                        }
-                    }
-                }
+                static panels::LogOutput logOutput;
+                logOutput.update(static_cast<spdlog::level::level_enum>(logLevelFilterSelected), textFilter);
+                logOutput.draw();
                 ImGui::PopFont();
                 ImGui::PopStyleVar();
 
@@ -86,6 +86,9 @@ class NodeEditorApplication : public Application
     /// @brief Shows a PopupModal where the user can rename the pin
     /// @param[in, out] renamePin Pointer to the pin to rename. Pointer gets nulled when finished.
     static void ShowRenamePinRequest(Pin*& renamePin);
+    /// @brief Shows the real-time settings and live statistics of the node
+    /// @param[in, out] node Node to show the settings for
+    static void ShowRealTimeSettings(Node* node);
 
     /// @brief Frame counter to block the navigate to content function till nodes are correctly loaded
     int frameCountNavigate = 0;
@@ -93,6 +96,9 @@ class NodeEditorApplication : public Application
     /// Shows the queue size on the pins (every frame the queue mutex will be locked)
     static inline bool _showQueueSizeOnPins = false;
 
+    /// Shows the message rate on the flow links (sampled once per frame from lock-free counters)
+    static inline bool _showMessageRateOnLinks = false;
+
     /// @brief Pointer to the texture for the instinct logo
     static inline std::array<ImTextureID, 2> m_InstinctLogo{ nullptr, nullptr };
 
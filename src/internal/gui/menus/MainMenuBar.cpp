@@ -15,6 +15,8 @@
 #include "DebugMenu.hpp"
 
 #include "internal/FlowManager.hpp"
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
 
 #include <imgui.h>
 #include <fmt/core.h>
@@ -55,6 +57,11 @@ void NAV::gui::menus::ShowMainMenuBar(GlobalActions& globalAction)
         // #endif
         // Move cursor to the right, as ImGui::Spring() is not working inside menu bars
         std::string text = fmt::format("FPS: {:.2f} ({:.2g}ms)", io.Framerate, io.Framerate != 0.0F ? 1000.0F / io.Framerate : 0.0F);
+        if (auto progress = nm::GetInitializationProgress();
+            progress.initializing != 0)
+        {
+            text = fmt::format("Initializing nodes: {}/{}    {}", progress.initialized, progress.total, text);
+        }
         float textPosX = ImGui::GetCursorPosX() + ImGui::GetColumnWidth() - ImGui::CalcTextSize(text.c_str()).x
                          - ImGui::GetScrollX() - 2 * ImGui::GetStyle().ItemSpacing.x;
         ImGui::SetCursorPosX(textPosX);
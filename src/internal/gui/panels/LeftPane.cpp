@@ -78,6 +78,8 @@ bool NAV::gui::panels::ShowLeftPane(float paneWidth)
 #if defined(WIN32) || defined(_WIN32) || defined(__WIN32)
         ImGui::EndDisabled();
 #endif
+
+        ImGui::Checkbox("Show Message rate on links", &NodeEditorApplication::_showMessageRateOnLinks);
     }
 
     std::vector<ed::NodeId> selectedNodes;
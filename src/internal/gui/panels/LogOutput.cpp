@@ -0,0 +1,114 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "LogOutput.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "internal/gui/widgets/TextAnsiColored.hpp"
+#include "util/StringUtil.hpp"
+
+NAV::gui::panels::LogOutput::~LogOutput()
+{
+    if (_refilterCancel) { _refilterCancel->store(true, std::memory_order_relaxed); }
+    // The superseded threads were already cancelled, the destructors of the futures wait for them
+}
+
+void NAV::gui::panels::LogOutput::update(spdlog::level::level_enum minLevel, const ImGuiTextFilter& textFilter)
+{
+    if (const auto& sink = Logger::GetRingBufferSink())
+    {
+        std::vector<Line> newLines;
+        _nextSeq = sink->read_since(_nextSeq, newLines);
+        for (auto& line : newLines)
+        {
+            if (_lines.size() == sink->capacity()) { _lines.pop_front(); }
+            _lines.push_back(std::move(line));
+        }
+    }
+    uint64_t firstSeq = _lines.empty() ? _nextSeq : _lines.front()->seq;
+
+    if (minLevel != _minLevel || _filterText != textFilter.InputBuf)
+    {
+        _minLevel = minLevel;
+        _filterText = textFilter.InputBuf;
+        std::strncpy(_textFilter.InputBuf, textFilter.InputBuf, sizeof(_textFilter.InputBuf) - 1);
+        _textFilter.Build();
+
+        if (_refilterResult.valid())
+        {
+            _refilterCancel->store(true, std::memory_order_relaxed);
+            _supersededRefilters.push_back(std::move(_refilterResult));
+        }
+
+        // Filter all stored lines again on a separate thread. The lines are shared pointers, so the copy is cheap.
+        _refilterUpTo = _nextSeq;
+        _refilterCancel = std::make_shared<std::atomic<bool>>(false);
+        _refilterResult = std::async(std::launch::async, [lines = std::vector<Line>(_lines.begin(), _lines.end()), minLevel, textFilter = _textFilter, cancel = _refilterCancel]() mutable {
+            textFilter.Build(); // The copied filter ranges still point into the buffer of the original
+            std::deque<uint64_t> filteredSeqs;
+            for (const auto& line : lines)
+            {
+                if (cancel->load(std::memory_order_relaxed)) { break; }
+                if (passesFilter(line, minLevel, textFilter)) { filteredSeqs.push_back(line->seq); }
+            }
+            return filteredSeqs;
+        });
+    }
+
+    std::erase_if(_supersededRefilters, [](const auto& future) { return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready; });
+
+    if (_refilterResult.valid() && _refilterResult.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+    {
+        _filteredSeqs = _refilterResult.get();
+        _filteredUpTo = _refilterUpTo;
+    }
+
+    if (!_refilterResult.valid()) // Until the result is ready, the lines of the old filter are shown
+    {
+        // Lines which arrived since the last frame
+        for (uint64_t seq = std::max(_filteredUpTo, firstSeq); seq < _nextSeq; seq++)
+        {
+            if (passesFilter(_lines.at(seq - firstSeq), _minLevel, _textFilter)) { _filteredSeqs.push_back(seq); }
+        }
+        _filteredUpTo = _nextSeq;
+    }
+
+    while (!_filteredSeqs.empty() && _filteredSeqs.front() < firstSeq) { _filteredSeqs.pop_front(); }
+}
+
+void NAV::gui::panels::LogOutput::draw() const
+{
+    if (_lines.empty()) { return; }
+    uint64_t firstSeq = _lines.front()->seq;
+
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(_filteredSeqs.size()));
+    while (clipper.Step())
+    {
+        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+        {
+            auto seq = _filteredSeqs.at(static_cast<size_t>(i));
+            std::string text = _lines.at(seq - firstSeq)->text;
+            // str::replace(text, "[T]", "\033[30m[T]\033[0m");
+            str::replace(text, "[D]", "\033[36m[D]\033[0m");
+            str::replace(text, "[I]", "\033[32m[I]\033[0m");
+            str::replace(text, "[W]", "\033[33m[W]\033[0m");
+            str::replace(text, "[E]", "\033[31m[E]\033[0m");
+            ImGui::TextAnsiUnformatted(text.c_str());
+        }
+    }
+}
+
+bool NAV::gui::panels::LogOutput::passesFilter(const Line& line, spdlog::level::level_enum minLevel, const ImGuiTextFilter& textFilter)
+{
+    return line->level >= minLevel
+           && (!textFilter.IsActive() || textFilter.PassFilter(line->text.c_str()));
+}
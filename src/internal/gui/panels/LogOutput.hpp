@@ -0,0 +1,97 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file LogOutput.hpp
+/// @brief Log output panel, which reads the log lines incrementally and only renders the visible ones
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-15
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <imgui.h>
+
+#include "util/Logger.hpp"
+
+namespace NAV::gui::panels
+{
+
+/// @brief Log output panel
+///
+/// Every frame only the lines logged since the last frame are fetched from the ring buffer sink.
+/// When the filter changes, all stored lines are filtered again on a separate thread.
+class LogOutput
+{
+  public:
+    /// @brief Default constructor
+    LogOutput() = default;
+    /// @brief Destructor. Cancels the running filter threads and waits for them.
+    ~LogOutput();
+    /// @brief Copy constructor
+    LogOutput(const LogOutput&) = delete;
+    /// @brief Move constructor
+    LogOutput(LogOutput&&) = delete;
+    /// @brief Copy assignment operator
+    LogOutput& operator=(const LogOutput&) = delete;
+    /// @brief Move assignment operator
+    LogOutput& operator=(LogOutput&&) = delete;
+
+    /// @brief Fetches the new log lines and applies the filter. Call once per frame before draw().
+    /// @param[in] minLevel Minimum level of the lines to show
+    /// @param[in] textFilter Filter the lines have to pass
+    void update(spdlog::level::level_enum minLevel, const ImGuiTextFilter& textFilter);
+
+    /// @brief Renders the visible lines which pass the filter
+    void draw() const;
+
+  private:
+    /// Log line type
+    using Line = std::shared_ptr<const spdlog::sinks::sequenced_log_line>;
+
+    /// Stored lines (sequence numbers without gaps)
+    std::deque<Line> _lines;
+    /// Sequence number of the next line to fetch
+    uint64_t _nextSeq = 0;
+
+    /// Sequence numbers of the lines which pass the filter (ascending)
+    std::deque<uint64_t> _filteredSeqs;
+    /// Sequence number up to which the lines were checked against the filter
+    uint64_t _filteredUpTo = 0;
+
+    /// Minimum level of the current filter
+    spdlog::level::level_enum _minLevel = spdlog::level::n_levels;
+    /// Text of the current filter
+    std::string _filterText;
+    /// Copy of the current filter
+    ImGuiTextFilter _textFilter;
+
+    /// Result of the filtering on the separate thread
+    std::future<std::deque<uint64_t>> _refilterResult;
+    /// Flag to cancel the filtering on the separate thread
+    std::shared_ptr<std::atomic<bool>> _refilterCancel;
+    /// Sequence number up to which the lines are filtered on the separate thread
+    uint64_t _refilterUpTo = 0;
+    /// Filter threads, which were superseded by a newer filter. They are cancelled and kept until they finished,
+    /// because destroying the future of std::async would block until the thread finished.
+    std::vector<std::future<std::deque<uint64_t>>> _supersededRefilters;
+
+    /// @brief Checks whether the line passes the filter
+    /// @param[in] line Line to check
+    /// @param[in] minLevel Minimum level of the lines to show
+    /// @param[in] textFilter Filter the line has to pass
+    static bool passesFilter(const Line& line, spdlog::level::level_enum minLevel, const ImGuiTextFilter& textFilter);
+};
+
+} // namespace NAV::gui::panels
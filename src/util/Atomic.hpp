@@ -0,0 +1,31 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file Atomic.hpp
+/// @brief Helper functions for atomics
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-24
+
+#pragma once
+
+#include <atomic>
+
+namespace NAV
+{
+
+/// @brief Sets the atomic to the maximum of itself and the provided value
+/// @param[in, out] atomic Atomic to update
+/// @param[in] value Value to compare against
+template<typename T>
+void atomicMax(std::atomic<T>& atomic, T value)
+{
+    T prev = atomic.load(std::memory_order_relaxed);
+    while (prev < value && !atomic.compare_exchange_weak(prev, value, std::memory_order_relaxed)) {}
+}
+
+} // namespace NAV
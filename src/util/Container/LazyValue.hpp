@@ -0,0 +1,163 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file LazyValue.hpp
+/// @brief Value which is calculated on first access and cached afterwards
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-15
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#include "util/Assert.h"
+
+namespace NAV
+{
+
+/// @brief Value which is calculated on first access and cached afterwards
+///
+/// Node data is shared between nodes running in different threads, so the first access may happen concurrently.
+/// Only one thread calculates the value, the others wait for it. Setting or resetting the value requires exclusive access.
+/// @tparam T Type of the value
+template<typename T>
+class LazyValue
+{
+  public:
+    /// @brief Default constructor, which creates an invalid value
+    LazyValue() = default;
+
+    /// @brief Constructor, which creates a valid value
+    /// @param[in] value Value to store
+    explicit LazyValue(T value)
+        : _value(std::move(value)), _state(State::Valid) {}
+
+    /// @brief Destructor
+    ~LazyValue() = default;
+
+    /// @brief Copy constructor. Only takes over the value if it was already calculated
+    /// @param[in] other The other element to copy
+    LazyValue(const LazyValue& other)
+    {
+        if (other.valid())
+        {
+            _value = other._value;
+            _state.store(State::Valid, std::memory_order_relaxed);
+        }
+    }
+    /// @brief Move constructor. Only takes over the value if it was already calculated
+    /// @param[in] other The other element to move
+    LazyValue(LazyValue&& other) noexcept
+    {
+        if (other.valid())
+        {
+            _value = std::move(other._value);
+            _state.store(State::Valid, std::memory_order_relaxed);
+        }
+    }
+    /// @brief Copy assignment operator. Only takes over the value if it was already calculated
+    /// @param[in] other The other element to copy
+    LazyValue& operator=(const LazyValue& other)
+    {
+        if (this != &other)
+        {
+            if (other.valid()) { set(other._value); }
+            else { reset(); }
+        }
+        return *this;
+    }
+    /// @brief Move assignment operator. Only takes over the value if it was already calculated
+    /// @param[in] other The other element to move
+    LazyValue& operator=(LazyValue&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (other.valid()) { set(std::move(other._value)); }
+            else { reset(); }
+        }
+        return *this;
+    }
+
+    /// @brief Stores the value
+    /// @param[in] value Value to store
+    void set(T value)
+    {
+        _value = std::move(value);
+        _state.store(State::Valid, std::memory_order_release);
+    }
+
+    /// @brief Marks the value as invalid, so that it gets calculated again on the next access
+    void reset()
+    {
+        _state.store(State::Invalid, std::memory_order_relaxed);
+    }
+
+    /// @brief Checks whether the value is set or was already calculated
+    [[nodiscard]] bool valid() const
+    {
+        return _state.load(std::memory_order_acquire) == State::Valid;
+    }
+
+    /// @brief Returns the value, which has to be valid
+    [[nodiscard]] const T& value() const
+    {
+        INS_ASSERT_USER_ERROR(valid(), "The lazy value has to be set or calculated before accessing it directly");
+        return _value;
+    }
+
+    /// @brief Returns the value and calculates it if it is not valid yet
+    /// @param[in] calc Function returning the value, which is called at most once until the next reset
+    template<typename Func>
+    [[nodiscard]] const T& get(Func&& calc) const
+    {
+        auto state = _state.load(std::memory_order_acquire);
+        if (state == State::Valid) { return _value; }
+
+        if (state == State::Invalid && _state.compare_exchange_strong(state, State::Calculating, std::memory_order_acquire))
+        {
+            try
+            {
+                _value = std::forward<Func>(calc)();
+            }
+            catch (...)
+            {
+                _state.store(State::Invalid, std::memory_order_release);
+                _state.notify_all();
+                throw;
+            }
+            _state.store(State::Valid, std::memory_order_release);
+            _state.notify_all();
+            return _value;
+        }
+
+        while ((state = _state.load(std::memory_order_acquire)) != State::Valid)
+        {
+            if (state == State::Invalid) { return get(std::forward<Func>(calc)); } // Calculation threw in the other thread
+            _state.wait(state, std::memory_order_acquire);
+        }
+        return _value;
+    }
+
+  private:
+    /// @brief States of the value
+    enum class State : uint8_t
+    {
+        Invalid,     ///< Value needs to be calculated
+        Calculating, ///< Value is calculated by another thread
+        Valid,       ///< Value can be read
+    };
+
+    /// Cached value
+    mutable T _value{};
+    /// State of the value
+    mutable std::atomic<State> _state = State::Invalid;
+};
+
+} // namespace NAV
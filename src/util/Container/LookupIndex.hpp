@@ -0,0 +1,151 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file LookupIndex.hpp
+/// @brief Lazily built hash index from a key to the position of an element in a vector
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-15
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
+
+#include "util/Container/Unordered_map.hpp"
+
+namespace NAV
+{
+
+/// @brief Hash index from a key to the position of an element in a vector, which is owned by someone else
+///
+/// The index is built on the first lookup and kept up to date by the owner when appending elements.
+/// If the size of the vector changes behind its back (e.g. erasing elements), the index is rebuilt on the next lookup.
+/// Found positions are always verified, so a key modified in place is not reported at its old position anymore.
+/// A key which is only introduced by modifying an element in place is found after the next rebuild. Call invalidate() to force it.
+/// @note Node data is shared between nodes running in different threads, so the index may be built concurrently by const lookups.
+///       Only one thread builds it, while lookups of other threads wait for it.
+/// @tparam Key Key type of the elements (needs a std::hash specialization)
+/// @tparam LinearSearchSize Up to this amount of elements a linear search is faster than building and querying the index
+template<typename Key, size_t LinearSearchSize = 8>
+class LookupIndex
+{
+  public:
+    /// @brief Default constructor
+    LookupIndex() = default;
+    /// @brief Destructor
+    ~LookupIndex() = default;
+    /// @brief Copy constructor. The index is not copied, but rebuilt on the next lookup.
+    LookupIndex(const LookupIndex& /* other */) {}
+    /// @brief Move constructor. The index is not moved, but rebuilt on the next lookup.
+    LookupIndex(LookupIndex&& /* other */) noexcept {}
+    /// @brief Copy assignment operator. The index is not copied, but rebuilt on the next lookup.
+    LookupIndex& operator=(const LookupIndex& /* other */)
+    {
+        invalidate();
+        return *this;
+    }
+    /// @brief Move assignment operator. The index is not moved, but rebuilt on the next lookup.
+    LookupIndex& operator=(LookupIndex&& /* other */) noexcept
+    {
+        invalidate();
+        return *this;
+    }
+
+    /// @brief Searches the position of the first element with the key
+    /// @param[in] vec Vector with the elements
+    /// @param[in] key Key to search for
+    /// @param[in] proj Projection from an element to its key
+    /// @return The position in the vector or nullopt if not found
+    template<typename T, typename Projection>
+    [[nodiscard]] std::optional<size_t> find(const std::vector<T>& vec, const Key& key, Projection proj) const
+    {
+        if (vec.size() <= LinearSearchSize)
+        {
+            for (size_t i = 0; i < vec.size(); i++)
+            {
+                if (std::invoke(proj, vec[i]) == key) { return i; }
+            }
+            return std::nullopt;
+        }
+
+        if (_size.load(std::memory_order_acquire) != vec.size()) { rebuild(vec, proj, false); }
+
+        auto pos = lookup(key);
+        if (!pos || (*pos < vec.size() && std::invoke(proj, vec[*pos]) == key)) { return pos; }
+
+        // The vector was modified in place
+        rebuild(vec, proj, true);
+        return lookup(key);
+    }
+
+    /// @brief Adds the element which was appended to the vector by the owner
+    /// @param[in] key Key of the appended element
+    /// @param[in] vecSize Size of the vector after appending the element
+    void push_back(const Key& key, size_t vecSize)
+    {
+        std::scoped_lock lk(_mutex);
+        if (_size.load(std::memory_order_relaxed) + 1 != vecSize) { return; } // Not built or outdated, so it gets rebuilt anyway
+        _index.emplace(key, vecSize - 1);
+        _size.store(vecSize, std::memory_order_release);
+    }
+
+    /// @brief Marks the index as outdated, so that it gets rebuilt on the next lookup
+    void invalidate()
+    {
+        _size.store(INVALID, std::memory_order_relaxed);
+    }
+
+  private:
+    /// Size marking the index as not built
+    static constexpr size_t INVALID = std::numeric_limits<size_t>::max();
+
+    /// Position of the first element for every key
+    mutable unordered_map<Key, size_t> _index;
+    /// Size of the vector the index was built for
+    mutable std::atomic<size_t> _size = INVALID;
+    /// Mutex for the index. Lookups share it, building the index locks it exclusively.
+    mutable std::shared_mutex _mutex;
+
+    /// @brief Searches the key in the index
+    /// @param[in] key Key to search for
+    /// @return The position stored in the index or nullopt if not found
+    [[nodiscard]] std::optional<size_t> lookup(const Key& key) const
+    {
+        std::shared_lock lk(_mutex);
+        auto iter = _index.find(key);
+        if (iter == _index.end()) { return std::nullopt; }
+        return iter->second;
+    }
+
+    /// @brief Builds the index from the vector
+    /// @param[in] vec Vector with the elements
+    /// @param[in] proj Projection from an element to its key
+    /// @param[in] force Whether to rebuild even if the size matches
+    template<typename T, typename Projection>
+    void rebuild(const std::vector<T>& vec, Projection proj, bool force) const
+    {
+        std::scoped_lock lk(_mutex);
+        if (!force && _size.load(std::memory_order_relaxed) == vec.size()) { return; } // Built by another thread in the meantime
+
+        _index.clear();
+        _index.reserve(vec.size());
+        for (size_t i = 0; i < vec.size(); i++)
+        {
+            _index.emplace(std::invoke(proj, vec[i]), i);
+        }
+        _size.store(vec.size(), std::memory_order_release);
+    }
+};
+
+} // namespace NAV
@@ -0,0 +1,40 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file IpcTransport.hpp
+/// @brief Transports for exchanging data between processes on the same machine
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-10
+
+#pragma once
+
+#include <boost/asio.hpp>
+
+namespace NAV
+{
+/// @brief Transports for exchanging data between processes on the same machine
+enum class IpcTransport
+{
+    SharedMemory, ///< Lock-free ring in shared memory
+    UnixSocket,   ///< Unix domain stream socket
+    COUNT,        ///< Amount of items in the enum
+};
+
+/// @brief Whether Unix domain sockets are available on this platform
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+constexpr bool IPC_HAS_UNIX_SOCKETS = true;
+#else
+constexpr bool IPC_HAS_UNIX_SOCKETS = false;
+#endif
+
+/// @brief Converts the enum to a string
+/// @param[in] value Enum value to convert into text
+/// @return String representation of the enum
+const char* to_string(IpcTransport value);
+
+} // namespace NAV
@@ -0,0 +1,175 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "SharedMemoryRing.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include <fmt/format.h>
+#include <boost/interprocess/shared_memory_object.hpp>
+
+#include "util/Logger.hpp"
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <csignal>
+    #include <unistd.h>
+#endif
+
+namespace NAV
+{
+namespace
+{
+
+/// @brief Process id of the calling process
+int64_t currentProcessId()
+{
+#ifdef _WIN32
+    return static_cast<int64_t>(GetCurrentProcessId());
+#else
+    return static_cast<int64_t>(getpid());
+#endif
+}
+
+/// @brief Checks whether a process with the id is running
+/// @param[in] pid Process id
+bool isProcessAlive(int64_t pid)
+{
+#ifdef _WIN32
+    HANDLE process = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, static_cast<DWORD>(pid));
+    if (process == nullptr) { return false; }
+    DWORD exitCode = 0;
+    bool alive = GetExitCodeProcess(process, &exitCode) && exitCode == STILL_ACTIVE;
+    CloseHandle(process);
+    return alive;
+#else
+    return kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+#endif
+}
+
+} // namespace
+
+SharedMemoryRing::SharedMemoryRing(const std::string& name, size_t capacity, Role role)
+    : _segment(boost::interprocess::open_or_create, name.c_str(), capacity + sizeof(Header) + 4096), _role(role)
+{
+    // The construction is done under the segment lock, so both processes agree on the ring
+    _header = _segment.find_or_construct<Header>("Header")(capacity);
+    _data = _segment.find_or_construct<uint8_t>("Data")[_header->capacity](0);
+
+    int64_t pid = currentProcessId();
+    int64_t previousPid = pidSlot(role).exchange(pid);
+    if (previousPid != 0 && previousPid != pid && isProcessAlive(previousPid))
+    {
+        pidSlot(role).store(previousPid);
+        throw std::runtime_error(fmt::format("The {} side is already used by the process {}", role == Role::Producer ? "sending" : "receiving", previousPid));
+    }
+
+    if (role == Role::Consumer)
+    {
+        // A producer which did not unregister crashed, so its data belongs to an old run
+        if (int64_t producerPid = _header->producerPid.load();
+            producerPid != 0 && !isProcessAlive(producerPid))
+        {
+            _discardedStaleData = _header->head.load(std::memory_order_acquire) != _header->tail.load(std::memory_order_relaxed);
+            _header->tail.store(_header->head.load(std::memory_order_acquire), std::memory_order_release);
+            _header->producerPid.compare_exchange_strong(producerPid, 0);
+        }
+    }
+}
+
+SharedMemoryRing::~SharedMemoryRing()
+{
+    int64_t pid = currentProcessId();
+    pidSlot(_role).compare_exchange_strong(pid, 0);
+}
+
+std::atomic<int64_t>& SharedMemoryRing::pidSlot(Role role) const
+{
+    return role == Role::Producer ? _header->producerPid : _header->consumerPid;
+}
+
+bool SharedMemoryRing::push(const std::vector<uint8_t>& message)
+{
+    auto size = static_cast<uint32_t>(message.size());
+    size_t needed = sizeof(size) + message.size();
+
+    uint64_t head = _header->head.load(std::memory_order_relaxed);
+    uint64_t tail = _header->tail.load(std::memory_order_acquire);
+    if (needed > _header->capacity - (head - tail)) { return false; }
+
+    copyIn(head, reinterpret_cast<const uint8_t*>(&size), sizeof(size)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    copyIn(head + sizeof(size), message.data(), message.size());
+    _header->head.store(head + needed, std::memory_order_release);
+    return true;
+}
+
+bool SharedMemoryRing::pop(std::vector<uint8_t>& message)
+{
+    uint64_t tail = _header->tail.load(std::memory_order_relaxed);
+    uint64_t head = _header->head.load(std::memory_order_acquire);
+    if (head == tail) { return false; }
+
+    uint32_t size = 0;
+    uint64_t available = head - tail;
+    if (available >= sizeof(size))
+    {
+        copyOut(tail, reinterpret_cast<uint8_t*>(&size), sizeof(size)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+    // The segment can be written by any process, so never trust the positions and the length prefix
+    if (available < sizeof(size) || available > _header->capacity || size > available - sizeof(size))
+    {
+        LOG_ERROR("Shared memory ring is corrupted (head {}, tail {}, message size {}, capacity {}). Discarding all {} bytes in the ring.",
+                  head, tail, size, _header->capacity, available);
+        _header->tail.store(head, std::memory_order_release);
+        return false;
+    }
+    message.resize(size);
+    copyOut(tail + sizeof(size), message.data(), size);
+    _header->tail.store(tail + sizeof(size) + size, std::memory_order_release);
+    return true;
+}
+
+size_t SharedMemoryRing::capacity() const
+{
+    return _header->capacity;
+}
+
+size_t SharedMemoryRing::maxMessageSize() const
+{
+    return _header->capacity - sizeof(uint32_t);
+}
+
+void SharedMemoryRing::remove(const std::string& name)
+{
+    boost::interprocess::shared_memory_object::remove(name.c_str());
+}
+
+void SharedMemoryRing::copyIn(uint64_t pos, const uint8_t* data, size_t size)
+{
+    auto offset = static_cast<size_t>(pos % _header->capacity);
+    size_t first = std::min(size, static_cast<size_t>(_header->capacity) - offset);
+    std::memcpy(_data + offset, data, first);
+    std::memcpy(_data, data + first, size - first);
+}
+
+void SharedMemoryRing::copyOut(uint64_t pos, uint8_t* data, size_t size) const
+{
+    auto offset = static_cast<size_t>(pos % _header->capacity);
+    size_t first = std::min(size, static_cast<size_t>(_header->capacity) - offset);
+    std::memcpy(data, _data + offset, first);
+    std::memcpy(data + first, _data, size - first);
+}
+
+} // namespace NAV
@@ -0,0 +1,128 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file SharedMemoryRing.hpp
+/// @brief Lock-free single producer single consumer message ring in shared memory
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-10
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/interprocess/managed_shared_memory.hpp>
+
+namespace NAV
+{
+/// @brief Lock-free single producer single consumer message ring in shared memory
+///
+/// Messages are stored with a length prefix in a byte ring. The write and read positions are only ever increased,
+/// so that the producer and the consumer only need to synchronize over the two atomic positions.
+/// The segment is created by whichever side opens it first. Both sides register their process id in the segment,
+/// so that the consumer can detect and discard data left behind by a producer which crashed.
+class SharedMemoryRing
+{
+  public:
+    /// @brief Side of the ring
+    enum class Role
+    {
+        Producer, ///< Pushes messages
+        Consumer, ///< Pops messages
+    };
+
+    /// @brief Opens or creates the shared memory segment
+    /// @param[in] name Name of the shared memory segment
+    /// @param[in] capacity Capacity of the ring in [bytes], if the segment gets created
+    /// @param[in] role Side of the ring this process uses
+    /// @throws boost::interprocess::interprocess_exception if the segment can not be opened
+    /// @throws std::runtime_error if another running process uses the same side of the ring
+    SharedMemoryRing(const std::string& name, size_t capacity, Role role);
+    /// @brief Destructor (unregisters the process from the segment)
+    ~SharedMemoryRing();
+    /// @brief Copy constructor
+    SharedMemoryRing(const SharedMemoryRing&) = delete;
+    /// @brief Move constructor
+    SharedMemoryRing(SharedMemoryRing&&) = delete;
+    /// @brief Copy assignment operator
+    SharedMemoryRing& operator=(const SharedMemoryRing&) = delete;
+    /// @brief Move assignment operator
+    SharedMemoryRing& operator=(SharedMemoryRing&&) = delete;
+
+    /// @brief Whether the consumer discarded data of a crashed producer when opening the segment
+    [[nodiscard]] bool discardedStaleData() const { return _discardedStaleData; }
+
+    /// @brief Appends a message to the ring
+    /// @param[in] message Message to append
+    /// @return False if there is not enough space in the ring
+    bool push(const std::vector<uint8_t>& message);
+
+    /// @brief Takes the oldest message out of the ring
+    /// @param[out] message The message
+    /// @return False if the ring is empty or corrupted. A corrupted ring is emptied, so that the next message can be read again.
+    bool pop(std::vector<uint8_t>& message);
+
+    /// @brief Capacity of the ring in [bytes]
+    [[nodiscard]] size_t capacity() const;
+
+    /// @brief Maximum size of a single message in [bytes]
+    [[nodiscard]] size_t maxMessageSize() const;
+
+    /// @brief Removes the shared memory segment. Processes which still have it opened keep their mapping.
+    /// @param[in] name Name of the shared memory segment
+    static void remove(const std::string& name);
+
+  private:
+    /// @brief Positions in the ring, which are shared by the processes
+    struct Header
+    {
+        /// @brief Constructor
+        /// @param[in] capacity Capacity of the ring in [bytes]
+        explicit Header(uint64_t capacity)
+            : capacity(capacity) {}
+
+        std::atomic<uint64_t> head = 0;        ///< Write position (only changed by the producer)
+        std::atomic<uint64_t> tail = 0;        ///< Read position (only changed by the consumer)
+        uint64_t capacity;                     ///< Capacity of the ring in [bytes]
+        std::atomic<int64_t> producerPid = 0;  ///< Process id of the producer (0 if none is attached)
+        std::atomic<int64_t> consumerPid = 0;  ///< Process id of the consumer (0 if none is attached)
+    };
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "The ring positions have to be lock-free to be shared between processes");
+    static_assert(std::atomic<int64_t>::is_always_lock_free, "The process ids have to be lock-free to be shared between processes");
+
+    /// @brief Process id slot of the given side in the header
+    /// @param[in] role Side of the ring
+    [[nodiscard]] std::atomic<int64_t>& pidSlot(Role role) const;
+
+    /// @brief Copies bytes into the ring
+    /// @param[in] pos Position in the ring
+    /// @param[in] data Data to copy
+    /// @param[in] size Amount of bytes
+    void copyIn(uint64_t pos, const uint8_t* data, size_t size);
+
+    /// @brief Copies bytes out of the ring
+    /// @param[in] pos Position in the ring
+    /// @param[out] data Buffer to copy into
+    /// @param[in] size Amount of bytes
+    void copyOut(uint64_t pos, uint8_t* data, size_t size) const;
+
+    /// Shared memory segment
+    boost::interprocess::managed_shared_memory _segment;
+    /// Positions in the ring
+    Header* _header = nullptr;
+    /// Start of the ring data
+    uint8_t* _data = nullptr;
+    /// Side of the ring this process uses
+    Role _role;
+    /// Flag whether data of a crashed producer was discarded when opening the segment
+    bool _discardedStaleData = false;
+};
+
+} // namespace NAV
@@ -11,6 +11,7 @@
 #include "spdlog/sinks/basic_file_sink.h"
 #include "spdlog/sinks/stdout_color_sinks.h"
 #include "Logger/dist_filter_sink.hpp"
+#include "Logger/backpressure_logger.hpp"
 
 #include "internal/ConfigManager.hpp"
 #include "internal/Version.hpp"
@@ -110,7 +111,7 @@ Logger::Logger(const std::string& logpath)
         break;
     }
 
-    _ringBufferSink = std::make_shared<spdlog::sinks::ringbuffer_sink_mt>(4096);
+    _ringBufferSink = std::make_shared<spdlog::sinks::sequenced_ringbuffer_sink_mt>(4096);
     _ringBufferSink->set_level(spdlog::level::trace);
     _ringBufferSink->set_pattern(logPatternInfo);
 
@@ -129,13 +130,42 @@ Logger::Logger(const std::string& logpath)
     dist_filter_sink->add_sink(file_sink);
     dist_filter_sink->add_sink(_ringBufferSink);
 
-    // Set the logger as default logger
-    spdlog::set_default_logger(std::make_shared<spdlog::logger>("multi_sink", dist_filter_sink));
+    if (NAV::ConfigManager::Get<bool>("log-async", false))
+    {
+        auto policy = spdlog::backpressure_policy::block;
+        if (const auto& policyStr = NAV::ConfigManager::Get<std::string>("log-overflow-policy", "block");
+            policyStr == "drop")
+        {
+            policy = spdlog::backpressure_policy::drop;
+        }
+        else if (policyStr == "sample")
+        {
+            policy = spdlog::backpressure_policy::sample;
+        }
+
+        _asyncLogger = std::make_shared<spdlog::backpressure_logger>("multi_sink", dist_filter_sink,
+                                                                     NAV::ConfigManager::Get<size_t>("log-queue-size", 8192),
+                                                                     policy,
+                                                                     NAV::ConfigManager::Get<size_t>("log-rate-limit", 0));
+        // Set the logger as default logger
+        spdlog::set_default_logger(_asyncLogger);
+
+        // Level should be smaller or equal to the level of the sinks
+        spdlog::set_level(spdlog::level::from_str(NAV::ConfigManager::Get<std::string>("global-log-level", "trace")));
+        // Flushing every message would double the load on the writer thread
+        spdlog::flush_on(spdlog::level::err);
+        spdlog::flush_every(std::chrono::seconds(1));
+    }
+    else
+    {
+        // Set the logger as default logger
+        spdlog::set_default_logger(std::make_shared<spdlog::logger>("multi_sink", dist_filter_sink));
 
-    // Level should be smaller or equal to the level of the sinks
-    spdlog::set_level(spdlog::level::from_str(NAV::ConfigManager::Get<std::string>("global-log-level", "trace")));
-    // Minimum level which automatically triggers a flush
-    spdlog::flush_on(spdlog::level::trace);
+        // Level should be smaller or equal to the level of the sinks
+        spdlog::set_level(spdlog::level::from_str(NAV::ConfigManager::Get<std::string>("global-log-level", "trace")));
+        // Minimum level which automatically triggers a flush
+        spdlog::flush_on(spdlog::level::trace);
+    }
 
     writeHeader();
     if (NAV::ConfigManager::HasKey("log-filter"))
@@ -174,13 +204,32 @@ Logger::~Logger()
     writeFooter();
 
     spdlog::default_logger()->flush();
+
+    if (_asyncLogger && spdlog::default_logger() == _asyncLogger)
+    {
+        // Switch back to synchronous logging and wait for the writer thread to empty the queue
+        auto sinks = _asyncLogger->backend_sinks();
+        spdlog::set_default_logger(std::make_shared<spdlog::logger>("multi_sink", sinks.begin(), sinks.end()));
+        _asyncLogger.reset();
+    }
 }
 
-const std::shared_ptr<spdlog::sinks::ringbuffer_sink_mt>& Logger::GetRingBufferSink()
+const std::shared_ptr<spdlog::sinks::sequenced_ringbuffer_sink_mt>& Logger::GetRingBufferSink()
 {
     return _ringBufferSink;
 }
 
+Logger::DroppedMessages Logger::GetDroppedMessages()
+{
+    if (_asyncLogger == nullptr) { return {}; }
+
+    DroppedMessages dropped;
+    dropped.overrun = _asyncLogger->overrun_counter();
+    dropped.sampled = _asyncLogger->sampled_counter();
+    dropped.rateLimited = _asyncLogger->rate_limited_counter();
+    return dropped;
+}
+
 void Logger::writeSeparator() noexcept
 {
     LOG_INFO("===========================================================================================");
@@ -213,5 +262,11 @@ void Logger::writeFooter() noexcept
 
     LOG_INFO("Program finished on {:04d}-{:02d}-{:02d}", 1900 + t->tm_year, 1 + t->tm_mon, t->tm_mday);
 
+    if (_asyncLogger)
+    {
+        [[maybe_unused]] auto dropped = GetDroppedMessages();
+        LOG_INFO("Dropped log messages: {} overrun, {} sampled, {} rate limited", dropped.overrun, dropped.sampled, dropped.rateLimited);
+    }
+
     writeSeparator();
 }
\ No newline at end of file
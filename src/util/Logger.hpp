@@ -49,11 +49,17 @@
 
 #include "spdlog/spdlog.h"
 #include "spdlog/fmt/ostr.h"
-#include "spdlog/sinks/ringbuffer_sink.h"
+#include "util/Logger/sequenced_ringbuffer_sink.hpp"
 #include <fmt/std.h>
 
 #include <string>
 #include <stdexcept>
+#include <memory>
+
+namespace spdlog
+{
+class backpressure_logger;
+} // namespace spdlog
 
 // Macros are redefined in case SPDLOG is not available anymore and it needs to be switched to another Logger
 
@@ -105,11 +111,25 @@ class Logger
     Logger& operator=(Logger&&) = default;
 
     /// @brief Returns the ring buffer sink
-    static const std::shared_ptr<spdlog::sinks::ringbuffer_sink_mt>& GetRingBufferSink();
+    static const std::shared_ptr<spdlog::sinks::sequenced_ringbuffer_sink_mt>& GetRingBufferSink();
+
+    /// @brief Counters of log messages which were not written by the asynchronous logger
+    struct DroppedMessages
+    {
+        size_t overrun = 0;     ///< Messages overwritten in the full queue (drop policy)
+        size_t sampled = 0;     ///< Messages discarded while the queue was congested (sample policy)
+        size_t rateLimited = 0; ///< Messages discarded because a node exceeded the rate limit
+    };
+
+    /// @brief Returns the counters of dropped messages. All zero if not logging asynchronously.
+    static DroppedMessages GetDroppedMessages();
 
   private:
     /// @brief Ring buffer sink
-    static inline std::shared_ptr<spdlog::sinks::ringbuffer_sink_mt> _ringBufferSink = nullptr;
+    static inline std::shared_ptr<spdlog::sinks::sequenced_ringbuffer_sink_mt> _ringBufferSink = nullptr;
+
+    /// @brief Asynchronous logger front-end (only set if logging asynchronously)
+    static inline std::shared_ptr<spdlog::backpressure_logger> _asyncLogger = nullptr;
 
     /// @brief Writes a separation line to the console only
     static void writeSeparator() noexcept;
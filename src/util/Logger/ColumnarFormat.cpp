@@ -0,0 +1,391 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ColumnarFormat.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+#include <nlohmann/json.hpp>
+using json = nlohmann::json; ///< json namespace
+
+namespace NAV::ColumnarFormat
+{
+namespace
+{
+
+/// Nanoseconds per GPS week
+constexpr int64_t NANOSECONDS_PER_WEEK = 604800LL * 1'000'000'000LL;
+
+/// @brief Appends a trivially copyable value
+template<typename T>
+void writeValue(std::string& out, const T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    auto offset = out.size();
+    out.resize(offset + sizeof(T));
+    std::memcpy(out.data() + offset, &value, sizeof(T));
+}
+
+/// @brief Appends a string with its length
+void writeString(std::string& out, const std::string& str)
+{
+    writeValue(out, static_cast<uint32_t>(str.size()));
+    out.append(str);
+}
+
+/// @brief Reads values from the file content
+class Reader
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] data Data to read
+    explicit Reader(std::string_view data)
+        : _data(data) {}
+
+    /// @brief Reads a trivially copyable value
+    template<typename T>
+    [[nodiscard]] T readValue()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value{};
+        if (!available(sizeof(T))) { return value; }
+        std::memcpy(&value, _data.data() + _pos, sizeof(T));
+        _pos += sizeof(T);
+        return value;
+    }
+
+    /// @brief Reads a string with its length
+    [[nodiscard]] std::string readString()
+    {
+        auto size = readValue<uint32_t>();
+        return std::string(readBytes(size));
+    }
+
+    /// @brief Reads the given amount of bytes
+    [[nodiscard]] std::string_view readBytes(size_t size)
+    {
+        if (!available(size)) { return {}; }
+        auto bytes = _data.substr(_pos, size);
+        _pos += size;
+        return bytes;
+    }
+
+    /// @brief Current read position
+    [[nodiscard]] size_t position() const { return _pos; }
+
+    /// @brief Checks whether all reads so far were inside the data
+    [[nodiscard]] bool ok() const { return _ok; }
+
+  private:
+    /// @brief Checks whether the amount of bytes can be read and marks the reader as failed if not
+    bool available(size_t size)
+    {
+        if (!_ok || _data.size() - _pos < size)
+        {
+            _ok = false;
+            return false;
+        }
+        return true;
+    }
+
+    /// Data to read
+    std::string_view _data;
+    /// Read position
+    size_t _pos = 0;
+    /// Flag whether all reads succeeded
+    bool _ok = true;
+};
+
+/// @brief Determines the smallest encoding, which holds all present values without loss
+/// @param[in] values Values of the column (NaN if not present)
+/// @param[out] presentCount Amount of present values
+Encoding determineEncoding(const std::vector<double>& values, size_t& presentCount)
+{
+    presentCount = 0;
+    bool constant = true;
+    bool int32 = true;
+    bool flt = true;
+    double first = 0.0;
+    for (const auto& value : values)
+    {
+        if (std::isnan(value)) { continue; }
+        if (presentCount++ == 0) { first = value; }
+        constant &= std::memcmp(&value, &first, sizeof(double)) == 0;
+        int32 &= value >= std::numeric_limits<int32_t>::min() && value <= std::numeric_limits<int32_t>::max()
+                 && std::trunc(value) == value && !(value == 0.0 && std::signbit(value));
+        flt &= static_cast<double>(static_cast<float>(value)) == value;
+    }
+
+    if (presentCount == 0) { return Encoding::Missing; }
+    if (constant && presentCount > 1) { return Encoding::Constant; }
+    if (int32) { return Encoding::Int32; }
+    if (flt) { return Encoding::Float; }
+    return Encoding::Double;
+}
+
+/// @brief Appends the present values of the column in the given type
+template<typename T>
+void writeColumnValues(std::string& out, const std::vector<double>& values, size_t presentCount)
+{
+    auto offset = out.size();
+    out.resize(offset + presentCount * sizeof(T));
+    auto* dst = out.data() + offset;
+    for (const auto& value : values)
+    {
+        if (std::isnan(value)) { continue; }
+        auto converted = static_cast<T>(value);
+        std::memcpy(dst, &converted, sizeof(T));
+        dst += sizeof(T); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+}
+
+/// @brief Reads the present values of the column in the given type
+/// @param[in, out] reader Reader positioned at the values
+/// @param[in] bitmap Presence bitmap (empty if all rows are present)
+/// @param[out] column Values of the column
+template<typename T>
+void readColumnValues(Reader& reader, std::string_view bitmap, std::vector<double>& column)
+{
+    for (size_t r = 0; r < column.size(); r++)
+    {
+        if (!bitmap.empty() && !(static_cast<uint8_t>(bitmap[r / 8]) & (1U << (r % 8)))) { continue; }
+        column[r] = static_cast<double>(reader.readValue<T>());
+    }
+}
+
+} // namespace
+
+int64_t ToGpsNanoseconds(const InsTime& insTime)
+{
+    if (insTime.empty()) { return NO_TIME; }
+
+    auto gpsTime = insTime.toGPSweekTow();
+    auto weeks = static_cast<int64_t>(gpsTime.gpsCycle) * InsTimeUtil::WEEKS_PER_GPS_CYCLE + gpsTime.gpsWeek;
+    return weeks * NANOSECONDS_PER_WEEK + std::llround(gpsTime.tow * 1e9L);
+}
+
+InsTime FromGpsNanoseconds(int64_t nanoseconds)
+{
+    if (nanoseconds == NO_TIME) { return {}; }
+
+    auto weeks = nanoseconds / NANOSECONDS_PER_WEEK;
+    auto towNanoseconds = nanoseconds % NANOSECONDS_PER_WEEK;
+    return { 0, static_cast<int32_t>(weeks), static_cast<long double>(towNanoseconds) * 1e-9L };
+}
+
+void AppendFileHeader(std::string& out, const Schema& schema)
+{
+    auto dynamicBegin = schema.columns.begin() + static_cast<std::ptrdiff_t>(std::min(schema.staticColumnCount, schema.columns.size()));
+
+    json j;
+    j["dataType"] = schema.dataType;
+    j["staticColumns"] = std::vector<std::string>(schema.columns.begin(), dynamicBegin);
+    j["dynamicColumns"] = std::vector<std::string>(dynamicBegin, schema.columns.end());
+
+    out.append(MAGIC);
+    writeValue(out, VERSION);
+    writeString(out, j.dump());
+}
+
+void AppendSchemaChunk(std::string& out, std::span<const std::string> columns)
+{
+    writeValue(out, ChunkType::Schema);
+    auto sizeOffset = out.size();
+    writeValue(out, uint32_t(0));
+
+    writeValue(out, static_cast<uint32_t>(columns.size()));
+    for (const auto& column : columns) { writeString(out, column); }
+
+    auto payloadSize = static_cast<uint32_t>(out.size() - sizeOffset - sizeof(uint32_t));
+    std::memcpy(out.data() + sizeOffset, &payloadSize, sizeof(uint32_t));
+}
+
+void AppendDataChunk(std::string& out, std::span<const int64_t> times, const std::vector<std::vector<double>>& columns)
+{
+    auto rowCount = times.size();
+
+    writeValue(out, ChunkType::Data);
+    auto sizeOffset = out.size();
+    writeValue(out, uint32_t(0));
+
+    writeValue(out, static_cast<uint32_t>(rowCount));
+    writeValue(out, static_cast<uint32_t>(columns.size()));
+    auto firstTime = std::find_if(times.begin(), times.end(), [](int64_t t) { return t != NO_TIME; });
+    auto lastTime = std::find_if(times.rbegin(), times.rend(), [](int64_t t) { return t != NO_TIME; });
+    writeValue(out, firstTime != times.end() ? *firstTime : NO_TIME);
+    writeValue(out, lastTime != times.rend() ? *lastTime : NO_TIME);
+
+    auto timeOffset = out.size();
+    out.resize(timeOffset + rowCount * sizeof(int64_t));
+    std::memcpy(out.data() + timeOffset, times.data(), rowCount * sizeof(int64_t));
+
+    for (const auto& column : columns)
+    {
+        size_t presentCount = 0;
+        auto encoding = determineEncoding(column, presentCount);
+        bool hasBitmap = encoding != Encoding::Missing && presentCount != rowCount;
+        writeValue(out, static_cast<uint8_t>(static_cast<uint8_t>(encoding) | (hasBitmap ? BITMAP_FLAG : 0)));
+
+        if (hasBitmap)
+        {
+            auto bitmapOffset = out.size();
+            out.resize(bitmapOffset + (rowCount + 7) / 8, '\0');
+            for (size_t r = 0; r < rowCount; r++)
+            {
+                if (!std::isnan(column[r])) { out[bitmapOffset + r / 8] = static_cast<char>(static_cast<uint8_t>(out[bitmapOffset + r / 8]) | (1U << (r % 8))); }
+            }
+        }
+
+        switch (encoding)
+        {
+        case Encoding::Missing:
+            break;
+        case Encoding::Constant:
+            writeValue(out, *std::find_if(column.begin(), column.end(), [](double v) { return !std::isnan(v); }));
+            break;
+        case Encoding::Int32:
+            writeColumnValues<int32_t>(out, column, presentCount);
+            break;
+        case Encoding::Float:
+            writeColumnValues<float>(out, column, presentCount);
+            break;
+        case Encoding::Double:
+            writeColumnValues<double>(out, column, presentCount);
+            break;
+        }
+    }
+
+    auto payloadSize = static_cast<uint32_t>(out.size() - sizeOffset - sizeof(uint32_t));
+    std::memcpy(out.data() + sizeOffset, &payloadSize, sizeof(uint32_t));
+}
+
+std::optional<FileIndex> ReadIndex(std::string_view data)
+{
+    if (!data.starts_with(MAGIC)) { return std::nullopt; }
+
+    Reader reader(data.substr(MAGIC.size()));
+    if (reader.readValue<uint32_t>() != VERSION) { return std::nullopt; }
+
+    FileIndex index;
+    try
+    {
+        auto j = json::parse(reader.readString());
+        j.at("dataType").get_to(index.schema.dataType);
+        j.at("staticColumns").get_to(index.schema.columns);
+        index.schema.staticColumnCount = index.schema.columns.size();
+        for (const auto& column : j.at("dynamicColumns")) { index.schema.columns.push_back(column.get<std::string>()); }
+    }
+    catch (const std::exception& /* e */)
+    {
+        return std::nullopt;
+    }
+    if (!reader.ok()) { return std::nullopt; }
+
+    while (reader.position() + MAGIC.size() < data.size())
+    {
+        auto type = reader.readValue<ChunkType>();
+        auto size = reader.readValue<uint32_t>();
+        auto offset = MAGIC.size() + reader.position();
+        Reader payload(reader.readBytes(size));
+        if (!reader.ok())
+        {
+            index.truncated = true;
+            break;
+        }
+
+        if (type == ChunkType::Schema)
+        {
+            auto count = payload.readValue<uint32_t>();
+            for (uint32_t i = 0; i < count && payload.ok(); i++)
+            {
+                index.schema.columns.push_back(payload.readString());
+            }
+        }
+        else if (type == ChunkType::Data)
+        {
+            ChunkInfo chunk{ .type = type, .offset = offset, .size = size };
+            chunk.rowCount = payload.readValue<uint32_t>();
+            [[maybe_unused]] auto columnCount = payload.readValue<uint32_t>();
+            chunk.firstTime = payload.readValue<int64_t>();
+            chunk.lastTime = payload.readValue<int64_t>();
+            index.rowCount += chunk.rowCount;
+            index.chunks.push_back(chunk);
+        }
+        if (!payload.ok())
+        {
+            index.truncated = true;
+            break;
+        }
+    }
+
+    return index;
+}
+
+bool ReadDataChunk(std::string_view data, const ChunkInfo& chunk,
+                   std::vector<int64_t>& times, std::vector<std::vector<double>>& columns, size_t columnCount)
+{
+    if (chunk.type != ChunkType::Data || chunk.offset + chunk.size > data.size()) { return false; }
+
+    Reader reader(data.substr(chunk.offset, chunk.size));
+    auto rowCount = reader.readValue<uint32_t>();
+    auto chunkColumnCount = reader.readValue<uint32_t>();
+    [[maybe_unused]] auto firstTime = reader.readValue<int64_t>();
+    [[maybe_unused]] auto lastTime = reader.readValue<int64_t>();
+
+    auto timeBytes = reader.readBytes(rowCount * sizeof(int64_t));
+    if (!reader.ok()) { return false; }
+    times.resize(rowCount);
+    std::memcpy(times.data(), timeBytes.data(), timeBytes.size());
+
+    columns.resize(std::max(columnCount, static_cast<size_t>(chunkColumnCount)));
+    for (size_t c = 0; c < columns.size(); c++)
+    {
+        auto& column = columns[c];
+        column.assign(rowCount, std::nan(""));
+        if (c >= chunkColumnCount) { continue; }
+
+        auto encodingByte = reader.readValue<uint8_t>();
+        std::string_view bitmap;
+        if (encodingByte & BITMAP_FLAG) { bitmap = reader.readBytes((rowCount + 7) / 8); }
+
+        switch (static_cast<Encoding>(encodingByte & ~BITMAP_FLAG))
+        {
+        case Encoding::Missing:
+            break;
+        case Encoding::Constant:
+        {
+            auto value = reader.readValue<double>();
+            for (size_t r = 0; r < rowCount; r++)
+            {
+                if (bitmap.empty() || (static_cast<uint8_t>(bitmap[r / 8]) & (1U << (r % 8)))) { column[r] = value; }
+            }
+            break;
+        }
+        case Encoding::Int32:
+            readColumnValues<int32_t>(reader, bitmap, column);
+            break;
+        case Encoding::Float:
+            readColumnValues<float>(reader, bitmap, column);
+            break;
+        case Encoding::Double:
+            readColumnValues<double>(reader, bitmap, column);
+            break;
+        default:
+            return false;
+        }
+        if (!reader.ok()) { return false; }
+    }
+    columns.resize(columnCount);
+
+    return reader.ok();
+}
+
+} // namespace NAV::ColumnarFormat
@@ -0,0 +1,137 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file ColumnarFormat.hpp
+/// @brief Self-describing binary columnar log format
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-14
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Navigation/Time/InsTime.hpp"
+
+/// @brief Binary columnar log format
+///
+/// A file starts with the magic bytes, the format version and the schema as json text (data type and column descriptors).
+/// It is followed by chunks, each consisting of the chunk type, the payload size and the payload:
+/// - Schema chunks append columns (dynamic data descriptors which appear later in the stream) to the schema.
+/// - Data chunks contain the row count, the column count, the time range of the chunk, the time of every row
+///   (GPST nanoseconds since the GPS epoch) and then every column separately.
+///   A column is stored with the smallest type, which holds all its values in the chunk without loss (int32, float or double),
+///   and a presence bitmap if some rows have no value.
+///
+/// Because every chunk carries its size, a file which was not closed properly can be read up to the last complete chunk.
+/// The values are written in the native byte order (little-endian on all supported platforms).
+namespace NAV::ColumnarFormat
+{
+/// Magic bytes at the start of the file
+constexpr std::string_view MAGIC = "INSTCOL1";
+/// Version of the format
+constexpr uint32_t VERSION = 1;
+/// Time value of rows without time
+constexpr int64_t NO_TIME = std::numeric_limits<int64_t>::min();
+
+/// @brief Types of chunks
+enum class ChunkType : uint8_t
+{
+    Schema = 'S', ///< New columns are appended to the schema
+    Data = 'D',   ///< Rows of data
+};
+
+/// @brief Storage type of a column inside a data chunk
+enum class Encoding : uint8_t
+{
+    Missing = 0,  ///< No row has a value
+    Int32 = 1,    ///< All values are integers which fit into int32
+    Float = 2,    ///< All values can be represented as float
+    Double = 3,   ///< Values stored as double
+    Constant = 4, ///< All values are the same and stored once as double
+};
+
+/// Flag in the encoding byte, which signals that a presence bitmap follows
+constexpr uint8_t BITMAP_FLAG = 0x80;
+
+/// @brief Description of the columns
+struct Schema
+{
+    std::string dataType;             ///< Data identifier of the logged observations
+    std::vector<std::string> columns; ///< Column descriptors (static descriptors followed by the dynamic ones)
+    size_t staticColumnCount = 0;     ///< Amount of static data descriptors at the start of the columns
+};
+
+/// @brief Information about a chunk in the file
+struct ChunkInfo
+{
+    ChunkType type = ChunkType::Data; ///< Type of the chunk
+    size_t offset = 0;                ///< Offset of the payload from the start of the file
+    size_t size = 0;                  ///< Size of the payload in bytes
+    uint32_t rowCount = 0;            ///< Amount of rows (data chunks only)
+    int64_t firstTime = NO_TIME;      ///< Time of the first row with a time (data chunks only)
+    int64_t lastTime = NO_TIME;       ///< Time of the last row with a time (data chunks only)
+};
+
+/// @brief Index of a file, which is created by scanning the chunk headers
+struct FileIndex
+{
+    Schema schema;                 ///< Schema with all columns of the file
+    std::vector<ChunkInfo> chunks; ///< Data chunks in the order of the file
+    size_t rowCount = 0;           ///< Amount of rows over all data chunks
+    bool truncated = false;        ///< Flag whether the file ends with an incomplete chunk
+};
+
+/// @brief Converts the time into GPST nanoseconds since the GPS epoch
+/// @param[in] insTime Time to convert
+/// @return Nanoseconds or NO_TIME if the time is empty
+[[nodiscard]] int64_t ToGpsNanoseconds(const InsTime& insTime);
+
+/// @brief Converts GPST nanoseconds since the GPS epoch into a time
+/// @param[in] nanoseconds Nanoseconds or NO_TIME
+/// @return The time (empty for NO_TIME)
+[[nodiscard]] InsTime FromGpsNanoseconds(int64_t nanoseconds);
+
+/// @brief Appends the file header with the embedded schema
+/// @param[in, out] out Output buffer
+/// @param[in] schema Schema of the file
+void AppendFileHeader(std::string& out, const Schema& schema);
+
+/// @brief Appends a chunk, which adds columns to the schema
+/// @param[in, out] out Output buffer
+/// @param[in] columns Descriptors of the new columns
+void AppendSchemaChunk(std::string& out, std::span<const std::string> columns);
+
+/// @brief Appends a chunk with rows of data
+/// @param[in, out] out Output buffer
+/// @param[in] times Time of every row (NO_TIME if the row has no time)
+/// @param[in] columns Values of every column, each with one value per row (NaN if the row has no value)
+void AppendDataChunk(std::string& out, std::span<const int64_t> times, const std::vector<std::vector<double>>& columns);
+
+/// @brief Reads the header and scans the chunks of a file
+/// @param[in] data Content of the file
+/// @return The index or std::nullopt if the file is not a valid columnar log
+[[nodiscard]] std::optional<FileIndex> ReadIndex(std::string_view data);
+
+/// @brief Decodes a data chunk
+/// @param[in] data Content of the file
+/// @param[in] chunk Chunk to decode
+/// @param[out] times Time of every row
+/// @param[out] columns Values of every column. Columns which are not part of the chunk are filled with NaN.
+/// @param[in] columnCount Amount of columns to return (the column count of the schema)
+/// @return True if the chunk could be decoded
+bool ReadDataChunk(std::string_view data, const ChunkInfo& chunk,
+                   std::vector<int64_t>& times, std::vector<std::vector<double>>& columns, size_t columnCount);
+
+} // namespace NAV::ColumnarFormat
@@ -85,4 +85,22 @@ CommonLog::LocalPosition CommonLog::calcLocalPosition(const Eigen::Vector3d& lla
     return { .northSouth = northSouth, .eastWest = eastWest };
 }
 
+json CommonLog::saveCheckpoint()
+{
+    std::scoped_lock lk(_mutex);
+    json j = json::object();
+    if (!_startTime.empty()) { j["startTime"] = _startTime; }
+    if (!std::isnan(_originLatitude)) { j["originLatitude"] = _originLatitude; }
+    if (!std::isnan(_originLongitude)) { j["originLongitude"] = _originLongitude; }
+    return j;
+}
+
+void CommonLog::restoreCheckpoint(const json& j)
+{
+    std::scoped_lock lk(_mutex);
+    if (j.contains("startTime")) { j.at("startTime").get_to(_startTime); }
+    if (j.contains("originLatitude")) { j.at("originLatitude").get_to(_originLatitude); }
+    if (j.contains("originLongitude")) { j.at("originLongitude").get_to(_originLongitude); }
+}
+
 } // namespace NAV
\ No newline at end of file
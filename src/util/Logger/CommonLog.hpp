@@ -16,6 +16,9 @@
 #include <mutex>
 #include <vector>
 
+#include <nlohmann/json.hpp>
+using json = nlohmann::json; ///< json namespace
+
 #include "util/Eigen.hpp"
 #include "Navigation/Time/InsTime.hpp"
 
@@ -56,6 +59,14 @@ class CommonLog
     /// @return Local positions in north/south and east/west directions in [m]
     static LocalPosition calcLocalPosition(const Eigen::Vector3d& lla_position);
 
+    /// @brief Saves the common log variables for a checkpoint
+    /// @return Json object with the variables which are set already
+    [[nodiscard]] static json saveCheckpoint();
+
+    /// @brief Restores the common log variables from a checkpoint
+    /// @param[in] j Json object returned by saveCheckpoint()
+    static void restoreCheckpoint(const json& j);
+
   protected:
     /// @brief Default constructor
     CommonLog();
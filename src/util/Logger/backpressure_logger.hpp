@@ -0,0 +1,180 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file backpressure_logger.hpp
+/// @brief Logger front-end which applies rate limiting and sampling before handing messages to an asynchronous logger
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-05
+
+#pragma once
+
+#include "spdlog/async.h"
+#include "spdlog/async_logger.h"
+#include "spdlog/details/thread_pool.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace spdlog
+{
+
+/// @brief Behavior of the logger if the queue to the writer thread is full
+enum class backpressure_policy : uint8_t
+{
+    block,  ///< Block the calling thread till space is available in the queue
+    drop,   ///< Overwrite the oldest message in the queue
+    sample, ///< Only forward every n-th message below warning level while the queue is congested. Otherwise block.
+};
+
+/// @brief Logger front-end which filters messages on the calling thread and forwards them to an asynchronous logger
+///
+/// The async logger passes all messages through a queue to a dedicated writer thread, so that the calling threads
+/// do not have to wait for the sink mutexes. This front-end additionally
+/// - limits the amount of messages per second and source (node name prefix 'Name (id): ' or source location).
+///   Warnings and errors are never suppressed.
+/// - samples messages below warning level if the queue is filled more than 3/4 and the sample policy is active.
+///
+/// The filtering is lock-free, so that the node worker threads do not serialize here.
+class backpressure_logger : public spdlog::logger // NOLINT(cppcoreguidelines-virtual-class-destructor)
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] name Name of the logger
+    /// @param[in] sink Sink to write the messages into (called from the writer thread)
+    /// @param[in] queueSize Maximum amount of messages in the queue to the writer thread
+    /// @param[in] policy Behavior of the logger if the queue to the writer thread is full
+    /// @param[in] rateLimit Maximum amount of messages per second and source below warning level (0 = unlimited)
+    /// @param[in] sampleRate Only every n-th message is forwarded when sampling is active
+    backpressure_logger(std::string name, sink_ptr sink, size_t queueSize, backpressure_policy policy, size_t rateLimit, size_t sampleRate = 10)
+        : logger(name),
+          _threadPool(std::make_shared<details::thread_pool>(queueSize, 1)),
+          _backend(std::make_shared<async_logger>(std::move(name), std::move(sink), _threadPool,
+                                                  policy == backpressure_policy::drop ? async_overflow_policy::overrun_oldest
+                                                                                      : async_overflow_policy::block)),
+          _policy(policy),
+          _queueSize(queueSize),
+          _rateLimit(rateLimit),
+          _sampleRate(sampleRate == 0 ? 1 : sampleRate)
+    {
+        _backend->set_level(level::trace);
+        _backend->flush_on(level::off);
+    }
+
+    /// @brief Destructor. Waits till the writer thread wrote all messages in the queue.
+    ~backpressure_logger() override = default;
+    /// @brief Copy constructor
+    backpressure_logger(const backpressure_logger&) = delete;
+    /// @brief Move constructor
+    backpressure_logger(backpressure_logger&&) = delete;
+    /// @brief Copy assignment operator
+    backpressure_logger& operator=(const backpressure_logger&) = delete;
+    /// @brief Move assignment operator
+    backpressure_logger& operator=(backpressure_logger&&) = delete;
+
+    /// @brief Amount of messages overwritten in the queue because it was full (drop policy)
+    [[nodiscard]] size_t overrun_counter() const { return _threadPool->overrun_counter(); }
+
+    /// @brief Amount of messages discarded because the queue was congested (sample policy)
+    [[nodiscard]] size_t sampled_counter() const { return _sampledCounter.load(std::memory_order_relaxed); }
+
+    /// @brief Amount of messages discarded because a source exceeded the rate limit
+    [[nodiscard]] size_t rate_limited_counter() const { return _rateLimitedCounter.load(std::memory_order_relaxed); }
+
+    /// @brief Current amount of messages waiting for the writer thread
+    [[nodiscard]] size_t queue_size() const { return _threadPool->queue_size(); }
+
+    /// @brief Sinks the writer thread writes into (the logger itself has no sinks and forwards to the backend)
+    [[nodiscard]] const std::vector<sink_ptr>& backend_sinks() const { return _backend->sinks(); }
+
+  protected:
+    /// @brief Function called to process the log message
+    /// @param msg Log message struct
+    void sink_it_(const details::log_msg& msg) override
+    {
+        if (msg.level < level::warn)
+        {
+            if (_rateLimit != 0 && isRateLimited(msg))
+            {
+                _rateLimitedCounter.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            if (_policy == backpressure_policy::sample && _threadPool->queue_size() >= _queueSize / 4 * 3
+                && _sampleCounter.fetch_add(1, std::memory_order_relaxed) % _sampleRate != 0)
+            {
+                _sampledCounter.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+        _backend->log(msg.time, msg.source, msg.level, msg.payload);
+        if (should_flush_(msg)) { _backend->flush(); }
+    }
+
+    /// @brief Flushes the backend logger
+    void flush_() override
+    {
+        _backend->flush();
+    }
+
+  private:
+    /// @brief Message counter per source and second
+    struct RateBucket
+    {
+        std::atomic<int64_t> second{ 0 };  ///< Second since epoch, the counter refers to
+        std::atomic<uint32_t> counter{ 0 }; ///< Amount of messages within the second
+    };
+
+    /// Amount of rate limit buckets. Sources hashing into the same bucket share their limit.
+    static constexpr size_t RATE_BUCKETS = 256;
+
+    std::shared_ptr<details::thread_pool> _threadPool; ///< Writer thread and queue (has to outlive the backend)
+    std::shared_ptr<async_logger> _backend;            ///< Asynchronous logger which passes the messages to the writer thread
+    backpressure_policy _policy;                       ///< Behavior of the logger if the queue is full
+    size_t _queueSize;                                 ///< Maximum amount of messages in the queue
+    size_t _rateLimit;                                 ///< Maximum amount of messages per second and source (0 = unlimited)
+    size_t _sampleRate;                                ///< Only every n-th message is forwarded when sampling
+
+    std::array<RateBucket, RATE_BUCKETS> _rateBuckets; ///< Message counters for the rate limiting
+    std::atomic<size_t> _sampleCounter{ 0 };           ///< Counter to determine which messages to keep while sampling
+    std::atomic<size_t> _sampledCounter{ 0 };          ///< Amount of messages discarded by sampling
+    std::atomic<size_t> _rateLimitedCounter{ 0 };      ///< Amount of messages discarded by the rate limit
+
+    /// @brief Checks whether the source of the message exceeded its rate limit and counts the message
+    /// @param msg Log message struct
+    /// @return True if the message should be discarded
+    bool isRateLimited(const details::log_msg& msg)
+    {
+        std::string_view payload(msg.payload.data(), msg.payload.size());
+        // Node messages are prefixed with 'Name (id): '
+        size_t hash = 0;
+        if (auto pos = payload.find("): "); pos != std::string_view::npos)
+        {
+            hash = std::hash<std::string_view>{}(payload.substr(0, pos));
+        }
+        else if (msg.source.filename != nullptr)
+        {
+            hash = std::hash<std::string_view>{}(msg.source.filename) ^ static_cast<size_t>(msg.source.line);
+        }
+
+        auto& bucket = _rateBuckets.at(hash % RATE_BUCKETS);
+        int64_t second = std::chrono::duration_cast<std::chrono::seconds>(msg.time.time_since_epoch()).count();
+        int64_t bucketSecond = bucket.second.load(std::memory_order_relaxed);
+        if (bucketSecond != second && bucket.second.compare_exchange_strong(bucketSecond, second, std::memory_order_relaxed))
+        {
+            bucket.counter.store(0, std::memory_order_relaxed);
+        }
+        return bucket.counter.fetch_add(1, std::memory_order_relaxed) >= _rateLimit;
+    }
+};
+
+} // namespace spdlog
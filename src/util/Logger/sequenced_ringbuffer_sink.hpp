@@ -0,0 +1,123 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file sequenced_ringbuffer_sink.hpp
+/// @brief Ring buffer sink which numbers the log lines, so that readers can fetch only the new lines
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-15
+
+#pragma once
+
+#include "spdlog/sinks/base_sink.h"
+#include "spdlog/details/null_mutex.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace spdlog::sinks
+{
+
+/// @brief Formatted log line with its sequence number
+struct sequenced_log_line
+{
+    uint64_t seq = 0;                              ///< Sequence number of the line
+    spdlog::level::level_enum level = level::info; ///< Level of the log message
+    std::string text;                              ///< Formatted line without the line ending
+};
+
+/// @brief Ring buffer sink which numbers the log lines
+///
+/// Messages spanning several lines are split into one entry per line, so that every entry has the same height when displayed.
+/// The lines are stored as shared pointers, so readers copy only pointers while holding the lock.
+template<typename Mutex>
+class sequenced_ringbuffer_sink : public spdlog::sinks::base_sink<Mutex> // NOLINT(cppcoreguidelines-virtual-class-destructor)
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] n_items Maximum amount of lines to keep
+    explicit sequenced_ringbuffer_sink(size_t n_items)
+        : capacity_(n_items) {}
+    /// @brief Destructor
+    ~sequenced_ringbuffer_sink() override = default;
+    /// @brief Copy constructor
+    sequenced_ringbuffer_sink(const sequenced_ringbuffer_sink&) = delete;
+    /// @brief Move constructor
+    sequenced_ringbuffer_sink(sequenced_ringbuffer_sink&&) noexcept = delete;
+    /// @brief Copy assignment operator
+    sequenced_ringbuffer_sink& operator=(const sequenced_ringbuffer_sink&) = delete;
+    /// @brief Move assignment operator
+    sequenced_ringbuffer_sink& operator=(sequenced_ringbuffer_sink&&) noexcept = delete;
+
+    /// @brief Maximum amount of lines kept
+    [[nodiscard]] size_t capacity() const { return capacity_; }
+
+    /// @brief Appends all stored lines with a sequence number greater or equal to the given one
+    /// @param[in] seq Sequence number of the first line to read (usually the return value of the last call)
+    /// @param[in, out] lines Vector to append the lines to
+    /// @return Sequence number of the next line which will be logged
+    uint64_t read_since(uint64_t seq, std::vector<std::shared_ptr<const sequenced_log_line>>& lines)
+    {
+        std::lock_guard<Mutex> lock(spdlog::sinks::base_sink<Mutex>::mutex_);
+        uint64_t first = next_seq_ - buffer_.size();
+        for (uint64_t s = std::max(seq, first); s < next_seq_; s++)
+        {
+            lines.push_back(buffer_[s - first]);
+        }
+        return next_seq_;
+    }
+
+  protected:
+    /// @brief Function called to process the log message
+    /// @param msg Log message struct
+    void sink_it_(const spdlog::details::log_msg& msg) override
+    {
+        spdlog::memory_buf_t formatted_buf;
+        spdlog::sinks::base_sink<Mutex>::formatter_->format(msg, formatted_buf);
+        std::string_view formatted(formatted_buf.data(), formatted_buf.size());
+
+        while (!formatted.empty() && (formatted.back() == '\n' || formatted.back() == '\r')) { formatted.remove_suffix(1); }
+        while (true)
+        {
+            auto eol = formatted.find('\n');
+            auto line = formatted.substr(0, eol);
+            if (!line.empty() && line.back() == '\r') { line.remove_suffix(1); }
+
+            if (buffer_.size() == capacity_) { buffer_.pop_front(); }
+            buffer_.push_back(std::make_shared<const sequenced_log_line>(sequenced_log_line{ .seq = next_seq_++, .level = msg.level, .text = std::string(line) }));
+
+            if (eol == std::string_view::npos) { break; }
+            formatted.remove_prefix(eol + 1);
+        }
+    }
+
+    /// @brief Function called to flush the sink
+    void flush_() override {}
+
+  private:
+    /// Maximum amount of lines kept
+    size_t capacity_;
+    /// Sequence number of the next line
+    uint64_t next_seq_ = 0;
+    /// Stored lines
+    std::deque<std::shared_ptr<const sequenced_log_line>> buffer_;
+};
+
+#ifndef DOXYGEN_IGNORE
+
+using sequenced_ringbuffer_sink_mt = sequenced_ringbuffer_sink<std::mutex>;
+using sequenced_ringbuffer_sink_st = sequenced_ringbuffer_sink<spdlog::details::null_mutex>;
+
+#endif
+
+} // namespace spdlog::sinks
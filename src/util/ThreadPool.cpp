@@ -0,0 +1,125 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace NAV
+{
+
+ThreadPool::ThreadPool(size_t threadCount)
+{
+    _threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        _threads.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::scoped_lock lk(_mutex);
+        _stop = true;
+    }
+    _cv.notify_all();
+    for (auto& thread : _threads)
+    {
+        if (thread.joinable()) { thread.join(); }
+    }
+}
+
+ThreadPool& ThreadPool::Shared()
+{
+    static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 2U) - 1);
+    return pool;
+}
+
+size_t ThreadPool::threadCount() const
+{
+    return _threads.size();
+}
+
+void ThreadPool::enqueue(std::function<void()> task)
+{
+    {
+        std::scoped_lock lk(_mutex);
+        _tasks.push_back(std::move(task));
+    }
+    _cv.notify_one();
+}
+
+void ThreadPool::workerLoop()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock lk(_mutex);
+            _cv.wait(lk, [&] { return _stop || !_tasks.empty(); });
+            if (_tasks.empty()) { return; }
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& func)
+{
+    if (count == 0) { return; }
+
+    // Helpers which start after all indices were processed must not touch the stack of this call anymore
+    struct State
+    {
+        std::atomic<size_t> next = 0;
+        size_t done = 0;
+        std::exception_ptr exception;
+        std::mutex mutex;
+        std::condition_variable cv;
+    };
+    auto state = std::make_shared<State>();
+
+    auto process = [state, count, &func]() {
+        size_t processed = 0;
+        for (size_t i = state->next.fetch_add(1); i < count; i = state->next.fetch_add(1))
+        {
+            try
+            {
+                func(i);
+            }
+            catch (...)
+            {
+                std::scoped_lock lk(state->mutex);
+                if (!state->exception) { state->exception = std::current_exception(); }
+            }
+            processed++;
+        }
+        if (processed == 0) { return; }
+
+        std::scoped_lock lk(state->mutex);
+        state->done += processed;
+        if (state->done == count) { state->cv.notify_all(); }
+    };
+
+    for (size_t i = 0; i < std::min(count - 1, threadCount()); i++)
+    {
+        enqueue(process);
+    }
+    process();
+
+    std::unique_lock lk(state->mutex);
+    state->cv.wait(lk, [&] { return state->done == count; });
+    if (state->exception) { std::rethrow_exception(state->exception); }
+}
+
+} // namespace NAV
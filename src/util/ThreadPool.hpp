@@ -0,0 +1,79 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file ThreadPool.hpp
+/// @brief Pool of worker threads for independent tasks
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-15
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NAV
+{
+
+/// @brief Pool of worker threads, which execute independent tasks
+class ThreadPool
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] threadCount Amount of worker threads to start
+    explicit ThreadPool(size_t threadCount);
+    /// @brief Destructor. Finishes the queued tasks and joins the worker threads
+    ~ThreadPool();
+    /// @brief Copy constructor
+    ThreadPool(const ThreadPool&) = delete;
+    /// @brief Move constructor
+    ThreadPool(ThreadPool&&) = delete;
+    /// @brief Copy assignment operator
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    /// @brief Move assignment operator
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    /// @brief Pool shared by the whole application with one worker less than the hardware threads
+    static ThreadPool& Shared();
+
+    /// @brief Amount of worker threads
+    [[nodiscard]] size_t threadCount() const;
+
+    /// @brief Calls the function for every index in [0, count) and returns after all calls finished
+    ///
+    /// The calling thread processes indices as well, so this can also be called from within a task of the pool.
+    /// If calls throw, the first exception is rethrown after all calls finished.
+    /// @param[in] count Amount of indices
+    /// @param[in] func Function to call with the index
+    void parallelFor(size_t count, const std::function<void(size_t)>& func);
+
+  private:
+    /// @brief Adds a task to the queue
+    /// @param[in] task Task to execute on a worker thread
+    void enqueue(std::function<void()> task);
+
+    /// @brief Loop of the worker threads
+    void workerLoop();
+
+    /// Worker threads
+    std::vector<std::thread> _threads;
+    /// Queued tasks
+    std::deque<std::function<void()>> _tasks;
+    /// Mutex for the task queue
+    std::mutex _mutex;
+    /// Signals new tasks and the stop request
+    std::condition_variable _cv;
+    /// Flag to stop the worker threads
+    bool _stop = false;
+};
+
+} // namespace NAV
@@ -8,6 +8,7 @@
 
 #include "TimeBase.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <ctime>
 
@@ -22,12 +23,19 @@ NAV::InsTime currentTime;
 
 std::chrono::steady_clock::time_point currentTimeComputer;
 
+std::atomic<NAV::util::time::Clock> clockSource = NAV::util::time::Clock::Computer;
+std::atomic<int64_t> virtualClockNs = 0;
+
 /* -------------------------------------------------------------------------------------------------------- */
 /*                                       Private Function Declarations                                      */
 /* -------------------------------------------------------------------------------------------------------- */
 
 namespace NAV::util::time
 {
+
+/// @brief Returns the current time point of the selected clock
+std::chrono::steady_clock::time_point clockNow();
+
 } // namespace NAV::util::time
 
 /* -------------------------------------------------------------------------------------------------------- */
@@ -52,6 +60,30 @@ void NAV::util::time::SetMode(NAV::util::time::Mode mode)
     timeMode = mode;
 }
 
+void NAV::util::time::SetClock(Clock clock)
+{
+    clockSource = clock;
+}
+
+NAV::util::time::Clock NAV::util::time::GetClock()
+{
+    return clockSource;
+}
+
+void NAV::util::time::SetVirtualClock(std::chrono::nanoseconds elapsed)
+{
+    virtualClockNs = elapsed.count();
+}
+
+std::chrono::steady_clock::time_point NAV::util::time::clockNow()
+{
+    if (clockSource == Clock::Virtual)
+    {
+        return std::chrono::steady_clock::time_point(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(virtualClockNs.load())));
+    }
+    return std::chrono::steady_clock::now();
+}
+
 NAV::InsTime NAV::util::time::GetCurrentInsTime()
 {
     if (timeMode == Mode::POST_PROCESSING || currentTime.empty())
@@ -59,7 +91,7 @@ NAV::InsTime NAV::util::time::GetCurrentInsTime()
         return currentTime;
     }
     // (timeMode == Mode::REAL_TIME)
-    auto elapsed = std::chrono::steady_clock::now() - currentTimeComputer;
+    auto elapsed = clockNow() - currentTimeComputer;
     return currentTime + elapsed;
 }
 
@@ -78,7 +110,7 @@ void NAV::util::time::SetCurrentTime(const NAV::InsTime& insTime)
         {
             LOG_INFO("Updating current Time [{}] to [{} ]", currentExactTime, insTime);
         }
-        currentTimeComputer = std::chrono::steady_clock::now();
+        currentTimeComputer = clockNow();
         currentTime = insTime;
         LOG_DATA("Updating current Time [{}] to [{} ]", currentExactTime, insTime);
     }
@@ -89,7 +121,7 @@ void NAV::util::time::SetCurrentTimeToComputerTime()
     std::time_t t = std::time(nullptr);
     std::tm* now = std::localtime(&t); // NOLINT(concurrency-mt-unsafe)
 
-    currentTimeComputer = std::chrono::steady_clock::now();
+    currentTimeComputer = clockNow();
     currentTime = InsTime{ static_cast<uint16_t>(now->tm_year + 1900), static_cast<uint16_t>(now->tm_mon) + 1, static_cast<uint16_t>(now->tm_mday),
                            static_cast<uint16_t>(now->tm_hour), static_cast<uint16_t>(now->tm_min), static_cast<long double>(now->tm_sec) };
 }
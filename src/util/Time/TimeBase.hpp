@@ -13,6 +13,8 @@
 
 #pragma once
 
+#include <chrono>
+
 #include "Navigation/Time/InsTime.hpp"
 
 namespace NAV::util::time
@@ -24,6 +26,13 @@ enum class Mode
     POST_PROCESSING, ///< Time will be set by FlowExecutor only
 };
 
+/// @brief Clocks which can be added to the last time update in real-time mode
+enum class Clock
+{
+    Computer, ///< Steady clock of the computer
+    Virtual,  ///< Virtual clock which is only advanced explicitly (e.g. by replay nodes). Makes real-time executions deterministic.
+};
+
 /// @brief Set the time mode
 /// @param[in] mode Real time or postprocessing
 void SetMode(Mode mode);
@@ -31,6 +40,17 @@ void SetMode(Mode mode);
 /// @brief Get the time mode
 Mode GetMode();
 
+/// @brief Selects the clock which is added to the last time update in real-time mode
+/// @param[in] clock Computer or virtual clock
+void SetClock(Clock clock);
+
+/// @brief Get the selected clock
+Clock GetClock();
+
+/// @brief Sets the virtual clock
+/// @param[in] elapsed Time elapsed since the start of the virtual clock
+void SetVirtualClock(std::chrono::nanoseconds elapsed);
+
 /// @brief Get the current time.
 /// @return Pointer to the current time or nullptr if it is not known yet.
 InsTime GetCurrentInsTime();
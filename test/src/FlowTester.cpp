@@ -34,7 +34,7 @@ std::vector<const char*> argv = { "",
 
 } // namespace NAV::TESTS
 
-bool NAV::TESTS::testFlow(const char* path, bool useTestDirectories)
+bool NAV::TESTS::testFlow(const char* path, bool useTestDirectories, const std::vector<std::string>& additionalArguments)
 {
     // Config Manager object
     NAV::ConfigManager::initialize();
@@ -47,7 +47,14 @@ bool NAV::TESTS::testFlow(const char* path, bool useTestDirectories)
     argv.at(4) = inputPath.c_str();
     argv.at(5) = outputPath.c_str();
 
-    int executionFailure = NAV::AppLogic::processCommandLineArguments(static_cast<int>(argv.size() - 1), argv.data());
+    std::vector<const char*> args(argv.begin(), argv.end() - 1); // Without the terminating nullptr
+    for (const auto& argument : additionalArguments)
+    {
+        args.push_back(argument.c_str());
+    }
+    args.push_back(nullptr);
+
+    int executionFailure = NAV::AppLogic::processCommandLineArguments(static_cast<int>(args.size() - 1), args.data());
 
     nm::ClearRegisteredCallbacks();
 
@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <string>
 #include <vector>
 
 namespace NAV::TESTS
@@ -21,8 +22,9 @@ namespace NAV::TESTS
 /// @brief Loads and executes the flow
 /// @param[in] path Path to the flow file
 /// @param[in] useTestDirectories Whether to set the paths to 'test/..' or to the root folder
+/// @param[in] additionalArguments Further command line arguments (e.g. '--checkpoint=...')
 /// @return true if the execution was successful
-bool testFlow(const char* path, bool useTestDirectories = true);
+bool testFlow(const char* path, bool useTestDirectories = true, const std::vector<std::string>& additionalArguments = {});
 
 /// @brief Runs general purpose cleanup checks
 void runGeneralFlowCleanupChecks();
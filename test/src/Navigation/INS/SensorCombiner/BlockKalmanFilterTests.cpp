@@ -0,0 +1,77 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file BlockKalmanFilterTests.cpp
+/// @brief Tests for the Kalman Filter steps with block structure
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-15
+
+#include <cstdlib>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "Navigation/INS/SensorCombiner/BlockKalmanFilter.hpp"
+
+#include "Logger.hpp"
+
+namespace NAV::TESTS::BlockKalmanFilterTests
+{
+
+TEST_CASE("[BlockKalmanFilter] Same result as the dense Kalman Filter", "[BlockKalmanFilter]")
+{
+    auto logger = initializeTestLogger();
+
+    constexpr int numStatesEst = 12;
+    constexpr int numStatesPerPin = 6;
+    constexpr int numMeasurements = 6;
+    constexpr int numPins = 4;
+    constexpr int numStates = numStatesEst + (numPins - 1) * numStatesPerPin;
+
+    std::srand(42); // NOLINT(cert-msc51-cpp)
+
+    KalmanFilter kf{ numStates, numMeasurements };
+    kf.x = Eigen::MatrixXd::Random(numStates, 1);
+    Eigen::MatrixXd A = Eigen::MatrixXd::Random(numStates, numStates);
+    kf.P = A * A.transpose() + Eigen::MatrixXd::Identity(numStates, numStates);
+
+    // 𝚽 and 𝐐 with the structure of the IRWKF
+    kf.Phi = Eigen::MatrixXd::Identity(numStates, numStates);
+    kf.Phi.block<3, 3>(0, 3).diagonal().setConstant(0.01);
+    kf.Phi.block<3, 3>(6, 9).diagonal().setConstant(0.01);
+    Eigen::MatrixXd B = Eigen::MatrixXd::Random(numStatesEst, numStatesEst);
+    kf.Q.topLeftCorner(numStatesEst, numStatesEst) = B * B.transpose();
+    kf.Q.bottomRightCorner(numStates - numStatesEst, numStates - numStatesEst).diagonal() = Eigen::VectorXd::Random(numStates - numStatesEst).cwiseAbs();
+
+    kf.R = Eigen::MatrixXd::Identity(numMeasurements, numMeasurements) * 0.1;
+    kf.z = Eigen::MatrixXd::Random(numMeasurements, 1);
+
+    for (size_t pinIdx = 0; pinIdx < numPins; pinIdx++)
+    {
+        kf.H.setZero();
+        kf.H.leftCols(numStatesEst) = Eigen::MatrixXd::Random(numMeasurements, numStatesEst);
+        std::optional<Eigen::Index> biasStateIdx;
+        if (pinIdx > 0)
+        {
+            biasStateIdx = numStatesEst + numStatesPerPin * static_cast<Eigen::Index>(pinIdx - 1);
+            kf.H.block<6, 6>(0, *biasStateIdx) = Eigen::MatrixXd::Identity(6, 6);
+        }
+
+        KalmanFilter dense = kf;
+        dense.predict();
+        dense.correct();
+
+        BlockKalmanFilter::predict(kf, numStatesEst);
+        BlockKalmanFilter::correct(kf, numStatesEst, numStatesPerPin, biasStateIdx);
+
+        REQUIRE(kf.x.isApprox(dense.x, 1e-10));
+        REQUIRE(kf.P.isApprox(dense.P, 1e-10));
+        REQUIRE(kf.K.isApprox(dense.K, 1e-10));
+    }
+}
+
+} // namespace NAV::TESTS::BlockKalmanFilterTests
@@ -126,4 +126,25 @@ TEST_CASE("[Math] Catch Matcher significant digits container", "[Math]")
     REQUIRE_THAT(vec1, Catch::Matchers::EqualsSigDigitsContainer(vec2, 4));
 }
 
+TEST_CASE("[Math] Douglas-Peucker polyline simplification", "[Math]")
+{
+    auto logger = initializeTestLogger();
+
+    // Straight line with noise below the tolerance and one corner
+    std::vector<Eigen::Vector3d> points{
+        { 0.0, 0.0, 0.0 },
+        { 1.0, 0.05, 0.0 },
+        { 2.0, -0.05, 0.0 },
+        { 3.0, 0.0, 0.0 },
+        { 3.0, 1.0, 0.0 },
+        { 3.0, 2.0, 0.05 },
+        { 3.0, 3.0, 0.0 },
+    };
+    REQUIRE(math::douglasPeucker(points, 0.1) == std::vector<size_t>{ 0, 3, 6 });
+    REQUIRE(math::douglasPeucker(points, 0.01).size() == points.size());
+
+    REQUIRE(math::douglasPeucker({}, 1.0).empty());
+    REQUIRE(math::douglasPeucker({ Eigen::Vector3d::Zero(), Eigen::Vector3d::Ones() }, 1.0) == std::vector<size_t>{ 0, 1 });
+}
+
 } // namespace NAV::TESTS
\ No newline at end of file
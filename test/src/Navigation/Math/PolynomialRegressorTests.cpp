@@ -877,6 +877,39 @@ TEST_CASE("[PolynomialRegressor] Strategy comparison (large dataset)", "[Polynom
     for ([[maybe_unused]] const auto& d : data) { LOG_DEBUG("{:6.02f}, {:6.02f}", d.first, d.second); }
 }
 
+TEST_CASE("[PolynomialRegressor] Incremental QR sliding window", "[PolynomialRegressor]")
+{
+    auto logger = initializeTestLogger();
+
+    std::mt19937_64 gen(42); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    std::normal_distribution<double> noise(0.0, 0.01);
+
+    for (size_t polynomialDegree = 0; polynomialDegree <= 3; polynomialDegree++)
+    {
+        size_t windowSize = 7;
+        PolynomialRegressor<double> incremental(polynomialDegree, windowSize, PolynomialRegressor<>::Strategy::IncrementalQR);
+        PolynomialRegressor<double> reference(polynomialDegree, windowSize, PolynomialRegressor<>::Strategy::HouseholderQR);
+
+        for (size_t i = 0; i < 500; i++)
+        {
+            double x = 100.0 + static_cast<double>(i) * 0.5;
+            double y = 3.0 - 0.2 * (x - 100.0) + 0.01 * std::pow(x - 100.0, 2) + noise(gen);
+            incremental.push_back(x, y);
+            reference.push_back(x, y);
+            if (i % 10 == 0) // Replace the last point
+            {
+                incremental.push_back(x, y + 1.0);
+                reference.push_back(x, y + 1.0);
+            }
+
+            auto polynomial = incremental.calcPolynomial();
+            auto refPolynomial = reference.calcPolynomial();
+            REQUIRE(polynomial.coeffs().rows() == refPolynomial.coeffs().rows());
+            REQUIRE_THAT(polynomial.f(x + 0.5), Catch::Matchers::WithinAbs(refPolynomial.f(x + 0.5), 1e-7));
+        }
+    }
+}
+
 TEST_CASE("[PolynomialRegressor] Strategy Benchmark (insert all at once)", "[PolynomialRegressor]")
 {
     auto logger = initializeTestLogger();
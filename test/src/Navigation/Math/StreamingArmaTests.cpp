@@ -0,0 +1,77 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file StreamingArmaTests.cpp
+/// @brief Tests for the sliding window ARMA estimation
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-15
+
+#include <catch2/catch_test_macros.hpp>
+#include "CatchMatchers.hpp"
+
+#include <random>
+
+#include "Logger.hpp"
+#include "Navigation/Math/StreamingArma.hpp"
+
+namespace NAV::TESTS
+{
+
+TEST_CASE("[StreamingArma] Identify AR and MA processes", "[StreamingArma]")
+{
+    auto logger = initializeTestLogger();
+
+    constexpr size_t WINDOW_SIZE = 2000;
+    StreamingArma arma(3, WINDOW_SIZE, 2, 2);
+
+    std::mt19937 gen(42); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    std::normal_distribution<double> noise(0.0, 1.0);
+
+    double ar2_1 = 0.0; // AR(2) process y_t-1
+    double ar2_2 = 0.0; // AR(2) process y_t-2
+    double ma1 = 0.0;   // MA(1) process e_t-1
+    double ar1 = 0.0;   // AR(1) process y_t-1
+    for (size_t t = 0; t < 4 * WINDOW_SIZE; t++)
+    {
+        double y0 = 0.5 * ar2_1 - 0.3 * ar2_2 + noise(gen);
+        ar2_2 = ar2_1;
+        ar2_1 = y0;
+        double e = noise(gen);
+        double y1 = e + 0.6 * ma1;
+        ma1 = e;
+        double y2 = 0.7 * ar1 + noise(gen);
+        ar1 = y2;
+
+        arma.push_back(Eigen::Vector3d(y0 + 5.0, y1, y2 - 2.0));
+        REQUIRE(arma.full() == (t + 1 >= WINDOW_SIZE));
+    }
+
+    const auto& x = arma.parameters();
+    LOG_DEBUG("Parameters:\n{}", x);
+
+    REQUIRE(arma.arOrder(0) == 2);
+    REQUIRE(arma.maOrder(0) == 0);
+    REQUIRE_THAT(x(0, 0), Catch::Matchers::WithinAbs(0.5, 0.1));
+    REQUIRE_THAT(x(1, 0), Catch::Matchers::WithinAbs(-0.3, 0.1));
+
+    REQUIRE(arma.arOrder(1) == 0);
+    REQUIRE(arma.maOrder(1) >= 1);
+    REQUIRE_THAT(x(2, 1), Catch::Matchers::WithinAbs(-0.6, 0.1)); // MA regressors are -ê
+
+    REQUIRE(arma.arOrder(2) >= 1);
+    REQUIRE_THAT(x(0, 2), Catch::Matchers::WithinAbs(0.7, 0.1));
+
+    // The estimates contain the mean of the window
+    REQUIRE_THAT(arma.estimate()(0), Catch::Matchers::WithinAbs(5.0, 3.0));
+    REQUIRE_THAT(arma.estimate()(2), Catch::Matchers::WithinAbs(-2.0, 3.0));
+
+    arma.reset();
+    REQUIRE(!arma.full());
+}
+
+} // namespace NAV::TESTS
@@ -1062,4 +1062,19 @@ TEST_CASE("[InsTime] Arithmetic operators constexpr", "[InsTime]")
                               InsTimeUtil::EPSILON);
 }
 
+TEST_CASE("[InsTime] Json conversion", "[InsTime]")
+{
+    auto logger = initializeTestLogger();
+
+    // Times of 50 Hz IMU observations, which are not representable by the double values of json numbers
+    for (size_t i = 0; i < 100; i++)
+    {
+        auto insTime = InsTime(2, 220, 385980.778684L + static_cast<long double>(i) * 0.02L);
+
+        json j = insTime;
+        auto restored = j.get<InsTime>();
+        REQUIRE(restored == insTime);
+    }
+}
+
 } // namespace NAV::TESTS::InsTimeTests
\ No newline at end of file
@@ -0,0 +1,122 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file ColumnSelectionTests.cpp
+/// @brief Tests for the bulk value export of NodeData
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-12
+
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "NodeData/General/DynamicData.hpp"
+#include "NodeData/State/PosVelAtt.hpp"
+#include "Navigation/Transformations/Units.hpp"
+
+#include "Logger.hpp"
+
+namespace NAV::TESTS::ColumnSelectionTests
+{
+
+TEST_CASE("[ColumnSelection] writeValues matches getValueAt", "[ColumnSelection]")
+{
+    auto logger = initializeTestLogger();
+
+    PosVelAtt posVelAtt;
+    Eigen::Vector3d lla_position{ deg2rad(48.78081), deg2rad(9.172012), 254 };
+    posVelAtt.setState_n(lla_position, Eigen::Vector3d(1.0, -2.0, 0.5), trafo::n_Quat_b(deg2rad(1.0), deg2rad(2.0), deg2rad(30.0)));
+    const NodeData& nodeData = posVelAtt;
+
+    auto selection = ColumnSelection::StaticRange(0, nodeData.staticDescriptorCount());
+    REQUIRE(selection.size() == PosVelAtt::GetStaticDescriptorCount());
+
+    std::vector<double> values(selection.size());
+    nodeData.writeValues(values, selection);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        auto expected = nodeData.getValueAt(i);
+        if (expected) { CHECK(values.at(i) == *expected); }
+        else { CHECK(std::isnan(values.at(i))); }
+    }
+
+    ColumnSelection partial({ 5, 2 });
+    std::vector<double> partialValues(partial.size());
+    nodeData.writeValues(partialValues, partial);
+    CHECK(partialValues.at(0) == nodeData.getValueAtOrNaN(5));
+    CHECK(partialValues.at(1) == nodeData.getValueAtOrNaN(2));
+}
+
+TEST_CASE("[ColumnSelection] Dynamic descriptors", "[ColumnSelection]")
+{
+    auto logger = initializeTestLogger();
+
+    DynamicData dynamicData;
+    dynamicData.data.push_back(DynamicData::Data{ .description = "A", .value = 1.0, .rawData = {} });
+    dynamicData.data.push_back(DynamicData::Data{ .description = "B", .value = 2.0, .rawData = {} });
+    const NodeData& nodeData = dynamicData;
+
+    ColumnSelection selection({}, { "B", "C", "A" });
+    std::vector<double> values(selection.size());
+
+    nodeData.writeValues(values, selection);
+    CHECK(values.at(0) == 2.0);
+    CHECK(std::isnan(values.at(1)));
+    CHECK(values.at(2) == 1.0);
+    CHECK(selection.dynamicHint(0).load() == 1);
+    CHECK(selection.dynamicHint(1).load() == ColumnSelection::NO_HINT);
+    CHECK(selection.dynamicHint(2).load() == 0);
+
+    // Layout changes, so that the hints are outdated
+    std::swap(dynamicData.data.at(0), dynamicData.data.at(1));
+    dynamicData.data.at(0).value = 3.0;
+    nodeData.writeValues(values, selection);
+    CHECK(values.at(0) == 3.0);
+    CHECK(values.at(2) == 1.0);
+    CHECK(selection.dynamicHint(0).load() == 0);
+    CHECK(selection.dynamicHint(2).load() == 1);
+}
+
+TEST_CASE("[ColumnSelection] Shared between threads", "[ColumnSelection]")
+{
+    auto logger = initializeTestLogger();
+
+    // Two observations with different layouts, so that the threads keep invalidating the hints of each other
+    DynamicData dataAB;
+    dataAB.data.push_back(DynamicData::Data{ .description = "A", .value = 1.0, .rawData = {} });
+    dataAB.data.push_back(DynamicData::Data{ .description = "B", .value = 2.0, .rawData = {} });
+    DynamicData dataBA;
+    dataBA.data.push_back(DynamicData::Data{ .description = "B", .value = 2.0, .rawData = {} });
+    dataBA.data.push_back(DynamicData::Data{ .description = "A", .value = 1.0, .rawData = {} });
+
+    const ColumnSelection selection({}, { "A", "B" });
+    ColumnSelection copy = selection;
+    REQUIRE(copy.size() == 2);
+
+    std::atomic<size_t> wrongValues = 0;
+    auto worker = [&](const NodeData& nodeData) {
+        std::vector<double> values(selection.size());
+        for (size_t i = 0; i < 10000; i++)
+        {
+            nodeData.writeValues(values, selection);
+            if (values.at(0) != 1.0 || values.at(1) != 2.0) { wrongValues++; }
+        }
+    };
+    std::thread thread1(worker, std::cref(dataAB));
+    std::thread thread2(worker, std::cref(dataBA));
+    thread1.join();
+    thread2.join();
+
+    CHECK(wrongValues == 0);
+}
+
+} // namespace NAV::TESTS::ColumnSelectionTests
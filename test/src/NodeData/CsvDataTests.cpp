@@ -0,0 +1,81 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file CsvDataTests.cpp
+/// @brief Tests for the column-wise CSV data container
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-15
+
+#include <cmath>
+#include <string>
+#include <variant>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "NodeData/General/CsvData.hpp"
+
+#include "Logger.hpp"
+
+namespace NAV::TESTS::CsvDataTests
+{
+
+TEST_CASE("[CsvData] Numbers are stored contiguous and text only where needed", "[CsvData]")
+{
+    auto logger = initializeTestLogger();
+
+    CsvData data;
+    data.description = { "Time [s]", "Name", "Value" };
+    data.addLine({ "0.5", "first", " +12" });
+    data.addLine({ "1.0", "2", "1e-3" });
+    data.addLine({ "1.5" }); // Missing cells
+
+    REQUIRE(data.rows() == 3);
+    REQUIRE(data.cols() == 3);
+    REQUIRE(data.columnIndex("Value") == 2);
+    REQUIRE(!data.columnIndex("Unknown").has_value());
+
+    REQUIRE(data.column(0) == std::vector<double>{ 0.5, 1.0, 1.5 });
+    REQUIRE(data.value(0, 2) == 12.0);
+    REQUIRE(data.value(1, 2) == 1e-3);
+    REQUIRE(std::isnan(data.value(2, 2)));
+
+    REQUIRE(std::get<std::string>(data.at(0, 1)) == "first");
+    REQUIRE(std::get<double>(data.at(1, 1)) == 2.0);
+    REQUIRE(std::isnan(std::get<double>(data.at(2, 1))));
+}
+
+TEST_CASE("[CsvData] Columns appearing in later lines are filled up", "[CsvData]")
+{
+    auto logger = initializeTestLogger();
+
+    CsvData data;
+    data.addLine({ "1" });
+    data.addLine({ "2", "text" });
+
+    REQUIRE(data.cols() == 2);
+    REQUIRE(std::isnan(data.value(0, 1)));
+    REQUIRE(std::get<std::string>(data.at(1, 1)) == "text");
+
+    data.clear();
+    REQUIRE(data.rows() == 0);
+    REQUIRE(data.cols() == 0);
+}
+
+TEST_CASE("[CsvData] Conversion of cells behaves like std::stod", "[CsvData]")
+{
+    auto logger = initializeTestLogger();
+
+    REQUIRE(CsvData::toNumber("  3.25") == 3.25);
+    REQUIRE(CsvData::toNumber("-7") == -7.0);
+    REQUIRE(CsvData::toNumber("42 m") == 42.0);
+    REQUIRE(!CsvData::toNumber("abc").has_value());
+    REQUIRE(!CsvData::toNumber("").has_value());
+    REQUIRE(!CsvData::toNumber("   ").has_value());
+}
+
+} // namespace NAV::TESTS::CsvDataTests
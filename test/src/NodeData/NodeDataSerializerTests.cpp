@@ -0,0 +1,178 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file NodeDataSerializerTests.cpp
+/// @brief Tests for the binary NodeData serialization
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-10
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstring>
+
+#include "NodeData/NodeDataSerializer.hpp"
+#include "NodeData/General/DynamicData.hpp"
+#include "NodeData/General/StringObs.hpp"
+#include "NodeData/IMU/ImuObsWDelta.hpp"
+#include "NodeData/State/PosVelAtt.hpp"
+#include "Navigation/Transformations/Units.hpp"
+
+#include "Logger.hpp"
+
+namespace NAV::TESTS::NodeDataSerializerTests
+{
+
+namespace
+{
+/// @brief Data type without a serializer
+class UnknownObs : public NodeData
+{
+  public:
+    [[nodiscard]] std::vector<std::string> staticDataDescriptors() const override { return { "A", "B" }; }
+    [[nodiscard]] size_t staticDescriptorCount() const override { return 2; }
+    [[nodiscard]] std::optional<double> getValueAt(size_t idx) const override
+    {
+        if (idx == 0) { return 1.5; }
+        return std::nullopt;
+    }
+};
+
+/// @brief Data type derived from a type with a serializer
+class DerivedPosVel : public PosVel
+{};
+} // namespace
+
+TEST_CASE("[NodeDataSerializer] PosVelAtt round trip", "[NodeDataSerializer]")
+{
+    auto logger = initializeTestLogger();
+
+    PosVelAtt posVelAtt;
+    posVelAtt.insTime = InsTime(2, 224, 43200.123456789L);
+    posVelAtt.addEvent("Test event");
+    Eigen::Vector3d lla_position{ deg2rad(48.78081), deg2rad(9.172012), 254 };
+    posVelAtt.setState_n(lla_position, Eigen::Vector3d(1.0, -2.0, 0.5), trafo::n_Quat_b(deg2rad(1.0), deg2rad(2.0), deg2rad(30.0)));
+    Eigen::Matrix<double, 6, 6> e_covariance = Eigen::Matrix<double, 6, 6>::Identity() * 4.0;
+    posVelAtt.setPosVelCovarianceMatrix_e(e_covariance);
+
+    auto message = NodeDataSerializer::Serialize(posVelAtt);
+    REQUIRE(NodeDataSerializer::GetMessageType(message) == NodeDataSerializer::MessageType::Data);
+
+    std::deque<ImuPos> imuPositions;
+    auto obs = std::dynamic_pointer_cast<PosVelAtt>(NodeDataSerializer::Deserialize(message, imuPositions));
+    REQUIRE(obs != nullptr);
+
+    CHECK(obs->insTime == posVelAtt.insTime);
+    CHECK(obs->events() == posVelAtt.events());
+    CHECK(obs->e_position() == posVelAtt.e_position());
+    CHECK(obs->e_velocity() == posVelAtt.e_velocity());
+    CHECK(obs->e_Quat_b().coeffs() == posVelAtt.e_Quat_b().coeffs());
+    REQUIRE(obs->e_CovarianceMatrix().has_value());
+    CHECK(obs->e_CovarianceMatrix()->get() == e_covariance);
+}
+
+TEST_CASE("[NodeDataSerializer] ImuObsWDelta round trip", "[NodeDataSerializer]")
+{
+    auto logger = initializeTestLogger();
+
+    ImuPos senderImuPos;
+    json j{ { "b_positionAccel", Eigen::Vector3d(0.1, 0.2, 0.3) } };
+    from_json(j, senderImuPos);
+
+    ImuObsWDelta imuObs(senderImuPos);
+    imuObs.insTime = InsTime(2023, 1, 8, 12, 0, 0.01L, GPST);
+    imuObs.timeSinceStartup = 123456789;
+    imuObs.p_acceleration = Eigen::Vector3d(0.1, -0.2, 9.81);
+    imuObs.p_angularRate = Eigen::Vector3d(0.01, 0.02, -0.03);
+    imuObs.temperature = std::nullopt;
+    imuObs.dtime = 0.01;
+    imuObs.dtheta = Eigen::Vector3d(1e-4, 2e-4, 3e-4);
+    imuObs.dvel = Eigen::Vector3d(1e-3, 2e-3, 9.81e-2);
+
+    std::deque<ImuPos> receiverImuPositions;
+    auto obs = std::dynamic_pointer_cast<ImuObsWDelta>(NodeDataSerializer::Deserialize(NodeDataSerializer::Serialize(imuObs), receiverImuPositions));
+    REQUIRE(obs != nullptr);
+
+    CHECK(obs->insTime == imuObs.insTime);
+    REQUIRE(receiverImuPositions.size() == 1);
+    CHECK(&obs->imuPos == &receiverImuPositions.back());
+    CHECK(obs->imuPos.b_positionAccel() == senderImuPos.b_positionAccel());
+    CHECK(obs->timeSinceStartup == imuObs.timeSinceStartup);
+    CHECK(obs->p_acceleration == imuObs.p_acceleration);
+    CHECK(obs->p_angularRate == imuObs.p_angularRate);
+    CHECK(!obs->p_magneticField.has_value());
+    CHECK(!obs->temperature.has_value());
+    CHECK(obs->dtime == imuObs.dtime);
+    CHECK(obs->dtheta == imuObs.dtheta);
+    CHECK(obs->dvel == imuObs.dvel);
+
+    // The same IMU position is reused, a changed one does not modify the position of the received observations
+    auto obs2 = NodeDataSerializer::Deserialize(NodeDataSerializer::Serialize(imuObs), receiverImuPositions);
+    CHECK(receiverImuPositions.size() == 1);
+    from_json(json{ { "b_positionAccel", Eigen::Vector3d(0.4, 0.5, 0.6) } }, senderImuPos);
+    auto obs3 = std::dynamic_pointer_cast<ImuObsWDelta>(NodeDataSerializer::Deserialize(NodeDataSerializer::Serialize(imuObs), receiverImuPositions));
+    REQUIRE(obs3 != nullptr);
+    CHECK(receiverImuPositions.size() == 2);
+    CHECK(obs3->imuPos.b_positionAccel() == Eigen::Vector3d(0.4, 0.5, 0.6));
+    CHECK(obs->imuPos.b_positionAccel() == Eigen::Vector3d(0.1, 0.2, 0.3));
+}
+
+TEST_CASE("[NodeDataSerializer] StringObs, DynamicData and unsupported types", "[NodeDataSerializer]")
+{
+    auto logger = initializeTestLogger();
+
+    std::deque<ImuPos> imuPos;
+
+    StringObs stringObs("Hello World");
+    auto stringObsReceived = std::dynamic_pointer_cast<StringObs>(NodeDataSerializer::Deserialize(NodeDataSerializer::Serialize(stringObs), imuPos));
+    REQUIRE(stringObsReceived != nullptr);
+    CHECK(stringObsReceived->data == stringObs.data);
+    CHECK(stringObsReceived->insTime.empty());
+
+    UnknownObs unknownObs;
+    auto dynamicData = std::dynamic_pointer_cast<DynamicData>(NodeDataSerializer::Deserialize(NodeDataSerializer::Serialize(unknownObs), imuPos));
+    REQUIRE(dynamicData != nullptr);
+    REQUIRE(dynamicData->data.size() == 1);
+    CHECK(dynamicData->data.front().description == "A");
+    CHECK(dynamicData->data.front().value == 1.5);
+
+    // Derived types are not sent as their base type, as they would lose their members
+    DerivedPosVel derivedPosVel;
+    derivedPosVel.setPosition_e(Eigen::Vector3d(1.0, 2.0, 3.0));
+    auto derivedMessage = NodeDataSerializer::Serialize(derivedPosVel);
+    CHECK(NodeDataSerializer::GetDataType(derivedMessage) == DynamicData::type());
+    CHECK(std::dynamic_pointer_cast<DynamicData>(NodeDataSerializer::Deserialize(derivedMessage, imuPos)) != nullptr);
+    CHECK(NodeDataSerializer::GetDataType(NodeDataSerializer::Serialize(PosVel())) == PosVel::type());
+}
+
+TEST_CASE("[NodeDataSerializer] End of stream and invalid messages", "[NodeDataSerializer]")
+{
+    auto logger = initializeTestLogger();
+
+    std::deque<ImuPos> imuPos;
+
+    auto endOfStream = NodeDataSerializer::SerializeEndOfStream();
+    CHECK(NodeDataSerializer::GetMessageType(endOfStream) == NodeDataSerializer::MessageType::EndOfStream);
+    CHECK(NodeDataSerializer::Deserialize(endOfStream, imuPos) == nullptr);
+
+    CHECK(NodeDataSerializer::GetMessageType({}) == NodeDataSerializer::MessageType::Invalid);
+
+    auto truncated = NodeDataSerializer::Serialize(StringObs("Hello World"));
+    truncated.resize(truncated.size() - 3);
+    CHECK(NodeDataSerializer::Deserialize(truncated, imuPos) == nullptr);
+
+    // Counts which do not fit into the message are rejected without allocating memory for them
+    auto corrupt = NodeDataSerializer::Serialize(DynamicData());
+    CHECK(std::dynamic_pointer_cast<DynamicData>(NodeDataSerializer::Deserialize(corrupt, imuPos)) != nullptr);
+    uint32_t hugeCount = 0xFFFFFFFF;
+    std::memcpy(corrupt.data() + corrupt.size() - sizeof(hugeCount), &hugeCount, sizeof(hugeCount)); // Amount of values
+    CHECK(NodeDataSerializer::Deserialize(corrupt, imuPos) == nullptr);
+    std::memcpy(corrupt.data() + corrupt.size() - 2 * sizeof(hugeCount), &hugeCount, sizeof(hugeCount)); // Amount of events
+    CHECK(NodeDataSerializer::Deserialize(corrupt, imuPos) == nullptr);
+}
+
+} // namespace NAV::TESTS::NodeDataSerializerTests
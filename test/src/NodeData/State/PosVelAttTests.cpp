@@ -111,6 +111,99 @@ TEST_CASE("[PosVelAtt] Attitude Functions", "[PosVelAtt]")
     CHECK_THAT(state.b_Quat_e(), Catch::Matchers::WithinAbs(trafo::b_Quat_n(roll, pitch, yaw) * trafo::n_Quat_e(lla_position(0), lla_position(1)), EPSILON));
 }
 
+TEST_CASE("[PosVelAtt] Covariance Functions", "[PosVelAtt]")
+{
+    auto logger = initializeTestLogger();
+
+    // Stuttgart, Breitscheidstraße 2
+    // https://www.koordinaten-umrechner.de/decimal/48.780810,9.172012?karte=OpenStreetMap&zoom=19
+    Eigen::Vector3d lla_position{ deg2rad(48.78081), deg2rad(9.172012), 254 };
+    Eigen::Quaterniond n_Quat_e = trafo::n_Quat_e(lla_position(0), lla_position(1));
+
+    Eigen::Matrix<double, 6, 6> e_covariance = Eigen::Matrix<double, 6, 6>::Identity();
+    e_covariance.topLeftCorner<3, 3>() << 4.0, 0.5, 0.2,
+        0.5, 3.0, 0.1,
+        0.2, 0.1, 9.0;
+    e_covariance.bottomRightCorner<3, 3>().diagonal() << 0.1, 0.2, 0.3;
+
+    PosVel state;
+    CHECK_FALSE(state.e_CovarianceMatrix().has_value());
+    CHECK_FALSE(state.n_positionStdev().has_value());
+
+    state.setPositionAndStdDev_lla(lla_position, n_Quat_e * e_covariance.topLeftCorner<3, 3>() * n_Quat_e.conjugate());
+    state.setPosVelCovarianceMatrix_e(e_covariance);
+
+    // The copy is made before the values in the other frame were calculated
+    PosVel copy = state;
+    for (const auto* s : { &state, &copy })
+    {
+        REQUIRE(s->n_CovarianceMatrix().has_value());
+        CHECK(s->e_CovarianceMatrix()->get() == e_covariance);
+        const auto& n_covariance = s->n_CovarianceMatrix()->get();
+        Eigen::Matrix3d n_posCovariance = n_covariance.topLeftCorner<3, 3>();
+        Eigen::Matrix3d n_velCovariance = n_covariance.bottomRightCorner<3, 3>();
+        CHECK_THAT(n_posCovariance, Catch::Matchers::WithinAbs(Eigen::Matrix3d(n_Quat_e * e_covariance.topLeftCorner<3, 3>() * n_Quat_e.conjugate()), 1e-12));
+        CHECK_THAT(n_velCovariance, Catch::Matchers::WithinAbs(Eigen::Matrix3d(n_Quat_e * e_covariance.bottomRightCorner<3, 3>() * n_Quat_e.conjugate()), 1e-12));
+        CHECK(n_covariance.topRightCorner<3, 3>().isZero());
+
+        REQUIRE(s->e_positionStdev().has_value());
+        CHECK_THAT(s->e_positionStdev()->get(), Catch::Matchers::WithinAbs(Eigen::Vector3d(e_covariance.diagonal().head<3>().cwiseSqrt()), 1e-12));
+        CHECK_THAT(s->getValueAt(14).value(), Catch::Matchers::WithinAbs(s->n_positionStdev()->get().x(), 0));
+        CHECK_THAT(s->getValueAt(36).value(), Catch::Matchers::WithinAbs(s->n_CovarianceMatrix()->get()(PosVel::States::VelX, PosVel::States::VelY), 0));
+    }
+}
+
+TEST_CASE("[PosVelAtt] Derived values follow position changes", "[PosVelAtt]")
+{
+    auto logger = initializeTestLogger();
+
+    Eigen::Vector3d lla_position1{ deg2rad(48.78081), deg2rad(9.172012), 254 };
+    Eigen::Vector3d lla_position2{ deg2rad(-33.8688), deg2rad(151.2093), 58 };
+    Eigen::Quaterniond n_Quat_e1 = trafo::n_Quat_e(lla_position1(0), lla_position1(1));
+    Eigen::Quaterniond n_Quat_e2 = trafo::n_Quat_e(lla_position2(0), lla_position2(1));
+
+    Eigen::Vector3d e_velocity{ 1.0, -2.0, 3.0 };
+    Eigen::Quaterniond e_Quat_b = Eigen::Quaterniond(Eigen::AngleAxisd(0.3, Eigen::Vector3d(1.0, 2.0, 3.0).normalized()));
+    Eigen::Matrix3d e_posCovariance = Eigen::Vector3d(4.0, 1.0, 9.0).asDiagonal();
+    Eigen::Matrix<double, 6, 6> e_covariance = Eigen::Matrix<double, 6, 6>::Identity();
+    e_covariance.topLeftCorner<3, 3>() = e_posCovariance;
+
+    PosVelAtt state;
+    state.setStateAndStdDev_e(trafo::lla2ecef_WGS84(lla_position1), e_posCovariance, e_velocity, e_posCovariance, e_Quat_b);
+    state.setPosVelCovarianceMatrix_e(e_covariance);
+
+    // Calculate and cache the values in the local navigation frame
+    CHECK_THAT(state.n_velocity(), Catch::Matchers::WithinAbs(Eigen::Vector3d(n_Quat_e1 * e_velocity), 1e-12));
+    CHECK_THAT(state.n_Quat_b(), Catch::Matchers::WithinAbs(Eigen::Quaterniond(n_Quat_e1 * e_Quat_b), 1e-12));
+    REQUIRE(state.n_positionStdev().has_value());
+    REQUIRE(state.n_velocityStdev().has_value());
+    REQUIRE(state.n_CovarianceMatrix().has_value());
+
+    for (bool ecef : { true, false })
+    {
+        if (ecef) { state.setPosition_e(trafo::lla2ecef_WGS84(lla_position2)); }
+        else { state.setPosition_lla(lla_position2); }
+
+        // Values set in ECEF stay, the ones in the local navigation frame are rotated with the new position
+        CHECK(state.e_velocity() == e_velocity);
+        CHECK(state.e_Quat_b().coeffs() == e_Quat_b.coeffs());
+        CHECK_THAT(state.n_velocity(), Catch::Matchers::WithinAbs(Eigen::Vector3d(n_Quat_e2 * e_velocity), 1e-12));
+        CHECK_THAT(state.n_Quat_b(), Catch::Matchers::WithinAbs(Eigen::Quaterniond(n_Quat_e2 * e_Quat_b), 1e-12));
+        Eigen::Matrix3d n_posCovariance = n_Quat_e2 * e_posCovariance * n_Quat_e2.conjugate();
+        CHECK_THAT(state.n_positionStdev()->get(), Catch::Matchers::WithinAbs(Eigen::Vector3d(n_posCovariance.diagonal().cwiseSqrt()), 1e-12));
+        CHECK_THAT(state.n_velocityStdev()->get(), Catch::Matchers::WithinAbs(Eigen::Vector3d(n_posCovariance.diagonal().cwiseSqrt()), 1e-12));
+        CHECK_THAT(Eigen::Matrix3d(state.n_CovarianceMatrix()->get().topLeftCorner<3, 3>()), Catch::Matchers::WithinAbs(n_posCovariance, 1e-12));
+    }
+
+    // Values set in the local navigation frame stay and the ECEF ones follow the position
+    Eigen::Vector3d n_velocity{ 4.0, 5.0, -1.0 };
+    state.setVelocity_n(n_velocity);
+    CHECK_THAT(state.e_velocity(), Catch::Matchers::WithinAbs(Eigen::Vector3d(n_Quat_e2.conjugate() * n_velocity), 1e-12));
+    state.setPosition_lla(lla_position1);
+    CHECK(state.n_velocity() == n_velocity);
+    CHECK_THAT(state.e_velocity(), Catch::Matchers::WithinAbs(Eigen::Vector3d(n_Quat_e1.conjugate() * n_velocity), 1e-12));
+}
+
 TEST_CASE("[PosVelAtt] Attitude RollPitchYaw", "[PosVelAtt]")
 {
     auto logger = initializeTestLogger();
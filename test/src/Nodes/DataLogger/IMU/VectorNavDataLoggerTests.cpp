@@ -74,10 +74,10 @@ void compareObservations(std::deque<std::shared_ptr<const NAV::VectorNavBinaryOu
     }
 
     // ----------------------------------------------- TimeGroup -------------------------------------------------
-    if (data_csv->timeOutputs != nullptr)
+    if (data_csv->timeOutputs.has_value())
     {
-        REQUIRE(logs_csv->timeOutputs != nullptr);
-        REQUIRE(logs_vnb->timeOutputs != nullptr);
+        REQUIRE(logs_csv->timeOutputs.has_value());
+        REQUIRE(logs_vnb->timeOutputs.has_value());
 
         REQUIRE(data_csv->timeOutputs->timeField == logs_csv->timeOutputs->timeField);
         REQUIRE(data_csv->timeOutputs->timeField == logs_vnb->timeOutputs->timeField);
@@ -161,10 +161,10 @@ void compareObservations(std::deque<std::shared_ptr<const NAV::VectorNavBinaryOu
     }
 
     // ----------------------------------------------- ImuGroup --------------------------------------------------
-    if (data_csv->imuOutputs != nullptr)
+    if (data_csv->imuOutputs.has_value())
     {
-        REQUIRE(logs_csv->imuOutputs != nullptr);
-        REQUIRE(logs_vnb->imuOutputs != nullptr);
+        REQUIRE(logs_csv->imuOutputs.has_value());
+        REQUIRE(logs_vnb->imuOutputs.has_value());
 
         REQUIRE(data_csv->imuOutputs->imuField == logs_csv->imuOutputs->imuField);
         REQUIRE(data_csv->imuOutputs->imuField == logs_vnb->imuOutputs->imuField);
@@ -240,10 +240,10 @@ void compareObservations(std::deque<std::shared_ptr<const NAV::VectorNavBinaryOu
     }
 
     // ---------------------------------------------- GpsGroup 1 -------------------------------------------------
-    if (data_csv->gnss1Outputs != nullptr)
+    if (data_csv->gnss1Outputs.has_value())
     {
-        REQUIRE(logs_csv->gnss1Outputs != nullptr);
-        REQUIRE(logs_vnb->gnss1Outputs != nullptr);
+        REQUIRE(logs_csv->gnss1Outputs.has_value());
+        REQUIRE(logs_vnb->gnss1Outputs.has_value());
 
         REQUIRE(data_csv->gnss1Outputs->gnssField == logs_csv->gnss1Outputs->gnssField);
         REQUIRE(data_csv->gnss1Outputs->gnssField == logs_vnb->gnss1Outputs->gnssField);
@@ -441,10 +441,10 @@ void compareObservations(std::deque<std::shared_ptr<const NAV::VectorNavBinaryOu
     }
 
     // --------------------------------------------- AttitudeGroup -----------------------------------------------
-    if (data_csv->attitudeOutputs != nullptr)
+    if (data_csv->attitudeOutputs.has_value())
     {
-        REQUIRE(logs_csv->attitudeOutputs != nullptr);
-        REQUIRE(logs_vnb->attitudeOutputs != nullptr);
+        REQUIRE(logs_csv->attitudeOutputs.has_value());
+        REQUIRE(logs_vnb->attitudeOutputs.has_value());
 
         REQUIRE(data_csv->attitudeOutputs->attitudeField == logs_csv->attitudeOutputs->attitudeField);
         REQUIRE(data_csv->attitudeOutputs->attitudeField == logs_vnb->attitudeOutputs->attitudeField);
@@ -522,10 +522,10 @@ void compareObservations(std::deque<std::shared_ptr<const NAV::VectorNavBinaryOu
     }
 
     // ----------------------------------------------- InsGroup --------------------------------------------------
-    if (data_csv->insOutputs != nullptr)
+    if (data_csv->insOutputs.has_value())
     {
-        REQUIRE(logs_csv->insOutputs != nullptr);
-        REQUIRE(logs_vnb->insOutputs != nullptr);
+        REQUIRE(logs_csv->insOutputs.has_value());
+        REQUIRE(logs_vnb->insOutputs.has_value());
 
         REQUIRE(data_csv->insOutputs->insField == logs_csv->insOutputs->insField);
         REQUIRE(data_csv->insOutputs->insField == logs_vnb->insOutputs->insField);
@@ -611,10 +611,10 @@ void compareObservations(std::deque<std::shared_ptr<const NAV::VectorNavBinaryOu
     }
 
     // ---------------------------------------------- GpsGroup 2 -------------------------------------------------
-    if (data_csv->gnss2Outputs != nullptr)
+    if (data_csv->gnss2Outputs.has_value())
     {
-        REQUIRE(logs_csv->gnss2Outputs != nullptr);
-        REQUIRE(logs_vnb->gnss2Outputs != nullptr);
+        REQUIRE(logs_csv->gnss2Outputs.has_value());
+        REQUIRE(logs_vnb->gnss2Outputs.has_value());
 
         REQUIRE(data_csv->gnss2Outputs->gnssField == logs_csv->gnss2Outputs->gnssField);
         REQUIRE(data_csv->gnss2Outputs->gnssField == logs_vnb->gnss2Outputs->gnssField);
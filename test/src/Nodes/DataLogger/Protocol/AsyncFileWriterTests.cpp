@@ -0,0 +1,90 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file AsyncFileWriterTests.cpp
+/// @brief Tests for the buffered file writer with background thread
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-13
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "Nodes/DataLogger/Protocol/AsyncFileWriter.hpp"
+
+#include "Logger.hpp"
+
+namespace NAV::TESTS::AsyncFileWriterTests
+{
+
+namespace
+{
+std::string readFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios_base::binary);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+} // namespace
+
+TEST_CASE("[AsyncFileWriter] Formatting", "[AsyncFileWriter]")
+{
+    auto logger = initializeTestLogger();
+
+    auto path = std::filesystem::path("test") / "logs" / "AsyncFileWriterTests-format.csv";
+    std::filesystem::create_directories(path.parent_path());
+
+    AsyncFileWriter writer;
+    REQUIRE(writer.open(path));
+    writer.write("a,b");
+    writer.endRow();
+    writer.write(0.1);
+    writer.write(',');
+    writer.write(1.0 / 3.0, 3);
+    writer.write(',');
+    writer.write(2150);
+    writer.write(',');
+    writer.write(43200.123456789L, 12);
+    writer.endRow();
+    writer.flush();
+
+    CHECK(readFile(path) == "a,b\n0.1,0.333,2150,43200.1234568\n");
+
+    writer.close();
+    CHECK(writer.good());
+}
+
+TEST_CASE("[AsyncFileWriter] Many buffers", "[AsyncFileWriter]")
+{
+    auto logger = initializeTestLogger();
+
+    auto path = std::filesystem::path("test") / "logs" / "AsyncFileWriterTests-buffers.csv";
+    std::filesystem::create_directories(path.parent_path());
+
+    std::string expected;
+    {
+        AsyncFileWriter writer(64); // Small buffers, so that they are handed over often
+        REQUIRE(writer.open(path));
+        for (int i = 0; i < 10000; i++)
+        {
+            writer.write(i);
+            writer.write(',');
+            writer.write(static_cast<double>(i) * 0.5);
+            writer.endRow();
+            expected += std::to_string(i) + "," + fmt::format("{}", static_cast<double>(i) * 0.5) + "\n";
+        }
+    } // Destructor writes the remaining data
+
+    CHECK(readFile(path) == expected);
+}
+
+} // namespace NAV::TESTS::AsyncFileWriterTests
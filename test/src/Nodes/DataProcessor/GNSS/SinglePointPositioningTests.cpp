@@ -279,4 +279,181 @@ TEST_CASE("[SinglePointPositioning][flow] SPP with Spirent data (GPS L1 C/A - no
     }
 }
 
+TEST_CASE("[SinglePointPositioning][flow] SPP batch processing equals serial processing", "[SinglePointPositioning][flow]")
+{
+    auto logger = initializeTestLogger();
+
+    // ###########################################################################################################
+    //                                           SinglePointPositioning.flow
+    // ###########################################################################################################
+    //
+    // RinexObsFile (65)                          SinglePointPositioning (91)
+    //         (64) PosVelAtt |>  --(92)-->  |> GnssObs (88)      (90) SppSolution |>  --(97)-->  |> (95) Terminator (96)
+    //                              (93)-->  |> GnssNavInfo (89)
+    // RinexNavFile() (54)         /
+    //         (53) PosVelAtt <>  -
+    //
+    // ###########################################################################################################
+
+    auto runFlow = [](bool batchProcessing) {
+        nm::RegisterPreInitCallback([&]() {
+            dynamic_cast<RinexObsFile*>(nm::FindNode(65))->_path = "GNSS/Spirent-SimGEN_static_duration-4h_rate-5min_sys-GERCQI/Iono-none_tropo-none/Spirent_RINEX_MO.obs";
+            dynamic_cast<RinexNavFile*>(nm::FindNode(54))->_path = "GNSS/Spirent-SimGEN_static_duration-4h_rate-5min_sys-GERCQI/Spirent_RINEX_GN.23N";
+
+            auto* sppNode = dynamic_cast<SinglePointPositioning*>(nm::FindNode(91));
+            sppNode->_algorithm._obsFilter._filterFreq = G01;
+            sppNode->_algorithm._obsFilter._filterCode = Code::G1C;
+            sppNode->_algorithm._obsFilter._elevationMask = 0;
+
+            sppNode->_batchProcessing = batchProcessing;
+            sppNode->_batchSize = 20; // Several batches, the last one only partially filled
+        });
+
+        std::vector<std::shared_ptr<const SppSolution>> solutions;
+        nm::RegisterWatcherCallbackToInputPin(95, [&](const Node* /* node */, const InputPin::NodeDataQueue& queue, size_t /* pinIdx */) {
+            REQUIRE(dynamic_cast<SinglePointPositioning*>(nm::FindNode(91))->isBatchProcessingActive() == batchProcessing);
+            solutions.push_back(std::dynamic_pointer_cast<const SppSolution>(queue.front()));
+        });
+
+        REQUIRE(testFlow("test/flow/Nodes/DataProcessor/GNSS/SinglePointPositioning.flow"));
+        return solutions;
+    };
+
+    auto serialSolutions = runFlow(false);
+    auto batchSolutions = runFlow(true);
+
+    REQUIRE(serialSolutions.size() == 49);
+    REQUIRE(batchSolutions.size() == serialSolutions.size());
+    for (size_t i = 0; i < serialSolutions.size(); i++)
+    {
+        const auto& serial = serialSolutions.at(i);
+        const auto& batch = batchSolutions.at(i);
+        LOG_DEBUG("[{}] Comparing epoch {}", serial->insTime.toYMDHMS(GPST), i);
+
+        REQUIRE(batch->insTime == serial->insTime);
+        REQUIRE(batch->nSatellites == serial->nSatellites);
+        REQUIRE(batch->nMeasPsr == serial->nMeasPsr);
+        REQUIRE(batch->nMeasDopp == serial->nMeasDopp);
+        REQUIRE_THAT((batch->e_position() - serial->e_position()).norm(), Catch::Matchers::WithinAbs(0.0, 1e-6));
+        REQUIRE_THAT((batch->e_velocity() - serial->e_velocity()).norm(), Catch::Matchers::WithinAbs(0.0, 1e-6));
+    }
+}
+
+TEST_CASE("[SinglePointPositioning][flow] Parallel observation selection equals serial selection", "[SinglePointPositioning][flow]")
+{
+    auto logger = initializeTestLogger();
+
+    nm::RegisterPreInitCallback([&]() {
+        dynamic_cast<RinexObsFile*>(nm::FindNode(65))->_path = "GNSS/Skydel_static_duration-4h_rate-5min_sys-GERCQIS/Iono-Klob_tropo-Saast/SkydelRINEX_S_20230080959_04H_02Z_MO.rnx";
+        dynamic_cast<RinexNavFile*>(nm::FindNode(54))->_path = "GNSS/Skydel_static_duration-4h_rate-5min_sys-GERCQIS/SkydelRINEX_S_20238959_7200S_GN.rnx";
+
+        auto* sppNode = dynamic_cast<SinglePointPositioning*>(nm::FindNode(91));
+        sppNode->_algorithm._obsFilter._filterFreq = Freq_All;
+        sppNode->_algorithm._obsFilter._filterCode = Code_ALL;
+        sppNode->_algorithm._obsFilter._elevationMask = deg2rad(15.0); // Let some signals trigger the mask
+    });
+
+    // ###########################################################################################################
+    //                                           SinglePointPositioning.flow
+    // ###########################################################################################################
+    //
+    // RinexObsFile (65)                          SinglePointPositioning (91)
+    //         (64) PosVelAtt |>  --(92)-->  |> GnssObs (88)      (90) SppSolution |>  --(97)-->  |> (95) Terminator (96)
+    //                              (93)-->  |> GnssNavInfo (89)
+    // RinexNavFile() (54)         /
+    //         (53) PosVelAtt <>  -
+    //
+    // ###########################################################################################################
+
+    const Eigen::Vector3d lla_refRecvPos(deg2rad(30.0), deg2rad(95.0), 0.0);
+    const Eigen::Vector3d e_refRecvPos = trafo::lla2ecef_WGS84(lla_refRecvPos);
+
+    size_t messageCounter = 0;
+    size_t maxSignals = 0;
+    nm::RegisterWatcherCallbackToInputPin(88, [&](const Node* node, const InputPin::NodeDataQueue& queue, size_t /* pinIdx */) {
+        const auto* spp = dynamic_cast<const NAV::SinglePointPositioning*>(node);
+        auto gnssObs = std::static_pointer_cast<const GnssObs>(queue.front());
+        // Collection of all connected navigation data providers
+        std::vector<InputPin::IncomingLink::ValueWrapper<GnssNavInfo>> gnssNavInfoWrappers;
+        std::vector<const GnssNavInfo*> gnssNavInfos;
+        for (size_t i = 0; i < spp->_dynamicInputPins.getNumberOfDynamicPins(); i++)
+        {
+            if (auto gnssNavInfo = spp->getInputValue<GnssNavInfo>(NAV::SinglePointPositioning::INPUT_PORT_INDEX_GNSS_NAV_INFO + i))
+            {
+                gnssNavInfoWrappers.push_back(*gnssNavInfo);
+                gnssNavInfos.push_back(gnssNavInfo->v);
+            }
+        }
+        if (gnssNavInfos.empty()) { return; }
+        messageCounter++;
+
+        auto receivers = spp->_algorithm._receiver;
+        receivers[SPP::Algorithm::Rover].gnssObs = gnssObs;
+        receivers[SPP::Algorithm::Rover].e_posMarker = e_refRecvPos;
+        receivers[SPP::Algorithm::Rover].lla_posMarker = lla_refRecvPos;
+        receivers[SPP::Algorithm::Rover].e_vel.setZero();
+
+        auto select = [&](bool parallelCalculation) {
+            ObservationFilter obsFilter = spp->_algorithm._obsFilter;
+            obsFilter._parallelCalculation = parallelCalculation;
+            return obsFilter.selectObservationsForCalculation(receivers, gnssNavInfos, "SPP TEST");
+        };
+        auto [serialObs, serialFiltered] = select(false);
+        auto [parallelObs, parallelFiltered] = select(true);
+        LOG_DEBUG("[{}] Comparing {} selected signals", gnssObs->insTime.toYMDHMS(GPST), serialObs.signals.size());
+        maxSignals = std::max(maxSignals, serialObs.signals.size());
+
+        REQUIRE(parallelObs.signals.size() == serialObs.signals.size());
+        for (auto serialIter = serialObs.signals.begin(), parallelIter = parallelObs.signals.begin();
+             serialIter != serialObs.signals.end();
+             ++serialIter, ++parallelIter)
+        {
+            const auto& [serialSatSigId, serialSignal] = *serialIter;
+            const auto& [parallelSatSigId, parallelSignal] = *parallelIter;
+            REQUIRE(parallelSatSigId == serialSatSigId); // Same order
+            REQUIRE(parallelSignal.navData() == serialSignal.navData());
+            REQUIRE(parallelSignal.freqNum() == serialSignal.freqNum());
+            REQUIRE(parallelSignal.recvObs.size() == serialSignal.recvObs.size());
+            for (size_t r = 0; r < serialSignal.recvObs.size(); r++)
+            {
+                const auto& serialRecv = serialSignal.recvObs.at(r);
+                const auto& parallelRecv = parallelSignal.recvObs.at(r);
+                REQUIRE(parallelRecv.e_satPos() == serialRecv.e_satPos());
+                REQUIRE(parallelRecv.e_satVel() == serialRecv.e_satVel());
+                REQUIRE(parallelRecv.satClock().transmitTime == serialRecv.satClock().transmitTime);
+                REQUIRE(parallelRecv.satClock().bias == serialRecv.satClock().bias);
+                REQUIRE(parallelRecv.satClock().drift == serialRecv.satClock().drift);
+                REQUIRE(parallelRecv.satElevation() == serialRecv.satElevation());
+                REQUIRE(parallelRecv.satAzimuth() == serialRecv.satAzimuth());
+                REQUIRE(parallelRecv.obs.size() == serialRecv.obs.size());
+                for (const auto& [obsType, obs] : serialRecv.obs)
+                {
+                    REQUIRE(parallelRecv.obs.contains(obsType));
+                    REQUIRE(parallelRecv.obs.at(obsType).measurement == obs.measurement);
+                    REQUIRE(parallelRecv.obs.at(obsType).measVar == obs.measVar);
+                }
+            }
+        }
+        REQUIRE(parallelObs.systems == serialObs.systems);
+        REQUIRE(parallelObs.satellites == serialObs.satellites);
+        REQUIRE(parallelObs.nObservables == serialObs.nObservables);
+        REQUIRE(parallelObs.nObservablesUniqueSatellite == serialObs.nObservablesUniqueSatellite);
+
+        REQUIRE(parallelFiltered.frequencyFilter == serialFiltered.frequencyFilter);
+        REQUIRE(parallelFiltered.codeFilter == serialFiltered.codeFilter);
+        REQUIRE(parallelFiltered.excludedSatellites == serialFiltered.excludedSatellites);
+        REQUIRE(parallelFiltered.tempExcludedSignal == serialFiltered.tempExcludedSignal);
+        REQUIRE(parallelFiltered.notAllReceiversObserved == serialFiltered.notAllReceiversObserved);
+        REQUIRE(parallelFiltered.noPseudorangeMeasurement == serialFiltered.noPseudorangeMeasurement);
+        REQUIRE(parallelFiltered.navigationDataMissing == serialFiltered.navigationDataMissing);
+        REQUIRE(parallelFiltered.elevationMaskTriggered == serialFiltered.elevationMaskTriggered);
+        REQUIRE(parallelFiltered.snrMaskTriggered == serialFiltered.snrMaskTriggered);
+    });
+
+    REQUIRE(testFlow("test/flow/Nodes/DataProcessor/GNSS/SinglePointPositioning.flow"));
+
+    REQUIRE(messageCounter == 49);
+    REQUIRE(maxSignals > 1); // Otherwise the parallel path is not taken
+}
+
 } // namespace NAV::TESTS::SinglePointPositioningTests
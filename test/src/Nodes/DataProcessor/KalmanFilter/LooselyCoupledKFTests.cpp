@@ -19,12 +19,14 @@
 #include <algorithm>
 #include <atomic>
 #include <mutex>
+#include <chrono>
 #include <Eigen/Core>
 
 #include "FlowTester.hpp"
 
 #include "internal/NodeManager.hpp"
 namespace nm = NAV::NodeManager;
+#include "internal/FlowProfiler.hpp"
 
 #include "Navigation/Ellipsoid/Ellipsoid.hpp"
 #include "Navigation/Transformations/Units.hpp"
@@ -211,4 +213,95 @@ TEST_CASE("[LooselyCoupledKF][flow] Test flow with IMU data arriving after GNSS
     testLCKFwithImuFile("DataProcessor/lckf/vn310-imu-after.csv", MESSAGE_COUNT_GNSS, MESSAGE_COUNT_GNSS_FIX, MESSAGE_COUNT_IMU, MESSAGE_COUNT_IMU_FIX);
 }
 
+TEST_CASE("[LooselyCoupledKF][flow] Covariance propagation interval", "[LooselyCoupledKF][flow]")
+{
+    auto logger = initializeTestLogger();
+
+    /// Result of a flow execution
+    struct Run
+    {
+        /// Time of the first IMU sample after each update and the diagonal of the covariance matrix after the update
+        std::vector<std::pair<InsTime, Eigen::VectorXd>> P;
+        /// Runtime statistics of the LCKF node
+        std::shared_ptr<FlowProfiler::NodeStatistics> stats;
+
+        /// Total time spent in the callbacks of the LCKF node [s]
+        [[nodiscard]] double callbackTime() const
+        {
+            uint64_t total = 0;
+            for (const auto& pin : stats->inputPins) { total += pin.callbackTimeTotal; }
+            return static_cast<double>(total) * 1e-9;
+        }
+    };
+
+    auto runFlow = [](int covariancePropagationInterval, LooselyCoupledKF::QCalculationAlgorithm qCalculationAlgorithm) {
+        Run run;
+        size_t nUpdates = 0;
+        size_t nRecorded = 0;
+
+        nm::RegisterPreInitCallback([&]() {
+            auto* lckf = dynamic_cast<LooselyCoupledKF*>(nm::FindNode(10));
+            lckf->_covariancePropagationInterval = covariancePropagationInterval;
+            lckf->_qCalculationAlgorithm = qCalculationAlgorithm;
+        });
+
+        // INS/GNSS LCKF (10) |> PosVel (8)
+        nm::RegisterWatcherCallbackToInputPin(8, [&](const Node* /* node */, const InputPin::NodeDataQueue& /* queue */, size_t /* pinIdx */) {
+            nUpdates++;
+        });
+
+        // INS/GNSS LCKF (10) |> ImuObsIn (7)
+        // Called in the same thread as the update, so the first IMU sample after an update sees the covariance after the update
+        nm::RegisterWatcherCallbackToInputPin(7, [&](const Node* node, const InputPin::NodeDataQueue& queue, size_t /* pinIdx */) {
+            if (!run.stats) { run.stats = node->getStatistics(); }
+            if (nRecorded == nUpdates) { return; }
+            nRecorded = nUpdates;
+
+            const auto* lckf = dynamic_cast<const LooselyCoupledKF*>(node);
+            run.P.emplace_back(queue.front()->insTime, lckf->_kalmanFilter.P(all, all).diagonal());
+        });
+
+        REQUIRE(testFlow("test/flow/Nodes/DataProcessor/KalmanFilter/LooselyCoupledKF.flow", true, { "--profile" }));
+        REQUIRE(run.stats != nullptr);
+        return run;
+    };
+
+    // The IMU data has 10 samples between two GNSS updates
+    constexpr int COVARIANCE_PROPAGATION_INTERVAL = 5;
+
+    for (auto qCalculationAlgorithm : { LooselyCoupledKF::QCalculationAlgorithm::VanLoan, LooselyCoupledKF::QCalculationAlgorithm::Taylor1 })
+    {
+        bool vanLoan = qCalculationAlgorithm == LooselyCoupledKF::QCalculationAlgorithm::VanLoan;
+        CAPTURE(vanLoan);
+
+        auto perSample = runFlow(1, qCalculationAlgorithm);
+        auto decimated = runFlow(COVARIANCE_PROPAGATION_INTERVAL, qCalculationAlgorithm);
+
+        // The covariance after the updates must stay close to the propagation with every IMU sample
+        REQUIRE(perSample.P.size() > 100);
+        REQUIRE(decimated.P.size() == perSample.P.size());
+        for (size_t i = 0; i < perSample.P.size(); i++)
+        {
+            CAPTURE(i);
+            REQUIRE(decimated.P.at(i).first == perSample.P.at(i).first);
+            const auto& P_perSample = perSample.P.at(i).second;
+            const auto& P_decimated = decimated.P.at(i).second;
+            for (Eigen::Index s = 0; s < P_perSample.size(); s++)
+            {
+                CAPTURE(s, P_perSample(s), P_decimated(s));
+                REQUIRE(std::abs(P_decimated(s) - P_perSample(s)) <= 1e-2 * std::abs(P_perSample(s)) + 1e-15);
+            }
+        }
+
+        // Benchmark
+        LOG_INFO("LCKF callbacks with {} Q take {:.3f} s when propagating the covariance every IMU sample", vanLoan ? "Van Loan" : "Taylor 1st order", perSample.callbackTime());
+        LOG_INFO("LCKF callbacks with {} Q take {:.3f} s when propagating the covariance every {} IMU samples ({:.2f}x faster)", vanLoan ? "Van Loan" : "Taylor 1st order",
+                 decimated.callbackTime(), COVARIANCE_PROPAGATION_INTERVAL, perSample.callbackTime() / decimated.callbackTime());
+        if (vanLoan) // The matrix exponential of Van Loan dominates the prediction, the Taylor series are too cheap for a reliable timing
+        {
+            REQUIRE(decimated.callbackTime() < perSample.callbackTime());
+        }
+    }
+}
+
 } // namespace NAV::TESTS::LooselyCoupledKFTests
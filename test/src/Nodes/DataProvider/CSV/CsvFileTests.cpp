@@ -0,0 +1,112 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file CsvFileTests.cpp
+/// @brief Tests for the CsvFile node
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-20
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "FlowTester.hpp"
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+
+#include "Logger.hpp"
+
+#include "NodeData/General/CsvData.hpp"
+
+namespace NAV::TESTS::CsvFileTests
+{
+
+TEST_CASE("[CsvFile][flow] Stream a file without time columns in chunks", "[CsvFile][flow]")
+{
+    auto logger = initializeTestLogger();
+
+    // ###########################################################################################################
+    //                                                  CsvFile.flow
+    // ###########################################################################################################
+    //
+    //  CsvFile (1)                    Terminator (3)
+    //     (2) CsvData |>  --(5)->  |> Input (4)
+    //
+    // ###########################################################################################################
+
+    constexpr std::array<double, 11> ELAPSED_TIME = { 11460000, 11760000, 12060000, 12360000, 12660000, 12960000,
+                                                      13260000, 13560000, 13860000, 14160000, 14460000 };
+    constexpr size_t CHUNK_SIZE = 4;
+
+    std::vector<std::shared_ptr<const CsvData>> chunks;
+    nm::RegisterWatcherCallbackToInputPin(4, [&chunks](const Node* /* node */, const InputPin::NodeDataQueue& queue, size_t /* pinIdx */) {
+        auto chunk = std::dynamic_pointer_cast<const CsvData>(queue.front());
+        REQUIRE(chunk != nullptr);
+        chunks.push_back(chunk);
+    });
+
+    REQUIRE(testFlow("test/flow/Nodes/DataProvider/CSV/CsvFile.flow"));
+
+    REQUIRE(chunks.size() == 3);
+    size_t row = 0;
+    for (const auto& chunk : chunks)
+    {
+        // The file has no GPS time columns, so the chunks are tagged with the index of their first line
+        REQUIRE(chunk->insTime == InsTime(0, 0, static_cast<long double>(row)));
+        REQUIRE(chunk->rows() == std::min(CHUNK_SIZE, ELAPSED_TIME.size() - row));
+
+        auto col = chunk->columnIndex("Elapsed Time (ms)");
+        REQUIRE(col.has_value());
+        for (size_t r = 0; r < chunk->rows(); r++, row++)
+        {
+            REQUIRE(chunk->value(r, *col) == ELAPSED_TIME.at(row));
+        }
+    }
+    REQUIRE(row == ELAPSED_TIME.size());
+}
+
+TEST_CASE("[CsvFile][flow] Stream a file with time columns and skip chunks without valid times", "[CsvFile][flow]")
+{
+    auto logger = initializeTestLogger();
+
+    // ###########################################################################################################
+    //                                                CsvFile_Time.flow
+    // ###########################################################################################################
+    //
+    //  CsvFile (1)                    Terminator (3)
+    //     (2) CsvData |>  --(5)->  |> Input (4)
+    //
+    // ###########################################################################################################
+
+    std::vector<std::shared_ptr<const CsvData>> chunks;
+    nm::RegisterWatcherCallbackToInputPin(4, [&chunks](const Node* /* node */, const InputPin::NodeDataQueue& queue, size_t /* pinIdx */) {
+        auto chunk = std::dynamic_pointer_cast<const CsvData>(queue.front());
+        REQUIRE(chunk != nullptr);
+        chunks.push_back(chunk);
+    });
+
+    REQUIRE(testFlow("test/flow/Nodes/DataProvider/CSV/CsvFile_Time.flow"));
+
+    // The chunk with the lines 4 to 7 has no valid time and is skipped instead of being tagged with the line index
+    REQUIRE(chunks.size() == 2);
+
+    // The first line of the first chunk has no time, so the second line is used
+    REQUIRE(chunks.at(0)->insTime == InsTime(0, 2244, 101.0L));
+    REQUIRE(chunks.at(0)->rows() == 4);
+    REQUIRE(chunks.at(1)->insTime == InsTime(0, 2244, 108.0L));
+    REQUIRE(chunks.at(1)->rows() == 2);
+
+    auto col = chunks.at(1)->columnIndex("Value");
+    REQUIRE(col.has_value());
+    REQUIRE(chunks.at(1)->value(0, *col) == 8.0);
+    REQUIRE(chunks.at(1)->value(1, *col) == 9.0);
+}
+
+} // namespace NAV::TESTS::CsvFileTests
@@ -0,0 +1,82 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file UartReplayTests.cpp
+/// @brief Tests for the UartReplay node
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-23
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <utility>
+#include <vector>
+
+#include "FlowTester.hpp"
+#include "Logger.hpp"
+
+#include "internal/NodeManager.hpp"
+namespace nm = NAV::NodeManager;
+
+#include "NodeData/GNSS/UbloxObs.hpp"
+#include "util/Time/TimeBase.hpp"
+
+namespace NAV::TESTS::UartReplayTests
+{
+
+TEST_CASE("[UartReplay][flow] Replay Spirent_ublox-F9P_static_duration-15min_sys-GPS-GAL_iono-Klobuchar_tropo-Saastamoinen.ubx", "[UartReplay][flow]")
+{
+    auto logger = initializeTestLogger();
+
+    // ###########################################################################################################
+    //                                              UartReplay.flow
+    // ###########################################################################################################
+    //
+    // UartReplay (1)                   UartPacketConverter (3)                  UbloxGnssObsConverter (6)
+    //  (2) UartPacket |> --(11)--> |> UartPacket (5)  (4) UbloxObs |> --(12)--> |> UbloxObs (7)  (8) GnssObs |> --(13)--> |> (10) Terminator (9)
+    constexpr size_t PIN_ID_UART_PACKET = 5;
+    constexpr size_t PIN_ID_UBLOX_OBS = 7;
+    //
+    // ###########################################################################################################
+
+    // The file contains 8429 UBX and 23427 NMEA messages
+    constexpr size_t N_PACKETS = 8429 + 23427;
+    // Times of the first and last UBX-RXM-RAWX message with a known GPS week (the first 44 messages have week 0)
+    const InsTime firstRawxTime(0, 2244, 35128.0L);
+    const InsTime lastRawxTime(0, 2244, 36732.004L);
+
+    size_t nPackets = 0;
+    nm::RegisterWatcherCallbackToInputPin(PIN_ID_UART_PACKET, [&](const Node* /* node */, const InputPin::NodeDataQueue& /* queue */, size_t /* pinIdx */) {
+        nPackets++;
+    });
+
+    // Observation time and current time while the observation arrives. Checked after the flow, as the callbacks run in the node threads.
+    std::vector<std::pair<InsTime, InsTime>> times;
+    nm::RegisterWatcherCallbackToInputPin(PIN_ID_UBLOX_OBS, [&](const Node* /* node */, const InputPin::NodeDataQueue& queue, size_t /* pinIdx */) {
+        auto obs = std::static_pointer_cast<const UbloxObs>(queue.front());
+        if (obs->insTime.empty() || obs->insTime.toGPSweekTow().gpsWeek == 0) { return; }
+        times.emplace_back(obs->insTime, util::time::GetCurrentInsTime());
+    });
+
+    REQUIRE(testFlow("test/flow/Nodes/DataProvider/GNSS/UartReplay.flow"));
+
+    REQUIRE(nPackets == N_PACKETS);
+
+    REQUIRE(!times.empty());
+    REQUIRE(times.front().first == firstRawxTime);
+    constexpr double EPSILON = 1e-6; // [s] The virtual clock has nanosecond resolution
+    for (const auto& [obsTime, currentTime] : times)
+    {
+        // The virtual clock runs with the packet times. So the current time is never before an already replayed
+        // packet and never after the last packet, no matter how fast the computer replays the file.
+        REQUIRE(!currentTime.empty());
+        REQUIRE(static_cast<double>((currentTime - obsTime).count()) > -EPSILON);
+        REQUIRE(static_cast<double>((lastRawxTime - currentTime).count()) > -EPSILON);
+    }
+}
+
+} // namespace NAV::TESTS::UartReplayTests
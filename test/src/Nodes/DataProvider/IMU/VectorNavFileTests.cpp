@@ -66,7 +66,7 @@ void compareImuObservation(const std::shared_ptr<const NAV::VectorNavBinaryOutpu
     REQUIRE_THAT(obs->insTime.toGPSweekTow().tow - IMU_REFERENCE_DATA.at(messageCounterImuData).at(ImuRef_GpsTow), Catch::Matchers::WithinAbs(0.0L, 5e-7L));
 
     // ----------------------------------------------- TimeGroup -------------------------------------------------
-    REQUIRE(obs->timeOutputs != nullptr);
+    REQUIRE(obs->timeOutputs.has_value());
 
     REQUIRE(extractBit(obs->timeOutputs->timeField, vn::protocol::uart::TimeGroup::TIMEGROUP_TIMESTARTUP));
     REQUIRE(obs->timeOutputs->timeStartup == static_cast<uint64_t>(IMU_REFERENCE_DATA.at(messageCounterImuData).at(ImuRef_Time_TimeStartup)));
@@ -85,7 +85,7 @@ void compareImuObservation(const std::shared_ptr<const NAV::VectorNavBinaryOutpu
     REQUIRE(obs->timeOutputs->timeField == vn::protocol::uart::TimeGroup::TIMEGROUP_NONE);
 
     // ----------------------------------------------- ImuGroup --------------------------------------------------
-    REQUIRE(obs->imuOutputs != nullptr);
+    REQUIRE(obs->imuOutputs.has_value());
 
     REQUIRE(extractBit(obs->imuOutputs->imuField, vn::protocol::uart::ImuGroup::IMUGROUP_UNCOMPMAG));
     REQUIRE(obs->imuOutputs->uncompMag(0) == static_cast<float>(IMU_REFERENCE_DATA.at(messageCounterImuData).at(ImuRef_IMU_UncompMag_X)));
@@ -137,7 +137,7 @@ void compareImuObservation(const std::shared_ptr<const NAV::VectorNavBinaryOutpu
     REQUIRE(obs->imuOutputs->imuField == vn::protocol::uart::ImuGroup::IMUGROUP_NONE);
 
     // ---------------------------------------------- GpsGroup 1 -------------------------------------------------
-    REQUIRE(obs->gnss1Outputs != nullptr);
+    REQUIRE(obs->gnss1Outputs.has_value());
 
     REQUIRE(extractBit(obs->gnss1Outputs->gnssField, vn::protocol::uart::GpsGroup::GPSGROUP_TOW));
     REQUIRE(obs->gnss1Outputs->tow == static_cast<uint64_t>(IMU_REFERENCE_DATA.at(messageCounterImuData).at(ImuRef_GNSS1_Tow)));
@@ -154,7 +154,7 @@ void compareImuObservation(const std::shared_ptr<const NAV::VectorNavBinaryOutpu
     REQUIRE(obs->gnss1Outputs->gnssField == vn::protocol::uart::GpsGroup::GPSGROUP_NONE);
 
     // --------------------------------------------- AttitudeGroup -----------------------------------------------
-    REQUIRE(obs->attitudeOutputs != nullptr);
+    REQUIRE(obs->attitudeOutputs.has_value());
 
     REQUIRE(extractBit(obs->attitudeOutputs->attitudeField, vn::protocol::uart::AttitudeGroup::ATTITUDEGROUP_YAWPITCHROLL));
     REQUIRE(obs->attitudeOutputs->ypr(0) == static_cast<float>(IMU_REFERENCE_DATA.at(messageCounterImuData).at(ImuRef_Att_YawPitchRoll_Y)));
@@ -175,10 +175,10 @@ void compareImuObservation(const std::shared_ptr<const NAV::VectorNavBinaryOutpu
     REQUIRE(obs->attitudeOutputs->attitudeField == vn::protocol::uart::AttitudeGroup::ATTITUDEGROUP_NONE);
 
     // ----------------------------------------------- InsGroup --------------------------------------------------
-    REQUIRE(obs->insOutputs == nullptr);
+    REQUIRE_FALSE(obs->insOutputs.has_value());
 
     // ---------------------------------------------- GpsGroup 2 -------------------------------------------------
-    REQUIRE(obs->gnss2Outputs == nullptr);
+    REQUIRE_FALSE(obs->gnss2Outputs.has_value());
 }
 
 TEST_CASE("[VectorNavFile][flow] Read 'data/VectorNav/FixedSize/vn310-imu.csv' and compare content with hardcoded values", "[VectorNavFile][flow]")
@@ -249,7 +249,7 @@ void compareGnssObservation(const std::shared_ptr<const NAV::VectorNavBinaryOutp
     REQUIRE_THAT(obs->insTime.toGPSweekTow().tow - GNSS_REFERENCE_DATA.at(messageCounterGnssData).at(GnssRef_GpsTow), Catch::Matchers::WithinAbs(0.0L, 5e-7L));
 
     // ----------------------------------------------- TimeGroup -------------------------------------------------
-    REQUIRE(obs->timeOutputs != nullptr);
+    REQUIRE(obs->timeOutputs.has_value());
 
     REQUIRE(extractBit(obs->timeOutputs->timeField, vn::protocol::uart::TimeGroup::TIMEGROUP_TIMESTARTUP));
     REQUIRE(obs->timeOutputs->timeStartup == static_cast<uint64_t>(GNSS_REFERENCE_DATA.at(messageCounterGnssData).at(GnssRef_Time_TimeStartup)));
@@ -277,10 +277,10 @@ void compareGnssObservation(const std::shared_ptr<const NAV::VectorNavBinaryOutp
     REQUIRE(obs->timeOutputs->timeField == vn::protocol::uart::TimeGroup::TIMEGROUP_NONE);
 
     // ----------------------------------------------- ImuGroup --------------------------------------------------
-    REQUIRE(obs->imuOutputs == nullptr);
+    REQUIRE_FALSE(obs->imuOutputs.has_value());
 
     // ---------------------------------------------- GpsGroup 1 -------------------------------------------------
-    REQUIRE(obs->gnss1Outputs != nullptr);
+    REQUIRE(obs->gnss1Outputs.has_value());
 
     REQUIRE(extractBit(obs->gnss1Outputs->gnssField, vn::protocol::uart::GpsGroup::GPSGROUP_UTC));
     REQUIRE(obs->gnss1Outputs->timeUtc.year == static_cast<int8_t>(GNSS_REFERENCE_DATA.at(messageCounterGnssData).at(GnssRef_GNSS1_UTC_year)));
@@ -352,7 +352,7 @@ void compareGnssObservation(const std::shared_ptr<const NAV::VectorNavBinaryOutp
     REQUIRE(obs->gnss1Outputs->gnssField == vn::protocol::uart::GpsGroup::GPSGROUP_NONE);
 
     // --------------------------------------------- AttitudeGroup -----------------------------------------------
-    REQUIRE(obs->attitudeOutputs != nullptr);
+    REQUIRE(obs->attitudeOutputs.has_value());
 
     REQUIRE(extractBit(obs->attitudeOutputs->attitudeField, vn::protocol::uart::AttitudeGroup::ATTITUDEGROUP_YAWPITCHROLL));
     REQUIRE(obs->attitudeOutputs->ypr(0) == static_cast<float>(GNSS_REFERENCE_DATA.at(messageCounterGnssData).at(GnssRef_Att_YawPitchRoll_Y)));
@@ -373,7 +373,7 @@ void compareGnssObservation(const std::shared_ptr<const NAV::VectorNavBinaryOutp
     REQUIRE(obs->attitudeOutputs->attitudeField == vn::protocol::uart::AttitudeGroup::ATTITUDEGROUP_NONE);
 
     // ----------------------------------------------- InsGroup --------------------------------------------------
-    REQUIRE(obs->insOutputs != nullptr);
+    REQUIRE(obs->insOutputs.has_value());
 
     REQUIRE(extractBit(obs->insOutputs->insField, vn::protocol::uart::InsGroup::INSGROUP_INSSTATUS));
     REQUIRE(obs->insOutputs->insStatus.mode() == static_cast<NAV::vendor::vectornav::InsStatus::Mode>(GNSS_REFERENCE_DATA.at(messageCounterGnssData).at(GnssRef_INS_InsStatus_Mode)));
@@ -433,7 +433,7 @@ void compareGnssObservation(const std::shared_ptr<const NAV::VectorNavBinaryOutp
     REQUIRE(obs->insOutputs->insField == vn::protocol::uart::InsGroup::INSGROUP_NONE);
 
     // ---------------------------------------------- GpsGroup 2 -------------------------------------------------
-    REQUIRE(obs->gnss2Outputs != nullptr);
+    REQUIRE(obs->gnss2Outputs.has_value());
 
     REQUIRE(extractBit(obs->gnss2Outputs->gnssField, vn::protocol::uart::GpsGroup::GPSGROUP_UTC));
     REQUIRE(obs->gnss2Outputs->timeUtc.year == static_cast<int8_t>(GNSS_REFERENCE_DATA.at(messageCounterGnssData).at(GnssRef_GNSS2_UTC_year)));
@@ -580,7 +580,7 @@ void compareDynamicSizeObservation(const std::shared_ptr<const NAV::VectorNavBin
     REQUIRE_THAT(obs->insTime.toGPSweekTow().tow - REFERENCE_DATA.at(messageCounterData).at(Ref_GpsTow), Catch::Matchers::WithinAbs(0.0L, 9e-7L));
 
     // ----------------------------------------------- TimeGroup -------------------------------------------------
-    REQUIRE(obs->timeOutputs != nullptr);
+    REQUIRE(obs->timeOutputs.has_value());
 
     REQUIRE(extractBit(obs->timeOutputs->timeField, vn::protocol::uart::TimeGroup::TIMEGROUP_TIMESTARTUP));
     REQUIRE(obs->timeOutputs->timeStartup == static_cast<uint64_t>(REFERENCE_DATA.at(messageCounterData).at(Ref_Time_TimeStartup)));
@@ -623,10 +623,10 @@ void compareDynamicSizeObservation(const std::shared_ptr<const NAV::VectorNavBin
     REQUIRE(obs->timeOutputs->timeField == vn::protocol::uart::TimeGroup::TIMEGROUP_NONE);
 
     // ----------------------------------------------- ImuGroup --------------------------------------------------
-    REQUIRE(obs->imuOutputs == nullptr);
+    REQUIRE_FALSE(obs->imuOutputs.has_value());
 
     // ---------------------------------------------- GpsGroup 1 -------------------------------------------------
-    REQUIRE(obs->gnss1Outputs != nullptr);
+    REQUIRE(obs->gnss1Outputs.has_value());
 
     REQUIRE(extractBit(obs->gnss1Outputs->gnssField, vn::protocol::uart::GpsGroup::GPSGROUP_NUMSATS));
     REQUIRE(obs->gnss1Outputs->numSats == static_cast<uint8_t>(REFERENCE_DATA.at(messageCounterData).at(Ref_GNSS1_NumSats)));
@@ -678,7 +678,7 @@ void compareDynamicSizeObservation(const std::shared_ptr<const NAV::VectorNavBin
     REQUIRE(obs->gnss1Outputs->gnssField == vn::protocol::uart::GpsGroup::GPSGROUP_NONE);
 
     // --------------------------------------------- AttitudeGroup -----------------------------------------------
-    REQUIRE(obs->attitudeOutputs != nullptr);
+    REQUIRE(obs->attitudeOutputs.has_value());
 
     REQUIRE(extractBit(obs->attitudeOutputs->attitudeField, vn::protocol::uart::AttitudeGroup::ATTITUDEGROUP_YAWPITCHROLL));
     REQUIRE_THAT(obs->attitudeOutputs->ypr(0), Catch::Matchers::WithinAbs(static_cast<float>(REFERENCE_DATA.at(messageCounterData).at(Ref_Att_YawPitchRoll_Y)), EPSILON_FLOAT));
@@ -730,7 +730,7 @@ void compareDynamicSizeObservation(const std::shared_ptr<const NAV::VectorNavBin
     REQUIRE(obs->attitudeOutputs->attitudeField == vn::protocol::uart::AttitudeGroup::ATTITUDEGROUP_NONE);
 
     // ----------------------------------------------- InsGroup --------------------------------------------------
-    REQUIRE(obs->insOutputs != nullptr);
+    REQUIRE(obs->insOutputs.has_value());
 
     REQUIRE(extractBit(obs->insOutputs->insField, vn::protocol::uart::InsGroup::INSGROUP_INSSTATUS));
     REQUIRE(obs->insOutputs->insStatus.mode() == static_cast<NAV::vendor::vectornav::InsStatus::Mode>(REFERENCE_DATA.at(messageCounterData).at(Ref_INS_InsStatus_Mode)));
@@ -790,7 +790,7 @@ void compareDynamicSizeObservation(const std::shared_ptr<const NAV::VectorNavBin
     REQUIRE(obs->insOutputs->insField == vn::protocol::uart::InsGroup::INSGROUP_NONE);
 
     // ---------------------------------------------- GpsGroup 2 -------------------------------------------------
-    REQUIRE(obs->gnss2Outputs != nullptr);
+    REQUIRE(obs->gnss2Outputs.has_value());
 
     REQUIRE(extractBit(obs->gnss2Outputs->gnssField, vn::protocol::uart::GpsGroup::GPSGROUP_NUMSATS));
     REQUIRE(obs->gnss2Outputs->numSats == static_cast<uint8_t>(REFERENCE_DATA.at(messageCounterData).at(Ref_GNSS2_NumSats)));
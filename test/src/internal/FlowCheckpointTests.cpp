@@ -0,0 +1,97 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file FlowCheckpointTests.cpp
+/// @brief Tests for the checkpoints of the post-processing
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-22
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "FlowTester.hpp"
+#include "util/Json.hpp"
+
+#include "Logger.hpp"
+
+namespace NAV::TESTS::FlowCheckpointTests
+{
+
+namespace
+{
+std::string readFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios_base::binary);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+} // namespace
+
+TEST_CASE("[FlowCheckpoint][flow] Resuming from a checkpoint gives the same output", "[FlowCheckpoint][flow]")
+{
+    auto logger = initializeTestLogger();
+
+    // ###########################################################################################################
+    //                                       TightlyCoupledKF_Checkpoint.flow
+    // ###########################################################################################################
+    //
+    //  PosVelAttFile (8)             TightlyCoupledKF (11)                       CsvLogger (17)
+    //     (9) PosVelAtt |> --(21)->  |> Init PVA (14)      (16) PosVelAtt |> --(23)->  |> writeObservation (18)
+    //  ImuFile (1)                   |
+    //     (2) ImuObs    |> --(19)->  |> ImuObs (12)
+    //  RinexObsFile (4)              |
+    //     (5) GnssObs   |> --(20)->  |> GnssObs (13)
+    //  RinexNavFile (6)              |
+    //     (7) GnssNavInfo <> -(22)-> <> GnssNavInfo (15)
+    //
+    // ###########################################################################################################
+
+    const char* flowPath = "test/flow/Nodes/DataProcessor/KalmanFilter/TightlyCoupledKF_Checkpoint.flow";
+    const auto outputPath = std::filesystem::path("test") / "logs" / "TightlyCoupledKF_Checkpoint.csv";
+    const auto checkpointPath = std::filesystem::path("test") / "logs" / "TightlyCoupledKF_Checkpoint.json";
+    const std::string checkpointArgument = "--checkpoint=TightlyCoupledKF_Checkpoint.json";
+    const std::string intervalArgument = "--checkpoint-interval=0.25"; // Every 15 s of data time, the data covers about 33 s
+
+    std::filesystem::remove(checkpointPath);
+
+    REQUIRE(testFlow(flowPath));
+    auto uninterrupted = readFile(outputPath);
+    REQUIRE(!uninterrupted.empty());
+
+    // Taking checkpoints must not change the output
+    REQUIRE(testFlow(flowPath, true, { checkpointArgument, intervalArgument }));
+    REQUIRE(readFile(outputPath) == uninterrupted);
+    REQUIRE(std::filesystem::exists(checkpointPath));
+
+    json checkpoint;
+    {
+        std::ifstream file(checkpointPath);
+        checkpoint = json::parse(file);
+    }
+    auto fileSize = checkpoint.at("nodes").at("17").at("state").at("FileWriter").at("fileSize").get<size_t>();
+    REQUIRE(fileSize > 0);
+    REQUIRE(fileSize < uninterrupted.size());
+
+    // Simulate a crash after the checkpoint, which left an incomplete output
+    std::filesystem::resize_file(outputPath, fileSize + (uninterrupted.size() - fileSize) / 2);
+    {
+        std::fstream file(outputPath, std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+        file.seekp(static_cast<std::streamoff>(fileSize));
+        file << "garbage";
+    }
+
+    REQUIRE(testFlow(flowPath, true, { checkpointArgument, intervalArgument, "--resume" }));
+    REQUIRE(readFile(outputPath) == uninterrupted);
+}
+
+} // namespace NAV::TESTS::FlowCheckpointTests
@@ -0,0 +1,87 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "internal/RealTime.hpp"
+#include "Logger.hpp"
+
+namespace NAV::TESTS
+{
+
+TEST_CASE("[RealTime] Settings json conversion", "[RealTime]")
+{
+    auto logger = initializeTestLogger();
+
+    RealTime::Settings settings;
+    REQUIRE(!settings.modifiesThread());
+
+    settings.cpuAffinity = { 1, 3 };
+    settings.policy = RealTime::SchedulingPolicy::FIFO;
+    settings.priority = 42;
+    settings.budget = std::chrono::microseconds(2500);
+    settings.monitorLatency = true;
+    REQUIRE(settings.modifiesThread());
+
+    json j = settings;
+    auto restored = j.get<RealTime::Settings>();
+    REQUIRE(restored.cpuAffinity == settings.cpuAffinity);
+    REQUIRE(restored.policy == settings.policy);
+    REQUIRE(restored.priority == settings.priority);
+    REQUIRE(restored.budget == settings.budget);
+    REQUIRE(restored.monitorLatency == settings.monitorLatency);
+
+    // Older flow files do not contain the settings
+    restored = json::object().get<RealTime::Settings>();
+    REQUIRE(!restored.modifiesThread());
+    REQUIRE(restored.budget.count() == 0);
+}
+
+TEST_CASE("[RealTime] Deadline and latency statistics", "[RealTime]")
+{
+    auto logger = initializeTestLogger();
+
+    RealTime::Statistics stats;
+    constexpr std::chrono::microseconds budget(100);
+
+    REQUIRE(!stats.addProcessing(std::chrono::microseconds(50), budget));
+    REQUIRE(!stats.addProcessing(std::chrono::microseconds(100), budget));
+    REQUIRE(stats.addProcessing(std::chrono::microseconds(300), budget));
+    REQUIRE(!stats.addProcessing(std::chrono::microseconds(300), std::chrono::microseconds(0)));
+
+    REQUIRE(stats.messagesProcessed == 4);
+    REQUIRE(stats.deadlineMisses == 1);
+    REQUIRE(stats.processingTimeMax == 300'000);
+    REQUIRE(stats.processingTime.count() == 4);
+
+    stats.addLatency(std::chrono::milliseconds(2));
+    stats.addLatency(std::chrono::milliseconds(-1)); // Clocks of sensor and computer can be slightly off
+    REQUIRE(stats.messagesOutput == 2);
+    REQUIRE(stats.latencyMax == 2'000'000);
+    REQUIRE(stats.latency.count() == 2);
+
+    stats.reset();
+    REQUIRE(stats.messagesProcessed == 0);
+    REQUIRE(stats.deadlineMisses == 0);
+    REQUIRE(stats.processingTimeMax == 0);
+    REQUIRE(stats.processingTime.count() == 0);
+    REQUIRE(stats.messagesOutput == 0);
+    REQUIRE(stats.latencyMax == 0);
+    REQUIRE(stats.latency.count() == 0);
+}
+
+TEST_CASE("[RealTime] Apply default settings to thread", "[RealTime]")
+{
+    auto logger = initializeTestLogger();
+
+    bool modified = false;
+    REQUIRE(RealTime::ApplyToCurrentThread(RealTime::Settings{}, "Test", modified));
+    REQUIRE(!modified);
+}
+
+} // namespace NAV::TESTS
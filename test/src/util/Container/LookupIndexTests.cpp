@@ -0,0 +1,128 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file LookupIndexTests.cpp
+/// @brief Tests for the lazily built lookup index
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-15
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "Logger.hpp"
+#include "util/Container/LookupIndex.hpp"
+#include "NodeData/GNSS/GnssObs.hpp"
+
+namespace NAV::TESTS::LookupIndexTests
+{
+
+TEST_CASE("[LookupIndex] Finds elements and follows modifications of the vector", "[LookupIndex]")
+{
+    auto logger = initializeTestLogger();
+
+    struct Element
+    {
+        int key = 0;
+    };
+    std::vector<Element> vec;
+    LookupIndex<int, 2> index;
+    auto proj = &Element::key;
+
+    for (int i = 0; i < 20; i++)
+    {
+        vec.push_back({ i * 10 });
+        index.push_back(vec.back().key, vec.size());
+    }
+    REQUIRE(index.find(vec, 50, proj) == 5);
+    REQUIRE(!index.find(vec, 55, proj).has_value());
+
+    // Appended through the index
+    vec.push_back({ 55 });
+    index.push_back(55, vec.size());
+    REQUIRE(index.find(vec, 55, proj) == 20);
+
+    // Erased behind the back of the index
+    vec.erase(vec.begin() + 3);
+    REQUIRE(index.find(vec, 50, proj) == 4);
+    REQUIRE(!index.find(vec, 30, proj).has_value());
+
+    // Modified in place
+    vec[0].key = 30;
+    REQUIRE(!index.find(vec, 0, proj).has_value());
+    index.invalidate();
+    REQUIRE(index.find(vec, 30, proj) == 0);
+
+    // Copies rebuild their own index
+    auto copy = index;
+    REQUIRE(copy.find(vec, 190, proj) == 18);
+}
+
+TEST_CASE("[LookupIndex] Concurrent lookups while the index is rebuilt", "[LookupIndex]")
+{
+    auto logger = initializeTestLogger();
+
+    struct Element
+    {
+        int key = 0;
+    };
+    std::vector<Element> vec;
+    for (int i = 0; i < 1000; i++) { vec.push_back({ i }); }
+    LookupIndex<int> index;
+    auto proj = &Element::key;
+
+    for (int round = 0; round < 20; round++)
+    {
+        // Modified in place, so that the lookup of the old key forces a rebuild while the other threads are searching
+        vec.at(static_cast<size_t>(round)).key = -round - 1;
+
+        std::atomic<size_t> wrongPositions = 0;
+        auto worker = [&]() {
+            for (int key = 0; key < 1000; key++)
+            {
+                auto pos = index.find(vec, key, proj);
+                if (key <= round ? pos.has_value() : pos != static_cast<size_t>(key)) { wrongPositions++; }
+            }
+        };
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < 4; t++) { threads.emplace_back(worker); }
+        for (auto& thread : threads) { thread.join(); }
+
+        REQUIRE(wrongPositions == 0);
+    }
+}
+
+TEST_CASE("[LookupIndex] GnssObs lookups by signal and satellite", "[LookupIndex]")
+{
+    auto logger = initializeTestLogger();
+
+    GnssObs gnssObs;
+    for (uint16_t satNum = 1; satNum <= 32; satNum++)
+    {
+        gnssObs(SatSigId(Code::G1C, satNum)).pseudorange = GnssObs::ObservationData::Pseudorange{ .value = 2e7 + satNum };
+        gnssObs(SatSigId(Code::G2W, satNum)).pseudorange = GnssObs::ObservationData::Pseudorange{ .value = 3e7 + satNum };
+        gnssObs.satData(SatId(GPS, satNum)).frequencies |= G01 | G02;
+    }
+    REQUIRE(gnssObs.data.size() == 64);
+    REQUIRE(gnssObs.getSatData().size() == 32);
+
+    const auto& constObs = gnssObs;
+    REQUIRE(constObs(SatSigId(Code::G2W, 17))->get().pseudorange->value == 3e7 + 17);
+    REQUIRE(!constObs(SatSigId(Code::G5Q, 17)).has_value());
+    REQUIRE(constObs.contains(SatSigId(Code::G1C, 32)));
+    REQUIRE(constObs.satData(SatId(GPS, 5))->get().frequencies == (G01 | G02));
+    REQUIRE(!constObs.satData(SatId(GAL, 5)).has_value());
+
+    gnssObs.data.erase(gnssObs.data.begin());
+    REQUIRE(!constObs.contains(SatSigId(Code::G1C, 1)));
+    REQUIRE(constObs(SatSigId(Code::G2W, 1))->get().pseudorange->value == 3e7 + 1);
+}
+
+} // namespace NAV::TESTS::LookupIndexTests
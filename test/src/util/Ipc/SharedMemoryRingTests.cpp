@@ -0,0 +1,174 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file SharedMemoryRingTests.cpp
+/// @brief Tests for the shared memory message ring
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-10
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstring>
+#include <numeric>
+#include <thread>
+
+#ifndef _WIN32
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
+#include "util/Ipc/SharedMemoryRing.hpp"
+
+#include "Logger.hpp"
+
+namespace NAV::TESTS::SharedMemoryRingTests
+{
+
+TEST_CASE("[SharedMemoryRing] Push and pop with wrap around", "[SharedMemoryRing]")
+{
+    auto logger = initializeTestLogger();
+
+    const std::string name = "instinct-test-ring";
+    SharedMemoryRing::remove(name);
+
+    SharedMemoryRing producer(name, 64, SharedMemoryRing::Role::Producer);
+    SharedMemoryRing consumer(name, 1024, SharedMemoryRing::Role::Consumer); // Opens the existing segment
+    REQUIRE(consumer.capacity() == 64);
+
+    std::vector<uint8_t> message(20);
+    std::vector<uint8_t> received;
+    CHECK(!consumer.pop(received));
+
+    for (uint8_t i = 0; i < 10; i++)
+    {
+        std::iota(message.begin(), message.end(), i);
+        REQUIRE(producer.push(message));
+        REQUIRE(producer.push(message));
+        CHECK(!producer.push(message)); // 3 * (4 + 20) bytes do not fit
+
+        for (size_t n = 0; n < 2; n++)
+        {
+            REQUIRE(consumer.pop(received));
+            CHECK(received == message);
+        }
+        CHECK(!consumer.pop(received));
+    }
+
+    SharedMemoryRing::remove(name);
+}
+
+TEST_CASE("[SharedMemoryRing] Corrupted length prefix", "[SharedMemoryRing]")
+{
+    auto logger = initializeTestLogger();
+
+    const std::string name = "instinct-test-ring-corrupted";
+    SharedMemoryRing::remove(name);
+
+    SharedMemoryRing producer(name, 64, SharedMemoryRing::Role::Producer);
+    SharedMemoryRing consumer(name, 64, SharedMemoryRing::Role::Consumer);
+
+    std::vector<uint8_t> message{ 1, 2, 3 };
+    std::vector<uint8_t> received;
+    REQUIRE(producer.push(message));
+
+    // Another process overwrites the length prefix of the message
+    boost::interprocess::managed_shared_memory segment(boost::interprocess::open_only, name.c_str());
+    uint8_t* data = segment.find<uint8_t>("Data").first;
+    REQUIRE(data != nullptr);
+    uint32_t size = 1000;
+    std::memcpy(data, &size, sizeof(size));
+
+    CHECK(!consumer.pop(received)); // Must not read behind the ring
+    CHECK(!consumer.pop(received)); // The corrupted data was discarded
+
+    // The ring is usable again
+    REQUIRE(producer.push(message));
+    REQUIRE(consumer.pop(received));
+    CHECK(received == message);
+
+    SharedMemoryRing::remove(name);
+}
+
+TEST_CASE("[SharedMemoryRing] Concurrent producer and consumer", "[SharedMemoryRing]")
+{
+    auto logger = initializeTestLogger();
+
+    const std::string name = "instinct-test-ring-concurrent";
+    SharedMemoryRing::remove(name);
+
+    SharedMemoryRing producer(name, 1024, SharedMemoryRing::Role::Producer);
+    SharedMemoryRing consumer(name, 1024, SharedMemoryRing::Role::Consumer);
+
+    constexpr uint32_t N_MESSAGES = 100000;
+    std::thread producerThread([&]() {
+        std::vector<uint8_t> message(sizeof(uint32_t));
+        for (uint32_t i = 0; i < N_MESSAGES; i++)
+        {
+            std::memcpy(message.data(), &i, sizeof(i));
+            while (!producer.push(message)) { std::this_thread::yield(); }
+        }
+    });
+
+    std::vector<uint8_t> received;
+    for (uint32_t i = 0; i < N_MESSAGES; i++)
+    {
+        while (!consumer.pop(received)) { std::this_thread::yield(); }
+        REQUIRE(received.size() == sizeof(uint32_t));
+        uint32_t value = 0;
+        std::memcpy(&value, received.data(), sizeof(value));
+        REQUIRE(value == i);
+    }
+    producerThread.join();
+
+    SharedMemoryRing::remove(name);
+}
+
+TEST_CASE("[SharedMemoryRing] Registration of the processes", "[SharedMemoryRing]")
+{
+    auto logger = initializeTestLogger();
+
+    const std::string name = "instinct-test-ring-registration";
+    SharedMemoryRing::remove(name);
+
+    std::vector<uint8_t> message{ 1, 2, 3 };
+    std::vector<uint8_t> received;
+    {
+        SharedMemoryRing producer(name, 64, SharedMemoryRing::Role::Producer);
+        REQUIRE(producer.push(message));
+    }
+    // The producer finished regularly, so its data is kept for a consumer which opens the segment later
+    {
+        SharedMemoryRing consumer(name, 64, SharedMemoryRing::Role::Consumer);
+        CHECK(!consumer.discardedStaleData());
+        REQUIRE(consumer.pop(received));
+        CHECK(received == message);
+    }
+
+#ifndef _WIN32
+    // A producer which crashes does not unregister
+    if (pid_t child = fork(); child == 0)
+    {
+        SharedMemoryRing producer(name, 64, SharedMemoryRing::Role::Producer);
+        producer.push(message);
+        _exit(0); // Skips the destructor
+    }
+    else
+    {
+        REQUIRE(child > 0);
+        int status = 0;
+        waitpid(child, &status, 0);
+    }
+    SharedMemoryRing consumer(name, 64, SharedMemoryRing::Role::Consumer);
+    CHECK(consumer.discardedStaleData());
+    CHECK(!consumer.pop(received));
+#endif
+
+    SharedMemoryRing::remove(name);
+}
+
+} // namespace NAV::TESTS::SharedMemoryRingTests
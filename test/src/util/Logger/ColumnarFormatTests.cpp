@@ -0,0 +1,124 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file ColumnarFormatTests.cpp
+/// @brief Tests for the binary columnar log format
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-14
+
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "util/Logger/ColumnarFormat.hpp"
+
+#include "Logger.hpp"
+
+namespace NAV::TESTS::ColumnarFormatTests
+{
+
+namespace
+{
+/// @brief Compares the values bitwise, so that NaN equals NaN
+bool sameValue(double a, double b)
+{
+    return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+} // namespace
+
+TEST_CASE("[ColumnarFormat] Time conversion", "[ColumnarFormat]")
+{
+    auto logger = initializeTestLogger();
+
+    InsTime insTime(2, 185, 43200.123456789L);
+    auto nanoseconds = ColumnarFormat::ToGpsNanoseconds(insTime);
+    CHECK(nanoseconds == (2LL * 1024 + 185) * 604800'000'000'000LL + 43200'123'456'789LL);
+    CHECK(ColumnarFormat::ToGpsNanoseconds(ColumnarFormat::FromGpsNanoseconds(nanoseconds)) == nanoseconds);
+
+    CHECK(ColumnarFormat::ToGpsNanoseconds(InsTime()) == ColumnarFormat::NO_TIME);
+    CHECK(ColumnarFormat::FromGpsNanoseconds(ColumnarFormat::NO_TIME).empty());
+}
+
+TEST_CASE("[ColumnarFormat] Write and read chunks", "[ColumnarFormat]")
+{
+    auto logger = initializeTestLogger();
+
+    const double nan = std::nan("");
+
+    ColumnarFormat::Schema schema{ .dataType = "PosVelAtt", .columns = { "Int", "Float", "Double", "Sparse" }, .staticColumnCount = 3 };
+    std::string file;
+    ColumnarFormat::AppendFileHeader(file, schema);
+
+    std::vector<int64_t> times1{ ColumnarFormat::NO_TIME, 1'000'000'000, 2'000'000'000 };
+    std::vector<std::vector<double>> columns1{
+        { 1.0, -5.0, 2147483647.0 }, // Int32
+        { 0.5, 0.25, -0.0 },         // Float
+        { 0.1, nan, 1e300 },         // Double with bitmap
+        { nan, nan, nan },           // Missing
+    };
+    ColumnarFormat::AppendDataChunk(file, times1, columns1);
+
+    ColumnarFormat::AppendSchemaChunk(file, std::vector<std::string>{ "Dynamic" });
+
+    std::vector<int64_t> times2{ 3'000'000'000, 4'000'000'000 };
+    std::vector<std::vector<double>> columns2{
+        { 7.0, 7.0 },  // Constant
+        { nan, 3.0 },  // Int32 with bitmap
+        { 0.2, 0.3 },  // Double
+        { nan, 42.0 }, // Int32 with bitmap
+        { 1.5, nan },  // Float with bitmap
+    };
+    ColumnarFormat::AppendDataChunk(file, times2, columns2);
+
+    auto index = ColumnarFormat::ReadIndex(file);
+    REQUIRE(index.has_value());
+    CHECK(index->schema.dataType == "PosVelAtt");
+    CHECK(index->schema.columns == std::vector<std::string>{ "Int", "Float", "Double", "Sparse", "Dynamic" });
+    CHECK(index->schema.staticColumnCount == 3);
+    CHECK(index->rowCount == 5);
+    CHECK_FALSE(index->truncated);
+    REQUIRE(index->chunks.size() == 2);
+    CHECK(index->chunks.at(0).firstTime == 1'000'000'000);
+    CHECK(index->chunks.at(0).lastTime == 2'000'000'000);
+    CHECK(index->chunks.at(1).firstTime == 3'000'000'000);
+    CHECK(index->chunks.at(1).lastTime == 4'000'000'000);
+
+    std::vector<int64_t> times;
+    std::vector<std::vector<double>> columns;
+
+    REQUIRE(ColumnarFormat::ReadDataChunk(file, index->chunks.at(0), times, columns, index->schema.columns.size()));
+    CHECK(times == times1);
+    REQUIRE(columns.size() == 5);
+    for (size_t c = 0; c < columns1.size(); c++)
+    {
+        for (size_t r = 0; r < times1.size(); r++) { CHECK(sameValue(columns.at(c).at(r), columns1.at(c).at(r))); }
+    }
+    for (const auto& value : columns.at(4)) { CHECK(std::isnan(value)); } // Column did not exist in this chunk
+
+    REQUIRE(ColumnarFormat::ReadDataChunk(file, index->chunks.at(1), times, columns, index->schema.columns.size()));
+    CHECK(times == times2);
+    REQUIRE(columns.size() == 5);
+    for (size_t c = 0; c < columns2.size(); c++)
+    {
+        for (size_t r = 0; r < times2.size(); r++) { CHECK(sameValue(columns.at(c).at(r), columns2.at(c).at(r))); }
+    }
+
+    // A file which was not closed properly can be read up to the last complete chunk
+    auto truncated = ColumnarFormat::ReadIndex(std::string_view(file).substr(0, file.size() - 3));
+    REQUIRE(truncated.has_value());
+    CHECK(truncated->truncated);
+    CHECK(truncated->chunks.size() == 1);
+    CHECK(truncated->schema.columns.size() == 5);
+
+    CHECK_FALSE(ColumnarFormat::ReadIndex("not a columnar log").has_value());
+}
+
+} // namespace NAV::TESTS::ColumnarFormatTests
@@ -9,6 +9,11 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "Logger.hpp"
+#include "util/Logger/backpressure_logger.hpp"
+#include "util/Logger/sequenced_ringbuffer_sink.hpp"
+#include "spdlog/sinks/ostream_sink.h"
+
+#include <sstream>
 
 namespace NAV::TESTS
 {
@@ -23,4 +28,74 @@ TEST_CASE("[Logger] Initialization", "[Logger]")
     auto logger = initializeTestLogger();
 }
 
+TEST_CASE("[Logger] Backpressure logger rate limit", "[Logger]")
+{
+    constexpr size_t RATE_LIMIT = 5;
+    constexpr size_t MESSAGES = 100;
+
+    std::ostringstream oss;
+    size_t rateLimited = 0;
+    {
+        auto sink = std::make_shared<spdlog::sinks::ostream_sink_mt>(oss);
+        sink->set_pattern("%v");
+        auto logger = std::make_shared<spdlog::backpressure_logger>("test", sink, 1024, spdlog::backpressure_policy::block, RATE_LIMIT);
+        logger->set_level(spdlog::level::trace);
+        REQUIRE(logger->sinks().empty()); // The sink is owned by the backend, which has to be used when switching back to synchronous logging
+        REQUIRE(logger->backend_sinks().size() == 1);
+        REQUIRE(logger->backend_sinks().front() == sink);
+
+        for (size_t i = 0; i < MESSAGES; i++)
+        {
+            logger->debug("Node A (1): Message {}", i);
+            logger->debug("Node B (2): Message {}", i);
+        }
+        logger->warn("Node A (1): Warnings are never rate limited");
+        logger->flush();
+        rateLimited = logger->rate_limited_counter();
+    } // Destructor waits for the writer thread
+
+    // A change of the second during the loop resets the counter once
+    REQUIRE(rateLimited >= 2 * (MESSAGES - 2 * RATE_LIMIT));
+    REQUIRE(rateLimited <= 2 * (MESSAGES - RATE_LIMIT));
+    REQUIRE(oss.str().find("Node A (1): Message 0") != std::string::npos);
+    REQUIRE(oss.str().find("Node B (2): Message 0") != std::string::npos);
+    REQUIRE(oss.str().find("Warnings are never rate limited") != std::string::npos);
+}
+
+TEST_CASE("[Logger] Sequenced ring buffer sink", "[Logger]")
+{
+    auto sink = std::make_shared<spdlog::sinks::sequenced_ringbuffer_sink_st>(4);
+    sink->set_pattern("%v");
+    spdlog::logger logger("test", sink);
+    logger.set_level(spdlog::level::trace);
+
+    logger.info("Line 0");
+    logger.warn("Line 1\nLine 2");
+
+    std::vector<std::shared_ptr<const spdlog::sinks::sequenced_log_line>> lines;
+    uint64_t nextSeq = sink->read_since(0, lines);
+    REQUIRE(nextSeq == 3);
+    REQUIRE(lines.size() == 3);
+    REQUIRE(lines.at(0)->text == "Line 0");
+    REQUIRE(lines.at(0)->level == spdlog::level::info);
+    REQUIRE(lines.at(2)->text == "Line 2");
+    REQUIRE(lines.at(2)->level == spdlog::level::warn);
+
+    // Only the new lines are read. Lines which dropped out of the buffer are skipped.
+    logger.debug("Line 3");
+    logger.debug("Line 4");
+    logger.debug("Line 5");
+    lines.clear();
+    nextSeq = sink->read_since(nextSeq, lines);
+    REQUIRE(nextSeq == 6);
+    REQUIRE(lines.size() == 3);
+    REQUIRE(lines.front()->seq == 3);
+
+    lines.clear();
+    sink->read_since(0, lines);
+    REQUIRE(lines.size() == 4);
+    REQUIRE(lines.front()->seq == 2);
+    REQUIRE(lines.back()->text == "Line 5");
+}
+
 } // namespace NAV::TESTS
\ No newline at end of file
@@ -0,0 +1,58 @@
+// This file is part of INSTINCT, the INS Toolkit for Integrated
+// Navigation Concepts and Training by the Institute of Navigation of
+// the University of Stuttgart, Germany.
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+/// @file ThreadPoolTests.cpp
+/// @brief Tests for the thread pool
+/// @author T. Topp (topp@ins.uni-stuttgart.de)
+/// @date 2024-08-15
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "util/ThreadPool.hpp"
+
+#include "Logger.hpp"
+
+namespace NAV::TESTS::ThreadPoolTests
+{
+
+TEST_CASE("[ThreadPool] Parallel for", "[ThreadPool]")
+{
+    auto logger = initializeTestLogger();
+
+    ThreadPool pool(3);
+    REQUIRE(pool.threadCount() == 3);
+
+    for (size_t count : { 0UL, 1UL, 2UL, 1000UL })
+    {
+        std::vector<int> calls(count, 0);
+        pool.parallelFor(count, [&](size_t i) { calls.at(i)++; });
+        for (const auto& c : calls) { REQUIRE(c == 1); }
+    }
+
+    // Nested calls from within the pool
+    std::atomic<size_t> sum = 0;
+    pool.parallelFor(8, [&](size_t) {
+        pool.parallelFor(100, [&](size_t i) { sum += i; });
+    });
+    REQUIRE(sum == 8 * 4950);
+
+    // Exceptions are forwarded to the caller after all calls finished
+    std::atomic<size_t> finished = 0;
+    auto failingTask = [&](size_t i) {
+        finished++;
+        if (i == 50) { throw std::runtime_error("Task failed"); }
+    };
+    REQUIRE_THROWS_AS(pool.parallelFor(100, failingTask), std::runtime_error);
+    REQUIRE(finished == 100);
+}
+
+} // namespace NAV::TESTS::ThreadPoolTests